@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/avx_demo: kernels with and without AVX2 and AVX512F
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the run time of the kernels that have AVX2 and AVX512F variants,
+// with each instruction set enabled in turn (see GxB_CPU_AVX2 and
+// GxB_CPU_AVX512F): reduction to scalar, C=A+B where all matrices are dense,
+// and C=A'*B and C+=A'*B via dot products where A and B are full.  The
+// results must be the same in all three cases.
+
+// usage:
+// avx_demo n ntrials
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("avx_demo failed: %d, line %d\n", info, __LINE__) ; \
+        exit (1) ;                                                  \
+    }                                                               \
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// create a dense n-by-n matrix with small integer values
+static GrB_Matrix dense (GrB_Type type, GrB_Index n, int seed)
+{
+    GrB_Index nz = n * n ;
+    GrB_Index *I = (GrB_Index *) malloc (nz * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc (nz * sizeof (GrB_Index)) ;
+    int32_t   *X = (int32_t   *) malloc (nz * sizeof (int32_t)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("avx_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    GrB_Index p = 0 ;
+    for (GrB_Index j = 0 ; j < n ; j++)
+    {
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            I [p] = i ;
+            J [p] = j ;
+            X [p] = (int32_t) ((i * seed + j) % 7) ;
+            p++ ;
+        }
+    }
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, type, n, n)) ;
+    OK (GrB_Matrix_build_INT32 (A, I, J, X, nz, GrB_PLUS_INT32)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    return (A) ;
+}
+
+// time each kernel for one type, with the given instruction sets enabled
+static void kernels
+(
+    const char *what,
+    GrB_Monoid monoid,
+    GrB_BinaryOp plus,
+    GrB_Semiring semiring,
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Matrix C,
+    GrB_Descriptor desc,
+    int ntrials,
+    GrB_Matrix *C_result,       // C from this run
+    double *s_result            // s=reduce(A) from this run
+)
+{
+    double s = 0 ;
+
+    double t = wtime ( ) ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        OK (GrB_Matrix_reduce_FP64 (&s, NULL, monoid, A, NULL)) ;
+    }
+    double t_reduce = (wtime ( ) - t) / ntrials ;
+
+    t = wtime ( ) ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, plus, A, B, NULL)) ;
+    }
+    double t_ewise = (wtime ( ) - t) / ntrials ;
+
+    t = wtime ( ) ;
+    OK (GrB_mxm (C, NULL, NULL, semiring, A, B, desc)) ;
+    double t_dot2 = wtime ( ) - t ;
+
+    t = wtime ( ) ;
+    OK (GrB_mxm (C, NULL, plus, semiring, A, B, desc)) ;
+    double t_dot4 = wtime ( ) - t ;
+
+    printf ("%-8s reduce: %9.5f  C=A+B: %9.5f  C=A'*B: %9.5f  C+=A'*B: "
+        "%9.5f sec\n", what, t_reduce, t_ewise, t_dot2, t_dot4) ;
+    OK (GrB_Matrix_dup (C_result, C)) ;
+    (*s_result) = s ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    GrB_Index n = (argc > 1) ? atoll (argv [1]) : 2000 ;
+    int ntrials = (argc > 2) ? atoi (argv [2]) : 10 ;
+    bool have_avx2, have_avx512f ;
+    OK (GxB_Global_Option_get (GxB_CPU_AVX2, &have_avx2)) ;
+    OK (GxB_Global_Option_get (GxB_CPU_AVX512F, &have_avx512f)) ;
+    printf ("avx_demo: # of threads: %d, n: %g, trials: %d, "
+        "AVX2: %d, AVX512F: %d\n", nthreads, (double) n, ntrials,
+        have_avx2, have_avx512f) ;
+
+    GrB_Descriptor desc ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+
+    GrB_Type types [3] = { GrB_FP64, GrB_FP32, GrB_INT32 } ;
+    GrB_Monoid monoids [3] = { GrB_PLUS_MONOID_FP64, GrB_PLUS_MONOID_FP32,
+        GrB_PLUS_MONOID_INT32 } ;
+    GrB_BinaryOp plus [3] = { GrB_PLUS_FP64, GrB_PLUS_FP32, GrB_PLUS_INT32 } ;
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_PLUS_TIMES_SEMIRING_FP32, GrB_PLUS_TIMES_SEMIRING_INT32 } ;
+    const char *names [3] = { "double", "float", "int32" } ;
+
+    //--------------------------------------------------------------------------
+    // time each kernel with each instruction set, for each type
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        printf ("\n%s:\n", names [k]) ;
+        GrB_Matrix A = dense (types [k], n, 3) ;
+        GrB_Matrix B = dense (types [k], n, 5) ;
+        GrB_Matrix C ;
+        OK (GrB_Matrix_new (&C, types [k], n, n)) ;
+
+        GrB_Matrix C_vanilla = NULL, C_avx2 = NULL, C_avx512f = NULL ;
+        double s_vanilla, s_avx2, s_avx512f ;
+
+        OK (GxB_Global_Option_set (GxB_CPU_AVX2, false)) ;
+        OK (GxB_Global_Option_set (GxB_CPU_AVX512F, false)) ;
+        kernels ("vanilla", monoids [k], plus [k], semirings [k],
+            A, B, C, desc, ntrials, &C_vanilla, &s_vanilla) ;
+
+        OK (GxB_Global_Option_set (GxB_CPU_AVX2, true)) ;
+        kernels (have_avx2 ? "AVX2" : "(AVX2)", monoids [k], plus [k],
+            semirings [k], A, B, C, desc, ntrials, &C_avx2, &s_avx2) ;
+
+        OK (GxB_Global_Option_set (GxB_CPU_AVX512F, true)) ;
+        kernels (have_avx512f ? "AVX512F" : "(AVX512F)", monoids [k],
+            plus [k], semirings [k], A, B, C, desc, ntrials, &C_avx512f,
+            &s_avx512f) ;
+
+        // check the results
+        GrB_Matrix D ;
+        bool ok = true ;
+        double dmax ;
+        OK (GrB_Matrix_new (&D, types [k], n, n)) ;
+        for (int kk = 0 ; kk < 2 ; kk++)
+        {
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_MINUS_FP64,
+                C_vanilla, (kk == 0) ? C_avx2 : C_avx512f, NULL)) ;
+            OK (GrB_Matrix_apply (D, NULL, NULL, GrB_ABS_FP64, D, NULL)) ;
+            OK (GrB_Matrix_reduce_FP64 (&dmax, NULL, GrB_MAX_MONOID_FP64, D,
+                NULL)) ;
+            ok = ok && (dmax == 0) ;
+        }
+        ok = ok && (s_vanilla == s_avx2) && (s_vanilla == s_avx512f) ;
+        printf ("results %s\n", ok ? "match" : "differ") ;
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+        GrB_Matrix_free (&C) ;
+        GrB_Matrix_free (&D) ;
+        GrB_Matrix_free (&C_vanilla) ;
+        GrB_Matrix_free (&C_avx2) ;
+        GrB_Matrix_free (&C_avx512f) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor_free (&desc) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
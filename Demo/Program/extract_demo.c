@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/extract_demo: C=A(I,:) with a large list I
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the run time of C=A(I,:), where A is a sparse n-by-n matrix held
+// by column with about d entries per column, and I is a list of nI row
+// indices, as in the sampling of a subgraph.  I is first unsorted with
+// duplicates, and then sorted with duplicates.  Each extraction constructs
+// the inverse of I (GB_I_inverse), which is done with a single thread and
+// then with all threads.  The results must be the same in both cases.
+
+// usage:
+// extract_demo n nI d ntrials
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = method ;                                            \
+    if (info != GrB_SUCCESS)                                            \
+    {                                                                   \
+        printf ("extract_demo failed: %d, line %d\n", info, __LINE__) ; \
+        exit (1) ;                                                      \
+    }                                                                   \
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// simple pseudo-random number generator
+static uint64_t state = 42 ;
+static GrB_Index irand (GrB_Index n)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((state >> 33) % n) ;
+}
+
+// create a sparse n-by-n matrix with about d entries per column
+static GrB_Matrix sparse (GrB_Index n, GrB_Index d)
+{
+    GrB_Index nz = n * d ;
+    GrB_Index *I = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc ((nz+1) * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("extract_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    for (GrB_Index p = 0 ; p < nz ; p++)
+    {
+        I [p] = irand (n) ;
+        J [p] = p / d ;
+        X [p] = (double) (1 + irand (9)) ;
+    }
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    return (A) ;
+}
+
+// compare two qsort keys
+static int compare (const void *a, const void *b)
+{
+    GrB_Index x = *((const GrB_Index *) a) ;
+    GrB_Index y = *((const GrB_Index *) b) ;
+    return ((x < y) ? -1 : ((x > y) ? 1 : 0)) ;
+}
+
+// returns true if C1 and C2 are the same
+static bool same (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Index nrows, ncols, nvals1, nvals2 ;
+    OK (GrB_Matrix_nrows (&nrows, C1)) ;
+    OK (GrB_Matrix_ncols (&ncols, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals1, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, C2)) ;
+    if (nvals1 != nvals2) return (false) ;
+    GrB_Matrix D ;
+    bool ok = true ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, nrows, ncols)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    GrB_Matrix_free (&D) ;
+    return (ok) ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    GrB_Index n  = (argc > 1) ? atoll (argv [1]) : 1000000 ;
+    GrB_Index nI = (argc > 2) ? atoll (argv [2]) : 4000000 ;
+    GrB_Index d  = (argc > 3) ? atoll (argv [3]) : 8 ;
+    int ntrials = (argc > 4) ? atoi (argv [4]) : 3 ;
+    printf ("extract_demo: # of threads: %d, n: %g, nI: %g, d: %g, "
+        "trials: %d\n", nthreads, (double) n, (double) nI, (double) d,
+        ntrials) ;
+
+    GrB_Matrix A = sparse (n, d) ;
+    GrB_Index *I = (GrB_Index *) malloc ((nI+1) * sizeof (GrB_Index)) ;
+    if (I == NULL)
+    {
+        printf ("extract_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    for (GrB_Index k = 0 ; k < nI ; k++)
+    {
+        I [k] = irand (n) ;
+    }
+
+    GrB_Descriptor desc1 ;
+    OK (GrB_Descriptor_new (&desc1)) ;
+    OK (GxB_Desc_set (desc1, GxB_NTHREADS, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // time C=A(I,:) with I unsorted, then sorted, with 1 and all threads
+    //--------------------------------------------------------------------------
+
+    for (int sorted = 0 ; sorted <= 1 ; sorted++)
+    {
+        if (sorted)
+        {
+            qsort (I, nI, sizeof (GrB_Index), compare) ;
+        }
+        GrB_Matrix C1, C2 ;
+        OK (GrB_Matrix_new (&C1, GrB_FP64, nI, n)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, nI, n)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+
+        // C1 = A(I,:) with a single thread
+        double t = wtime ( ) ;
+        for (int trial = 0 ; trial < ntrials ; trial++)
+        {
+            OK (GrB_Matrix_extract (C1, NULL, NULL, A, I, nI, GrB_ALL, n,
+                desc1)) ;
+        }
+        double t1 = (wtime ( ) - t) / ntrials ;
+
+        // C2 = A(I,:) with all threads
+        t = wtime ( ) ;
+        for (int trial = 0 ; trial < ntrials ; trial++)
+        {
+            OK (GrB_Matrix_extract (C2, NULL, NULL, A, I, nI, GrB_ALL, n,
+                NULL)) ;
+        }
+        double t2 = (wtime ( ) - t) / ntrials ;
+
+        GrB_Index nvals ;
+        OK (GrB_Matrix_nvals (&nvals, C2)) ;
+        printf ("I %-8s nnz(C): %g  1 thread: %9.5f  %d threads: %9.5f sec"
+            "  speedup: %g\n", sorted ? "sorted" : "unsorted", (double) nvals,
+            t1, nthreads, t2, t1 / t2) ;
+        printf ("results %s\n", same (C1, C2) ? "match" : "differ") ;
+
+        GrB_Matrix_free (&C1) ;
+        GrB_Matrix_free (&C2) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    free (I) ;
+    GrB_Matrix_free (&A) ;
+    GrB_Descriptor_free (&desc1) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
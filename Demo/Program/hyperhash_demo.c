@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/hyperhash_demo: lookups in a hypersparse matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the throughput of GrB_Matrix_extractElement and
+// GxB_Matrix_extractElements on a hypersparse matrix with a huge dimension and
+// many vectors, with and without the hash index of its hyperlist (see
+// GxB_HYPER_HASH).  Without the hash index, each vector is found in the
+// hyperlist with a binary search.  With the hash index, it is found in O(1)
+// time.
+
+// usage:
+// hyperhash_demo nvec nlookups
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS && info != GrB_NO_VALUE)                \
+    {                                                               \
+        printf ("hyperhash_demo failed: %d, line %d\n", info, __LINE__) ; \
+        exit (1) ;                                                  \
+    }                                                               \
+}
+
+// a simple 64-bit random number generator (xorshift64*)
+static uint64_t state = 42 ;
+static uint64_t hrand (void)
+{
+    state ^= state >> 12 ;
+    state ^= state << 25 ;
+    state ^= state >> 27 ;
+    return (state * 0x2545F4914F6CDD1DULL) ;
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// look up nlookups entries one at a time, and then all at once
+static void lookups
+(
+    const char *what,
+    GrB_Matrix A,
+    const GrB_Index *I,
+    const GrB_Index *J,
+    int64_t nlookups,
+    double *X,
+    bool *Found
+)
+{
+    double t = wtime ( ) ;
+    int64_t nfound = 0 ;
+    double sum = 0 ;
+    for (int64_t k = 0 ; k < nlookups ; k++)
+    {
+        double x ;
+        GrB_Info info = GrB_Matrix_extractElement_FP64 (&x, A, I [k], J [k]) ;
+        if (info == GrB_SUCCESS)
+        {
+            nfound++ ;
+            sum += x ;
+        }
+    }
+    t = wtime ( ) - t ;
+    printf ("%-16s extractElement:  %10.3f sec, %8.2f million lookups/sec"
+        " (found %g, sum %g)\n", what, t, 1e-6 * nlookups / t,
+        (double) nfound, sum) ;
+
+    t = wtime ( ) ;
+    OK (GxB_Matrix_extractElements_FP64 (X, Found, A, I, J, nlookups)) ;
+    t = wtime ( ) - t ;
+    nfound = 0 ;
+    sum = 0 ;
+    for (int64_t k = 0 ; k < nlookups ; k++)
+    {
+        if (Found [k])
+        {
+            nfound++ ;
+            sum += X [k] ;
+        }
+    }
+    printf ("%-16s extractElements: %10.3f sec, %8.2f million lookups/sec"
+        " (found %g, sum %g)\n", what, t, 1e-6 * nlookups / t,
+        (double) nfound, sum) ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    int64_t nvec     = (argc > 1) ? atoll (argv [1]) : 4000000 ;
+    int64_t nlookups = (argc > 2) ? atoll (argv [2]) : 4000000 ;
+    printf ("hyperhash_demo: # of threads: %d, nvec: %g, lookups: %g\n",
+        nthreads, (double) nvec, (double) nlookups) ;
+
+    //--------------------------------------------------------------------------
+    // create a hypersparse matrix A of size 2^60-by-2^60 with nvec rows
+    //--------------------------------------------------------------------------
+
+    // Each row of A has a single entry, at a random position.  A is held by
+    // row, so it has nvec vectors in its hyperlist.
+
+    GrB_Index n = ((GrB_Index) 1) << 60 ;
+    GrB_Index *I = (GrB_Index *) malloc (nvec * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc (nvec * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc (nvec * sizeof (double)) ;
+    GrB_Index *Ilook = (GrB_Index *) malloc (nlookups * sizeof (GrB_Index)) ;
+    GrB_Index *Jlook = (GrB_Index *) malloc (nlookups * sizeof (GrB_Index)) ;
+    double    *Xlook = (double    *) malloc (nlookups * sizeof (double)) ;
+    bool      *Found = (bool      *) malloc (nlookups * sizeof (bool)) ;
+    if (I == NULL || J == NULL || X == NULL || Ilook == NULL || Jlook == NULL
+        || Xlook == NULL || Found == NULL)
+    {
+        printf ("hyperhash_demo: out of memory\n") ;
+        exit (1) ;
+    }
+
+    for (int64_t k = 0 ; k < nvec ; k++)
+    {
+        I [k] = hrand ( ) % n ;
+        J [k] = hrand ( ) % n ;
+        X [k] = (double) (k % 100) ;
+    }
+
+    // half of the lookups find an entry of A; the rest are random
+    for (int64_t k = 0 ; k < nlookups ; k++)
+    {
+        if (k % 2 == 0)
+        {
+            int64_t p = hrand ( ) % nvec ;
+            Ilook [k] = I [p] ;
+            Jlook [k] = J [p] ;
+        }
+        else
+        {
+            Ilook [k] = hrand ( ) % n ;
+            Jlook [k] = hrand ( ) % n ;
+        }
+    }
+
+    // do not build the hash index of A->h yet
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, INT64_MAX)) ;
+
+    double t = wtime ( ) ;
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nvec, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    t = wtime ( ) - t ;
+    printf ("time to create matrix: %g sec\n", t) ;
+
+    //--------------------------------------------------------------------------
+    // lookups with a binary search of the hyperlist
+    //--------------------------------------------------------------------------
+
+    lookups ("binary search:", A, Ilook, Jlook, nlookups, Xlook, Found) ;
+
+    //--------------------------------------------------------------------------
+    // build the hash index of A->h, and repeat the lookups
+    //--------------------------------------------------------------------------
+
+    int64_t hyper_hash ;
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, 1024)) ;
+    OK (GxB_Global_Option_get (GxB_HYPER_HASH, &hyper_hash)) ;
+    t = wtime ( ) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    t = wtime ( ) - t ;
+    printf ("time to build hash index (GxB_HYPER_HASH %g): %g sec\n",
+        (double) hyper_hash, t) ;
+
+    lookups ("hash index:", A, Ilook, Jlook, nlookups, Xlook, Found) ;
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    free (Ilook) ;
+    free (Jlook) ;
+    free (Xlook) ;
+    free (Found) ;
+    GrB_Matrix_free (&A) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
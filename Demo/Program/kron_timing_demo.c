@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/kron_timing_demo: time C=kron(A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the run time of C=kron(A,B) with one and all threads, for the two
+// shapes that arise when generating Kronecker graphs: A and B both n-by-1
+// (so C is a single n^2-by-1 vector), and a small A with a large n-by-n
+// sparse B.  Each is computed with a built-in operator (GrB_TIMES_FP64) and
+// with a user-defined operator, which uses the generic method.
+
+// usage:
+// kron_timing_demo n d ntrials
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                          \
+{                                                                           \
+    GrB_Info info = method ;                                                \
+    if (info != GrB_SUCCESS)                                                \
+    {                                                                       \
+        printf ("kron_timing_demo failed: %d, line %d\n", info, __LINE__) ; \
+        exit (1) ;                                                          \
+    }                                                                       \
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// simple pseudo-random number generator
+static uint64_t state = 42 ;
+static GrB_Index irand (GrB_Index n)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((state >> 33) % n) ;
+}
+
+// create a sparse m-by-n matrix with about d entries per column
+static GrB_Matrix sparse (GrB_Index m, GrB_Index n, GrB_Index d)
+{
+    GrB_Index nz = n * d ;
+    GrB_Index *I = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc ((nz+1) * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("kron_timing_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    for (GrB_Index p = 0 ; p < nz ; p++)
+    {
+        I [p] = irand (m) ;
+        J [p] = p / d ;
+        X [p] = (double) (1 + irand (9)) ;
+    }
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, m, n)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    return (A) ;
+}
+
+// a user-defined multiply operator, the same as GrB_TIMES_FP64
+static void mytimes (void *z, const void *x, const void *y)
+{
+    (*((double *) z)) = (*((const double *) x)) * (*((const double *) y)) ;
+}
+
+// returns true if C1 and C2 are the same
+static bool same (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Index nrows, ncols, nvals1, nvals2 ;
+    OK (GrB_Matrix_nrows (&nrows, C1)) ;
+    OK (GrB_Matrix_ncols (&ncols, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals1, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, C2)) ;
+    if (nvals1 != nvals2) return (false) ;
+    GrB_Matrix D ;
+    bool ok = true ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, nrows, ncols)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    GrB_Matrix_free (&D) ;
+    return (ok) ;
+}
+
+// time C=kron(A,B) with op, using the descriptor desc
+static double kron_time (GrB_Matrix *C, GrB_BinaryOp op, GrB_Matrix A,
+    GrB_Matrix B, GrB_Descriptor desc, int ntrials)
+{
+    GrB_Index am, an, bm, bn ;
+    OK (GrB_Matrix_nrows (&am, A)) ;
+    OK (GrB_Matrix_ncols (&an, A)) ;
+    OK (GrB_Matrix_nrows (&bm, B)) ;
+    OK (GrB_Matrix_ncols (&bn, B)) ;
+    OK (GrB_Matrix_new (C, GrB_FP64, am*bm, an*bn)) ;
+    double t = wtime ( ) ;
+    for (int trial = 0 ; trial < ntrials ; trial++)
+    {
+        OK (GrB_Matrix_kronecker_BinaryOp (*C, NULL, NULL, op, A, B, desc)) ;
+    }
+    return ((wtime ( ) - t) / ntrials) ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    GrB_Index n = (argc > 1) ? atoll (argv [1]) : 4000 ;
+    GrB_Index d = (argc > 2) ? atoll (argv [2]) : 8 ;
+    int ntrials = (argc > 3) ? atoi (argv [3]) : 3 ;
+    printf ("kron_timing_demo: # of threads: %d, n: %g, d: %g, trials: %d\n",
+        nthreads, (double) n, (double) d, ntrials) ;
+
+    GrB_BinaryOp mytimes_op ;
+    OK (GrB_BinaryOp_new (&mytimes_op, mytimes, GrB_FP64, GrB_FP64,
+        GrB_FP64)) ;
+    GrB_Descriptor desc1 ;
+    OK (GrB_Descriptor_new (&desc1)) ;
+    OK (GxB_Desc_set (desc1, GxB_NTHREADS, 1)) ;
+
+    //--------------------------------------------------------------------------
+    // time C=kron(A,B) for each shape and operator
+    //--------------------------------------------------------------------------
+
+    for (int shape = 0 ; shape <= 1 ; shape++)
+    {
+        GrB_Matrix A, B ;
+        if (shape == 0)
+        {
+            // A and B are n-by-1, with about n/2 entries each
+            A = sparse (n, 1, n/2) ;
+            B = sparse (n, 1, n/2) ;
+        }
+        else
+        {
+            // A is 4-by-4 and B is n-by-n with about d entries per column
+            A = sparse (4, 4, 3) ;
+            B = sparse (n, n, d) ;
+        }
+
+        for (int user = 0 ; user <= 1 ; user++)
+        {
+            GrB_BinaryOp op = user ? mytimes_op : GrB_TIMES_FP64 ;
+            GrB_Matrix C1, C2 ;
+            double t1 = kron_time (&C1, op, A, B, desc1, ntrials) ;
+            double t2 = kron_time (&C2, op, A, B, NULL, ntrials) ;
+            GrB_Index nvals ;
+            OK (GrB_Matrix_nvals (&nvals, C2)) ;
+            printf ("%-22s %-8s nnz(C): %g  1 thread: %9.5f  %d threads: "
+                "%9.5f sec  speedup: %g\n",
+                shape ? "A 4-by-4, B n-by-n" : "A, B n-by-1",
+                user ? "user op" : "built-in", (double) nvals, t1, nthreads,
+                t2, t1 / t2) ;
+            printf ("results %s\n", same (C1, C2) ? "match" : "differ") ;
+            GrB_Matrix_free (&C1) ;
+            GrB_Matrix_free (&C2) ;
+        }
+
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&B) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp_free (&mytimes_op) ;
+    GrB_Descriptor_free (&desc1) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
+
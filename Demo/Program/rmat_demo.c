@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/rmat_demo: triangle counting on an R-MAT graph
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Creates a skewed (power-law) graph with the R-MAT generator, and counts its
+// triangles with the masked matrix multiply C<L>=L*L' (via the dot3 method)
+// and C<L>=L*L (via the saxpy3 method), where L is the strictly lower
+// triangular part of the adjacency matrix.  A few hub vertices in the R-MAT
+// graph have a very high degree, so a single dot product C(i,j), or a single
+// vector times a scalar in saxpy3, can dominate the work.  Both methods split
+// this work into ultra-fine tasks, so the speedup with many threads is not
+// limited by a single costly task.  Each method is run with one thread and
+// with all threads, and the triangle counts are compared.
+
+// usage:
+// rmat_demo scale edgefactor burble
+
+// The graph has n = 2^scale nodes and about edgefactor*n edges.  The defaults
+// are scale = 18 and edgefactor = 16.  If burble is 1, diagnostic output is
+// printed.
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("rmat_demo failed: %d, line %d\n", info, __LINE__) ;  \
+        exit (1) ;                                                  \
+    }                                                               \
+}
+
+// a simple 64-bit random number generator (xorshift64*)
+static uint64_t state = 42 ;
+static uint64_t rrand (void)
+{
+    state ^= state >> 12 ;
+    state ^= state << 25 ;
+    state ^= state >> 27 ;
+    return (state * 0x2545F4914F6CDD1DULL) ;
+}
+
+// a random number in the range 0 to 1
+static double rrand_unit (void)
+{
+    return (((double) (rrand ( ) >> 11)) / 9007199254740992.0) ;
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// count the triangles with C<L>=L*L' or C<L>=L*L, and return the time
+static double tricount
+(
+    int64_t *ntri,
+    GrB_Matrix L,
+    GrB_Descriptor desc,
+    int nthreads
+)
+{
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, L)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads)) ;
+    GrB_Matrix C ;
+    OK (GrB_Matrix_new (&C, GrB_INT64, n, n)) ;
+    double t = wtime ( ) ;
+    OK (GrB_mxm (C, L, NULL, GxB_PLUS_PAIR_INT64, L, L, desc)) ;
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    t = wtime ( ) - t ;
+    (*ntri) = 0 ;
+    OK (GrB_Matrix_reduce_INT64 (ntri, NULL, GrB_PLUS_MONOID_INT64, C, NULL)) ;
+    OK (GrB_Matrix_free (&C)) ;
+    return (t) ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads_max ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_max)) ;
+    int scale      = (argc > 1) ? atoi (argv [1]) : 18 ;
+    int edgefactor = (argc > 2) ? atoi (argv [2]) : 16 ;
+    bool burble    = (argc > 3) ? (atoi (argv [3]) != 0) : false ;
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    int64_t nedges = edgefactor * n ;
+    printf ("rmat_demo: # of threads: %d, scale: %d, edgefactor: %d\n",
+        nthreads_max, scale, edgefactor) ;
+
+    //--------------------------------------------------------------------------
+    // create the R-MAT graph
+    //--------------------------------------------------------------------------
+
+    // Each edge (i,j) is placed by recursively choosing one of the four
+    // quadrants of the adjacency matrix, with probabilities a, b, c, and d.
+    // The nodes are then randomly relabeled, so that the hub vertices are
+    // not all at the start of the matrix.
+
+    double a = 0.57, b = 0.19, c = 0.19 ;
+    GrB_Index *I = (GrB_Index *) malloc (2 * nedges * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc (2 * nedges * sizeof (GrB_Index)) ;
+    GrB_Index *P = (GrB_Index *) malloc (n * sizeof (GrB_Index)) ;
+    if (I == NULL || J == NULL || P == NULL)
+    {
+        printf ("rmat_demo: out of memory\n") ;
+        exit (1) ;
+    }
+
+    // P = a random permutation of 0:n-1
+    for (GrB_Index k = 0 ; k < n ; k++)
+    {
+        P [k] = k ;
+    }
+    for (GrB_Index k = n-1 ; k > 0 ; k--)
+    {
+        GrB_Index s = rrand ( ) % (k+1) ;
+        GrB_Index t = P [k] ;
+        P [k] = P [s] ;
+        P [s] = t ;
+    }
+
+    double t = wtime ( ) ;
+    for (int64_t e = 0 ; e < nedges ; e++)
+    {
+        GrB_Index i = 0, j = 0 ;
+        for (int level = 0 ; level < scale ; level++)
+        {
+            double r = rrand_unit ( ) ;
+            i <<= 1 ;
+            j <<= 1 ;
+            if (r < a)
+            {
+                // top left quadrant
+            }
+            else if (r < a + b)
+            {
+                // top right quadrant
+                j++ ;
+            }
+            else if (r < a + b + c)
+            {
+                // bottom left quadrant
+                i++ ;
+            }
+            else
+            {
+                // bottom right quadrant
+                i++ ;
+                j++ ;
+            }
+        }
+        // add the edge in both directions
+        I [2*e  ] = P [i] ;
+        J [2*e  ] = P [j] ;
+        I [2*e+1] = P [j] ;
+        J [2*e+1] = P [i] ;
+    }
+
+    // A = the symmetric adjacency matrix, with duplicate edges removed
+    GrB_Matrix A, L ;
+    GrB_Scalar one ;
+    OK (GrB_Scalar_new (&one, GrB_BOOL)) ;
+    OK (GrB_Scalar_setElement_BOOL (one, true)) ;
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+    OK (GxB_Matrix_build_Scalar (A, I, J, one, 2 * nedges)) ;
+    OK (GrB_Scalar_free (&one)) ;
+    free (I) ;
+    free (J) ;
+    free (P) ;
+
+    // L = tril (A,-1): this removes the self edges as well
+    OK (GrB_Matrix_new (&L, GrB_BOOL, n, n)) ;
+    OK (GxB_Matrix_Option_set (L, GxB_FORMAT, GxB_BY_ROW)) ;
+    OK (GrB_Matrix_select_INT64 (L, NULL, NULL, GrB_TRIL, A, -1, NULL)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_wait (L, GrB_MATERIALIZE)) ;
+    t = wtime ( ) - t ;
+
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, L)) ;
+    GrB_Vector deg ;
+    int64_t maxdeg = 0 ;
+    OK (GrB_Vector_new (&deg, GrB_INT64, n)) ;
+    OK (GrB_Matrix_reduce_Monoid (deg, NULL, NULL, GxB_PLUS_INT64_MONOID, L,
+        NULL)) ;
+    OK (GrB_Vector_reduce_INT64 (&maxdeg, NULL, GrB_MAX_MONOID_INT64, deg,
+        NULL)) ;
+    OK (GrB_Vector_free (&deg)) ;
+    printf ("time to create the graph: %g sec\n", t) ;
+    printf ("nodes: %g, edges: %g, max degree in L: %g\n",
+        (double) n, (double) nvals, (double) maxdeg) ;
+
+    //--------------------------------------------------------------------------
+    // count the triangles
+    //--------------------------------------------------------------------------
+
+    // C<L>=L*L' is computed with the dot3 method, and C<L>=L*L is computed
+    // with the saxpy3 method.
+
+    GrB_Descriptor desc_dot, desc_saxpy ;
+    OK (GrB_Descriptor_new (&desc_dot)) ;
+    OK (GxB_Desc_set (desc_dot, GrB_MASK, GrB_STRUCTURE)) ;
+    OK (GxB_Desc_set (desc_dot, GrB_INP1, GrB_TRAN)) ;
+    OK (GxB_Desc_set (desc_dot, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GrB_Descriptor_new (&desc_saxpy)) ;
+    OK (GxB_Desc_set (desc_saxpy, GrB_MASK, GrB_STRUCTURE)) ;
+    OK (GxB_Desc_set (desc_saxpy, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+
+    const char *what [2] = { "C<L>=L*L' (dot3):  ", "C<L>=L*L (saxpy3): " } ;
+    GrB_Descriptor desc [2] = { desc_dot, desc_saxpy } ;
+    int64_t ntri_1 = -1 ;
+    bool ok = true ;
+
+    for (int method = 0 ; method < 2 ; method++)
+    {
+        int64_t ntri1, ntri ;
+        double t1 = tricount (&ntri1, L, desc [method], 1) ;
+        OK (GxB_Global_Option_set (GxB_BURBLE, burble)) ;
+        double tn = tricount (&ntri, L, desc [method], nthreads_max) ;
+        OK (GxB_Global_Option_set (GxB_BURBLE, false)) ;
+        printf ("%s triangles: %g, 1 thread: %g sec, %d threads: %g sec,"
+            " speedup: %g\n", what [method], (double) ntri, t1, nthreads_max,
+            tn, t1 / tn) ;
+        if (ntri_1 < 0) ntri_1 = ntri1 ;
+        ok = ok && (ntri == ntri1) && (ntri == ntri_1) ;
+    }
+
+    printf ("rmat_demo: %s\n", ok ? "all tests passed" : "test failure") ;
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&L) ;
+    GrB_Descriptor_free (&desc_dot) ;
+    GrB_Descriptor_free (&desc_saxpy) ;
+    OK (GrB_finalize ( )) ;
+    return (ok ? 0 : 1) ;
+}
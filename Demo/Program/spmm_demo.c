@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/spmm_demo: sparse times tall-and-thin dense matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Compares the run time of C=A*X, where A is a sparse n-by-n matrix with about
+// d entries per column and X is a dense n-by-f matrix, with f small (as in
+// the propagation of f features per node of a graph).  Three methods are
+// compared: C=A*X with the default method (saxpy4 or saxpy5 with a full C),
+// C=A*X via dot products (dot2, with A or X explicitly transposed), and C+=A*X
+// computed in-place with C full on input (saxpy4 or saxpy5).  All matrices are
+// held by column, and then all are held by row.  The results must be the same
+// in all three cases.
+
+// usage:
+// spmm_demo n d f ntrials
+
+#include "GraphBLAS.h"
+#include <stdlib.h>
+#include <time.h>
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define OK(method)                                                      \
+{                                                                       \
+    GrB_Info info = method ;                                            \
+    if (info != GrB_SUCCESS)                                            \
+    {                                                                   \
+        printf ("spmm_demo failed: %d, line %d\n", info, __LINE__) ;    \
+        exit (1) ;                                                      \
+    }                                                                   \
+}
+
+// wall-clock time
+static double wtime (void)
+{
+    #if defined ( _OPENMP )
+    return (omp_get_wtime ( )) ;
+    #else
+    return (((double) clock ( )) / CLOCKS_PER_SEC) ;
+    #endif
+}
+
+// simple pseudo-random number generator
+static uint64_t state = 42 ;
+static GrB_Index irand (GrB_Index n)
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL ;
+    return ((state >> 33) % n) ;
+}
+
+// create a sparse n-by-n matrix with about d entries per column
+static GrB_Matrix sparse (GrB_Type type, GrB_Index n, GrB_Index d)
+{
+    GrB_Index nz = n * d ;
+    GrB_Index *I = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc ((nz+1) * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("spmm_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    for (GrB_Index p = 0 ; p < nz ; p++)
+    {
+        I [p] = irand (n) ;
+        J [p] = p / d ;
+        X [p] = (double) (1 + irand (9)) ;
+    }
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, type, n, n)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    return (A) ;
+}
+
+// create a dense n-by-f matrix with small integer values
+static GrB_Matrix dense (GrB_Type type, GrB_Index n, GrB_Index f)
+{
+    GrB_Index nz = n * f ;
+    GrB_Index *I = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = (GrB_Index *) malloc ((nz+1) * sizeof (GrB_Index)) ;
+    double    *X = (double    *) malloc ((nz+1) * sizeof (double)) ;
+    if (I == NULL || J == NULL || X == NULL)
+    {
+        printf ("spmm_demo: out of memory\n") ;
+        exit (1) ;
+    }
+    GrB_Index p = 0 ;
+    for (GrB_Index j = 0 ; j < f ; j++)
+    {
+        for (GrB_Index i = 0 ; i < n ; i++)
+        {
+            I [p] = i ;
+            J [p] = j ;
+            X [p] = (double) ((i + 3*j) % 7) ;
+            p++ ;
+        }
+    }
+    GrB_Matrix A ;
+    OK (GrB_Matrix_new (&A, type, n, f)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, nz, GrB_PLUS_FP64)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    return (A) ;
+}
+
+// returns true if C1 and C2 are the same
+static bool same (GrB_Matrix C1, GrB_Matrix C2)
+{
+    GrB_Index n, f, nvals1, nvals2 ;
+    OK (GrB_Matrix_nrows (&n, C1)) ;
+    OK (GrB_Matrix_ncols (&f, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals1, C1)) ;
+    OK (GrB_Matrix_nvals (&nvals2, C2)) ;
+    if (nvals1 != nvals2) return (false) ;
+    GrB_Matrix D ;
+    double dmax ;
+    OK (GrB_Matrix_new (&D, GrB_FP64, n, f)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (D, NULL, NULL, GrB_MINUS_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_apply (D, NULL, NULL, GrB_ABS_FP64, D, NULL)) ;
+    OK (GrB_Matrix_reduce_FP64 (&dmax, NULL, GrB_MAX_MONOID_FP64, D, NULL)) ;
+    GrB_Matrix_free (&D) ;
+    return (dmax == 0) ;
+}
+
+int main (int argc, char **argv)
+{
+
+    //--------------------------------------------------------------------------
+    // start GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    GrB_Index n = (argc > 1) ? atoll (argv [1]) : 100000 ;
+    GrB_Index d = (argc > 2) ? atoll (argv [2]) : 16 ;
+    GrB_Index f = (argc > 3) ? atoll (argv [3]) : 64 ;
+    int ntrials = (argc > 4) ? atoi (argv [4]) : 10 ;
+    printf ("spmm_demo: # of threads: %d, n: %g, d: %g, f: %g, trials: %d\n",
+        nthreads, (double) n, (double) d, (double) f, ntrials) ;
+
+    GrB_Descriptor desc ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+
+    GrB_Type types [2] = { GrB_FP64, GrB_FP32 } ;
+    GrB_Semiring semirings [2] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_PLUS_TIMES_SEMIRING_FP32 } ;
+    GrB_BinaryOp plus [2] = { GrB_PLUS_FP64, GrB_PLUS_FP32 } ;
+    const char *names [2] = { "double", "float" } ;
+
+    //--------------------------------------------------------------------------
+    // time each method for each type, with matrices by column and by row
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        for (int by_row = 0 ; by_row <= 1 ; by_row++)
+        {
+            GxB_Format_Value fmt = by_row ? GxB_BY_ROW : GxB_BY_COL ;
+            OK (GxB_Global_Option_set (GxB_FORMAT, fmt)) ;
+            GrB_Matrix A = sparse (types [k], n, d) ;
+            GrB_Matrix X = dense (types [k], n, f) ;
+            GrB_Matrix C1, C2, C3 ;
+            OK (GrB_Matrix_new (&C1, types [k], n, f)) ;
+            OK (GrB_Matrix_new (&C2, types [k], n, f)) ;
+            OK (GrB_Matrix_new (&C3, types [k], n, f)) ;
+
+            // C1 = A*X, default method
+            double t = wtime ( ) ;
+            for (int trial = 0 ; trial < ntrials ; trial++)
+            {
+                OK (GrB_mxm (C1, NULL, NULL, semirings [k], A, X, NULL)) ;
+            }
+            double t_default = (wtime ( ) - t) / ntrials ;
+
+            // C2 = A*X, via dot products
+            t = wtime ( ) ;
+            for (int trial = 0 ; trial < ntrials ; trial++)
+            {
+                OK (GrB_mxm (C2, NULL, NULL, semirings [k], A, X, desc)) ;
+            }
+            double t_dot = (wtime ( ) - t) / ntrials ;
+
+            // C3 += A*X, in-place, where C3 is full and all zero on input
+            double t_inplace = 0 ;
+            for (int trial = 0 ; trial < ntrials ; trial++)
+            {
+                OK (GrB_Matrix_assign_FP64 (C3, NULL, NULL, 0, GrB_ALL, n,
+                    GrB_ALL, f, NULL)) ;
+                OK (GrB_Matrix_wait (C3, GrB_MATERIALIZE)) ;
+                t = wtime ( ) ;
+                OK (GrB_mxm (C3, NULL, plus [k], semirings [k], A, X, NULL)) ;
+                t_inplace += wtime ( ) - t ;
+            }
+            t_inplace /= ntrials ;
+
+            printf ("%-6s by %s: C=A*X: %9.5f  C=A*X (dot): %9.5f  "
+                "C+=A*X: %9.5f sec\n", names [k], by_row ? "row" : "col",
+                t_default, t_dot, t_inplace) ;
+
+            // check the results (C1 and C2 may have empty rows, C3 does not)
+            bool ok = same (C1, C2) ;
+            OK (GrB_Matrix_assign_FP64 (C1, C1, NULL, 0, GrB_ALL, n, GrB_ALL,
+                f, GrB_DESC_SC)) ;
+            ok = ok && same (C1, C3) ;
+            printf ("results %s\n", ok ? "match" : "differ") ;
+
+            GrB_Matrix_free (&A) ;
+            GrB_Matrix_free (&X) ;
+            GrB_Matrix_free (&C1) ;
+            GrB_Matrix_free (&C2) ;
+            GrB_Matrix_free (&C3) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free everything
+    //--------------------------------------------------------------------------
+
+    GrB_Descriptor_free (&desc) ;
+    OK (GrB_finalize ( )) ;
+    return (0) ;
+}
@@ -57,6 +57,39 @@ void mexFunction
         { 
             method = GxB_COMPRESSION_LZ4HC ;
         }
+        else if (MATCH (method_name, "zstd"))
+        { 
+            method = GxB_COMPRESSION_ZSTD ;
+        }
+        else if (MATCH (method_name, "shuffle:lz4"))
+        { 
+            method = GxB_COMPRESSION_SHUFFLE + GxB_COMPRESSION_LZ4 ;
+        }
+        else if (MATCH (method_name, "shuffle:lz4hc"))
+        { 
+            method = GxB_COMPRESSION_SHUFFLE + GxB_COMPRESSION_LZ4HC ;
+        }
+        else if (MATCH (method_name, "shuffle:zstd"))
+        { 
+            method = GxB_COMPRESSION_SHUFFLE + GxB_COMPRESSION_ZSTD ;
+        }
+        else if (MATCH (method_name, "delta:lz4"))
+        { 
+            method = GxB_COMPRESSION_DELTA + GxB_COMPRESSION_LZ4 ;
+        }
+        else if (MATCH (method_name, "delta:lz4hc"))
+        { 
+            method = GxB_COMPRESSION_DELTA + GxB_COMPRESSION_LZ4HC ;
+        }
+        else if (MATCH (method_name, "delta:zstd"))
+        { 
+            method = GxB_COMPRESSION_DELTA + GxB_COMPRESSION_ZSTD ;
+        }
+        else if (MATCH (method_name, "delta:shuffle:zstd"))
+        { 
+            method = GxB_COMPRESSION_DELTA + GxB_COMPRESSION_SHUFFLE
+                + GxB_COMPRESSION_ZSTD ;
+        }
         else if (MATCH (method_name, "debug"))
         { 
             // use GrB_Matrix_serializeSize and GrB_Matrix_serialize, just
@@ -115,7 +148,7 @@ void mexFunction
         {
             level = (int) mxGetScalar (pargin [2]) ;
         }
-        if (level < 0 || level > 9) level = 0 ;
+        if (level < 0 || level > 19) level = 0 ;
         // set the descriptor
         OK (GxB_Desc_set (desc, GxB_COMPRESSION, method + level)) ;
     }
@@ -24,6 +24,20 @@ function blob = serialize (G, method, level)
 %            provides excellent compression compared with LZ4, and higher
 %            levels of LZ4HC only slightly improve compression quality.
 %
+%   'zstd'   ZSTD, slower than LZ4 but often much more compact.  The level
+%            can be 1 to 19 with 1 the default.
+%
+%   'shuffle:lz4', 'shuffle:lz4hc', 'shuffle:zstd': the bytes of each
+%            array are shuffled before compression, so that the k-th byte
+%            of each entry is stored contiguously.  This can greatly
+%            improve compression of the indices and of numerical values.
+%
+%   'delta:lz4', 'delta:lz4hc', 'delta:zstd', 'delta:shuffle:zstd': the
+%            integer arrays that hold the pattern of a sparse matrix are
+%            encoded as the differences between adjacent entries, in 1 to
+%            10 bytes each, before they are compressed.  The values are not
+%            delta-encoded, but they are shuffled with 'delta:shuffle:zstd'.
+%
 % Example:
 %   G = GrB (magic (5))
 %   blob = GrB.serialize (G) ;      % compressed via LZ4
@@ -1308,6 +1308,10 @@
 #define GxB_ANY_UINT64_MONOID GxM_ANY_UINT64_MONOID
 #define GxB_ANY_UINT8 GxM_ANY_UINT8
 #define GxB_ANY_UINT8_MONOID GxM_ANY_UINT8_MONOID
+#define GxB_Arena_clear GxM_Arena_clear
+#define GxB_Arena_free GxM_Arena_free
+#define GxB_Arena_highwater GxM_Arena_highwater
+#define GxB_Arena_new GxM_Arena_new
 #define GxB_ASIN_FC32 GxM_ASIN_FC32
 #define GxB_ASIN_FC64 GxM_ASIN_FC64
 #define GxB_ASIN_FP32 GxM_ASIN_FP32
@@ -1997,6 +2001,8 @@
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
+#define GxB_Matrix_deserialize_fd GxM_Matrix_deserialize_fd
+#define GxB_Matrix_deserialize_stream GxM_Matrix_deserialize_stream
 #define GxB_Matrix_diag GxM_Matrix_diag
 #define GxB_Matrix_eWiseUnion GxM_Matrix_eWiseUnion
 #define GxB_Matrix_export_BitmapC GxM_Matrix_export_BitmapC
@@ -2011,6 +2017,20 @@
 #define GxB_Matrix_export_HyperCSR GxM_Matrix_export_HyperCSR
 #define GxB_Matrix_extractElement_FC32 GxM_Matrix_extractElement_FC32
 #define GxB_Matrix_extractElement_FC64 GxM_Matrix_extractElement_FC64
+#define GxB_Matrix_extractElements_BOOL GxM_Matrix_extractElements_BOOL
+#define GxB_Matrix_extractElements_FC32 GxM_Matrix_extractElements_FC32
+#define GxB_Matrix_extractElements_FC64 GxM_Matrix_extractElements_FC64
+#define GxB_Matrix_extractElements_FP32 GxM_Matrix_extractElements_FP32
+#define GxB_Matrix_extractElements_FP64 GxM_Matrix_extractElements_FP64
+#define GxB_Matrix_extractElements_INT16 GxM_Matrix_extractElements_INT16
+#define GxB_Matrix_extractElements_INT32 GxM_Matrix_extractElements_INT32
+#define GxB_Matrix_extractElements_INT64 GxM_Matrix_extractElements_INT64
+#define GxB_Matrix_extractElements_INT8 GxM_Matrix_extractElements_INT8
+#define GxB_Matrix_extractElements_UDT GxM_Matrix_extractElements_UDT
+#define GxB_Matrix_extractElements_UINT16 GxM_Matrix_extractElements_UINT16
+#define GxB_Matrix_extractElements_UINT32 GxM_Matrix_extractElements_UINT32
+#define GxB_Matrix_extractElements_UINT64 GxM_Matrix_extractElements_UINT64
+#define GxB_Matrix_extractElements_UINT8 GxM_Matrix_extractElements_UINT8
 #define GxB_Matrix_extractTuples_FC32 GxM_Matrix_extractTuples_FC32
 #define GxB_Matrix_extractTuples_FC64 GxM_Matrix_extractTuples_FC64
 #define GxB_Matrix_fprint GxM_Matrix_fprint
@@ -2026,6 +2046,7 @@
 #define GxB_Matrix_import_HyperCSR GxM_Matrix_import_HyperCSR
 #define GxB_Matrix_iso GxM_Matrix_iso
 #define GxB_Matrix_memoryUsage GxM_Matrix_memoryUsage
+#define GxB_Matrix_mmap GxM_Matrix_mmap
 #define GxB_Matrix_Option_get GxM_Matrix_Option_get
 #define GxB_Matrix_Option_set GxM_Matrix_Option_set
 #define GxB_Matrix_pack_BitmapC GxM_Matrix_pack_BitmapC
@@ -2043,8 +2064,25 @@
 #define GxB_Matrix_select_FC32 GxM_Matrix_select_FC32
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_serialize GxM_Matrix_serialize
+#define GxB_Matrix_serialize_fd GxM_Matrix_serialize_fd
+#define GxB_Matrix_serialize_mmap GxM_Matrix_serialize_mmap
+#define GxB_Matrix_serialize_stream GxM_Matrix_serialize_stream
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
+#define GxB_Matrix_setElements_BOOL GxM_Matrix_setElements_BOOL
+#define GxB_Matrix_setElements_FC32 GxM_Matrix_setElements_FC32
+#define GxB_Matrix_setElements_FC64 GxM_Matrix_setElements_FC64
+#define GxB_Matrix_setElements_FP32 GxM_Matrix_setElements_FP32
+#define GxB_Matrix_setElements_FP64 GxM_Matrix_setElements_FP64
+#define GxB_Matrix_setElements_INT16 GxM_Matrix_setElements_INT16
+#define GxB_Matrix_setElements_INT32 GxM_Matrix_setElements_INT32
+#define GxB_Matrix_setElements_INT64 GxM_Matrix_setElements_INT64
+#define GxB_Matrix_setElements_INT8 GxM_Matrix_setElements_INT8
+#define GxB_Matrix_setElements_UDT GxM_Matrix_setElements_UDT
+#define GxB_Matrix_setElements_UINT16 GxM_Matrix_setElements_UINT16
+#define GxB_Matrix_setElements_UINT32 GxM_Matrix_setElements_UINT32
+#define GxB_Matrix_setElements_UINT64 GxM_Matrix_setElements_UINT64
+#define GxB_Matrix_setElements_UINT8 GxM_Matrix_setElements_UINT8
 #define GxB_Matrix_sort GxM_Matrix_sort
 #define GxB_Matrix_split GxM_Matrix_split
 #define GxB_Matrix_subassign GxM_Matrix_subassign
@@ -2549,6 +2587,9 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_MxM_Plan_free GxM_MxM_Plan_free
+#define GxB_MxM_Plan_new GxM_MxM_Plan_new
+#define GxB_MxM_Plan_stats GxM_MxM_Plan_stats
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -3259,6 +3300,20 @@
 #define GxB_Vector_export_Full GxM_Vector_export_Full
 #define GxB_Vector_extractElement_FC32 GxM_Vector_extractElement_FC32
 #define GxB_Vector_extractElement_FC64 GxM_Vector_extractElement_FC64
+#define GxB_Vector_extractElements_BOOL GxM_Vector_extractElements_BOOL
+#define GxB_Vector_extractElements_FC32 GxM_Vector_extractElements_FC32
+#define GxB_Vector_extractElements_FC64 GxM_Vector_extractElements_FC64
+#define GxB_Vector_extractElements_FP32 GxM_Vector_extractElements_FP32
+#define GxB_Vector_extractElements_FP64 GxM_Vector_extractElements_FP64
+#define GxB_Vector_extractElements_INT16 GxM_Vector_extractElements_INT16
+#define GxB_Vector_extractElements_INT32 GxM_Vector_extractElements_INT32
+#define GxB_Vector_extractElements_INT64 GxM_Vector_extractElements_INT64
+#define GxB_Vector_extractElements_INT8 GxM_Vector_extractElements_INT8
+#define GxB_Vector_extractElements_UDT GxM_Vector_extractElements_UDT
+#define GxB_Vector_extractElements_UINT16 GxM_Vector_extractElements_UINT16
+#define GxB_Vector_extractElements_UINT32 GxM_Vector_extractElements_UINT32
+#define GxB_Vector_extractElements_UINT64 GxM_Vector_extractElements_UINT64
+#define GxB_Vector_extractElements_UINT8 GxM_Vector_extractElements_UINT8
 #define GxB_Vector_extractTuples_FC32 GxM_Vector_extractTuples_FC32
 #define GxB_Vector_extractTuples_FC64 GxM_Vector_extractTuples_FC64
 #define GxB_Vector_fprint GxM_Vector_fprint
@@ -3281,6 +3336,20 @@
 #define GxB_Vector_serialize GxM_Vector_serialize
 #define GxB_Vector_setElement_FC32 GxM_Vector_setElement_FC32
 #define GxB_Vector_setElement_FC64 GxM_Vector_setElement_FC64
+#define GxB_Vector_setElements_BOOL GxM_Vector_setElements_BOOL
+#define GxB_Vector_setElements_FC32 GxM_Vector_setElements_FC32
+#define GxB_Vector_setElements_FC64 GxM_Vector_setElements_FC64
+#define GxB_Vector_setElements_FP32 GxM_Vector_setElements_FP32
+#define GxB_Vector_setElements_FP64 GxM_Vector_setElements_FP64
+#define GxB_Vector_setElements_INT16 GxM_Vector_setElements_INT16
+#define GxB_Vector_setElements_INT32 GxM_Vector_setElements_INT32
+#define GxB_Vector_setElements_INT64 GxM_Vector_setElements_INT64
+#define GxB_Vector_setElements_INT8 GxM_Vector_setElements_INT8
+#define GxB_Vector_setElements_UDT GxM_Vector_setElements_UDT
+#define GxB_Vector_setElements_UINT16 GxM_Vector_setElements_UINT16
+#define GxB_Vector_setElements_UINT32 GxM_Vector_setElements_UINT32
+#define GxB_Vector_setElements_UINT64 GxM_Vector_setElements_UINT64
+#define GxB_Vector_setElements_UINT8 GxM_Vector_setElements_UINT8
 #define GxB_Vector_sort GxM_Vector_sort
 #define GxB_Vector_subassign GxM_Vector_subassign
 #define GxB_Vector_subassign_BOOL GxM_Vector_subassign_BOOL
@@ -3305,6 +3374,7 @@
 #define GxB_Vector_unpack_Full GxM_Vector_unpack_Full
 #define GB_accum_mask GM_accum_mask
 #define GB_add GM_add
+#define GB_add_mask_slice GM_add_mask_slice
 #define GB_add_phase0 GM_add_phase0
 #define GB_add_phase1 GM_add_phase1
 #define GB_add_phase2 GM_add_phase2
@@ -3329,12 +3399,22 @@
 #define GB_AxB_dot3_slice GM_AxB_dot3_slice
 #define GB_AxB_dot4 GM_AxB_dot4
 #define GB_AxB_meta GM_AxB_meta
+#define GB_AxB_outer GM_AxB_outer
+#define GB_AxB_outer_flops GM_AxB_outer_flops
+#define GB_AxB_outer_ok GM_AxB_outer_ok
+#define GB_AxB_push_pull GM_AxB_push_pull
 #define GB_AxB_rowscale GM_AxB_rowscale
 #define GB_AxB_saxpy GM_AxB_saxpy
 #define GB_AxB_saxpy3 GM_AxB_saxpy3
+#define GB_AxB_saxpy3_cache_free GM_AxB_saxpy3_cache_free
 #define GB_AxB_saxpy3_cumsum GM_AxB_saxpy3_cumsum
 #define GB_AxB_saxpy3_flopcount GM_AxB_saxpy3_flopcount
+#define GB_AxB_saxpy3_key GM_AxB_saxpy3_key
+#define GB_AxB_saxpy3_plan_clear GM_AxB_saxpy3_plan_clear
+#define GB_AxB_saxpy3_plan_reuse GM_AxB_saxpy3_plan_reuse
+#define GB_AxB_saxpy3_plan_save GM_AxB_saxpy3_plan_save
 #define GB_AxB_saxpy3_slice_balanced GM_AxB_saxpy3_slice_balanced
+#define GB_AxB_saxpy3_slice_cached GM_AxB_saxpy3_slice_cached
 #define GB_AxB_saxpy3_slice_quick GM_AxB_saxpy3_slice_quick
 #define GB_AxB_saxpy3_sym_bh GM_AxB_saxpy3_sym_bh
 #define GB_AxB_saxpy3_symbolic GM_AxB_saxpy3_symbolic
@@ -3380,7 +3460,10 @@
 #define GB_AxB_saxpy4 GM_AxB_saxpy4
 #define GB_AxB_saxpy4_tasks GM_AxB_saxpy4_tasks
 #define GB_AxB_saxpy5 GM_AxB_saxpy5
+#define GB_AxB_saxpy_full GM_AxB_saxpy_full
 #define GB_AxB_saxpy_generic GM_AxB_saxpy_generic
+#define GB_AxB_saxpy_msa GM_AxB_saxpy_msa
+#define GB_AxB_saxpy_msa_control GM_AxB_saxpy_msa_control
 #define GB_AxB_saxpy_sparsity GM_AxB_saxpy_sparsity
 #define GB_AxB_semiring_builtin GM_AxB_semiring_builtin
 #define GB_BinaryOp_check GM_BinaryOp_check
@@ -3433,6 +3516,7 @@
 #define GB_builder GM_builder
 #define GB_burble_assign GM_burble_assign
 #define GB_calloc_memory GM_calloc_memory
+#define GB_calloc_work GM_calloc_work
 #define GB_cast_array GM_cast_array
 #define GB_cast_factory GM_cast_factory
 #define GB_cast_matrix GM_cast_matrix
@@ -3516,7 +3600,10 @@
 #define GB_Descriptor_check GM_Descriptor_check
 #define GB_Descriptor_get GM_Descriptor_get
 #define GB_deserialize GM_deserialize
+#define GB_deserialize_block GM_deserialize_block
 #define GB_deserialize_from_blob GM_deserialize_from_blob
+#define GB_deserialize_mmap GM_deserialize_mmap
+#define GB_deserialize_stream GM_deserialize_stream
 #define GB_divcomplex GM_divcomplex
 #define GB_do_dynamic_header GM_do_dynamic_header
 #define GB_dup GM_dup
@@ -3524,6 +3611,7 @@
 #define GB_ek_slice GM_ek_slice
 #define GB_ek_slice_merge1 GM_ek_slice_merge1
 #define GB_ek_slice_merge2 GM_ek_slice_merge2
+#define GB_Elements_sort GM_Elements_sort
 #define GB_emult GM_emult
 #define GB_emult_02 GM_emult_02
 #define GB_emult_04 GM_emult_04
@@ -3538,14 +3626,18 @@
 #define GB_ewise_slice GM_ewise_slice
 #define GB_export GM_export
 #define GB_extract GM_extract
+#define GB_extractElements GM_extractElements
 #define GB_extractTuples GM_extractTuples
 #define GB_extract_vector_list GM_extract_vector_list
 #define GB_FC32_div GM_FC32_div
 #define GB_FC64_div GM_FC64_div
+#define GB_fd_read GM_fd_read
+#define GB_fd_write GM_fd_write
 #define GB_flip_binop_code GM_flip_binop_code
 #define GB_flip_op GM_flip_op
 #define GB_free_memory GM_free_memory
 #define GB_free_pool_finalize GM_free_pool_finalize
+#define GB_free_work GM_free_work
 #define GB_frexpe GM_frexpe
 #define GB_frexpef GM_frexpef
 #define GB_frexpx GM_frexpx
@@ -3561,17 +3653,23 @@
 #define GB_Global_burble_set GM_Global_burble_set
 #define GB_Global_chunk_get GM_Global_chunk_get
 #define GB_Global_chunk_set GM_Global_chunk_set
+#define GB_Global_cpu_features_set GM_Global_cpu_features_set
 #define GB_Global_flush_get GM_Global_flush_get
 #define GB_Global_flush_set GM_Global_flush_set
 #define GB_Global_free_function GM_Global_free_function
 #define GB_Global_free_function_set GM_Global_free_function_set
 #define GB_Global_free_pool_dump GM_Global_free_pool_dump
+#define GB_Global_free_pool_flush GM_Global_free_pool_flush
 #define GB_Global_free_pool_get GM_Global_free_pool_get
 #define GB_Global_free_pool_init GM_Global_free_pool_init
 #define GB_Global_free_pool_limit_get GM_Global_free_pool_limit_get
 #define GB_Global_free_pool_limit_set GM_Global_free_pool_limit_set
+#define GB_Global_free_pool_magazine_limit_get GM_Global_free_pool_magazine_limit_get
+#define GB_Global_free_pool_magazine_limit_set GM_Global_free_pool_magazine_limit_set
 #define GB_Global_free_pool_nblocks_total GM_Global_free_pool_nblocks_total
 #define GB_Global_free_pool_put GM_Global_free_pool_put
+#define GB_Global_free_pool_stats_clear GM_Global_free_pool_stats_clear
+#define GB_Global_free_pool_stats_get GM_Global_free_pool_stats_get
 #define GB_Global_get_wtime GM_Global_get_wtime
 #define GB_Global_gpu_chunk_get GM_Global_gpu_chunk_get
 #define GB_Global_gpu_chunk_set GM_Global_gpu_chunk_set
@@ -3591,6 +3689,8 @@
 #define GB_Global_hack_get GM_Global_hack_get
 #define GB_Global_hack_set GM_Global_hack_set
 #define GB_Global_have_realloc_function GM_Global_have_realloc_function
+#define GB_Global_hyper_hash_get GM_Global_hyper_hash_get
+#define GB_Global_hyper_hash_set GM_Global_hyper_hash_set
 #define GB_Global_hyper_switch_get GM_Global_hyper_switch_get
 #define GB_Global_hyper_switch_set GM_Global_hyper_switch_set
 #define GB_Global_is_csc_get GM_Global_is_csc_get
@@ -3642,6 +3742,8 @@
 #define GB_helper5 GM_helper5
 #define GB_helper7 GM_helper7
 #define GB_helper8 GM_helper8
+#define GB_hyper_hash_build GM_hyper_hash_build
+#define GB_hyper_hash_free GM_hyper_hash_free
 #define GB_hypermatrix_prune GM_hypermatrix_prune
 #define GB_hyper_prune GM_hyper_prune
 #define GB_hyper_realloc GM_hyper_realloc
@@ -3660,6 +3762,11 @@
 #define GB_ijsort GM_ijsort
 #define GB_import GM_import
 #define GB_IndexUnaryOp_check GM_IndexUnaryOp_check
+#define GB_Ingest_add GM_Ingest_add
+#define GB_Ingest_alloc GM_Ingest_alloc
+#define GB_Ingest_clear GM_Ingest_clear
+#define GB_Ingest_free GM_Ingest_free
+#define GB_Ingest_merge GM_Ingest_merge
 #define GB_init GM_init
 #define GB_int64_multiply GM_int64_multiply
 #define GB_is_diagonal GM_is_diagonal
@@ -3760,6 +3867,7 @@
 #define GB_LZ4_versionString GM_LZ4_versionString
 #define GB_make_shallow GM_make_shallow
 #define GB_malloc_memory GM_malloc_memory
+#define GB_malloc_work GM_malloc_work
 #define GB_mask GM_mask
 #define GB_Mask_compatible GM_Mask_compatible
 #define GB_masker GM_masker
@@ -3776,6 +3884,7 @@
 #define GB_memcpy GM_memcpy
 #define GB_memoryUsage GM_memoryUsage
 #define GB_memset GM_memset
+#define GB_mmap GM_mmap
 #define GB_Monoid_check GM_Monoid_check
 #define GB_Monoid_new GM_Monoid_new
 #define GB_msort_1 GM_msort_1
@@ -3784,6 +3893,7 @@
 #define GB_msort_2_create_merge_tasks GM_msort_2_create_merge_tasks
 #define GB_msort_3 GM_msort_3
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
+#define GB_munmap GM_munmap
 #define GB_mxm GM_mxm
 #define GB_new GM_new
 #define GB_new_bix GM_new_bix
@@ -3801,6 +3911,7 @@
 #define GB_Pending_free GM_Pending_free
 #define GB_Pending_n GM_Pending_n
 #define GB_Pending_realloc GM_Pending_realloc
+#define GB_Pending_sort GM_Pending_sort
 #define GB_phbix_free GM_phbix_free
 #define GB_ph_free GM_ph_free
 #define GB_positional_binop_ijflip GM_positional_binop_ijflip
@@ -3828,6 +3939,7 @@
 #define GB_qsort_2 GM_qsort_2
 #define GB_qsort_3 GM_qsort_3
 #define GB_realloc_memory GM_realloc_memory
+#define GB_realloc_work GM_realloc_work
 #define GB_reduce_to_scalar GM_reduce_to_scalar
 #define GB_reduce_to_vector GM_reduce_to_vector
 #define GB_resize GM_resize
@@ -3842,10 +3954,15 @@
 #define GB_Semiring_new GM_Semiring_new
 #define GB_serialize GM_serialize
 #define GB_serialize_array GM_serialize_array
+#define GB_serialize_array_method GM_serialize_array_method
+#define GB_serialize_block GM_serialize_block
+#define GB_serialize_bound GM_serialize_bound
 #define GB_serialize_free_blocks GM_serialize_free_blocks
 #define GB_serialize_method GM_serialize_method
+#define GB_serialize_stream GM_serialize_stream
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
+#define GB_setElements GM_setElements
 #define GB_shallow_copy GM_shallow_copy
 #define GB_shallow_op GM_shallow_op
 #define GB_signum GM_signum
@@ -3898,6 +4015,8 @@
 #define GB_transplant_conform GM_transplant_conform
 #define GB_transpose GM_transpose
 #define GB_transpose_bucket GM_transpose_bucket
+#define GB_transpose_cache_build GM_transpose_cache_build
+#define GB_transpose_cache_free GM_transpose_cache_free
 #define GB_transpose_cast GM_transpose_cast
 #define GB_transpose_in_place GM_transpose_in_place
 #define GB_transpose_ix GM_transpose_ix
@@ -3916,3 +4035,6 @@
 #define GB_Vector_removeElement GM_Vector_removeElement
 #define GB_wait GM_wait
 #define GB_xalloc_memory GM_xalloc_memory
+#define GB_zstd_calloc GM_zstd_calloc
+#define GB_zstd_free GM_zstd_free
+#define GB_zstd_malloc GM_zstd_malloc
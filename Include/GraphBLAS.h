@@ -462,6 +462,13 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 //          present, very sparse, and not complemented, or when C is a dense
 //          vector or matrix, or when C is small.
 //
+//      GxB_AxB_OUTER: computes C=A*B' as the sum of the outer products
+//          A(:,k)*B(:,k)', without transposing A or B.  It is used only for
+//          C=A*B' where A and B are sparse or hypersparse and held in the
+//          same orientation; otherwise GxB_AxB_OUTER is treated as
+//          GxB_DEFAULT.  It works well when the number of flops is small
+//          compared with the number of entries in B.
+//
 // GxB_SORT: GrB_mxm and other methods may return a matrix in a 'jumbled'
 //      state, with indices out of order.  The sort is left pending.  Some
 //      methods can tolerate jumbled matrices on input, so this can be faster.
@@ -478,6 +485,13 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 // GxB_IMPORT:  GxB_FAST_IMPORT (faster, for trusted input data) or
 //      GxB_SECURE_IMPORT (slower, for untrusted input data), for the
 //      GxB*_pack* methods.
+//
+// GxB_ARENA: a GxB_Arena (see below), or NULL (the default).  If present,
+//      werkspace for the method is taken from the arena instead of malloc.
+//
+// GxB_MXM_PLAN: a GxB_MxM_Plan (see below), or NULL (the default).  If
+//      present, GrB_mxm, GrB_mxv, and GrB_vxm save their symbolic analysis
+//      in the plan, and reuse it when the same patterns are multiplied again.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field for global options.  They are defined with the same integer
@@ -511,6 +525,8 @@ typedef enum
     GxB_SORT = 35,          // control sort in GrB_mxm
     GxB_COMPRESSION = 36,   // select compression for serialize
     GxB_IMPORT = 37,        // secure vs fast import
+    GxB_ARENA = 38,         // arena for werkspace
+    GxB_MXM_PLAN = 39,      // plan for the symbolic analysis of C=A*B
 }
 GrB_Desc_Field ;
 
@@ -541,6 +557,7 @@ typedef enum
     GxB_AxB_DOT       = 1003,   // dot product
     GxB_AxB_HASH      = 1004,   // hash-based saxpy method
     GxB_AxB_SAXPY     = 1005,   // saxpy method (any kind)
+    GxB_AxB_OUTER     = 1006,   // outer product method, for C=A*B' only
 
     // for GxB_IMPORT only:
     GxB_SECURE_IMPORT = 502     // GxB*_pack* methods trust their input data
@@ -654,6 +671,104 @@ GrB_DESC_RSCT0T1 ; // GrB_REPLACE  GrB_STRUCTURE  GrB_COMP   GrB_TRAN  GrB_TRAN
 // them results in an error (GrB_INVALID_VALUE).  Attempts to free them are
 // silently ignored.
 
+//------------------------------------------------------------------------------
+// GxB_Arena: a reusable region of memory for werkspace
+//------------------------------------------------------------------------------
+
+// A GxB_Arena is a block of memory owned by the user application, that can be
+// attached to a descriptor with GxB_set (desc, GxB_ARENA, arena).  Any
+// GraphBLAS method that uses the descriptor takes its temporary werkspace from
+// the arena, with a simple bump allocator, instead of allocating and freeing
+// each piece of werkspace with malloc/free.  All of the werkspace is released
+// in O(1) time when the method returns.  Requests that do not fit in the arena
+// are satisfied by malloc instead.  This can be faster for applications that
+// call many GraphBLAS methods on small problems (such as GrB_mxv or GrB_vxm in
+// a breadth-first search).
+
+// GxB_Arena_highwater returns the largest # of bytes ever in use in the arena,
+// and the # of requests that did not fit and were allocated by malloc
+// instead.  Either output may be NULL.  GxB_Arena_clear resets both
+// statistics to zero.  Use these to select the size of the arena.
+
+// An arena may be attached to any number of descriptors, but it may be used
+// by only one user thread at a time, and it must not be freed while it is
+// attached to a descriptor that is still in use.
+
+typedef struct GB_Arena_opaque *GxB_Arena ;
+
+GB_PUBLIC
+GrB_Info GxB_Arena_new          // create a new arena
+(
+    GxB_Arena *arena,           // handle of arena to create
+    size_t size                 // size of the arena, in bytes
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Arena_highwater    // report the memory usage of an arena
+(
+    size_t *highwater,          // max # of bytes in use in the arena
+    int64_t *noverflow,         // # of requests that did not fit
+    const GxB_Arena arena       // arena to query
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Arena_clear        // reset the high-water mark of an arena
+(
+    GxB_Arena arena             // arena to modify
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Arena_free         // free an arena
+(
+    GxB_Arena *arena            // handle of arena to free
+) ;
+
+//------------------------------------------------------------------------------
+// GxB_MxM_Plan: a reusable symbolic analysis for C=A*B
+//------------------------------------------------------------------------------
+
+// A GxB_MxM_Plan holds the symbolic analysis of a sparse matrix product
+// C<M>=A*B computed by the saxpy-based method: the parallel tasks, the size
+// and kind of each hash table, and the number of entries in each vector of C
+// found by the symbolic phase.  It is attached to a descriptor with GxB_set
+// (desc, GxB_MXM_PLAN, plan).  The first GrB_mxm, GrB_mxv, or GrB_vxm that
+// uses the descriptor performs the full computation and saves its analysis
+// in the plan.  Subsequent calls with the same patterns of A, B, and M (and
+// the same values of M, if the mask is not structural) skip the analysis and
+// compute only the numerical values of C.  The values of A and B, the
+// semiring, and the type of C may all differ from one call to the next.  If
+// any pattern changes, the plan is rebuilt automatically; the result is
+// always the same as if no plan were used.
+
+// GxB_MxM_Plan_stats returns the # of times the plan has been built, and the
+// # of times it has been reused.  Either output may be NULL.
+
+// A plan may be attached to any number of descriptors, but it may be used by
+// only one user thread at a time, and it must not be freed while it is
+// attached to a descriptor that is still in use.
+
+typedef struct GB_MxM_Plan_opaque *GxB_MxM_Plan ;
+
+GB_PUBLIC
+GrB_Info GxB_MxM_Plan_new       // create a new, empty plan
+(
+    GxB_MxM_Plan *plan          // handle of plan to create
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_MxM_Plan_stats     // report how often a plan was reused
+(
+    int64_t *nbuild,            // # of times the plan was built
+    int64_t *nreuse,            // # of times the plan was reused
+    const GxB_MxM_Plan plan     // plan to query
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_MxM_Plan_free      // free a plan
+(
+    GxB_MxM_Plan *plan          // handle of plan to free
+) ;
+
 //==============================================================================
 // GrB_Type: data types
 //==============================================================================
@@ -3205,6 +3320,335 @@ GrB_Info GrB_Vector_extractElement  // x = v(i)
     (x, v, i)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements and GxB_Vector_extractElements
+//------------------------------------------------------------------------------
+
+// GxB_Vector_setElements (w, I, X, nvals) sets a list of entries in w,
+// w (I [k]) = X [k] for k = 0:nvals-1, with the same result as nvals calls to
+// GrB_Vector_setElement, in order.  GxB_Vector_extractElements (X, Found, v,
+// I, nvals) extracts a list of entries, X [k] = v (I [k]).  See
+// GxB_Matrix_setElements and GxB_Matrix_extractElements for details.
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_BOOL    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const bool *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT8    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const int8_t *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT16   // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const int16_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT32   // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const int32_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_INT64   // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const int64_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT8   // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const uint8_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT16  // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const uint16_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT32  // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const uint32_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UINT64  // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const uint64_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FP32    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const float *X,                 // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FP64    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const double *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FC32    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const GxB_FC32_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_FC64    // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const GxB_FC64_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements_UDT     // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Vector_setElements         // w(I) = X
+(
+    GrB_Vector w,                   // vector to modify
+    const GrB_Index *I,             // array of indices of tuples
+    const <type> *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Vector_setElements(w,I,X,nvals)             \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_CASES (*, GxB, Vector_setElements)       \
+    )                                                   \
+    (w, I, X, nvals)
+#endif
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_BOOL // X = v(I)
+(
+    bool *X,                        // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT8 // X = v(I)
+(
+    int8_t *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT16 // X = v(I)
+(
+    int16_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT32 // X = v(I)
+(
+    int32_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_INT64 // X = v(I)
+(
+    int64_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT8 // X = v(I)
+(
+    uint8_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT16 // X = v(I)
+(
+    uint16_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT32 // X = v(I)
+(
+    uint32_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UINT64 // X = v(I)
+(
+    uint64_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FP32 // X = v(I)
+(
+    float *X,                       // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FP64 // X = v(I)
+(
+    double *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FC32 // X = v(I)
+(
+    GxB_FC32_t *X,                  // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_FC64 // X = v(I)
+(
+    GxB_FC64_t *X,                  // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements_UDT // X = v(I)
+(
+    void *X,                        // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Vector_extractElements     // X = v(I)
+(
+    <type> *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Vector v,             // vector to extract entries from
+    const GrB_Index *I,             // array of indices of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Vector_extractElements(X,Found,v,I,nvals)   \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_CASES (*, GxB, Vector_extractElements)   \
+    )                                                   \
+    (X, Found, v, I, nvals)
+#endif
+
 //------------------------------------------------------------------------------
 // GrB_Vector_removeElement
 //------------------------------------------------------------------------------
@@ -3807,200 +4251,570 @@ GrB_Info GrB_Matrix_setElement_Scalar   // C (i,j) = x
     GrB_Index j                         // column index
 ) ;
 
-// Type-generic version:  x can be any supported C type or void * for a
-// user-defined type.
+// Type-generic version:  x can be any supported C type or void * for a
+// user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_setElement          // C (i,j) = x
+(
+    GrB_Matrix C,                       // matrix to modify
+    <type> x,                           // scalar to assign to C(i,j)
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GrB_Matrix_setElement(C,x,i,j)                      \
+    _Generic                                                \
+    (                                                       \
+        (x),                                                \
+            GB_CASES (, GrB, Matrix_setElement),            \
+            default : GrB_Matrix_setElement_Scalar          \
+    )                                                       \
+    (C, x, i, j)
+#endif
+
+//------------------------------------------------------------------------------
+// GrB_Matrix_extractElement
+//------------------------------------------------------------------------------
+
+// Extract a single entry from a matrix, x = A(i,j), typecasting from the type
+// of A to the type of x, as needed.
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_BOOL     // x = A(i,j)
+(
+    bool *x,                            // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_INT8     // x = A(i,j)
+(
+    int8_t *x,                          // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_UINT8    // x = A(i,j)
+(
+    uint8_t *x,                         // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_INT16    // x = A(i,j)
+(
+    int16_t *x,                         // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_UINT16   // x = A(i,j)
+(
+    uint16_t *x,                        // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_INT32    // x = A(i,j)
+(
+    int32_t *x,                         // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_UINT32   // x = A(i,j)
+(
+    uint32_t *x,                        // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_INT64    // x = A(i,j)
+(
+    int64_t *x,                         // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_UINT64   // x = A(i,j)
+(
+    uint64_t *x,                        // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_FP32     // x = A(i,j)
+(
+    float *x,                           // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_FP64     // x = A(i,j)
+(
+    double *x,                          // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElement_FC32     // x = A(i,j)
+(
+    GxB_FC32_t *x,                      // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElement_FC64     // x = A(i,j)
+(
+    GxB_FC64_t *x,                      // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_UDT      // x = A(i,j)
+(
+    void *x,                            // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement_Scalar   // x = A(i,j)
+(
+    GrB_Scalar x,                       // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+// Type-generic version:  x can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GrB_Matrix_extractElement      // x = A(i,j)
+(
+    <type> *x,                          // extracted scalar
+    const GrB_Matrix A,                 // matrix to extract a scalar from
+    GrB_Index i,                        // row index
+    GrB_Index j                         // column index
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GrB_Matrix_extractElement(x,A,i,j)                      \
+    _Generic                                                    \
+    (                                                           \
+        (x),                                                    \
+            GB_CASES (*, GrB, Matrix_extractElement),           \
+            default : GrB_Matrix_extractElement_Scalar          \
+    )                                                           \
+    (x, A, i, j)
+#endif
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements and GxB_Matrix_extractElements
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_setElements (C, I, J, X, nvals) sets a list of entries in C,
+// C (I [k], J [k]) = X [k] for k = 0:nvals-1, with the same result as nvals
+// calls to GrB_Matrix_setElement, in order.  If a tuple appears more than once,
+// the last one takes precedence.  Entries already present in C are modified in
+// place; new entries are added to C as pending tuples (or set in the bitmap, if
+// C is bitmap), and are assembled by the next GrB_Matrix_wait, as usual.
+
+// GxB_Matrix_extractElements (X, Found, A, I, J, nvals) extracts a list of
+// entries, X [k] = A (I [k], J [k]) for k = 0:nvals-1.  If the optional Found
+// array is present, Found [k] is set to true if the entry is present and false
+// otherwise; X [k] is not modified if the entry is not present.  GrB_SUCCESS is
+// returned if all entries are present, or GrB_NO_VALUE if any are not.
+
+// Both methods work on all the tuples in parallel.  If the matrix is sparse or
+// hypersparse, the tuples are sorted by vector, so that each vector and index
+// is found with a monotonic search rather than a binary search per tuple.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_BOOL    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const bool *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT8    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int8_t *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT16   // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int16_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT32   // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int32_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_INT64   // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int64_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT8   // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint8_t *X,               // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT16  // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint16_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT32  // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint32_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UINT64  // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint64_t *X,              // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FP32    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const float *X,                 // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FP64    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const double *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FC32    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC32_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_FC64    // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC64_t *X,            // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_setElements_UDT     // C(I,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index nvals                 // number of tuples
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
 
 /*
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_setElement          // C (i,j) = x
+GrB_Info GxB_Matrix_setElements         // C(I,J) = X
 (
-    GrB_Matrix C,                       // matrix to modify
-    <type> x,                           // scalar to assign to C(i,j)
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const <type> *X,                // array of values of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 */
 
 #if GxB_STDC_VERSION >= 201112L
-#define GrB_Matrix_setElement(C,x,i,j)                      \
-    _Generic                                                \
-    (                                                       \
-        (x),                                                \
-            GB_CASES (, GrB, Matrix_setElement),            \
-            default : GrB_Matrix_setElement_Scalar          \
-    )                                                       \
-    (C, x, i, j)
+#define GxB_Matrix_setElements(C,I,J,X,nvals)           \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_CASES (*, GxB, Matrix_setElements)       \
+    )                                                   \
+    (C, I, J, X, nvals)
 #endif
 
-//------------------------------------------------------------------------------
-// GrB_Matrix_extractElement
-//------------------------------------------------------------------------------
-
-// Extract a single entry from a matrix, x = A(i,j), typecasting from the type
-// of A to the type of x, as needed.
-
-GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_BOOL     // x = A(i,j)
-(
-    bool *x,                            // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
-) ;
-
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_INT8     // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_BOOL // X = A(I,J)
 (
-    int8_t *x,                          // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    bool *X,                        // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_UINT8    // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_INT8 // X = A(I,J)
 (
-    uint8_t *x,                         // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    int8_t *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_INT16    // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_INT16 // X = A(I,J)
 (
-    int16_t *x,                         // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    int16_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_UINT16   // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_INT32 // X = A(I,J)
 (
-    uint16_t *x,                        // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    int32_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_INT32    // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_INT64 // X = A(I,J)
 (
-    int32_t *x,                         // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    int64_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_UINT32   // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_UINT8 // X = A(I,J)
 (
-    uint32_t *x,                        // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    uint8_t *X,                     // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_INT64    // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_UINT16 // X = A(I,J)
 (
-    int64_t *x,                         // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    uint16_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_UINT64   // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_UINT32 // X = A(I,J)
 (
-    uint64_t *x,                        // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    uint32_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_FP32     // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_UINT64 // X = A(I,J)
 (
-    float *x,                           // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    uint64_t *X,                    // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_FP64     // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_FP32 // X = A(I,J)
 (
-    double *x,                          // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    float *X,                       // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GxB_Matrix_extractElement_FC32     // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_FP64 // X = A(I,J)
 (
-    GxB_FC32_t *x,                      // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    double *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GxB_Matrix_extractElement_FC64     // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_FC32 // X = A(I,J)
 (
-    GxB_FC64_t *x,                      // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    GxB_FC32_t *X,                  // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_UDT      // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_FC64 // X = A(I,J)
 (
-    void *x,                            // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    GxB_FC64_t *X,                  // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement_Scalar   // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements_UDT // X = A(I,J)
 (
-    GrB_Scalar x,                       // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    void *X,                        // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
-// Type-generic version:  x can be a pointer to any supported C type or void *
+// Type-generic version:  X can be a pointer to any supported C type or void *
 // for a user-defined type.
 
 /*
 
 GB_PUBLIC
-GrB_Info GrB_Matrix_extractElement      // x = A(i,j)
+GrB_Info GxB_Matrix_extractElements     // X = A(I,J)
 (
-    <type> *x,                          // extracted scalar
-    const GrB_Matrix A,                 // matrix to extract a scalar from
-    GrB_Index i,                        // row index
-    GrB_Index j                         // column index
+    <type> *X,                      // array of extracted values
+    bool *Found,                    // optional: true if entry present
+    const GrB_Matrix A,             // matrix to extract entries from
+    const GrB_Index *I,             // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    GrB_Index nvals                 // number of tuples
 ) ;
 
 */
 
 #if GxB_STDC_VERSION >= 201112L
-#define GrB_Matrix_extractElement(x,A,i,j)                      \
-    _Generic                                                    \
-    (                                                           \
-        (x),                                                    \
-            GB_CASES (*, GrB, Matrix_extractElement),           \
-            default : GrB_Matrix_extractElement_Scalar          \
-    )                                                           \
-    (x, A, i, j)
+#define GxB_Matrix_extractElements(X,Found,A,I,J,nvals) \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_CASES (*, GxB, Matrix_extractElements)   \
+    )                                                   \
+    (X, Found, A, I, J, nvals)
 #endif
 
 //------------------------------------------------------------------------------
@@ -4386,6 +5200,11 @@ typedef enum            // for global options or matrix options
     GxB_FLUSH = 102,    // flush function diagnostic output
     GxB_MEMORY_POOL = 103,  // memory pool control
     GxB_PRINT_1BASED = 104,   // print matrices as 0-based or 1-based
+    GxB_MEMORY_POOL_MAGAZINE = 105, // per-thread memory pool control
+    GxB_MEMORY_POOL_STATS = 106,    // memory pool hit/miss statistics
+    GxB_HYPER_HASH = 107,   // min # of vectors for a hyperlist hash (int64_t)
+    GxB_CPU_AVX2 = 108,     // use kernels compiled for AVX2 (bool)
+    GxB_CPU_AVX512F = 109,  // use kernels compiled for AVX512F (bool)
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get only:
@@ -4399,6 +5218,8 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 32,      // sparsity control: 0 to 15; see below
+    GxB_CONCURRENT_INGEST = 39,     // concurrent setElement (bool); see below
+    GxB_PUSH_PULL = 40,             // push/pull mxv and vxm (bool); see below
 
     //------------------------------------------------------------
     // GPU and options (DRAFT: do not use)
@@ -4436,6 +5257,31 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // size of b array for GxB_set/get (GxB_BITMAP_SWITCH, b)
 #define GxB_NBITMAP_SWITCH 8    // size of bitmap_switch parameter array
 
+// GxB_MEMORY_POOL: free_pool_limit [k] is the maximum number of free blocks of
+// size 2^k held in the shared memory pool, for all threads.  Lowering the
+// limit frees the blocks beyond it, including those in the magazine of the
+// calling thread.
+//
+// GxB_MEMORY_POOL_MAGAZINE: in front of the shared pool, each thread holds a
+// magazine of up to magazine_limit [k] free blocks of size 2^k, which it can
+// access without synchronizing with other threads.  Blocks are moved between
+// a magazine and the shared pool in batches of about magazine_limit [k]/2.
+// Setting magazine_limit [k] to zero disables the kth magazine, and a negative
+// value selects the default (at most 64 blocks or 64 KB per size class, for
+// sizes 2^3 to 2^16).  Magazines require POSIX threads; if not available,
+// magazine_limit [k] is always zero.
+//
+// GxB_MEMORY_POOL_STATS returns GxB_MEMORY_POOL_NSTATS counts for each size
+// class k, summed over all threads, in an int64_t array of size
+// GxB_MEMORY_POOL_NSTATS*64.  The hit rate for blocks of size 2^k is
+// (stats [k] + stats [64+k]) / (stats [k] + stats [64+k] + stats [128+k]).
+//
+//      stats [k]:      allocations satisfied by the thread's magazine
+//      stats [64+k]:   allocations satisfied by the shared pool
+//      stats [128+k]:  allocations not satisfied by the pool (malloc used)
+//      stats [192+k]:  blocks freed because the shared pool was full
+#define GxB_MEMORY_POOL_NSTATS 4
+
 // any sparsity value:
 #define GxB_ANY_SPARSITY (GxB_HYPERSPARSE + GxB_SPARSE + GxB_BITMAP + GxB_FULL)
 
@@ -4473,6 +5319,32 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // for how A should be stored (hypersparse, sparse, bitmap, or full, or any
 // combination).
 
+// GxB_CONCURRENT_INGEST:
+//      If true, multiple user threads may call GrB_Matrix_setElement or
+//      GrB_Vector_setElement on the same matrix or vector at the same time.
+//      Each thread appends its tuples to its own list of pending tuples, and
+//      the lists are assembled into the matrix by the next GrB_wait, or by
+//      any other method that uses the matrix.  No other method may be called
+//      on the matrix while any thread is calling setElement (including
+//      GrB_*_removeElement and GrB_*_extractElement).  Duplicate entries
+//      added by the same thread are assembled in the order they were added;
+//      the order of duplicates added by different threads is not specified.
+//      The tuples are never assembled by setElement itself, even in blocking
+//      mode.  Setting this option to false assembles all pending tuples.
+//      The default is false.
+
+// GxB_PUSH_PULL:
+//      If true, GrB_mxv and GrB_vxm select between a "push" (saxpy) and a
+//      "pull" (dot product) method each time the matrix is used, from the
+//      number of entries in the input vector and the mask, as in a
+//      direction-optimizing breadth-first search.  The transpose of the
+//      matrix is built the first time it is needed and kept inside the
+//      matrix, so that either direction can be taken without transposing the
+//      matrix again.  The transpose is freed when the matrix is modified, or
+//      when this option is set to false.  The automatic selection is not
+//      done if the descriptor selects a method with GxB_AxB_METHOD.  The
+//      default is false.
+
 // GxB_HYPER_SWITCH:
 //      If the matrix or vector structure can be sparse or hypersparse, the
 //      GxB_HYPER_SWITCH parameter controls when each of these structures are
@@ -4547,6 +5419,24 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
 // global settings via GxB_Global_Option_set has no effect on matrices already
 // created.
 
+// GxB_HYPER_HASH (an int64_t, 1024 by default) controls the hash index of the
+// list of vectors of a hypersparse matrix.  If a hypersparse matrix has at
+// least this many vectors, GraphBLAS builds a hash index of its hyperlist when
+// the matrix is used in an operation that looks up many of its vectors (such
+// as GrB_mxm, GrB_extract, GxB_Matrix_setElements, or GrB_Matrix_wait with
+// GrB_MATERIALIZE), so that each vector can be found in O(1) time instead of
+// by a binary search.  The hash index is kept with the matrix until its
+// hyperlist changes.  Use GxB_set (GxB_HYPER_HASH, INT64_MAX) to disable it.
+
+// GxB_CPU_AVX2 and GxB_CPU_AVX512F (each a bool) control the use of kernels
+// compiled for the AVX2 and AVX512F instruction sets on the x86_64.  These
+// kernels are used for some built-in semirings (PLUS_TIMES on integer and
+// floating-point types), monoids (PLUS, MIN, MAX, and TIMES), and binary
+// operators (the same four), when the matrices are dense.  Each is true by
+// default if the CPU supports the instruction set.  Either can be set false,
+// to select the kernels for the next smaller instruction set.  Setting one to
+// true has no effect if the CPU does not support it.
+
 GB_PUBLIC
 GrB_Info GxB_Global_Option_set      // set a global default option
 (
@@ -4592,6 +5482,14 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_FORMAT, GxB_BY_COL) ;
 //      GxB_get (GxB_FORMAT, GxB_Format_Value *s) ;
 //
+//      GxB_set (GxB_HYPER_HASH, int64_t hyper_hash) ;
+//      GxB_get (GxB_HYPER_HASH, int64_t *hyper_hash) ;
+//
+//      GxB_set (GxB_CPU_AVX2, bool avx2) ;
+//      GxB_get (GxB_CPU_AVX2, bool *avx2) ;
+//      GxB_set (GxB_CPU_AVX512F, bool avx512f) ;
+//      GxB_get (GxB_CPU_AVX512F, bool *avx512f) ;
+//
 //      GxB_set (GxB_NTHREADS, nthreads_max) ;
 //      GxB_get (GxB_NTHREADS, int *nthreads_max) ;
 //
@@ -4611,6 +5509,15 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_MEMORY_POOL, free_pool_limit) ;
 //      GxB_set (GxB_MEMORY_POOL, NULL) ;     // set defaults
 //      GxB_get (GxB_MEMORY_POOL, free_pool_limit) ;
+//
+//      int64_t magazine_limit [64] ;
+//      GxB_set (GxB_MEMORY_POOL_MAGAZINE, magazine_limit) ;
+//      GxB_set (GxB_MEMORY_POOL_MAGAZINE, NULL) ;     // set defaults
+//      GxB_get (GxB_MEMORY_POOL_MAGAZINE, magazine_limit) ;
+//
+//      int64_t pool_stats [GxB_MEMORY_POOL_NSTATS * 64] ;
+//      GxB_get (GxB_MEMORY_POOL_STATS, pool_stats) ;
+//      GxB_set (GxB_MEMORY_POOL_STATS, NULL) ;        // clear the statistics
 
 // To get global options that can be queried but not modified:
 //
@@ -4635,6 +5542,12 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_CONCURRENT_INGEST, bool concurrent) ;
+//      GxB_get (GrB_Matrix A, GxB_CONCURRENT_INGEST, bool *concurrent) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_PUSH_PULL, bool push_pull) ;
+//      GxB_get (GrB_Matrix A, GxB_PUSH_PULL, bool *push_pull) ;
 
 // To set/get a vector option or status:
 //
@@ -4650,6 +5563,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Vector v, GxB_CONCURRENT_INGEST, bool concurrent) ;
+//      GxB_get (GrB_Vector v, GxB_CONCURRENT_INGEST, bool *concurrent) ;
 
 // To set/get a descriptor field:
 //
@@ -4676,6 +5592,7 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GrB_Descriptor d, GxB_AxB_METHOD, GxB_AxB_HASH) ;
 //      GxB_set (GrB_Descriptor d, GxB_AxB_METHOD, GxB_AxB_SAXPY) ;
 //      GxB_set (GrB_Descriptor d, GxB_AxB_METHOD, GxB_AxB_DOT) ;
+//      GxB_set (GrB_Descriptor d, GxB_AxB_METHOD, GxB_AxB_OUTER) ;
 //      GxB_get (GrB_Descriptor d, GrB_AxB_METHOD, GrB_Desc_Value *v) ;
 //
 //      GxB_set (GrB_Descriptor d, GxB_NTHREADS, nthreads) ;
@@ -4692,6 +5609,12 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //
 //      GxB_set (GrB_Descriptor d, GxB_IMPORT, int method) ;
 //      GxB_get (GrB_Descriptor d, GxB_IMPORT, int *method) ;
+//
+//      GxB_set (GrB_Descriptor d, GxB_ARENA, GxB_Arena arena) ;
+//      GxB_get (GrB_Descriptor d, GxB_ARENA, GxB_Arena *arena) ;
+//
+//      GxB_set (GrB_Descriptor d, GxB_MXM_PLAN, GxB_MxM_Plan plan) ;
+//      GxB_get (GrB_Descriptor d, GxB_MXM_PLAN, GxB_MxM_Plan *plan) ;
 
 #if GxB_STDC_VERSION >= 201112L
 #define GxB_set(arg1,...)                                       \
@@ -4747,7 +5670,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             GrB_Scalar       *: GrB_Scalar_free       , \
             GrB_Vector       *: GrB_Vector_free       , \
             GrB_Matrix       *: GrB_Matrix_free       , \
-            GrB_Descriptor   *: GrB_Descriptor_free     \
+            GrB_Descriptor   *: GrB_Descriptor_free   , \
+            GxB_Arena        *: GxB_Arena_free        , \
+            GxB_MxM_Plan     *: GxB_MxM_Plan_free       \
     )                                                   \
     (object)
 #endif
@@ -11399,17 +12324,23 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
     free (blob) ;
 */
 
-// Three methods are currently implemented: no compression, LZ4, and LZ4HC
+// Four methods are currently implemented: no compression, LZ4, LZ4HC, and ZSTD
 #define GxB_COMPRESSION_NONE -1     // no compression
 #define GxB_COMPRESSION_DEFAULT 0   // LZ4
 #define GxB_COMPRESSION_LZ4   1000  // LZ4
 #define GxB_COMPRESSION_LZ4HC 2000  // LZ4HC, with default level 9
+#define GxB_COMPRESSION_ZSTD  6000  // ZSTD, with default level 1
 
 // possible future methods that could be added:
 // #define GxB_COMPRESSION_ZLIB  3000  // ZLIB, with default level 6
 // #define GxB_COMPRESSION_LZO   4000  // LZO, with default level 2
 // #define GxB_COMPRESSION_BZIP2 5000  // BZIP2, with default level 9
-// #define GxB_COMPRESSION_LZSS  6000  // LZSS
+
+// shuffle the bytes of each block before compressing it
+#define GxB_COMPRESSION_SHUFFLE  100000
+
+// delta and varint encoding of the integer arrays before compressing them
+#define GxB_COMPRESSION_DELTA    200000
 
 // using the Intel IPP versions, if available (not yet supported);
 #define GxB_COMPRESSION_INTEL   1000000
@@ -11420,17 +12351,39 @@ GrB_Info GrB_Matrix_exportHint  // suggest the best export format
 
 //  LZ4     no level setting
 //  LZ4HC   1: fast, 9: default, 9: max
+//  ZSTD    1: fast, 1: default, 19: max
 
 //  these methos are not yet supported but may be added in the future:
 //  ZLIB    1: fast, 6: default, 9: max
 //  LZO     1: fast (X1ST), 2: default (XST)
 //  BZIP2   1: fast, 9: default, 9: max
-//  LZSS    no level setting
 
 // For all methods, a level of zero results in the default level setting.
 // These settings can be added, so to use LZ4HC at level 5, use method =
 // GxB_COMPRESSION_LZ4HC + 5.
 
+// Adding GxB_COMPRESSION_SHUFFLE to any method shuffles the bytes of each
+// block before it is compressed: the first byte of every entry is placed
+// first, then the second byte of every entry, and so on.  This places the
+// high-order bytes of the integer indices and pointers (which are nearly
+// always zero) together, which can greatly improve the compression of the
+// pattern of a matrix.  It may also help for the values of a matrix.  For
+// example, use GxB_COMPRESSION_SHUFFLE + GxB_COMPRESSION_ZSTD + 3 for ZSTD at
+// level 3 on the shuffled bytes.  The shuffle setting is recorded in the
+// serialized matrix, so it is not needed when the matrix is deserialized.
+
+// Adding GxB_COMPRESSION_DELTA to any method encodes the integer arrays of a
+// sparse or hypersparse matrix (its pointers, hyperlist, and row or column
+// indices) before they are compressed.  Each block of these arrays is held as
+// the differences between adjacent entries, in a variable-length code of 1 to
+// 10 bytes each.  The sorted indices of a sparse matrix typically differ by a
+// small amount, so most entries take just one or two bytes, before the block
+// is compressed with the selected method.  The values of the matrix are not
+// delta-encoded, and GxB_COMPRESSION_SHUFFLE, if also present, applies only
+// to the values.  For example, GxB_COMPRESSION_DELTA + GxB_COMPRESSION_SHUFFLE
+// + GxB_COMPRESSION_ZSTD delta-encodes the pattern and shuffles the values,
+// and compresses both with ZSTD.
+
 // If the Intel IPPS compression methods are available, they can be selected
 // by adding GxB_COMPRESSION_INTEL.  For example, to use the Intel IPPS
 // implementation of LZ4HC at level 9, use method = GxB_COMPRESSION_INTEL +
@@ -11559,6 +12512,159 @@ GrB_Info GxB_deserialize_type_name  // return the type name of a blob
     GrB_Index blob_size     // size of the blob
 ) ;
 
+//------------------------------------------------------------------------------
+// streaming serialize/deserialize
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_serialize_stream is like GxB_Matrix_serialize, except that the
+// serialized matrix is not held in a single blob in memory.  Instead, it is
+// compressed in parallel, in blocks of at most 1MB each, and each compressed
+// block is passed to the user's write_function as soon as it is ready.  At
+// most two sets of nthreads compressed blocks are held in workspace at any one
+// time, so a very large matrix can be serialized to a file, pipe, or socket
+// without first allocating a blob as large as the matrix itself.  Arrays that
+// are not compressed (GxB_COMPRESSION_NONE) are written directly from the
+// matrix with no workspace.  GxB_Matrix_deserialize_stream reads the stream
+// back with the user's read_function, and decompresses each block directly
+// into the new matrix.  Only the bytes of the serialized matrix are read, so a
+// single stream may hold other data, or many serialized matrices, one after
+// the other.
+
+// The write_function is called with (stream, buffer, size), and must write all
+// size bytes of the buffer to the stream; the read_function must read exactly
+// size bytes from the stream into the buffer.  Both functions return true if
+// successful, or false if the write or read failed.  The functions are called
+// by only one thread at a time, and in order.  The stream parameter is not
+// accessed by GraphBLAS; it is passed to each call of the write_function or
+// read_function.  If the write_function fails, GxB_Matrix_serialize_stream
+// returns GrB_INVALID_VALUE.  If the read_function fails, or if the stream is
+// invalid, GxB_Matrix_deserialize_stream returns GrB_INVALID_OBJECT.
+
+// The format of a stream differs from that of a blob.  A stream cannot be
+// deserialized with GxB_Matrix_deserialize, and a blob cannot be deserialized
+// with GxB_Matrix_deserialize_stream.
+
+// GxB_Matrix_serialize_fd and GxB_Matrix_deserialize_fd are the same as the
+// stream methods, except that they write to and read from a POSIX file
+// descriptor.  Example usage:
+
+/*
+    int fd = open ("A.grb", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GxB_Matrix_serialize_fd (fd, A, NULL) ;
+    close (fd) ;
+    fd = open ("A.grb", O_RDONLY) ;
+    GxB_Matrix_deserialize_fd (&B, atype, fd, NULL) ;
+    close (fd) ;
+*/
+
+typedef bool (*GxB_stream_write_function)
+(
+    void *stream,           // the user's stream
+    const void *buffer,     // write buffer [0..size-1] to the stream
+    size_t size
+) ;
+
+typedef bool (*GxB_stream_read_function)
+(
+    void *stream,           // the user's stream
+    void *buffer,           // read buffer [0..size-1] from the stream
+    size_t size
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // input:
+    GxB_stream_write_function write_function,   // writes to the stream
+    void *stream,                   // stream to write to
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize stream into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function read_function,     // reads from the stream
+    void *stream,                   // stream to read from
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize_fd    // serialize a GrB_Matrix to a file
+(
+    // input:
+    int fd,                         // file descriptor to write to
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_deserialize_fd  // deserialize a GrB_Matrix from a file
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the file
+    // input:
+    GrB_Type type,      // type of the matrix C (see GxB_Matrix_deserialize)
+    int fd,                         // file descriptor to read from
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+// GxB_Matrix_serialize_mmap writes a matrix to a file in an uncompressed
+// format whose arrays are each aligned to a 4096-byte page.  GxB_Matrix_mmap
+// maps such a file into memory with mmap, and creates a matrix whose arrays
+// point directly into the mapped file, in O(1) time with no copying.  Pages of
+// the file are read from disk only when they are first accessed, and the same
+// file mapped by many processes shares a single copy in the OS page cache.
+
+// A matrix created by GxB_Matrix_mmap is read-only.  It may be used as an
+// input to any GraphBLAS method, but it may not be used as an output, or
+// modified by GrB_*_setElement, GrB_*_removeElement, or GrB_Matrix_clear.  It
+// cannot be exported or unpacked.  Use GrB_Matrix_dup to create a copy that
+// can be modified.  The mapping is released by GrB_Matrix_free.  The file
+// descriptor may be closed once GxB_Matrix_mmap returns.  The file must not
+// be modified or truncated while the matrix exists.  These methods are not
+// available on Windows (GrB_NOT_IMPLEMENTED is returned).  Example usage:
+
+/*
+    int fd = open ("A.grb", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GxB_Matrix_serialize_mmap (fd, A, NULL) ;
+    close (fd) ;
+    fd = open ("A.grb", O_RDONLY) ;
+    GxB_Matrix_mmap (&B, atype, fd, NULL) ;
+    close (fd) ;
+    GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, B, B, NULL) ;
+    GrB_Matrix_free (&B) ;
+*/
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize_mmap  // write a GrB_Matrix to a file for mmap
+(
+    // input:
+    int fd,                         // file descriptor to write to
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // to control # of threads used
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_mmap            // create a matrix from a mapped file
+(
+    // output:
+    GrB_Matrix *C,      // read-only matrix mapped from the file
+    // input:
+    GrB_Type type,      // type of the matrix C (see GxB_Matrix_deserialize)
+    int fd,                         // file descriptor to map
+    const GrB_Descriptor desc       // not used
+) ;
+
 //==============================================================================
 // GxB_Vector_sort and GxB_Matrix_sort: sort a matrix or vector
 //==============================================================================
@@ -23,12 +23,17 @@
 #define GB_FREE_ALL                 \
 {                                   \
     GB_FREE_WORKSPACE ;             \
-    GB_phbix_free (C) ;             \
+    if (C != A) GB_phbix_free (C) ; \
 }
 
+// A can be sparse, hypersparse, bitmap, or full, and C has the same sparsity
+// structure as A.  If C and A are the same matrix, then C=A*D is computed
+// in-place, with no mask or accum.  The type of C must then be the same as
+// the ztype of the multiplicative operator.
+
 GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or A
     const GrB_Matrix A,             // input matrix
     const GrB_Matrix D,             // diagonal input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*D
@@ -42,7 +47,7 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    ASSERT (C != NULL && C->static_header) ;
+    ASSERT (C != NULL && (C->static_header || C == A)) ;
     ASSERT_MATRIX_OK (A, "A for colscale A*D", GB0) ;
     ASSERT_MATRIX_OK (D, "D for colscale A*D", GB0) ;
     ASSERT (!GB_ZOMBIES (A)) ;
@@ -55,12 +60,13 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
     ASSERT (A->vdim == D->vlen) ;
     ASSERT (GB_is_diagonal (D, Context)) ;
 
-    ASSERT (!GB_IS_BITMAP (A)) ;        // TODO: ok for now
+    ASSERT (C != D) ;
     ASSERT (!GB_IS_BITMAP (D)) ;
     ASSERT (!GB_IS_FULL (D)) ;
     GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+    const bool C_in_place = (C == A) ;
 
-    GBURBLE ("(%s=%s*%s) ",
+    GBURBLE ("(%s%s=%s*%s) ", C_in_place ? "in-place: " : "",
         GB_sparsity_char_matrix (A),    // C has the sparsity structure of A
         GB_sparsity_char_matrix (A),
         GB_sparsity_char_matrix (D)) ;
@@ -86,12 +92,32 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
     bool C_iso = GB_iso_AxB (cscalar, A, D, A->vdim, semiring, flipxy, true) ;
 
     //--------------------------------------------------------------------------
-    // copy the pattern of A into C
+    // copy the pattern of A into C, or use A itself if done in-place
     //--------------------------------------------------------------------------
 
-    // allocate C->x but do not initialize it
-    // set C->iso = C_iso   OK
-    GB_OK (GB_dup_worker (&C, C_iso, A, false, ztype, Context)) ;
+    if (C_in_place)
+    {
+        // C and A are the same matrix, so the pattern of C is already
+        // computed.  The values of C overwrite the values of A.
+        ASSERT (C->type == ztype) ;
+        if (C_iso)
+        { 
+            // C is iso on output; replace A->x with the single scalar
+            GB_OK (GB_convert_any_to_iso (C, cscalar, Context)) ;
+        }
+        else if (C->iso)
+        { 
+            // expand A->x; not initialized if the operator is positional
+            GB_OK (GB_convert_any_to_non_iso (C,
+                !GB_OPCODE_IS_POSITIONAL (opcode), Context)) ;
+        }
+    }
+    else
+    { 
+        // allocate C->x but do not initialize it
+        // set C->iso = C_iso   OK
+        GB_OK (GB_dup_worker (&C, C_iso, A, false, ztype, Context)) ;
+    }
     GB_void *restrict Cx = (GB_void *) C->x ;
 
     //--------------------------------------------------------------------------
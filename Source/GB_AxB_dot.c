@@ -30,7 +30,9 @@
 
 // If the result is computed in-place, then the C parameter is ignored, and the
 // result is computed in C_in instead.  This case requires the accum operator
-// to match the monoid of the semiring.
+// to match the monoid of the semiring.  GB_AxB_dot4 computes C+=A'*B in-place
+// when C is as-if-full, for built-in semirings.  Otherwise, if C is bitmap or
+// as-if-full, GB_AxB_dot2 computes C+=A'*B in-place.
 
 // The semiring defines C=A*B.  flipxy modifies how the semiring multiply
 // operator is applied.  If false, then fmult(aik,bkj) is computed.  If true,
@@ -156,7 +158,12 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
     { 
         // no work to do; C is an empty matrix, normally hypersparse
         GBURBLE ("(empty dot) ") ;
-        if (C_in != NULL) return (GrB_SUCCESS) ;
+        if (C_in != NULL)
+        { 
+            // C_in += A'*B where A'*B is empty: C_in is unchanged
+            (*done_in_place) = true ;
+            return (GrB_SUCCESS) ;
+        }
         return (GB_new (&C, true, // auto sparsity, static header
             ztype, A->vdim, B->vdim, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
             GB_Global_hyper_switch_get ( ), 1, Context)) ;
@@ -199,14 +206,29 @@ GrB_Info GB_AxB_dot                 // dot product (multiple methods)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // in-place C+=A'*B via dot2, if dot4 cannot be used
+    //--------------------------------------------------------------------------
+
+    if (GB_AxB_dot2_in_place_control (C_iso, C_in, M, accum, semiring, A, B))
+    { 
+        // C_in is bitmap or as-if-full, the accum operator matches the monoid
+        // (not ANY), no mask is present, and A and B are not hypersparse.
+        (*mask_applied) = false ;    // no mask to apply
+        info = GB_AxB_dot2 (C_in, true, false, NULL, NULL, false, false,
+            false, A, B, semiring, flipxy, Context) ;
+        (*done_in_place) = (info == GrB_SUCCESS) ;
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // general case: C<M>=A'*B, C<!M>=A'B*, or C=A'*B, not in-place
     //--------------------------------------------------------------------------
 
     GBURBLE ("(%sdot2) ", iso_kind) ;
     (*mask_applied) = (M != NULL) ; // mask applied if present
-    (*done_in_place) = false ;      // TODO: allow dot2 to work in-place
-    return (GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
+    (*done_in_place) = false ;
+    return (GB_AxB_dot2 (C, false, C_iso, cscalar, M, Mask_comp, Mask_struct,
         false, A, B, semiring, flipxy, Context)) ;
 }
 
@@ -15,6 +15,14 @@
 // bitmap or full, and the dot product method accesses A with a different
 // stride than when computing C=A'*B.
 
+// If C_in_place is true, then C is the user's input matrix, which is bitmap or
+// as-if-full, and C+=A'*B (or C+=A*B) is computed in-place.  The accum
+// operator is the same as the monoid of the semiring (which cannot be ANY),
+// and the type of C matches the monoid type.  No mask is present, C is not
+// iso on output, and A and B are not hypersparse.  If C is full on input, it
+// is converted to bitmap with all entries present; GB_conform converts it
+// back to full when done.
+
 // TODO:  this is slower than it could be if A and B are both bitmap/full, when
 // A->vlen is large.  This is because the inner loop is a simple full/bitmap
 // dot product, across the entire input vectors.  No tiling is used, so cache
@@ -41,7 +49,8 @@
 GB_PUBLIC
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or C_in
+    const bool C_in_place,          // if true, C+=A'*B is done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<!M>=A'*B, may be NULL
@@ -62,7 +71,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     GrB_Info info ;
 
-    ASSERT (C != NULL && C->static_header) ;
+    ASSERT (C != NULL && (C->static_header || C_in_place)) ;
     ASSERT_MATRIX_OK_OR_NULL (M_in, "M for dot A'*B", GB0) ;
     ASSERT_MATRIX_OK (A_in, "A for dot A'*B", GB0) ;
     ASSERT_MATRIX_OK (B_in, "B for dot A'*B", GB0) ;
@@ -78,6 +87,11 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     ASSERT (!GB_PENDING (B_in)) ;
 
     ASSERT_SEMIRING_OK (semiring, "semiring for numeric A'*B", GB0) ;
+    ASSERT (GB_IMPLIES (C_in_place, M_in == NULL && !C_iso
+        && !GB_IS_HYPERSPARSE (A_in) && !GB_IS_HYPERSPARSE (B_in)
+        && (GB_IS_BITMAP (C) || GB_as_if_full (C))
+        && C->type == semiring->add->op->ztype
+        && semiring->add->op->opcode != GB_ANY_binop_code)) ;
 
     GrB_Matrix M = NULL ;
 
@@ -270,14 +284,16 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     // allocate C
     //--------------------------------------------------------------------------
 
-    // if M is sparse/hyper, then calloc C->b; otherwise use malloc
+    // if M is not present, or sparse/hyper, then calloc C->b; otherwise use
+    // malloc, since the dot2 method clears each entry of Cb when M is bitmap
+    // or full
     bool M_is_sparse_or_hyper = (M != NULL) &&
         (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
     GrB_Type ctype = add->op->ztype ;
 
     // determine the sparsity of C
     int C_sparsity = GxB_BITMAP ;
-    if (M == NULL)
+    if (M == NULL && !C_in_place)
     {
         // no mask is present so C can be bitmap or full
         if (A_is_full && B_is_full)
@@ -310,7 +326,15 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
         }
     }
 
-    if (M_in == NULL)
+    if (C_in_place)
+    { 
+        GBURBLE ("(dot2 in-place: %s += %s%s*%s) ",
+            GB_sparsity_char_matrix (C),
+            GB_sparsity_char_matrix (A_in),
+            A_not_transposed ? "" : "'",
+            GB_sparsity_char_matrix (B_in)) ;
+    }
+    else if (M_in == NULL)
     { 
         GBURBLE ("(dot %s = %s%s*%s) ",
             GB_sparsity_char (C_sparsity),
@@ -331,11 +355,25 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
             GB_sparsity_char_matrix (B_in)) ;
     }
 
-    // set C->iso = C_iso
-    GB_OK (GB_new_bix (&C, true, // bitmap/ful, static header
-        ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
-        M_is_sparse_or_hyper, B->hyper_switch, cnvec, cnz, true, C_iso,
-        Context)) ;
+    if (C_in_place)
+    { 
+        // C is the user's input matrix: convert it to non-iso and bitmap.  If
+        // C is as-if-full, all entries of the bitmap are present.
+        ASSERT (C->vlen == cvlen && C->vdim == cvdim) ;
+        if (C->iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (C, true, Context)) ;
+        }
+        GB_OK (GB_convert_any_to_bitmap (C, Context)) ;
+    }
+    else
+    { 
+        // set C->iso = C_iso
+        GB_OK (GB_new_bix (&C, true, // bitmap/ful, static header
+            ctype, cvlen, cvdim, GB_Ap_malloc, true, C_sparsity,
+            (C_sparsity == GxB_BITMAP) && (M == NULL || M_is_sparse_or_hyper),
+            B->hyper_switch, cnvec, cnz, true, C_iso, Context)) ;
+    }
 
     //--------------------------------------------------------------------------
     // if M is sparse/hyper, scatter it into the C bitmap
@@ -210,6 +210,19 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     GB_OK (GB_AxB_dot3_one_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
         M, Context)) ;
 
+    //--------------------------------------------------------------------------
+    // build the hash indices of A->h and B->h, if needed
+    //--------------------------------------------------------------------------
+
+    // Each entry M(i,j) requires a search for A(:,i) in the hyperlist of A, in
+    // no particular order, and each vector C(:,j) requires a search for B(:,j)
+    // in the hyperlist of B.  Both searches take O(1) time with a hash index.
+
+    GB_hyper_hash_build (A, Context) ;
+    GB_hyper_hash_build (B, Context) ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
+    const GB_Hyper_hash B_hyper_hash = GB_hyper_hash_get (B) ;
+
     //--------------------------------------------------------------------------
     // phase1: estimate the work to compute each entry in C
     //--------------------------------------------------------------------------
@@ -242,7 +255,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
     GB_FREE_WORK (&TaskList, TaskList_size) ;
     GB_OK (GB_AxB_dot3_slice (&TaskList, &TaskList_size, &ntasks, &nthreads,
-        C, Context)) ;
+        C, M, A, B, Context)) ;
 
     GBURBLE ("nthreads %d ntasks %d ", nthreads, ntasks) ;
 
@@ -259,7 +272,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
         memcpy (C->x, cscalar, ctype->size) ;
         GB_OK (GB (_Adot3B__any_pair_iso) (C, M, Mask_struct, A, B,
-            TaskList, ntasks, nthreads)) ;
+            TaskList, ntasks, nthreads, Context)) ;
 
     }
     else
@@ -283,7 +296,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
             #define GB_AxB_WORKER(add,mult,xname)                           \
             {                                                               \
                 info = GB_Adot3B (add,mult,xname) (C, M, Mask_struct, A, B, \
-                    TaskList, ntasks, nthreads) ;                           \
+                    TaskList, ntasks, nthreads, Context) ;                  \
                 done = (info != GrB_NO_VALUE) ;                             \
             }                                                               \
             break ;
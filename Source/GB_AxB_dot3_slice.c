@@ -19,12 +19,22 @@
 // is costly to compute, it is possible that it is placed by itself in a
 // single coarse task.
 
-// FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
-// of a single entry C(i,j) can be broken into multiple tasks.  The slice of
-// A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
+// If A and B are both sparse or hypersparse, a single costly entry C(i,j) is
+// not placed in a coarse task.  Instead, the computation of the dot product
+// C(i,j) = A(:,i)'*B(:,j) is broken into multiple ultra-fine tasks.  The
+// slices of A(:,i) and B(:,j) for each task are found with GB_slice_vector,
+// where no mask is used.  Each ultra-fine task computes its partial dot
+// product A(i1:i2,i)'*B(i1:i2,j) in workspace, and the partial results are
+// summed into C(i,j) with the monoid when all tasks are done (see
+// GB_AxB_dot3_template.c).  An ultra-fine task has klast == -1, and computes C(i,j) for the
+// single entry Ci,Cx [pC], in the vector C(:,kfirst).  The slices are
+// Ai,Ax [pA:pA_end-1] and Bi,Bx [pB:pB_end-1].  All ultra-fine tasks for the
+// same entry C(i,j) appear consecutively in the TaskList, after all the
+// coarse tasks.
 
 #define GB_FREE_WORKSPACE                       \
 {                                               \
+    GB_WERK_POP (Heavy, int64_t) ;              \
     GB_WERK_POP (Coarse, int64_t) ;             \
 }
 
@@ -50,6 +60,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, with the same pattern as C
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
     GB_Context Context
 )
 {
@@ -90,6 +103,8 @@ GrB_Info GB_AxB_dot3_slice
     const int64_t cnvec = C->nvec ;
     const int64_t cvlen = C->vlen ;
     const int64_t cnz = GB_nnz_held (C) ;
+    const int64_t *restrict Ch = C->h ;
+    const int64_t *restrict Mi = M->i ;
 
     //--------------------------------------------------------------------------
     // compute the cumulative sum of the work
@@ -106,6 +121,7 @@ GrB_Info GB_AxB_dot3_slice
     //--------------------------------------------------------------------------
 
     GB_WERK_DECLARE (Coarse, int64_t) ;
+    GB_WERK_DECLARE (Heavy, int64_t) ;
     int ntasks1 = 0 ;
     nthreads = GB_nthreads (total_work, chunk, nthreads_max) ;
     GB_task_struct *restrict TaskList = NULL ; size_t TaskList_size = 0 ;
@@ -156,9 +172,47 @@ GrB_Info GB_AxB_dot3_slice
     GB_pslice (Coarse, Cwork, cnz, ntasks1, false) ;
 
     //--------------------------------------------------------------------------
-    // construct all tasks, both coarse and fine
+    // find the entries C(i,j) that are costly to compute
     //--------------------------------------------------------------------------
 
+    // An entry C(i,j) with more work than target_task_size spans at least one
+    // boundary of the coarse tasks, so it is either Ci [Coarse [t]-1] or
+    // Ci [Coarse [t]], for some t.  These costly dot products are split into
+    // ultra-fine tasks, but only if A and B are both sparse or hypersparse.
+
+    bool A_is_sparse_or_hyper = GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A) ;
+    bool B_is_sparse_or_hyper = GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B) ;
+    int nheavy = 0 ;
+    if (A_is_sparse_or_hyper && B_is_sparse_or_hyper)
+    {
+        GB_WERK_PUSH (Heavy, 2 * ntasks1 + 2, int64_t) ;
+        if (Heavy == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        for (int t = 0 ; t <= ntasks1 ; t++)
+        {
+            for (int64_t p = Coarse [t] - 1 ; p <= Coarse [t] ; p++)
+            {
+                if (p < 0 || p >= cnz) continue ;
+                if (nheavy > 0 && Heavy [nheavy-1] >= p) continue ;
+                if (Cwork [p+1] - Cwork [p] > target_task_size)
+                { 
+                    // C(i,j) is costly; keep the list sorted and unique
+                    Heavy [nheavy++] = p ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the coarse tasks
+    //--------------------------------------------------------------------------
+
+    int h = 0 ;     // next costly entry, Ci [Heavy [h]]
+
     for (int t = 0 ; t < ntasks1 ; t++)
     {
 
@@ -169,43 +223,145 @@ GrB_Info GB_AxB_dot3_slice
         int64_t pfirst = Coarse [t] ;
         int64_t plast  = Coarse [t+1] - 1 ;
 
-        if (pfirst <= plast)
-        { 
-            // find the first vector of the slice for task taskid: the
-            // vector that owns the entry Ci [pfirst] and Cx [pfirst].
-            int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec,
-                cvlen) ;
-
-            // find the last vector of the slice for task taskid: the
-            // vector that owns the entry Ci [plast] and Cx [plast].
-            int64_t klast = GB_search_for_vector (plast, Cp, kfirst, cnvec,
-                cvlen) ;
-
-            // construct a coarse task that computes Ci,Cx [pfirst:plast].
-            // These entries appear in C(:,kfirst:klast), but this task does
-            // not compute all of C(:,kfirst), but just the subset starting at
-            // Ci,Cx [pstart].  The task computes all of the vectors
-            // C(:,kfirst+1:klast-1).  The task computes only part of the last
-            // vector, ending at Ci,Cx [pC_end-1] or Ci,Cx [plast].  This
-            // slice strategy is the same as GB_ek_slice.
-
-            GB_REALLOC_TASK_WORK (TaskList, ntasks + 1, max_ntasks) ;
-            TaskList [ntasks].kfirst = kfirst ;
-            TaskList [ntasks].klast  = klast ;
-            ASSERT (kfirst <= klast) ;
-            TaskList [ntasks].pC     = pfirst ;
-            TaskList [ntasks].pC_end = plast + 1 ;
-            ntasks++ ;
-
+        while (pfirst <= plast)
+        {
+            // exclude the next costly entry from this coarse task, if any
+            int64_t pend = plast ;
+            while (h < nheavy && Heavy [h] < pfirst) h++ ;
+            if (h < nheavy && Heavy [h] <= plast)
+            { 
+                pend = Heavy [h] - 1 ;
+            }
+
+            if (pfirst <= pend)
+            { 
+                // find the first vector of the slice for task taskid: the
+                // vector that owns the entry Ci [pfirst] and Cx [pfirst].
+                int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec,
+                    cvlen) ;
+
+                // find the last vector of the slice for task taskid: the
+                // vector that owns the entry Ci [pend] and Cx [pend].
+                int64_t klast = GB_search_for_vector (pend, Cp, kfirst, cnvec,
+                    cvlen) ;
+
+                // construct a coarse task that computes Ci,Cx [pfirst:pend].
+                // These entries appear in C(:,kfirst:klast), but this task
+                // does not compute all of C(:,kfirst), but just the subset
+                // starting at Ci,Cx [pstart].  The task computes all of the
+                // vectors C(:,kfirst+1:klast-1).  The task computes only part
+                // of the last vector, ending at Ci,Cx [pC_end-1] or
+                // Ci,Cx [pend].  This slice strategy is the same as
+                // GB_ek_slice.
+
+                GB_REALLOC_TASK_WORK (TaskList, ntasks + 1, max_ntasks) ;
+                TaskList [ntasks].kfirst = kfirst ;
+                TaskList [ntasks].klast  = klast ;
+                ASSERT (kfirst <= klast) ;
+                TaskList [ntasks].pC     = pfirst ;
+                TaskList [ntasks].pC_end = pend + 1 ;
+                ntasks++ ;
+            }
+
+            // skip the costly entry, if any; it is done by ultra-fine tasks
+            pfirst = pend + 2 ;
         }
-        else
-        { 
-            // This task is empty, which means the coarse task that computes
-            // C(i,j) is doing too much work.
-            // FUTURE:: Use ultra-fine tasks here instead, and split the work
-            // for computing the single dot product C(i,j) amongst several
-            // ultra-fine tasks.
-            ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the ultra-fine tasks
+    //--------------------------------------------------------------------------
+
+    if (nheavy > 0)
+    {
+        GBURBLE ("(%d ultra-fine dot products) ", nheavy) ;
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ah = A->h ;
+        const int64_t *restrict Ai = A->i ;
+        const int64_t anvec = A->nvec ;
+        const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+        const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
+
+        const int64_t *restrict Bp = B->p ;
+        const int64_t *restrict Bh = B->h ;
+        const int64_t *restrict Bi = B->i ;
+        const int64_t bnvec = B->nvec ;
+        const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+        const GB_Hyper_hash B_hyper_hash = GB_hyper_hash_get (B) ;
+
+        const int64_t vlen = A->vlen ;
+
+        for (h = 0 ; h < nheavy ; h++)
+        {
+
+            //------------------------------------------------------------------
+            // get C(i,j), A(:,i), and B(:,j)
+            //------------------------------------------------------------------
+
+            int64_t pC = Heavy [h] ;
+            int64_t k = GB_search_for_vector (pC, Cp, 0, cnvec, cvlen) ;
+            int64_t i = Mi [pC] ;
+            int64_t j = GBH (Ch, k) ;
+            int64_t pleft = 0 ;
+            int64_t pA_start, pA_end, pB_start, pB_end ;
+            GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, vlen, A_hyper_hash,
+                &pleft, anvec-1, i, &pA_start, &pA_end) ;
+            pleft = 0 ;
+            GB_hyper_hash_lookup (B_is_hyper, Bh, Bp, vlen, B_hyper_hash,
+                &pleft, bnvec-1, j, &pB_start, &pB_end) ;
+            int64_t ainz = pA_end - pA_start ;
+            int64_t bjnz = pB_end - pB_start ;
+            if (ainz <= 0 || bjnz <= 0)
+            { 
+                // C(i,j) is a zombie; a single empty task is enough
+                pA_start = pA_end = pB_start = pB_end = 0 ;
+                ainz = bjnz = 0 ;
+            }
+
+            //------------------------------------------------------------------
+            // split the dot product A(:,i)'*B(:,j) into ultra-fine tasks
+            //------------------------------------------------------------------
+
+            double work = (double) (Cwork [pC+1] - Cwork [pC]) ;
+            int64_t nfine = (int64_t) ceil (work / target_task_size) ;
+            nfine = GB_IMIN (nfine, ainz + bjnz) ;
+            nfine = GB_IMAX (nfine, 1) ;
+            double ckwork = (double) (ainz + bjnz) ;
+
+            GB_REALLOC_TASK_WORK (TaskList, ntasks + nfine, max_ntasks) ;
+            int64_t pA = pA_start ;
+            int64_t pB = pB_start ;
+            for (int64_t fid = 0 ; fid < nfine ; fid++)
+            {
+                // this task starts at A(i1,i) and B(i1,j)
+                TaskList [ntasks].kfirst = k ;
+                TaskList [ntasks].klast  = -1 ;
+                TaskList [ntasks].pC     = pC ;
+                TaskList [ntasks].pC_end = pC + 1 ;
+                TaskList [ntasks].pA     = pA ;
+                TaskList [ntasks].pB     = pB ;
+                if (fid < nfine - 1)
+                { 
+                    // find where the next task starts, at A(i2+1,i) and
+                    // B(i2+1,j), so that the remaining work is target_work
+                    double target_work = ((nfine-fid-1) * ckwork) / nfine ;
+                    GB_slice_vector (NULL, NULL, &pA, &pB,
+                        0, 0, NULL,
+                        pA_start, pA_end, Ai,
+                        pB_start, pB_end, Bi,
+                        vlen, target_work) ;
+                }
+                else
+                { 
+                    // the last task ends at the end of A(:,i) and B(:,j)
+                    pA = pA_end ;
+                    pB = pB_end ;
+                }
+                // this task ends at A(i2,i) and B(i2,j)
+                TaskList [ntasks].pA_end = pA ;
+                TaskList [ntasks].pB_end = pB ;
+                ntasks++ ;
+            }
         }
     }
 
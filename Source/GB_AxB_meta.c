@@ -18,9 +18,7 @@
 // matrix C passed in from the user (C_in).
 
 // The method is chosen automatically:  a gather/scatter saxpy method
-// (Gustavson), or a dot product method.
-
-// FUTURE:: an outer-product method for C=A*B'
+// (Gustavson), a dot product method, or for C=A*B', an outer-product method.
 
 #define GB_FREE_ALL             \
 {                               \
@@ -147,50 +145,33 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // If C is bitmap:
     //
     //      C can be computed in-place if its type is the same as the semiring
-    //      monoid.  The accum must not be present, or if present it must match
-    //      the semiring monoid.  C_replace can be true or false.
-    //
-    //      TODO: modify GB_AxB_dot2 so it can compute C in-place,
-    //      or add a bitmap dot product method.  Also modify GB_AxB_saxpy
-    //      so it can compute a C bitmap in-place.
+    //      monoid, and the accum is present and matches the semiring monoid.
+    //      C_replace must be false, or effectively false.  C is computed
+    //      in-place by GB_AxB_dot2 (C+=A'*B with no mask) or by
+    //      GB_bitmap_AxB_saxpy (C<#M>+=A*B).  A full C can also be computed
+    //      in-place by these two methods, by converting it to bitmap.
     //
     // In both cases, C must not be transposed, nor can it be aliased with any
     // input matrix.
 
     bool can_do_in_place = false ;
 
-    if (C_in != NULL)
-    {
-        #if 0
-        // disabled: this will work for most methods in the future is too
-        // aggressive for dot4
-        if (GB_IS_BITMAP (C_in))
-        {
-            // C is bitmap
-            ASSERT (!GB_PENDING (C_in)) ; // no pending tuples in bitmap
-            ASSERT (!GB_ZOMBIES (C_in)) ; // bitmap never has zombies
-            can_do_in_place = (C_in->type == semiring->add->op->ztype)
-                && ((accum == NULL) || (accum == semiring->add->op)) ;
-        }
-        else
-        #endif
-        if (accum != NULL)
-        { 
-            // C is hypersparse, sparse, or full, and accum is present.
-            // check if C_in is competely dense:  no pending work.
-            bool C_is_dense = GB_as_if_full (C_in) ;
-
-            // accum must be present, and must match the monoid of the
-            // semiring, and the ztype of the monoid must match the type of C
-            bool accum_is_monoid = (accum == semiring->add->op) 
-                && (C_in->type == accum->ztype) ;
-
-            // C += A*B with C_replace ignored (effectively false)
-            // C<M> += A*B with C_replace false
-            // C<!M> += A*B with C_replace false
-            can_do_in_place = C_is_dense && accum_is_monoid
-                && ((M_in == NULL) || (M_in != NULL && !C_replace)) ;
-        }
+    if (C_in != NULL && accum != NULL)
+    { 
+        // C is hypersparse, sparse, bitmap, or full, and accum is present.
+        // C must be bitmap, or competely dense with no pending work.
+        bool C_is_dense_or_bitmap = GB_as_if_full (C_in) || GB_IS_BITMAP (C_in);
+
+        // accum must be present, and must match the monoid of the
+        // semiring, and the ztype of the monoid must match the type of C
+        bool accum_is_monoid = (accum == semiring->add->op) 
+            && (C_in->type == accum->ztype) ;
+
+        // C += A*B with C_replace ignored (effectively false)
+        // C<M> += A*B with C_replace false
+        // C<!M> += A*B with C_replace false
+        can_do_in_place = C_is_dense_or_bitmap && accum_is_monoid
+            && ((M_in == NULL) || (M_in != NULL && !C_replace)) ;
 
         // C must also not be transposed on output; see below.  Nor can it be
         // aliased with any input matrix.  This test is done after handling the
@@ -487,6 +468,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // done after any such transposings.
     }
 
+    // C=A*D or C=D*B can be computed in-place if C is the same matrix as the
+    // input A or B (not D), respectively.  The mask and accum must not be
+    // present, C must not be transposed, and no typecasting is done.  The
+    // pattern of C is unchanged, and its values are overwritten.
+    bool scale_in_place = (C_in != NULL) && (M == NULL) && (accum == NULL)
+        && !C_transpose && (A != B)
+        && (C_in->type == semiring->multiply->ztype) ;
+
     //--------------------------------------------------------------------------
     // burble
     //--------------------------------------------------------------------------
@@ -579,11 +568,6 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // AT = A', or AT=one(A') if only the pattern is needed.
             GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
                 Context)) ;
-            // do not use colscale if AT is now bitmap
-            if (GB_IS_BITMAP (AT))
-            { 
-                axb_method = GB_USE_SAXPY ;
-            }
         }
 
         //----------------------------------------------------------------------
@@ -593,10 +577,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         switch (axb_method)
         {
             case GB_USE_ROWSCALE : 
-                // C = D*B using rowscale
+                // C = D*B using rowscale, or C=D*C in-place
                 GBURBLE ("C%s=A'*B, rowscale ", M_str) ;
-                GB_OK (GB_AxB_rowscale (C, A, B, semiring, flipxy,
-                    Context)) ;
+                (*done_in_place) = scale_in_place && (C_in == B) ;
+                GB_OK (GB_AxB_rowscale ((*done_in_place) ? C_in : C, A, B,
+                    semiring, flipxy, Context)) ;
                 break ;
 
             case GB_USE_COLSCALE : 
@@ -634,14 +619,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         //----------------------------------------------------------------------
 
         if (allow_scale && M == NULL
-            && !GB_IS_BITMAP (A)     // TODO: A*D colscale with A bitmap
             && ((B_is_diagonal == -1) ? GB_is_diagonal (B, Context) : B_is_diagonal))
         { 
             // C = A*D, column scale
             axb_method = GB_USE_COLSCALE ;
         }
         else if (allow_scale && M == NULL
-            && !GB_IS_BITMAP (B)     // TODO: D*B' rowscale with B bitmap
             && ((A_is_diagonal == -1) ? GB_is_diagonal (A, Context) : A_is_diagonal))
         { 
             // C = D*B', row scale
@@ -652,21 +635,37 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // only use the dot product method if explicitly requested
             axb_method = GB_USE_DOT ;
         }
+        else if ((AxB_method == GxB_AxB_OUTER || AxB_method == GxB_DEFAULT)
+            && GB_AxB_outer_ok (A, B, semiring))
+        {
+            // C = A*B' via outer products if requested, or if the outer
+            // products take less work than transposing B.  The auto selection
+            // is only done if the mask is not present, since saxpy can exploit
+            // the mask but the outer-product method cannot.
+            if (AxB_method == GxB_AxB_OUTER)
+            { 
+                axb_method = GB_USE_OUTER ;
+            }
+            else if (M == NULL)
+            {
+                double flops = (double) GB_AxB_outer_flops (NULL, NULL, A, B,
+                    Context) ;
+                if (flops <= GB_AXB_OUTER_RATIO * (double) GB_nnz (B))
+                { 
+                    axb_method = GB_USE_OUTER ;
+                }
+            }
+        }
 
         //----------------------------------------------------------------------
         // BT = B'
         //----------------------------------------------------------------------
 
-        if (axb_method != GB_USE_COLSCALE)
+        if (axb_method != GB_USE_COLSCALE && axb_method != GB_USE_OUTER)
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
                 Context)) ;
-            // do not use rowscale if BT is now bitmap
-            if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
-            { 
-                axb_method = GB_USE_SAXPY ;
-            }
         }
 
         //----------------------------------------------------------------------
@@ -676,10 +675,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         switch (axb_method)
         {
             case GB_USE_COLSCALE : 
-                // C = A*D
+                // C = A*D, or C=C*D in-place
                 GBURBLE ("C%s=A*B', colscale ", M_str) ;
-                GB_OK (GB_AxB_colscale (C, A, B, semiring, flipxy,
-                    Context)) ;
+                (*done_in_place) = scale_in_place && (C_in == A) ;
+                GB_OK (GB_AxB_colscale ((*done_in_place) ? C_in : C, A, B,
+                    semiring, flipxy, Context)) ;
                 break ;
 
             case GB_USE_ROWSCALE : 
@@ -700,6 +700,13 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                     mask_applied, done_in_place, Context)) ;
                 break ;
 
+            case GB_USE_OUTER : 
+                // C = A*B' via outer products, with no transpose of A or B.
+                // The mask is applied later.
+                GBURBLE ("C%s=A*B', outer_product ", M_str) ;
+                GB_OK (GB_AxB_outer (C, A, B, semiring, flipxy, Context)) ;
+                break ;
+
             default : 
                 // C = A*B' via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
@@ -719,14 +726,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         //----------------------------------------------------------------------
 
         if (allow_scale && M == NULL
-            && !GB_IS_BITMAP (A)     // TODO: A*D colscale with A bitmap
             && ((B_is_diagonal == -1) ? GB_is_diagonal (B, Context) : B_is_diagonal))
         { 
             // C = A*D, column scale
             axb_method = GB_USE_COLSCALE ;
         }
         else if (allow_scale && M == NULL
-            && !GB_IS_BITMAP (B)     // TODO: D*B rowscale with B bitmap
             && ((A_is_diagonal == -1) ? GB_is_diagonal (A, Context) : A_is_diagonal))
         { 
             // C = D*B, row scale
@@ -747,7 +752,13 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         else
         {
             // C = A*B: auto selection: select saxpy or dot
-            if (GB_IS_HYPERSPARSE (A) && (GB_IS_BITMAP (B) || GB_IS_FULL (B)))
+            if (GB_AxB_saxpy_msa_control (M, Mask_comp, A, B, Context))
+            { 
+                // C<M>=A*B where M is very sparse: use the mask-driven saxpy
+                axb_method = GB_USE_MSA ;
+            }
+            else if (GB_IS_HYPERSPARSE (A)
+                && (GB_IS_BITMAP (B) || GB_IS_FULL (B)))
             {
                 // If A is hyper and B is bitmap/full, then saxpy will compute
                 // C as sparse or bitmap.  If bitmap, use saxpy; if sparse, use
@@ -759,12 +770,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 { 
                     // bitmap = hyper * (bitmap or full) is very efficient
                     // to do via GB_bitmap_AxB_saxpy.
+                    GBURBLE ("(A hyper, C bitmap: saxpy) ") ;
                     axb_method = GB_USE_SAXPY ;
                 }
                 else
                 { 
                     // sparse = hyper * (bitmap or full) would use
                     // GB_AxB_saxpy3, which can be slow, so use dot instead.
+                    GBURBLE ("(A hyper, C sparse: dot) ") ;
                     axb_method = GB_USE_DOT ;
                 }
             }
@@ -782,15 +795,19 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         switch (axb_method)
         {
             case GB_USE_COLSCALE : 
-                // C = A*D, column scale
+                // C = A*D, column scale, or C=C*D in-place
                 GBURBLE ("C%s=A*B, colscale ", M_str) ;
-                GB_OK (GB_AxB_colscale (C, A, B, semiring, flipxy, Context)) ;
+                (*done_in_place) = scale_in_place && (C_in == A) ;
+                GB_OK (GB_AxB_colscale ((*done_in_place) ? C_in : C, A, B,
+                    semiring, flipxy, Context)) ;
                 break ;
 
             case GB_USE_ROWSCALE : 
-                // C = D*B, row scale
+                // C = D*B, row scale, or C=D*C in-place
                 GBURBLE ("C%s=A*B, rowscale ", M_str) ;
-                GB_OK (GB_AxB_rowscale (C, A, B, semiring, flipxy, Context)) ;
+                (*done_in_place) = scale_in_place && (C_in == B) ;
+                GB_OK (GB_AxB_rowscale ((*done_in_place) ? C_in : C, A, B,
+                    semiring, flipxy, Context)) ;
                 break ;
 
             case GB_USE_DOT : 
@@ -804,6 +821,15 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                     mask_applied, done_in_place, Context)) ;
                 break ;
 
+            case GB_USE_MSA : 
+                // C<M>=A*B via saxpy, driven by the entries of M
+                GBURBLE ("C%s=A*B, masked saxpy ", M_str) ;
+                (*mask_applied) = true ;    // mask is always applied
+                (*done_in_place) = false ;
+                GB_OK (GB_AxB_saxpy_msa (C, M, Mask_struct, A, B, semiring,
+                    flipxy, Context)) ;
+                break ;
+
             default : 
                 // C = A*B via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A*B, saxpy ", M_str) ;
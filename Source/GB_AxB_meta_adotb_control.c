@@ -44,16 +44,12 @@ void GB_AxB_meta_adotb_control
     // is very slow in general, and thus the saxpy method is usually used
     // instead.
 
-    if (allow_scale && M == NULL
-        && !GB_IS_BITMAP (A)     // TODO: A'*D colscale with A bitmap
-        && B_is_diagonal)
+    if (allow_scale && M == NULL && B_is_diagonal)
     { 
         // C = A'*D, col scale
         (*axb_method) = GB_USE_COLSCALE ;
     }
-    else if (allow_scale && M == NULL
-        && !GB_IS_BITMAP (B)     // TODO: D*B rowscale with B bitmap
-        && GB_is_diagonal (A, Context))
+    else if (allow_scale && M == NULL && GB_is_diagonal (A, Context))
     { 
         // C = D*B, row scale
         (*axb_method) = GB_USE_ROWSCALE ;
@@ -74,11 +70,13 @@ void GB_AxB_meta_adotb_control
             M, Mask_comp, accum, semiring))
         { 
             // C+=A'*B can be done with dot4
+            GBURBLE ("(C full, updated in-place: dot4) ") ;
             (*axb_method) = GB_USE_DOT ;
         }
         else if (GB_AxB_dot3_control (M, Mask_comp))
         { 
             // C<M>=A'*B uses the masked dot product method (dot3)
+            GBURBLE ("(M sparse: dot3) ") ;
             (*axb_method) = GB_USE_DOT ;
         }
         else if (GB_AxB_dot2_control (A, B, Context))
@@ -0,0 +1,432 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer: C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C = A*B' is computed as the sum of the outer products A(:,k)*B(:,k)', for
+// each k, where A and B are both held by column.  A and B are used in their
+// native orientation, so no explicit transpose of either matrix is needed.
+// The method is selected by GB_AxB_meta, either with the GxB_AxB_OUTER
+// descriptor setting, or automatically if the outer products take less work
+// than transposing B.
+
+// The total work is the flop count, sum (nnz (A(:,k)) * nnz (B(:,k))), for all
+// k.  The flops are split evenly across the tasks, without regard to the
+// boundaries between the vectors of A and B, so a single outer product
+// A(:,k)*B(:,k)' can be computed by many tasks.  Each task writes its partial
+// products as (i,j,t) tuples into its own section of the workspace, where
+// t = A(i,k)*B(j,k).  The tuples are then sorted and merged in parallel by
+// GB_builder, which sums the partial products for each C(i,j) with the monoid
+// of the semiring.  C is returned as hypersparse, and then conformed to its
+// desired sparsity by the caller.
+
+// A and B must be sparse or hypersparse, and the multiplicative operator must
+// not be positional (see GB_AxB_outer_ok).  The mask is not used; it is
+// applied later by GB_accum_mask.
+
+#include "GB_mxm.h"
+#include "GB_binop.h"
+#include "GB_build.h"
+#include "GB_hyper.h"
+#include "GB_search_for_vector_template.c"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Wf, Wf_size) ;           \
+    GB_FREE_WORK (&Wk, Wk_size) ;           \
+    GB_FREE (&Ti, Ti_size) ;                \
+    GB_FREE (&Tj, Tj_size) ;                \
+    GB_FREE (&Tx, Tx_size) ;                \
+    GB_WERK_POP (Tstart, int64_t) ;         \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phbix_free (C) ;                     \
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_outer_ok: determine if C=A*B' can be computed by GB_AxB_outer
+//------------------------------------------------------------------------------
+
+bool GB_AxB_outer_ok                // true if GB_AxB_outer can compute A*B'
+(
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring     // semiring that defines C=A*B'
+)
+{
+    GrB_BinaryOp mult = semiring->multiply ;
+    return (
+        // A and B must be sparse or hypersparse
+        (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) &&
+        (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) &&
+        // the multiplicative operator must have a function pointer
+        !GB_OPCODE_IS_POSITIONAL (mult->opcode) &&
+        (mult->binop_function != NULL)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_outer_flops: count the flops for C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+// Wf [kA] is the flop count for the outer product A(:,k)*B(:,k)', where
+// k = Ah [kA] (or k = kA if A is sparse), and Wk [kA] is the position kB of
+// B(:,k) in the vectors of B, or -1 if B(:,k) is empty.  Wf has size anvec+1
+// and Wk has size anvec.  Wf and Wk may be NULL, in which case only the total
+// flop count is returned.
+
+int64_t GB_AxB_outer_flops          // return the total flop count
+(
+    // output:
+    int64_t *restrict Wf,           // flops for each vector of A, or NULL
+    int64_t *restrict Wk,           // vector kB of B for each kA, or NULL
+    // input:
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A->vdim == B->vdim) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t anvec = A->nvec ;
+
+    // each vector A(:,k) requires a search for B(:,k) in the hyperlist of B
+    GB_hyper_hash_build (B, Context) ;
+    const GB_Hyper_hash B_hyper_hash = GB_hyper_hash_get (B) ;
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t bnvec = B->nvec ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+
+    //--------------------------------------------------------------------------
+    // count the flops for each vector of A
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+
+    int64_t total_flops = 0 ;
+    int64_t kA ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:total_flops)
+    for (kA = 0 ; kA < anvec ; kA++)
+    {
+        int64_t k = GBH (Ah, kA) ;
+        int64_t ajnz = Ap [kA+1] - Ap [kA] ;
+        int64_t kB = -1, flops = 0 ;
+        if (ajnz > 0)
+        {
+            int64_t pleft = 0, pB_start, pB_end ;
+            if (B_is_hyper)
+            {
+                // find B(:,k) in the hyperlist of B
+                if (GB_hyper_hash_lookup (true, Bh, Bp, B->vlen, B_hyper_hash,
+                    &pleft, bnvec-1, k, &pB_start, &pB_end))
+                {
+                    kB = pleft ;
+                }
+            }
+            else
+            {
+                // B(:,k) is the kth vector of B
+                kB = k ;
+            }
+            if (kB >= 0)
+            {
+                flops = ajnz * (Bp [kB+1] - Bp [kB]) ;
+            }
+        }
+        if (Wf != NULL)
+        {
+            Wf [kA] = flops ;
+            Wk [kA] = (flops == 0) ? -1 : kB ;
+        }
+        total_flops += flops ;
+    }
+
+    return (total_flops) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_outer: C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_outer               // C = A*B' via outer products
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, not transposed
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && C->static_header) ;
+    ASSERT_MATRIX_OK (A, "A for outer A*B'", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for outer A*B'", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (GB_JUMBLED_OK (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for outer A*B'", GB0) ;
+    ASSERT (A->vdim == B->vdim) ;
+    ASSERT (GB_AxB_outer_ok (A, B, semiring)) ;
+
+    int64_t *restrict Wf = NULL ; size_t Wf_size = 0 ;
+    int64_t *restrict Wk = NULL ; size_t Wk_size = 0 ;
+    int64_t *restrict Ti = NULL ; size_t Ti_size = 0 ;
+    int64_t *restrict Tj = NULL ; size_t Tj_size = 0 ;
+    GB_void *restrict Tx = NULL ; size_t Tx_size = 0 ;
+    GB_WERK_DECLARE (Tstart, int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    GrB_Type ztype = add->op->ztype ;
+    ASSERT (ztype == mult->ztype) ;
+    GxB_binary_function fmult = mult->binop_function ;
+    size_t zsize = ztype->size ;
+
+    bool A_is_pattern, B_is_pattern ;
+    GB_binop_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
+
+    // flipxy false: aik = (xtype) A(i,k) and bjk = (ytype) B(j,k)
+    // flipxy true:  aik = (ytype) A(i,k) and bjk = (xtype) B(j,k)
+    GB_Type_code aik_code = flipxy ? mult->ytype->code : mult->xtype->code ;
+    GB_Type_code bjk_code = flipxy ? mult->xtype->code : mult->ytype->code ;
+    GB_cast_function cast_A = A_is_pattern ? NULL :
+        GB_cast_factory (aik_code, A->type->code) ;
+    GB_cast_function cast_B = B_is_pattern ? NULL :
+        GB_cast_factory (bjk_code, B->type->code) ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const bool A_iso = A->iso ;
+    const size_t asize = A->type->size ;
+    const int64_t anvec = A->nvec ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bi = B->i ;
+    const GB_void *restrict Bx = (GB_void *) B->x ;
+    const bool B_iso = B->iso ;
+    const size_t bsize = B->type->size ;
+
+    //--------------------------------------------------------------------------
+    // count the flops for each outer product
+    //--------------------------------------------------------------------------
+
+    Wf = GB_MALLOC_WORK (anvec+1, int64_t, &Wf_size) ;
+    Wk = GB_MALLOC_WORK (anvec+1, int64_t, &Wk_size) ;
+    if (Wf == NULL || Wk == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_AxB_outer_flops (Wf, Wk, A, B, Context) ;
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+    GB_cumsum (Wf, anvec, NULL, nthreads, Context) ;
+    const int64_t flops = Wf [anvec] ;
+
+    GBURBLE ("(outer: " GBd " flops) ", flops) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the tuples
+    //--------------------------------------------------------------------------
+
+    // Ti becomes C->i, and Tx may become C->x.  Tj is freed by GB_builder
+    // with GB_FREE.  All three are passed to GB_builder, so they are
+    // allocated with GB_MALLOC, not GB_MALLOC_WORK.
+    int64_t ntuples = GB_IMAX (flops, 1) ;
+    Ti = GB_MALLOC (ntuples, int64_t, &Ti_size) ;
+    Tj = GB_MALLOC (ntuples, int64_t, &Tj_size) ;
+    Tx = GB_MALLOC (ntuples * zsize, GB_void, &Tx_size) ;
+    if (Ti == NULL || Tj == NULL || Tx == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // split the flops evenly across the tasks
+    //--------------------------------------------------------------------------
+
+    nthreads = GB_nthreads (flops, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, ntuples) ;
+    GB_WERK_PUSH (Tstart, ntasks+1, int64_t) ;
+    if (Tstart == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_eslice (Tstart, flops, ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // compute the outer products
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t p = Tstart [tid] ;
+        int64_t p_end = Tstart [tid+1] ;
+        if (p >= p_end) continue ;
+
+        GB_void aik [GB_VLA(aik_size)] ;
+        GB_void bjk [GB_VLA(bjk_size)] ;
+
+        // find the first outer product for this task, where the tuple p
+        // appears in the range Wf [kA] to Wf [kA+1]-1
+        int64_t kA = GB_search_for_vector (p, Wf, 0, anvec, 0) ;
+
+        //----------------------------------------------------------------------
+        // compute the tuples p to p_end-1
+        //----------------------------------------------------------------------
+
+        for ( ; p < p_end ; kA++)
+        {
+
+            //------------------------------------------------------------------
+            // get A(:,k) and B(:,k), and skip if either is empty
+            //------------------------------------------------------------------
+
+            int64_t kB = Wk [kA] ;
+            if (kB < 0) continue ;
+            int64_t pA_end = Ap [kA+1] ;
+            int64_t pB_start = Bp [kB] ;
+            int64_t pB_end = Bp [kB+1] ;
+            int64_t bjnz = pB_end - pB_start ;
+
+            // the task starts at A(i,k)*B(j,k) where A(i,k) is at position
+            // pA and B(j,k) is at position pB
+            int64_t q = p - Wf [kA] ;
+            int64_t pA = Ap [kA] + q / bjnz ;
+            int64_t pB = pB_start + q % bjnz ;
+
+            //------------------------------------------------------------------
+            // C += A(:,k)*B(:,k)' for the tuples owned by this task
+            //------------------------------------------------------------------
+
+            for ( ; pA < pA_end && p < p_end ; pA++)
+            {
+                // aik = A(i,k)
+                int64_t i = Ai [pA] ;
+                if (!A_is_pattern)
+                {
+                    cast_A (aik, Ax + (A_iso ? 0 : pA*asize), asize) ;
+                }
+                for ( ; pB < pB_end && p < p_end ; pB++, p++)
+                {
+                    // bjk = B(j,k)
+                    if (!B_is_pattern)
+                    {
+                        cast_B (bjk, Bx + (B_iso ? 0 : pB*bsize), bsize) ;
+                    }
+                    // t = A(i,k)*B(j,k), the partial product for C(i,j)
+                    Ti [p] = i ;
+                    Tj [p] = Bi [pB] ;
+                    if (flipxy)
+                    {
+                        fmult (Tx + p*zsize, bjk, aik) ;
+                    }
+                    else
+                    {
+                        fmult (Tx + p*zsize, aik, bjk) ;
+                    }
+                }
+                pB = pB_start ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace except for the tuples
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&Wf, Wf_size) ;
+    GB_FREE_WORK (&Wk, Wk_size) ;
+    GB_WERK_POP (Tstart, int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // merge the partial products: C(i,j) = sum of all tuples (i,j,t)
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_builder (
+        C,                      // create C using a static header
+        ztype,                  // C->type
+        A->vlen,                // C->vlen
+        B->vlen,                // C->vdim
+        true,                   // C->is_csc
+        &Ti,                    // Ti is C->i on output, or freed on error
+        &Ti_size,
+        &Tj,                    // Tj, freed on output
+        &Tj_size,
+        &Tx,                    // Tx is C->x on output, or freed
+        &Tx_size,
+        false,                  // tuples need to be sorted
+        false,                  // tuples have duplicates
+        ntuples,                // size of Ti and Tj in # of tuples
+        true,                   // is_matrix: unused
+        NULL, NULL,             // original I,J tuples
+        NULL,                   // no S_input
+        false,                  // C is not iso
+        flops,                  // # of tuples
+        add->op,                // sum the duplicates with the monoid
+        ztype,                  // the type of Tx (no typecasting)
+        Context
+    )) ;
+
+    ASSERT (Ti == NULL) ;
+    ASSERT (Tj == NULL) ;
+    ASSERT (Tx == NULL) ;
+    ASSERT (GB_IS_HYPERSPARSE (C)) ;
+    ASSERT_MATRIX_OK (C, "C output for outer A*B'", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// GB_AxB_push_pull: select push (saxpy) or pull (dot) for w<M>=A*u
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// In a breadth-first search and related graph algorithms, w<!v>=A*u is
+// computed once for each level, where u is the current frontier and v is the
+// set of visited nodes.  The "push" method (saxpy) takes time proportional to
+// the # of entries in A(:,k) for each u(k), and is fastest when u is very
+// sparse.  The "pull" method (dot products) computes w(i)=A(i,:)*u for each
+// w(i) allowed by the mask, and is fastest when u has many entries and few
+// nodes are left to visit, particularly if the monoid is ANY or LOR, so that
+// each dot product can stop as soon as an entry is found.
+
+// The two methods need A held in opposite formats: push needs A by column and
+// pull needs A by row, when w=A*u.  If the matrix A is in push/pull mode (see
+// GxB_PUSH_PULL), its transpose is built once and cached in A->AT, and each
+// call to GrB_mxv or GrB_vxm selects the method from an estimate of the work
+// for each one.  A or A->AT is then used, whichever does not have to be
+// transposed again for the selected method, and the method is selected by
+// modifying AxB_method.  Nothing is done if A is not in push/pull mode, or if
+// the method has been selected by the descriptor.
+
+// The work is estimated in O(1) time from the average degree of A and the
+// # of entries in u and M, as in GB_AxB_saxpy_msa_control.  If the cached
+// transpose cannot be built because out of memory, the method that does not
+// need it is used instead.
+
+#include "GB_mxm.h"
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_AxB_push_pull       // select push or pull for w<M>=A*u
+(
+    // input/output:
+    GrB_Matrix *A_handle,           // A on input, A or A->AT on output
+    bool *A_transpose,              // true if A' is used; negated if A->AT
+                                    // is returned in *A_handle
+    GrB_Desc_Value *AxB_method,     // set to GxB_AxB_SAXPY or GxB_AxB_DOT
+    // input:
+    const GrB_Matrix w,             // output vector (not modified)
+    const GrB_Matrix M,             // optional mask for w
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix u,             // input vector
+    const GrB_Semiring semiring,    // semiring that defines w=A*u
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A_handle != NULL && A_transpose != NULL && AxB_method != NULL) ;
+    GrB_Matrix A = (*A_handle) ;
+    ASSERT_MATRIX_OK (A, "A for push/pull", GB0) ;
+    ASSERT_MATRIX_OK (u, "u for push/pull", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for push/pull", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for push/pull", GB0) ;
+
+    if (!A->push_pull || (*AxB_method) != GxB_DEFAULT || GB_aliased (w, A))
+    { 
+        // A is not in push/pull mode, or the method has been selected by
+        // the descriptor, or A is modified by this call
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the method that can use A as-is
+    //--------------------------------------------------------------------------
+
+    // If A is held by row and not transposed, or by column and transposed,
+    // then w=A*u can use A in the dot product method (pull) with no
+    // transpose.  Otherwise, it can use A in the saxpy method (push).
+    const bool pull_as_is = ((*A_transpose) == A->is_csc) ;
+
+    //--------------------------------------------------------------------------
+    // estimate the work for push and pull
+    //--------------------------------------------------------------------------
+
+    // w=A*u, where A is m-by-n after any transpose, and u has length n
+    double m = (*A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    double n = (*A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    double anz = GB_nnz (A) + GB_Pending_n (A) ;
+    double unz = GB_nnz (u) + GB_Pending_n (u) ;
+    double mnz = (M == NULL) ? 0 : (GB_nnz (M) + GB_Pending_n (M)) ;
+
+    // average # of entries in each row and column of A
+    double a_row_degree = anz / GB_IMAX (m, 1) ;
+    double a_col_degree = anz / GB_IMAX (n, 1) ;
+
+    // push: each u(k) is multiplied by all of A(:,k)
+    double push_work = unz * a_col_degree ;
+
+    // pull: A(i,:)*u is computed for each w(i) allowed by the mask
+    double pull_rows = m ;
+    if (M != NULL)
+    { 
+        pull_rows = Mask_comp ? GB_IMAX (m - mnz, 0) : GB_IMIN (mnz, m) ;
+    }
+    double dot_work = (GB_IS_BITMAP (u) || GB_IS_FULL (u)) ?
+        a_row_degree : GB_merge_work (a_row_degree, unz) ;
+    GB_Opcode add_opcode = semiring->add->op->opcode ;
+    if (add_opcode == GB_ANY_binop_code || add_opcode == GB_LOR_binop_code)
+    { 
+        // each dot product stops at the first entry found, after examining
+        // about n/unz entries of A(i,:) if the entries of u are scattered
+        dot_work = GB_IMIN (dot_work, n / GB_IMAX (unz, 1)) ;
+    }
+    double pull_work = pull_rows * dot_work ;
+
+    //--------------------------------------------------------------------------
+    // select push or pull
+    //--------------------------------------------------------------------------
+
+    bool pull = (pull_work < push_work) ;
+    GBURBLE ("(%s: est. work push %g, pull %g) ", pull ? "pull" : "push",
+        push_work, pull_work) ;
+
+    if (pull != pull_as_is)
+    {
+        // the selected method needs A', so get it from the cache, or build
+        // it if not present
+        GB_MATRIX_WAIT (A) ;
+        info = GB_transpose_cache_build (A, Context) ;
+        if (info != GrB_SUCCESS && info != GrB_OUT_OF_MEMORY)
+        { 
+            return (info) ;
+        }
+        GrB_Matrix AT = GB_transpose_cache_get (A) ;
+        if (AT == NULL)
+        { 
+            // out of memory: use the method that does not need A'
+            GBURBLE ("(A' not cached) ") ;
+            pull = pull_as_is ;
+        }
+        else
+        { 
+            // w=A*u is computed as w=(A')'*u
+            ASSERT_MATRIX_OK (AT, "cached A' for push/pull", GB0) ;
+            (*A_handle) = AT ;
+            (*A_transpose) = !(*A_transpose) ;
+        }
+    }
+
+    (*AxB_method) = pull ? GxB_AxB_DOT : GxB_AxB_SAXPY ;
+    return (GrB_SUCCESS) ;
+}
@@ -14,11 +14,16 @@
 #include "GB_binop__include.h"
 #endif
 
-#define GB_FREE_ALL GB_phbix_free (C) ;
+#define GB_FREE_ALL if (C != B) GB_phbix_free (C) ;
+
+// B can be sparse, hypersparse, bitmap, or full, and C has the same sparsity
+// structure as B.  If C and B are the same matrix, then C=D*B is computed
+// in-place, with no mask or accum.  The type of C must then be the same as
+// the ztype of the multiplicative operator.
 
 GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or B
     const GrB_Matrix D,             // diagonal input matrix
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=D*B
@@ -32,7 +37,7 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
-    ASSERT (C != NULL && C->static_header) ;
+    ASSERT (C != NULL && (C->static_header || C == B)) ;
     ASSERT_MATRIX_OK (D, "D for rowscale D*B", GB0) ;
     ASSERT_MATRIX_OK (B, "B for rowscale D*B", GB0) ;
     ASSERT (!GB_ZOMBIES (D)) ;
@@ -45,11 +50,12 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
     ASSERT (D->vdim == B->vlen) ;
     ASSERT (GB_is_diagonal (D, Context)) ;
 
+    ASSERT (C != D) ;
     ASSERT (!GB_IS_BITMAP (D)) ;        // bitmap or full: not needed
-    ASSERT (!GB_IS_BITMAP (B)) ;
     ASSERT (!GB_IS_FULL (D)) ;
+    const bool C_in_place = (C == B) ;
 
-    GBURBLE ("(%s=%s*%s) ",
+    GBURBLE ("(%s%s=%s*%s) ", C_in_place ? "in-place: " : "",
         GB_sparsity_char_matrix (B),    // C has the sparsity structure of B
         GB_sparsity_char_matrix (D),
         GB_sparsity_char_matrix (B)) ;
@@ -75,12 +81,32 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
     bool C_iso = GB_iso_AxB (cscalar, D, B, D->vdim, semiring, flipxy, true) ;
 
     //--------------------------------------------------------------------------
-    // copy the pattern of B into C
+    // copy the pattern of B into C, or use B itself if done in-place
     //--------------------------------------------------------------------------
 
-    // allocate C->x but do not initialize it
-    // set C->iso = C_iso   OK
-    GB_OK (GB_dup_worker (&C, C_iso, B, false, ztype, Context)) ;
+    if (C_in_place)
+    {
+        // C and B are the same matrix, so the pattern of C is already
+        // computed.  The values of C overwrite the values of B.
+        ASSERT (C->type == ztype) ;
+        if (C_iso)
+        { 
+            // C is iso on output; replace B->x with the single scalar
+            GB_OK (GB_convert_any_to_iso (C, cscalar, Context)) ;
+        }
+        else if (C->iso)
+        { 
+            // expand B->x; not initialized if the operator is positional
+            GB_OK (GB_convert_any_to_non_iso (C,
+                !GB_OPCODE_IS_POSITIONAL (opcode), Context)) ;
+        }
+    }
+    else
+    { 
+        // allocate C->x but do not initialize it
+        // set C->iso = C_iso   OK
+        GB_OK (GB_dup_worker (&C, C_iso, B, false, ztype, Context)) ;
+    }
     GB_void *restrict Cx = (GB_void *) C->x ;
 
     //--------------------------------------------------------------------------
@@ -10,7 +10,12 @@
 #include "GB_mxm.h"
 #include "GB_bitmap_AxB_saxpy.h"
 
-// TODO: allow bitmap multiply to work in-place as well
+// C+=A*B can be computed in-place (with no mask) by saxpy4 and saxpy5 if C is
+// as-if-full.  If C is bitmap or as-if-full and the bitmap method is used,
+// then C<#M>+=A*B is computed in-place by GB_bitmap_AxB_saxpy, or by
+// GB_AxB_dot2 if A is bitmap/full and B is sparse/hyper (with no mask).
+// C=A*B (with no mask) is also computed by saxpy4 or saxpy5 if one of A or B
+// is sparse and the other is full (see GB_AxB_saxpy_full).
 
 GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 (
@@ -138,6 +143,33 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         }
     }
 
+    //--------------------------------------------------------------------------
+    // determine if saxpy4 or saxpy5 can be used: C = A*B where C is full
+    //--------------------------------------------------------------------------
+
+    if (!C_iso                              // C must be non-iso on output
+        && C_in == NULL                     // C is not computed in-place
+        && M == NULL                        // no mask present
+        && saxpy_method == GB_SAXPY_METHOD_BITMAP)
+    {
+        if (((GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) && GB_as_if_full (B))
+        ||  ((GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) && GB_as_if_full (A)))
+        { 
+            // C=A*B, where one of A or B is sparse/hyper and the other is
+            // as-if-full.  C is computed as a full matrix by saxpy4 or saxpy5,
+            // and converted to bitmap if any of its rows or columns are
+            // empty.  The same built-in semirings as saxpy4 and saxpy5 are
+            // supported.
+            info = GB_AxB_saxpy_full (C, A, B, semiring, flipxy, Context) ;
+            if (info != GrB_NO_VALUE)
+            { 
+                // return if saxpy4 or saxpy5 has handled this case, otherwise
+                // fall through to dot2 or bitmap_saxpy below.
+                return (info) ;
+            }
+        }
+    }
+
     //--------------------------------------------------------------------------
     // burble
     //--------------------------------------------------------------------------
@@ -231,24 +263,37 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 
         ASSERT (C_sparsity == GxB_BITMAP) ;
 
+        // C<#M>+=A*B can be done in-place if C is bitmap or as-if-full, the
+        // accum operator matches the monoid, and no typecasting is needed.
+        // GB_AxB_meta ensures that C_replace is false if M is present.
+        bool C_in_place = (!C_iso && C_in != NULL
+            && (GB_IS_BITMAP (C_in) || GB_as_if_full (C_in))
+            && (accum != NULL) && (accum == semiring->add->op)
+            && (C_in->type == accum->ztype)) ;
+
         if ((GB_IS_BITMAP (A) || GB_IS_FULL (A)) &&
             (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))
         { 
             // C<#M> = A*B via dot products, where A is bitmap or full and B is
             // sparse or hypersparse, using the dot2 method with A not
             // explicitly transposed.
-            info = GB_AxB_dot2 (C, C_iso, cscalar, M, Mask_comp, Mask_struct,
-                true, A, B, semiring, flipxy, Context) ;
+            C_in_place = GB_AxB_dot2_in_place_control (C_iso, C_in, M, accum,
+                semiring, A, B) ;
+            info = GB_AxB_dot2 (C_in_place ? C_in : C, C_in_place, C_iso,
+                cscalar, M, Mask_comp, Mask_struct, true, A, B, semiring,
+                flipxy, Context) ;
         }
         else
         { 
             // C<#M> = A*B via bitmap saxpy method
-            info = GB_bitmap_AxB_saxpy (C, C_iso, cscalar, M,
-                Mask_comp, Mask_struct, A, B, semiring, flipxy, Context) ;
+            info = GB_bitmap_AxB_saxpy (C_in_place ? C_in : C, C_in_place,
+                C_iso, cscalar, M, Mask_comp, Mask_struct, A, B, semiring,
+                flipxy, Context) ;
         }
 
         // the mask is always applied if present
         (*mask_applied) = (M != NULL && info == GrB_SUCCESS) ;
+        (*done_in_place) = (C_in_place && info == GrB_SUCCESS) ;
     }
 
 // tt1 = omp_get_wtime ( ) - tt1 ; printf ("saxpy time: %g\n", tt1) ;
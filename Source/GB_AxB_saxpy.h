@@ -98,6 +98,60 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_full: C=A*B via saxpy4 or saxpy5, where C is full or bitmap
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy_full          // C = A*B with C full or bitmap
+(
+    GrB_Matrix C,                   // output, static header
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy5_kblock: determine the k-block size for saxpy5
+//------------------------------------------------------------------------------
+
+// If A is full and too large to fit in cache, GB_AxB_saxpy5 splits the
+// columns of A (and rows of B) into k-blocks, so that each block A(:,k1:k2-1)
+// fits in the L2 cache while it is used by all vectors of a task.  Each task
+// then does at most GB_SAXPY5_JPANEL vectors of B.  This is only worth doing
+// if each k-block is used often enough by each task, so the average number of
+// entries in GB_SAXPY5_JPANEL vectors of B must be at least B->vlen.  B must
+// not be jumbled.  If k-blocking is not used, the k-block is all of B->vlen.
+
+#define GB_SAXPY5_KBLOCK_BYTES (256 * 1024)
+#define GB_SAXPY5_JPANEL 256
+
+static inline int64_t GB_AxB_saxpy5_kblock
+(
+    const GrB_Matrix A,             // A is full, m-by-k
+    const GrB_Matrix B              // B is sparse or hypersparse, k-by-n
+)
+{
+    const int64_t m = A->vlen ;
+    const int64_t k = B->vlen ;
+    const size_t asize = A->type->size ;
+    const double abytes = ((double) m) * ((double) k) * ((double) asize) ;
+    if (B->jumbled || B->nvec == 0 || abytes <= 2 * GB_SAXPY5_KBLOCK_BYTES)
+    { 
+        // A fits in cache, or B is jumbled: do not use k-blocking
+        return (GB_IMAX (k, 1)) ;
+    }
+    const double bdeg = ((double) GB_nnz (B)) / ((double) B->nvec) ;
+    if (bdeg * GB_SAXPY5_JPANEL < k)
+    { 
+        // B is too sparse for k-blocking to pay off
+        return (k) ;
+    }
+    // each block A(:,k1:k2-1) takes about GB_SAXPY5_KBLOCK_BYTES
+    return (GB_IMAX (16, GB_SAXPY5_KBLOCK_BYTES / (m * asize))) ;
+}
+
 //------------------------------------------------------------------------------
 // saxpy methods
 //------------------------------------------------------------------------------
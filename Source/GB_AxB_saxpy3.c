@@ -261,6 +261,16 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // GB_Global_timing_add (3, ttt) ;
 // ttt = omp_get_wtime ( ) ;
 
+    //==========================================================================
+    // build the hash index of A->h, if needed
+    //==========================================================================
+
+    // Each entry B(k,j) requires a search for A(:,k) in the hyperlist of A.
+    // This takes O(1) time with a hash index, for the flopcount analysis and
+    // for both the symbolic and numeric phases.
+
+    GB_hyper_hash_build (A, Context) ;
+
     //==========================================================================
     // phase0: create parallel tasks and allocate workspace
     //==========================================================================
@@ -268,7 +278,27 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+    // If a GxB_MxM_Plan is present in the descriptor, and it holds the
+    // analysis for the same patterns of M, A, and B, then phase0 and most of
+    // phase1 are skipped.  Otherwise the analysis is done below, and saved in
+    // the plan after phase1.
+    GxB_MxM_Plan plan = (Context == NULL) ? NULL : Context->plan ;
+    GB_saxpy3_key plan_key ;
+    bool plan_reused = false ;
+    if (plan != NULL)
+    { 
+        GB_AxB_saxpy3_key (&plan_key, M, Mask_comp, Mask_struct, A, B,
+            AxB_method, nthreads_max, chunk) ;
+        plan_reused = GB_AxB_saxpy3_plan_reuse (C, plan, &plan_key,
+            &SaxpyTasks, &SaxpyTasks_size, &info, &apply_mask, &M_in_place,
+            &ntasks, &nfine, &nthreads, Context) ;
+    }
+
+    if (plan_reused)
+    { 
+        GBURBLE ("(reuse plan) ") ;
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
         GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
@@ -285,8 +315,10 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     { 
         // Do the flopcount analysis and create a set of well-balanced tasks in
         // the general case.  This may select a single task for a single thread
-        // anyway, but this decision would be based on the analysis.
-        info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
+        // anyway, but this decision would be based on the analysis.  If the
+        // tasks have already been constructed for the same M, A, and B, and
+        // none of them has been modified since, the tasks are reused instead.
+        info = GB_AxB_saxpy3_slice_cached (C, M, Mask_comp, A, B, AxB_method,
             &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
             &ntasks, &nfine, &nthreads, Context) ;
     }
@@ -301,6 +333,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         // analysis so far and redo it without the mask.  This may result in
         // GB_bitmap_AxB_saxpy being called instead of GB_AxB_saxpy3.
         ASSERT (M != NULL && !apply_mask) ;
+        if (plan != NULL && !plan_reused)
+        { 
+            GB_AxB_saxpy3_plan_save (plan, &plan_key, C, NULL, info, false,
+                false, 0, 0, 0) ;
+        }
         GB_FREE_ALL ;
         return (GrB_NO_VALUE) ;
     }
@@ -579,17 +616,31 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // phase1: symbolic analysis
     //==========================================================================
 
-    // TODO constructing the tasks (the work above) can take a lot of time.
-    // See the web graph, where it takes a total of 3.03 sec for 64 trials, vs
-    // a total of 5.9 second for phase 7 (the numerical work below).
-    // Figure out a faster method.
-
 // ttt = omp_get_wtime ( ) - ttt ;
 // GB_Global_timing_add (5, ttt) ;
 // ttt = omp_get_wtime ( ) ;
 
-    GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
-        A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    if (plan_reused)
+    {
+        // Cp has already been restored from the plan for all coarse tasks.
+        // Only the fine tasks need to scatter the mask into their hash tables.
+        if (M != NULL && nfine > 0)
+        { 
+            GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+                A, B, SaxpyTasks, nfine, nfine, nthreads) ;
+        }
+    }
+    else
+    {
+        GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+        if (plan != NULL)
+        { 
+            // save the analysis in the plan, for the next C=A*B
+            GB_AxB_saxpy3_plan_save (plan, &plan_key, C, SaxpyTasks, info,
+                apply_mask, M_in_place, ntasks, nfine, nthreads) ;
+        }
+    }
 
 // the above phase takes 1.6 seconds for 64 trials of the web graph.
 
@@ -76,6 +76,15 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // sums its computations in a hash table shared by all fine tasks that compute
 // C(:,j), via atomics.  The vector index j is GBH (Bh, kk).
 
+// A fine task is also an ultra-fine task if it uses only part of A(:,k) for
+// its first entry B(k1,j) or its last entry B(k2,j).  For B(k1,j), the first
+// askip_first entries of A(:,k1) are skipped, and for B(k2,j), the last
+// askip_last entries of A(:,k2) are skipped.  If k1 == k2, the task computes
+// A(i1:i2,k)*B(k,j) for a contiguous part of a single vector A(:,k), so that
+// the work for a single costly entry B(k,j) can be split across many tasks.
+// The atomic updates of the hash table act as the monoid reduction of the
+// partial results.  Both are zero for all other tasks.
+
 // Both tasks use a hash table allocated uniquely for the task, in Hi, Hf, and
 // Hx.  The size of the hash table is determined by the maximum # of flops
 // needed to compute any vector in C(:,j1:j2) for a coarse task, or the entire
@@ -95,6 +104,8 @@ typedef struct
     GB_void *Hf ;       // Hf array for hash table (int8_t or int64_t)
     GB_void *Hx ;       // Hx array for hash table
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
+    int64_t askip_first ;   // # entries skipped at the start of A(:,k1)
+    int64_t askip_last ;    // # entries skipped at the end of A(:,k2)
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
 }
@@ -154,6 +165,145 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_cached: create balanced tasks, or reuse them
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_slice_cached
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+) ;
+
+// Each entry in the list B->saxpy3_cache holds the tasks for one problem
+// C<#M>=A*B.  An entry is never modified once it is attached to B, and it is
+// freed only when B is stamped.  The entry does not record the stamp of B,
+// since the list is freed whenever B->stamp changes.
+
+struct GB_saxpy3_cache_struct
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    struct GB_saxpy3_cache_struct *next ;   // next entry in the list, or NULL
+    int64_t count ;         // # of entries in the list, from this one on
+    int64_t A_stamp ;       // A->stamp
+    int64_t M_stamp ;       // M->stamp, or zero if M is not present
+    bool Mask_comp ;
+    GrB_Desc_Value AxB_method ;
+    int nthreads_max ;
+    double chunk ;
+    GB_saxpy3task_struct *SaxpyTasks ;  // list of tasks, or NULL if empty
+    size_t SaxpyTasks_size ;
+    GrB_Info info ;         // GrB_SUCCESS, or GrB_NO_VALUE if M is discarded
+    bool apply_mask ;
+    bool M_in_place ;
+    int ntasks ;
+    int nfine ;
+    int nthreads ;
+} ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_key: identify the patterns of M, A, and B for a plan
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int64_t n [19] ;        // dimensions, sparsity structure, and settings
+    double chunk ;          // chunk size
+    uint64_t checksum ;     // checksum of the patterns of A, B, and M
+}
+GB_saxpy3_key ;
+
+void GB_AxB_saxpy3_key
+(
+    GB_saxpy3_key *key,             // key to create
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    int nthreads_max,
+    double chunk
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: save and reuse the symbolic analysis in a GxB_MxM_Plan
+//------------------------------------------------------------------------------
+
+// The plan holds the tasks from phase0, without their hash tables, and the
+// counts nnz (C (:,j)) for the vectors of all coarse tasks from phase1.  The
+// counts for the vectors of fine tasks are computed in phase2, which is not
+// part of the plan.
+
+struct GB_saxpy3_plan_struct
+{
+    GB_saxpy3_key key ;     // identifies the inputs to the analysis
+    GB_saxpy3task_struct *SaxpyTasks ;  // list of tasks, or NULL if empty
+    size_t SaxpyTasks_size ;
+    int64_t *Cp ;           // Cp [kk] for each vector kk of a coarse task
+    size_t Cp_size ;
+    GrB_Info info ;         // GrB_SUCCESS, or GrB_NO_VALUE if M is discarded
+    bool apply_mask ;
+    bool M_in_place ;
+    int ntasks ;
+    int nfine ;
+    int nthreads ;
+} ;
+
+bool GB_AxB_saxpy3_plan_reuse       // true if the plan has been reused
+(
+    // input/output
+    GrB_Matrix C,                   // Cp is restored for coarse tasks
+    GxB_MxM_Plan plan,              // plan to reuse
+    // input
+    const GB_saxpy3_key *key,       // key for the current problem
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    GrB_Info *info,                 // GrB_SUCCESS, or GrB_NO_VALUE
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks (coarse and fine)
+    int *nfine,                     // # of fine tasks
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+) ;
+
+void GB_AxB_saxpy3_plan_save
+(
+    // input/output
+    GxB_MxM_Plan plan,              // plan to save the analysis in
+    // inputs
+    const GB_saxpy3_key *key,       // key for the current problem
+    const GrB_Matrix C,             // Cp is saved for coarse tasks
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const GrB_Info info,            // GrB_SUCCESS, or GrB_NO_VALUE
+    const bool apply_mask,
+    const bool M_in_place,
+    const int ntasks,
+    const int nfine,
+    const int nthreads
+) ;
+
+void GB_AxB_saxpy3_plan_clear
+(
+    GxB_MxM_Plan plan               // plan to clear
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_slice_quick: create a single sequential task for saxpy3
 //------------------------------------------------------------------------------
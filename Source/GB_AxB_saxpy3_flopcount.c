@@ -152,6 +152,7 @@ GrB_Info GB_AxB_saxpy3_flopcount
     const int64_t anvec = A->nvec ;
     const int64_t avlen = A->vlen ;
     const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
 
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bh = B->h ;
@@ -315,8 +316,8 @@ GrB_Info GB_AxB_saxpy3_flopcount
                     pleft = 0 ;
                 }
                 int64_t pA, pA_end ;
-                GB_lookup (A_is_hyper, Ah, Ap, avlen, &pleft, pright, k,
-                    &pA, &pA_end) ;
+                GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, avlen, A_hyper_hash,
+                    &pleft, pright, k, &pA, &pA_end) ;
 
                 // skip if A(:,k) empty
                 const int64_t aknz = pA_end - pA ;
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_key: create a key that identifies the patterns for a plan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The key identifies the inputs to the symbolic analysis of C<#M>=A*B held in
+// a GxB_MxM_Plan, so that the analysis can be reused if the same key is seen
+// again.  It records the dimensions and sparsity structure of each matrix,
+// the settings that affect the analysis, and a 64-bit checksum of the
+// contents of the arrays that define the patterns of A, B, and M.
+
+// The symbolic analysis depends on the entire patterns of A, B, and M, and on
+// the values of M if the mask is not structural.  The checksum thus includes
+// A->p, A->h, A->i, A->b, B->p, B->h, B->i, B->b, M->p, M->h, M->i, M->b, and
+// M->x (if the mask is valued).  The stamps of the matrices are not part of
+// the key, so that the plan can be reused for matrices that are rebuilt (or
+// transposed) with the same pattern from one call to the next.
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_checksum: 64-bit checksum of an array
+//------------------------------------------------------------------------------
+
+// The checksum sums a hash of each 64-bit word and its position, so it can be
+// computed in parallel, and its value does not depend on the # of threads.
+
+static inline uint64_t GB_checksum_mix (uint64_t x)
+{ 
+    x ^= x >> 30 ; x *= 0xBF58476D1CE4E5B9ULL ;
+    x ^= x >> 27 ; x *= 0x94D049BB133111EBULL ;
+    x ^= x >> 31 ;
+    return (x) ;
+}
+
+static uint64_t GB_checksum
+(
+    const void *X,          // array to checksum, may be NULL
+    int64_t nbytes,         // size of X in bytes
+    uint64_t seed,          // distinguishes one array from another
+    int nthreads_max,
+    double chunk
+)
+{
+
+    if (X == NULL || nbytes <= 0)
+    { 
+        return (seed) ;
+    }
+
+    const int64_t nwords = nbytes / sizeof (uint64_t) ;
+    const GB_void *restrict Xbytes = (const GB_void *) X ;
+    uint64_t checksum = 0 ;
+    int nth = GB_nthreads (nwords, chunk, nthreads_max) ;
+    int64_t w ;
+    #pragma omp parallel for num_threads(nth) schedule(static) \
+        reduction(+:checksum)
+    for (w = 0 ; w < nwords ; w++)
+    { 
+        uint64_t x ;
+        memcpy (&x, Xbytes + w * sizeof (uint64_t), sizeof (uint64_t)) ;
+        checksum += GB_checksum_mix (x ^ GB_checksum_mix (w + seed)) ;
+    }
+
+    // include any remaining bytes in the last partial word
+    uint64_t x = 0 ;
+    int64_t nleft = nbytes - nwords * sizeof (uint64_t) ;
+    memcpy (&x, Xbytes + nwords * sizeof (uint64_t), nleft) ;
+    checksum += GB_checksum_mix (x ^ GB_checksum_mix (nwords + seed)) ;
+    return (checksum) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_key: create the key for C<#M>=A*B
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_key
+(
+    GB_saxpy3_key *key,             // key to create
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    int nthreads_max,
+    double chunk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the scalar parts of the key
+    //--------------------------------------------------------------------------
+
+    memset (key, 0, sizeof (GB_saxpy3_key)) ;
+    int64_t anz = GB_nnz_held (A) ;
+    int64_t bnz = GB_nnz_held (B) ;
+    int64_t mnz = (M == NULL) ? 0 : GB_nnz_held (M) ;
+    int64_t *restrict n = key->n ;
+    n [ 0] = A->vlen ;
+    n [ 1] = A->vdim ;
+    n [ 2] = A->nvec ;
+    n [ 3] = GB_nnz (A) ;
+    n [ 4] = GB_sparsity (A) + 16 * A->jumbled ;
+    n [ 5] = B->vlen ;
+    n [ 6] = B->vdim ;
+    n [ 7] = B->nvec ;
+    n [ 8] = bnz ;
+    n [ 9] = GB_sparsity (B) + 16 * B->jumbled ;
+    n [10] = (M == NULL) ? -1 : M->vlen ;
+    n [11] = (M == NULL) ? -1 : M->vdim ;
+    n [12] = (M == NULL) ? -1 : M->nvec ;
+    n [13] = (M == NULL) ? -1 : GB_nnz (M) ;
+    n [14] = (M == NULL) ? -1 : GB_sparsity (M) ;
+    n [15] = Mask_comp ;
+    n [16] = AxB_method ;
+    n [17] = nthreads_max ;
+    n [18] = Mask_struct ;
+    key->chunk = chunk ;
+
+    //--------------------------------------------------------------------------
+    // compute the checksum of the pattern of A, B, and M
+    //--------------------------------------------------------------------------
+
+    int64_t esize = sizeof (int64_t) ;
+    int64_t mnvec = (M == NULL) ? 0 : M->nvec ;
+    uint64_t c = 0 ;
+    c += GB_checksum (A->p, (A->nvec+1) * esize, 1, nthreads_max, chunk) ;
+    c += GB_checksum (A->h, (A->nvec  ) * esize, 2, nthreads_max, chunk) ;
+    c += GB_checksum (B->p, (B->nvec+1) * esize, 3, nthreads_max, chunk) ;
+    c += GB_checksum (B->h, (B->nvec  ) * esize, 4, nthreads_max, chunk) ;
+    c += GB_checksum (B->i, bnz * esize, 5, nthreads_max, chunk) ;
+    c += GB_checksum (B->b, bnz, 6, nthreads_max, chunk) ;
+    c += GB_checksum (A->i, anz * esize, 9, nthreads_max, chunk) ;
+    c += GB_checksum (A->b, anz, 10, nthreads_max, chunk) ;
+    if (M != NULL)
+    { 
+        c += GB_checksum (M->p, (mnvec+1) * esize, 7, nthreads_max, chunk) ;
+        c += GB_checksum (M->h, (mnvec  ) * esize, 8, nthreads_max, chunk) ;
+        c += GB_checksum (M->i, mnz * esize, 11, nthreads_max, chunk) ;
+        c += GB_checksum (M->b, mnz, 12, nthreads_max, chunk) ;
+        if (!Mask_struct)
+        { 
+            // the analysis depends on the values of a valued mask
+            size_t msize = M->type->size ;
+            int64_t mxnz = (M->iso) ? 1 : mnz ;
+            c += GB_checksum (M->x, mxnz * msize, 13 + M->iso,
+                nthreads_max, chunk) ;
+        }
+    }
+
+    key->checksum = c ;
+}
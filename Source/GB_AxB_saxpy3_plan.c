@@ -0,0 +1,271 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan: save and reuse the symbolic analysis for saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A GxB_MxM_Plan holds the symbolic analysis of C<#M>=A*B computed by
+// GB_AxB_saxpy3: the tasks from phase0 (which determine the kind and size of
+// each hash table), the mask-handling decisions, and the counts nnz (C (:,j))
+// computed by phase1 for the vectors of all coarse tasks.  If the plan is
+// reused, phase0 and the coarse tasks of phase1 are skipped entirely.  Fine
+// tasks still scatter the mask M into their hash tables in phase1, since
+// those hash tables are workspace that is not kept in the plan.  The numeric
+// phases (phase2 to phase5) are always performed.
+
+// The analysis depends only on the patterns of A, B, and M, the values of M
+// if the mask is not structural, and on the settings that affect the tasks
+// (see GB_AxB_saxpy3_key).  It does not depend on the semiring or the types
+// of the matrices.  If the key of the current problem differs from the key
+// saved in the plan, the plan is not reused, and GB_AxB_saxpy3 replaces it
+// with a new analysis.
+
+// If GB_AxB_saxpy3_slice_balanced decides to discard the mask, GB_AxB_saxpy3
+// returns GrB_NO_VALUE, and its caller computes C=A*B instead, with another
+// call to GB_AxB_saxpy3.  Both outcomes are kept in the plan, in separate
+// slots, so that the same plan can be reused for both calls.
+
+// The plan is owned by the user application, and persists after the method
+// returns, so its contents are allocated with GB_MALLOC, not from the
+// werkspace (or a GxB_Arena).
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_plan_copy_Cp: copy Cp [kfirst:klast] for each coarse task
+//------------------------------------------------------------------------------
+
+static void GB_plan_copy_Cp
+(
+    int64_t *restrict Cp_dest,
+    const int64_t *restrict Cp_src,
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const int ntasks,
+    const int nfine,
+    const int nthreads
+)
+{
+    int taskid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = nfine ; taskid < ntasks ; taskid++)
+    {
+        int64_t kfirst = SaxpyTasks [taskid].start ;
+        int64_t klast  = SaxpyTasks [taskid].end ;
+        if (klast >= kfirst)
+        { 
+            memcpy (Cp_dest + kfirst, Cp_src + kfirst,
+                (klast - kfirst + 1) * sizeof (int64_t)) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_plan_slot_clear: free one analysis held in a plan
+//------------------------------------------------------------------------------
+
+static void GB_plan_slot_clear
+(
+    GxB_MxM_Plan plan,              // plan to modify
+    const int slot                  // 0 or 1
+)
+{
+    struct GB_saxpy3_plan_struct *P = plan->saxpy3 [slot] ;
+    if (P != NULL)
+    { 
+        GB_FREE (&(P->SaxpyTasks), P->SaxpyTasks_size) ;
+        GB_FREE (&(P->Cp), P->Cp_size) ;
+        GB_FREE (&(plan->saxpy3 [slot]), plan->saxpy3_size [slot]) ;
+    }
+    plan->saxpy3_size [slot] = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_clear: free the analysis held in a plan
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_clear
+(
+    GxB_MxM_Plan plan               // plan to clear
+)
+{ 
+    GB_plan_slot_clear (plan, 0) ;
+    GB_plan_slot_clear (plan, 1) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_reuse: reuse the analysis in a plan, if it matches
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_reuse       // true if the plan has been reused
+(
+    // input/output
+    GrB_Matrix C,                   // Cp is restored for coarse tasks
+    GxB_MxM_Plan plan,              // plan to reuse
+    // input
+    const GB_saxpy3_key *key,       // key for the current problem
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    GrB_Info *info,                 // GrB_SUCCESS, or GrB_NO_VALUE
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks (coarse and fine)
+    int *nfine,                     // # of fine tasks
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the plan matches the current problem
+    //--------------------------------------------------------------------------
+
+    ASSERT (SaxpyTasks_handle != NULL && (*SaxpyTasks_handle) == NULL) ;
+    struct GB_saxpy3_plan_struct *P = NULL ;
+    for (int slot = 0 ; slot <= 1 ; slot++)
+    {
+        struct GB_saxpy3_plan_struct *P2 = plan->saxpy3 [slot] ;
+        if (P2 != NULL &&
+            memcmp (&(P2->key), key, sizeof (GB_saxpy3_key)) == 0)
+        { 
+            P = P2 ;
+            break ;
+        }
+    }
+    if (P == NULL)
+    { 
+        // the plan is empty, or one of the patterns has changed
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // make a copy of the tasks
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3task_struct *SaxpyTasks = NULL ;
+    size_t SaxpyTasks_size = 0 ;
+    if (P->ntasks > 0)
+    {
+        SaxpyTasks = GB_MALLOC_WORK (P->ntasks, GB_saxpy3task_struct,
+            &SaxpyTasks_size) ;
+        if (SaxpyTasks == NULL)
+        { 
+            // out of memory; do the analysis instead
+            return (false) ;
+        }
+        memcpy (SaxpyTasks, P->SaxpyTasks,
+            P->ntasks * sizeof (GB_saxpy3task_struct)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // restore Cp for the vectors of all coarse tasks
+    //--------------------------------------------------------------------------
+
+    if (P->info == GrB_SUCCESS)
+    { 
+        GB_plan_copy_Cp (C->p, P->Cp, SaxpyTasks, P->ntasks, P->nfine,
+            P->nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return the result
+    //--------------------------------------------------------------------------
+
+    plan->nreuse++ ;
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    (*info)       = P->info ;
+    (*apply_mask) = P->apply_mask ;
+    (*M_in_place) = P->M_in_place ;
+    (*ntasks)     = P->ntasks ;
+    (*nfine)      = P->nfine ;
+    (*nthreads)   = P->nthreads ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: save the analysis in a plan
+//------------------------------------------------------------------------------
+
+// Any prior analysis in the same slot of the plan is discarded.  If out of
+// memory, the slot is left empty, and the next call to GB_AxB_saxpy3 will try
+// to save it again.
+
+void GB_AxB_saxpy3_plan_save
+(
+    // input/output
+    GxB_MxM_Plan plan,              // plan to save the analysis in
+    // inputs
+    const GB_saxpy3_key *key,       // key for the current problem
+    const GrB_Matrix C,             // Cp is saved for coarse tasks
+    const GB_saxpy3task_struct *SaxpyTasks,
+    const GrB_Info info,            // GrB_SUCCESS, or GrB_NO_VALUE
+    const bool apply_mask,
+    const bool M_in_place,
+    const int ntasks,
+    const int nfine,
+    const int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // allocate the plan contents
+    //--------------------------------------------------------------------------
+
+    const int slot = (info == GrB_NO_VALUE) ? 1 : 0 ;
+    GB_plan_slot_clear (plan, slot) ;
+    size_t P_size = 0 ;
+    struct GB_saxpy3_plan_struct *P = GB_MALLOC (1,
+        struct GB_saxpy3_plan_struct, &P_size) ;
+    if (P == NULL)
+    { 
+        // out of memory
+        return ;
+    }
+    memset (P, 0, sizeof (struct GB_saxpy3_plan_struct)) ;
+    plan->saxpy3 [slot] = P ;
+    plan->saxpy3_size [slot] = P_size ;
+    P->key = (*key) ;
+    P->info = info ;
+    if (info == GrB_SUCCESS)
+    { 
+        P->apply_mask = apply_mask ;
+        P->M_in_place = M_in_place ;
+        P->ntasks     = ntasks ;
+        P->nfine      = nfine ;
+        P->nthreads   = nthreads ;
+    }
+
+    if (P->ntasks > 0)
+    {
+        P->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct,
+            &(P->SaxpyTasks_size)) ;
+        P->Cp = GB_MALLOC (C->nvec + 1, int64_t, &(P->Cp_size)) ;
+        if (P->SaxpyTasks == NULL || P->Cp == NULL)
+        { 
+            // out of memory
+            GB_plan_slot_clear (plan, slot) ;
+            return ;
+        }
+
+        //----------------------------------------------------------------------
+        // save the tasks, without their hash tables, and Cp for coarse tasks
+        //----------------------------------------------------------------------
+
+        memcpy (P->SaxpyTasks, SaxpyTasks,
+            ntasks * sizeof (GB_saxpy3task_struct)) ;
+        for (int taskid = 0 ; taskid < ntasks ; taskid++)
+        { 
+            P->SaxpyTasks [taskid].Hi = NULL ;
+            P->SaxpyTasks [taskid].Hf = NULL ;
+            P->SaxpyTasks [taskid].Hx = NULL ;
+            P->SaxpyTasks [taskid].my_cjnz = 0 ;
+        }
+        GB_plan_copy_Cp (P->Cp, C->p, SaxpyTasks, ntasks, nfine, nthreads) ;
+    }
+
+    plan->nbuild++ ;
+}
@@ -11,6 +11,7 @@
 // GrB_NO_VALUE, to indicate that the analysis was terminated early.
 
 #include "GB_AxB_saxpy3.h"
+#include "GB_search_for_vector_template.c"
 
 // control parameters for generating parallel tasks
 #define GB_NTASKS_PER_THREAD 2
@@ -23,7 +24,8 @@
 {                                           \
     GB_WERK_POP (Fine_fl, int64_t) ;        \
     GB_WERK_POP (Fine_slice, int64_t) ;     \
-    GB_WERK_POP (Coarse_Work, int64_t) ;    \
+    GB_WERK_POP (Fine_offset, int64_t) ;    \
+    GB_WERK_POP (Fine_leader, int64_t) ;    \
     GB_WERK_POP (Coarse_initial, int64_t) ; \
 }
 
@@ -103,12 +105,61 @@ static inline int64_t GB_hash_table_size
     return (hash_size) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_fine_slice: slice the flops for A*B(:,j) into fine tasks
+//------------------------------------------------------------------------------
+
+// Fine_fl [0:bjnz] is the cumulative sum of the flops for each entry B(k,j),
+// where Fine_fl [s+1] - Fine_fl [s] = nnz (A(:,k)) for the entry B(k,j) at
+// position s in B(:,j).  Fine_fl [0] need not be zero, since Fine_fl is a
+// part of the cumulative sum for all vectors B(:,j) that are split into fine
+// tasks.  The flops are split evenly into team_size fine tasks, and fine task
+// fid does the flops Fine_slice [fid] to Fine_slice [fid+1]-1.
+// A task boundary that falls inside the work for a single entry B(k,j) is
+// moved to the nearest entry, unless A(:,k)*B(k,j) is more work than a single
+// task.  In that case, the boundary is kept, and A(:,k)*B(k,j) is split
+// across ultra-fine tasks that each compute A(i1:i2,k)*B(k,j).
+
+static inline void GB_fine_slice
+(
+    int64_t *restrict Fine_slice,       // size team_size+1
+    const int64_t *restrict Fine_fl,    // size bjnz+1
+    const int64_t bjnz,
+    const int team_size
+)
+{
+    int64_t fl_first = Fine_fl [0] ;
+    int64_t fl_last  = Fine_fl [bjnz] ;
+    double task_flops = ((double) (fl_last - fl_first)) / ((double) team_size) ;
+    Fine_slice [0] = fl_first ;
+    for (int fid = 1 ; fid < team_size ; fid++)
+    {
+        int64_t f = fl_first + (int64_t) (fid * task_flops) ;
+        f = GB_IMIN (f, fl_last) ;
+        if (f < fl_last)
+        {
+            // find the entry B(k,j) at position s whose work contains f
+            int64_t s = GB_search_for_vector (f, Fine_fl, 0, bjnz, 0) ;
+            int64_t f1 = Fine_fl [s] ;
+            int64_t f2 = Fine_fl [s+1] ;
+            if (f2 - f1 <= task_flops)
+            { 
+                // A(:,k)*B(k,j) is not costly: move to the nearest entry
+                f = (f - f1 <= f2 - f) ? f1 : f2 ;
+            }
+        }
+        Fine_slice [fid] = GB_IMAX (f, Fine_slice [fid-1]) ;
+    }
+    Fine_slice [team_size] = fl_last ;
+}
+
 //------------------------------------------------------------------------------
 // GB_create_coarse_task: create a single coarse task
 //------------------------------------------------------------------------------
 
 // Compute the max flop count for any vector in a coarse task, determine the
-// hash table size, and construct the coarse task.
+// hash table size, and construct the coarse task.  Each coarse task is created
+// by a single thread, and all coarse tasks are created in parallel.
 
 static inline void GB_create_coarse_task
 (
@@ -116,11 +167,8 @@ static inline void GB_create_coarse_task
     int64_t klast,
     GB_saxpy3task_struct *SaxpyTasks,
     int taskid,         // taskid for this coarse task
-    int64_t *Bflops,    // size bnvec; cum sum of flop counts for vectors of B
+    const int64_t *Bflops,  // size bnvec; cum sum of flop counts for vectors
     int64_t cvlen,      // vector length of B and C
-    double chunk,
-    int nthreads_max,
-    int64_t *Coarse_Work,   // workspace for parallel reduction for flop count
     const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
 )
 {
@@ -129,42 +177,12 @@ static inline void GB_create_coarse_task
     // find the max # of flops for any vector in this task
     //--------------------------------------------------------------------------
 
-    int64_t nk = klast - kfirst + 1 ;
-    int nth = GB_nthreads (nk, chunk, nthreads_max) ;
-
-    // each thread finds the max flop count for a subset of the vectors
-    int tid ;
-    #pragma omp parallel for num_threads(nth) schedule(static)
-    for (tid = 0 ; tid < nth ; tid++)
-    {
-        int64_t my_flmax = 1, istart, iend ;
-        GB_PARTITION (istart, iend, nk, tid, nth) ;
-        for (int64_t i = istart ; i < iend ; i++)
-        { 
-            int64_t kk = kfirst + i ;
-            int64_t fl = Bflops [kk+1] - Bflops [kk] ;
-            my_flmax = GB_IMAX (my_flmax, fl) ;
-        }
-        Coarse_Work [tid] = my_flmax ;
-    }
-
-    // combine results from each thread
     int64_t flmax = 1 ;
-    for (tid = 0 ; tid < nth ; tid++)
-    { 
-        flmax = GB_IMAX (flmax, Coarse_Work [tid]) ;
-    }
-
-    // check the parallel computation
-    #ifdef GB_DEBUG
-    int64_t flmax2 = 1 ;
     for (int64_t kk = kfirst ; kk <= klast ; kk++)
-    {
+    { 
         int64_t fl = Bflops [kk+1] - Bflops [kk] ;
-        flmax2 = GB_IMAX (flmax2, fl) ;
+        flmax = GB_IMAX (flmax, fl) ;
     }
-    ASSERT (flmax == flmax2) ;
-    #endif
 
     //--------------------------------------------------------------------------
     // define the coarse task
@@ -248,9 +266,10 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     size_t SaxpyTasks_size = 0 ;
 
     GB_WERK_DECLARE (Coarse_initial, int64_t) ; // initial coarse tasks
-    GB_WERK_DECLARE (Coarse_Work, int64_t) ;    // workspace for flop counts
+    GB_WERK_DECLARE (Fine_leader, int64_t) ;    // leader of each team
+    GB_WERK_DECLARE (Fine_offset, int64_t) ;    // team t in Fine_fl
     GB_WERK_DECLARE (Fine_slice, int64_t) ;
-    GB_WERK_DECLARE (Fine_fl, int64_t) ;        // size max(nnz(B(:,j)))
+    GB_WERK_DECLARE (Fine_fl, int64_t) ;        // size sum(nnz(B(:,j)))+1
 
     //--------------------------------------------------------------------------
     // get A, and B
@@ -261,6 +280,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     const int64_t avlen = A->vlen ;
     const int64_t anvec = A->nvec ;
     const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
 
     const int64_t *restrict Bp = B->p ;
     const int64_t *restrict Bh = B->h ;
@@ -439,10 +459,13 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     // determine # of parallel tasks
     //--------------------------------------------------------------------------
 
-    int ncoarse = 0 ;       // # of coarse tasks
-    int max_bjnz = 0 ;      // max (nnz (B (:,j))) of fine tasks
+    // A costly vector A*B(:,j) is split into a team of fine tasks.  Each team
+    // uses the entries Fine_offset [t] to Fine_offset [t+1]-1 in the Fine_fl
+    // workspace, for the flop counts of each entry B(k,j) in B(:,j).
 
-    // FUTURE: also use ultra-fine tasks that compute A(i1:i2,k)*B(k,j)
+    int ncoarse = 0 ;       // # of coarse tasks
+    int nteams = 0 ;        // # of vectors B(:,j) split into fine tasks
+    int64_t fine_nz = 0 ;   // sum of nnz (B (:,j)) for all fine tasks
 
     if (ntasks_initial > 1)
     {
@@ -493,7 +516,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -508,7 +531,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         kcoarse_start = kk+1 ;
 
                         // vectors kk will be split into multiple fine tasks
-                        max_bjnz = GB_IMAX (max_bjnz, bjnz) ;
+                        nteams++ ;
+                        fine_nz += bjnz ;
                         int team_size = ceil (jflops / target_fine_size) ;
                         (*nfine) += team_size ;
                     }
@@ -560,19 +584,20 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
 
     SaxpyTasks = GB_MALLOC_WORK ((*ntasks), GB_saxpy3task_struct,
         &SaxpyTasks_size) ;
-    GB_WERK_PUSH (Coarse_Work, nthreads_max, int64_t) ;
-    if (max_bjnz > 0)
+    if (nteams > 0)
     { 
         // also allocate workspace to construct fine tasks
-        GB_WERK_PUSH (Fine_slice, (*ntasks)+1, int64_t) ;
-        // Fine_fl will only fit on the Werk stack if max_bjnz is small,
+        GB_WERK_PUSH (Fine_leader, nteams, int64_t) ;
+        GB_WERK_PUSH (Fine_offset, nteams+1, int64_t) ;
+        GB_WERK_PUSH (Fine_slice, (*nfine) + nteams, int64_t) ;
+        // Fine_fl will only fit on the Werk stack if fine_nz is small,
         // but try anyway, in case it fits.  It is placed at the top of the
         // Werk stack.
-        GB_WERK_PUSH (Fine_fl, max_bjnz+1, int64_t) ;
+        GB_WERK_PUSH (Fine_fl, fine_nz+1, int64_t) ;
     }
 
-    if (SaxpyTasks == NULL || Coarse_Work == NULL ||
-        (max_bjnz > 0 && (Fine_slice == NULL || Fine_fl == NULL)))
+    if (SaxpyTasks == NULL || (nteams > 0 && (Fine_leader == NULL ||
+        Fine_offset == NULL || Fine_slice == NULL || Fine_fl == NULL)))
     { 
         // out of memory
         GB_FREE_ALL ;
@@ -590,11 +615,17 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     {
 
         //----------------------------------------------------------------------
-        // create the coarse and fine tasks
+        // find the vectors of each coarse task, and each team of fine tasks
         //----------------------------------------------------------------------
 
+        // This phase takes O(ntasks_initial) time, plus the time to scan the
+        // vectors in the few initial coarse tasks that are costly.  The
+        // coarse and fine tasks are then constructed in parallel.
+
         int nf = 0 ;            // fine tasks have task id 0:nfine-1
         int nc = (*nfine) ;     // coarse task ids are nfine:ntasks-1
+        int nt = 0 ;            // team id of the next team of fine tasks
+        int64_t nz = 0 ;        // position of the next team in Fine_fl
 
         for (int taskid = 0 ; taskid < ntasks_initial ; taskid++)
         {
@@ -624,77 +655,34 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = (Bp == NULL) ? bvlen : (Bp [kk+1] - Bp [kk]);
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
                         if (kcoarse_start < kk)
                         { 
                             // kcoarse_start:kk-1 form a single coarse task
-                            GB_create_coarse_task (kcoarse_start, kk-1,
-                                SaxpyTasks, nc++, Bflops, cvlen, chunk,
-                                nthreads_max, Coarse_Work, AxB_method) ;
+                            SaxpyTasks [nc].start = kcoarse_start ;
+                            SaxpyTasks [nc].end   = kk-1 ;
+                            nc++ ;
                         }
 
                         // next coarse task (if any) starts at kk+1
                         kcoarse_start = kk+1 ;
 
-                        // count the work for each entry B(k,j).  Do not
-                        // include the work to scan M(:,j), since that will
-                        // be evenly divided between all tasks in this team.
-                        int64_t pB_start = GBP (Bp, kk, bvlen) ;
-                        int nth = GB_nthreads (bjnz, chunk, nthreads_max) ;
-                        int64_t s ;
-                        #pragma omp parallel for num_threads(nth) \
-                            schedule(static)
-                        for (s = 0 ; s < bjnz ; s++)
-                        { 
-                            // get B(k,j)
-                            Fine_fl [s] = 1 ;
-                            int64_t pB = pB_start + s ;
-                            if (!GBB (Bb, pB)) continue ;
-                            int64_t k = GBI (Bi, pB, bvlen) ;
-                            // fl = flop count for just A(:,k)*B(k,j)
-                            int64_t pA, pA_end ;
-                            int64_t pleft = 0 ;
-                            GB_lookup (A_is_hyper, Ah, Ap, avlen, &pleft,
-                                anvec-1, k, &pA, &pA_end) ;
-                            int64_t fl = pA_end - pA ;
-                            Fine_fl [s] = fl ;
-                            ASSERT (fl >= 0) ;
-                        }
-
-                        // cumulative sum of flops to compute A*B(:,j)
-                        GB_cumsum (Fine_fl, bjnz, NULL, nth, Context) ;
-
-                        // slice B(:,j) into fine tasks
+                        // the team for A*B(:,j) is fine tasks nf:nf+team_size-1
                         int team_size = ceil (jflops / target_fine_size) ;
-                        ASSERT (Fine_slice != NULL) ;
-                        GB_pslice (Fine_slice, Fine_fl, bjnz, team_size, false);
-
-                        // shared hash table for all fine tasks for A*B(:,j)
-                        int64_t hsize = 
-                            GB_hash_table_size (jflops, cvlen, AxB_method) ;
-
-                        // construct the fine tasks for C(:,j)=A*B(:,j)
-                        int leader = nf ;
                         for (int fid = 0 ; fid < team_size ; fid++)
                         { 
-                            int64_t pstart = Fine_slice [fid] ;
-                            int64_t pend   = Fine_slice [fid+1] ;
-                            int64_t fl = Fine_fl [pend] - Fine_fl [pstart] ;
-                            SaxpyTasks [nf].start  = pB_start + pstart ;
-                            SaxpyTasks [nf].end    = pB_start + pend - 1 ;
-                            SaxpyTasks [nf].vector = kk ;
-                            SaxpyTasks [nf].hsize  = hsize ;
-                            SaxpyTasks [nf].Hi = NULL ;   // assigned later
-                            SaxpyTasks [nf].Hf = NULL ;   // assigned later
-                            SaxpyTasks [nf].Hx = NULL ;   // assigned later
-                            SaxpyTasks [nf].my_cjnz = 0 ;
-                            SaxpyTasks [nf].leader = leader ;
-                            SaxpyTasks [nf].team_size = team_size ;
-                            nf++ ;
+                            SaxpyTasks [nf+fid].vector = kk ;
+                            SaxpyTasks [nf+fid].leader = nf ;
+                            SaxpyTasks [nf+fid].team_size = team_size ;
                         }
+                        Fine_leader [nt] = nf ;
+                        Fine_offset [nt] = nz ;
+                        nf += team_size ;
+                        nz += bjnz ;
+                        nt++ ;
                     }
                 }
 
@@ -702,18 +690,146 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                 if (kcoarse_start < klast)
                 { 
                     // kcoarse_start:klast-1 form a single coarse task
-                    GB_create_coarse_task (kcoarse_start, klast-1, SaxpyTasks,
-                        nc++, Bflops, cvlen, chunk, nthreads_max,
-                        Coarse_Work, AxB_method) ;
+                    SaxpyTasks [nc].start = kcoarse_start ;
+                    SaxpyTasks [nc].end   = klast-1 ;
+                    nc++ ;
                 }
 
             }
             else
             { 
                 // This coarse task is OK as-is.
-                GB_create_coarse_task (kfirst, klast-1, SaxpyTasks,
-                    nc++, Bflops, cvlen, chunk, nthreads_max,
-                    Coarse_Work, AxB_method) ;
+                SaxpyTasks [nc].start = kfirst ;
+                SaxpyTasks [nc].end   = klast-1 ;
+                nc++ ;
+            }
+        }
+
+        ASSERT (nf == (*nfine) && nc == (*ntasks)) ;
+        ASSERT (nt == nteams && nz == fine_nz) ;
+
+        //----------------------------------------------------------------------
+        // create the coarse tasks
+        //----------------------------------------------------------------------
+
+        int nth = GB_nthreads (bnvec, chunk, nthreads_max) ;
+        nth = GB_IMIN (nth, ncoarse) ;
+        int taskid ;
+        #pragma omp parallel for num_threads(nth) schedule(dynamic,1)
+        for (taskid = (*nfine) ; taskid < (*ntasks) ; taskid++)
+        { 
+            GB_create_coarse_task (SaxpyTasks [taskid].start,
+                SaxpyTasks [taskid].end, SaxpyTasks, taskid, Bflops, cvlen,
+                AxB_method) ;
+        }
+
+        if (nteams > 0)
+        {
+
+            //------------------------------------------------------------------
+            // count the work for each entry B(k,j) of all fine tasks
+            //------------------------------------------------------------------
+
+            // Do not include the work to scan M(:,j), since that will be
+            // evenly divided between all tasks in each team.  All entries
+            // B(k,j) of all teams are counted in a single parallel loop, so
+            // that a single large team and many small teams are handled with
+            // the same balanced effort.
+
+            Fine_offset [nteams] = fine_nz ;
+            nth = GB_nthreads (fine_nz, chunk, nthreads_max) ;
+            int tid ;
+            #pragma omp parallel for num_threads(nth) schedule(static)
+            for (tid = 0 ; tid < nth ; tid++)
+            {
+                int64_t sfirst, slast ;
+                GB_PARTITION (sfirst, slast, fine_nz, tid, nth) ;
+                if (sfirst >= slast) continue ;
+                // find the team that owns the entry at position sfirst
+                int64_t team = GB_search_for_vector (sfirst, Fine_offset, 0,
+                    nteams, 0) ;
+                for (int64_t s = sfirst ; s < slast ; s++)
+                {
+                    // advance to the team that owns the entry at position s
+                    while (s >= Fine_offset [team+1])
+                    { 
+                        team++ ;
+                    }
+                    // get B(k,j)
+                    Fine_fl [s] = 1 ;
+                    int64_t kk = SaxpyTasks [Fine_leader [team]].vector ;
+                    int64_t pB = GBP (Bp, kk, bvlen) + (s - Fine_offset [team]);
+                    if (!GBB (Bb, pB)) continue ;
+                    int64_t k = GBI (Bi, pB, bvlen) ;
+                    // fl = flop count for just A(:,k)*B(k,j)
+                    int64_t pA, pA_end ;
+                    int64_t pleft = 0 ;
+                    GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, avlen,
+                        A_hyper_hash, &pleft, anvec-1, k, &pA, &pA_end) ;
+                    int64_t fl = pA_end - pA ;
+                    Fine_fl [s] = fl ;
+                    ASSERT (fl >= 0) ;
+                }
+            }
+
+            // cumulative sum of flops for all entries of all fine tasks
+            GB_cumsum (Fine_fl, fine_nz, NULL, nth, Context) ;
+
+            //------------------------------------------------------------------
+            // create the fine tasks
+            //------------------------------------------------------------------
+
+            nth = GB_IMIN (nteams, nthreads_max) ;
+            int team ;
+            #pragma omp parallel for num_threads(nth) schedule(dynamic,1)
+            for (team = 0 ; team < nteams ; team++)
+            {
+                // get the team for C(:,j)=A*B(:,j)
+                int leader = (int) Fine_leader [team] ;
+                int team_size = SaxpyTasks [leader].team_size ;
+                int64_t kk = SaxpyTasks [leader].vector ;
+                int64_t pB_start = GBP (Bp, kk, bvlen) ;
+                int64_t bjnz = Fine_offset [team+1] - Fine_offset [team] ;
+                double jflops = Bflops [kk+1] - Bflops [kk] ;
+                const int64_t *restrict Team_fl = Fine_fl + Fine_offset [team];
+                int64_t *restrict Team_slice = Fine_slice + leader + team ;
+
+                // slice the flops for A*B(:,j) into fine tasks
+                GB_fine_slice (Team_slice, Team_fl, bjnz, team_size) ;
+
+                // shared hash table for all fine tasks for A*B(:,j)
+                int64_t hsize = GB_hash_table_size (jflops, cvlen, AxB_method) ;
+
+                // construct the fine tasks for C(:,j)=A*B(:,j)
+                for (int fid = 0 ; fid < team_size ; fid++)
+                {
+                    // this task does the flops fstart:fend-1
+                    int64_t fstart = Team_slice [fid] ;
+                    int64_t fend   = Team_slice [fid+1] ;
+                    int64_t pstart = 0, pend = 0 ;
+                    int64_t askip_first = 0, askip_last = 0 ;
+                    if (fstart < fend)
+                    { 
+                        // first and last entries B(k,j) of this task
+                        pstart = GB_search_for_vector (fstart, Team_fl, 0,
+                            bjnz, 0) ;
+                        pend = GB_search_for_vector (fend-1, Team_fl, pstart,
+                            bjnz, 0) + 1 ;
+                        // parts of A(:,k) to skip for those entries
+                        askip_first = fstart - Team_fl [pstart] ;
+                        askip_last  = Team_fl [pend] - fend ;
+                    }
+                    int f = leader + fid ;
+                    SaxpyTasks [f].start  = pB_start + pstart ;
+                    SaxpyTasks [f].end    = pB_start + pend - 1 ;
+                    SaxpyTasks [f].askip_first = askip_first ;
+                    SaxpyTasks [f].askip_last  = askip_last ;
+                    SaxpyTasks [f].hsize  = hsize ;
+                    SaxpyTasks [f].Hi = NULL ;   // assigned later
+                    SaxpyTasks [f].Hf = NULL ;   // assigned later
+                    SaxpyTasks [f].Hx = NULL ;   // assigned later
+                    SaxpyTasks [f].my_cjnz = 0 ;
+                }
             }
         }
 
@@ -726,8 +842,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         //----------------------------------------------------------------------
 
         // create a single coarse task: hash or Gustavson
-        GB_create_coarse_task (0, bnvec-1, SaxpyTasks, 0, Bflops, cvlen, 1, 1,
-            Coarse_Work, AxB_method) ;
+        GB_create_coarse_task (0, bnvec-1, SaxpyTasks, 0, Bflops, cvlen,
+            AxB_method) ;
 
         if (bnvec == 1)
         { 
@@ -747,4 +863,3 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
     return (GrB_SUCCESS) ;
 }
-
@@ -0,0 +1,247 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_cached: construct or reuse balanced tasks for saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The flop count analysis and task construction of GB_AxB_saxpy3_slice_balanced
+// can take a significant fraction of the total time of C=A*B, particularly for
+// medium-sized problems.  Iterative methods often compute C=A*B, C<M>=A*B, or
+// C<!M>=A*B many times with the same matrices A, B, and M.  In this case, the
+// tasks constructed by GB_AxB_saxpy3_slice_balanced are identical each time,
+// and are kept in a short list attached to B, so that they can be reused.
+
+// The tasks depend only on the patterns of A, B, and M, and the settings of
+// Mask_comp, AxB_method, nthreads_max, and chunk.  Each entry in the list
+// B->saxpy3_cache records the stamps of A and M (see GB_stamp) and these
+// settings, so the entry for the current problem is found in O(1) time per
+// entry.  A stamp changes whenever its matrix is modified, and is never
+// reused by any other matrix, so an entry can never match a problem whose
+// matrices differ from the ones the tasks were constructed for.  The list is
+// freed whenever B is stamped.  An entry for a matrix A or M that has since
+// been modified or freed can never be matched again, but it stays in the list
+// until B is stamped.  Once the list holds GB_SAXPY3_CACHE_SIZE entries, no
+// more tasks are cached for B.
+
+// B is an input matrix, and other user threads may use it as an input at the
+// same time, so the list is never modified except to add a new entry at its
+// head, with an atomic compare/exchange.  No entry is modified or freed while
+// B can be used as an input.  No critical section is needed.
+
+// An entry holds only the list of tasks, without any workspace, and the
+// mask-handling decisions made by GB_AxB_saxpy3_slice_balanced.  If that
+// method decided to discard the mask (returning GrB_NO_VALUE), this outcome is
+// cached as well.  The entries are allocated with GB_MALLOC, not from the
+// werkspace (or a GxB_Arena), since they persist after the method returns.
+
+#include "GB_AxB_saxpy3.h"
+#include "GB_atomics.h"
+
+#define GB_SAXPY3_CACHE_SIZE 4
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_cached: create balanced tasks, or reuse them
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_slice_cached
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix M,             // optional mask matrix
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B; only its cache modified
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    bool *apply_mask,               // if true, apply M during sapxy3
+    bool *M_in_place,               // if true, use M in-place
+    int *ntasks,                    // # of tasks created (coarse and fine)
+    int *nfine,                     // # of fine tasks created
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (SaxpyTasks_handle != NULL && (*SaxpyTasks_handle) == NULL) ;
+    ASSERT (B != C) ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    const int64_t A_stamp = A->stamp ;
+    const int64_t M_stamp = (M == NULL) ? 0 : M->stamp ;
+
+    //--------------------------------------------------------------------------
+    // look for the tasks in the list B->saxpy3_cache
+    //--------------------------------------------------------------------------
+
+    struct GB_saxpy3_cache_struct *head, *entry ;
+    GB_ATOMIC_READ
+    head = B->saxpy3_cache ;
+
+    for (entry = head ; entry != NULL ; entry = entry->next)
+    {
+        if (entry->A_stamp == A_stamp && entry->M_stamp == M_stamp &&
+            entry->Mask_comp == Mask_comp && entry->AxB_method == AxB_method &&
+            entry->nthreads_max == nthreads_max && entry->chunk == chunk)
+        { 
+            break ;
+        }
+    }
+
+    if (entry != NULL)
+    {
+        // make a copy of the cached tasks
+        GB_saxpy3task_struct *SaxpyTasks = NULL ;
+        size_t SaxpyTasks_size = 0 ;
+        if (entry->ntasks > 0)
+        {
+            SaxpyTasks = GB_MALLOC_WORK (entry->ntasks, GB_saxpy3task_struct,
+                &SaxpyTasks_size) ;
+            if (SaxpyTasks == NULL)
+            { 
+                // out of memory
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            memcpy (SaxpyTasks, entry->SaxpyTasks,
+                entry->ntasks * sizeof (GB_saxpy3task_struct)) ;
+        }
+        GBURBLE ("(cached tasks) ") ;
+        (*SaxpyTasks_handle) = SaxpyTasks ;
+        (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+        (*apply_mask) = entry->apply_mask ;
+        (*M_in_place) = entry->M_in_place ;
+        (*ntasks)     = entry->ntasks ;
+        (*nfine)      = entry->nfine ;
+        (*nthreads)   = entry->nthreads ;
+        return (entry->info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the tasks
+    //--------------------------------------------------------------------------
+
+    info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
+        SaxpyTasks_handle, SaxpyTasks_size_handle, apply_mask, M_in_place,
+        ntasks, nfine, nthreads, Context) ;
+    if (!(info == GrB_SUCCESS || info == GrB_NO_VALUE))
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    if (head != NULL && head->count >= GB_SAXPY3_CACHE_SIZE)
+    { 
+        // the list is full
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // save a copy of the tasks in a new entry
+    //--------------------------------------------------------------------------
+
+    // If out of memory, the tasks are simply not cached.
+
+    size_t header_size ;
+    entry = GB_MALLOC (1, struct GB_saxpy3_cache_struct, &header_size) ;
+    if (entry == NULL)
+    { 
+        // out of memory; do not cache the tasks
+        return (info) ;
+    }
+    memset (entry, 0, sizeof (struct GB_saxpy3_cache_struct)) ;
+    entry->header_size = header_size ;
+    entry->A_stamp = A_stamp ;
+    entry->M_stamp = M_stamp ;
+    entry->Mask_comp = Mask_comp ;
+    entry->AxB_method = AxB_method ;
+    entry->nthreads_max = nthreads_max ;
+    entry->chunk = chunk ;
+    entry->info = info ;
+    if (info == GrB_SUCCESS)
+    { 
+        entry->apply_mask = (*apply_mask) ;
+        entry->M_in_place = (*M_in_place) ;
+        entry->ntasks     = (*ntasks) ;
+        entry->nfine      = (*nfine) ;
+        entry->nthreads   = (*nthreads) ;
+    }
+    if (entry->ntasks > 0)
+    {
+        entry->SaxpyTasks = GB_MALLOC (entry->ntasks, GB_saxpy3task_struct,
+            &(entry->SaxpyTasks_size)) ;
+        if (entry->SaxpyTasks == NULL)
+        { 
+            // out of memory; do not cache the tasks
+            GB_FREE (&entry, header_size) ;
+            return (info) ;
+        }
+        memcpy (entry->SaxpyTasks, *SaxpyTasks_handle,
+            entry->ntasks * sizeof (GB_saxpy3task_struct)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // add the new entry to the head of the list, unless the list is full
+    //--------------------------------------------------------------------------
+
+    while (true)
+    {
+        entry->next = head ;
+        entry->count = (head == NULL) ? 1 : (head->count + 1) ;
+        int64_t expected = (int64_t) head ;
+        int64_t desired = (int64_t) entry ;
+        if (GB_ATOMIC_COMPARE_EXCHANGE_64 ((int64_t *) (&(B->saxpy3_cache)),
+            expected, desired))
+        { 
+            // the entry has been added to the list
+            break ;
+        }
+        // another thread may have added an entry to the list
+        GB_ATOMIC_READ
+        head = B->saxpy3_cache ;
+        if (head != NULL && head->count >= GB_SAXPY3_CACHE_SIZE)
+        { 
+            // the list is full; do not cache the tasks
+            GB_FREE (&(entry->SaxpyTasks), entry->SaxpyTasks_size) ;
+            GB_FREE (&entry, header_size) ;
+            break ;
+        }
+    }
+
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cache_free: free the cached saxpy3 tasks of a matrix
+//------------------------------------------------------------------------------
+
+// This is called by GB_stamp whenever B is modified, when no other user
+// thread can be using B.
+
+void GB_AxB_saxpy3_cache_free   // free the cached saxpy3 tasks of B, if any
+(
+    GrB_Matrix B                // matrix with cached tasks to free
+)
+{
+
+    if (B != NULL)
+    {
+        struct GB_saxpy3_cache_struct *entry = B->saxpy3_cache ;
+        while (entry != NULL)
+        { 
+            struct GB_saxpy3_cache_struct *next = entry->next ;
+            GB_FREE (&(entry->SaxpyTasks), entry->SaxpyTasks_size) ;
+            size_t header_size = entry->header_size ;
+            GB_FREE (&entry, header_size) ;
+            entry = next ;
+        }
+        B->saxpy3_cache = NULL ;
+    }
+}
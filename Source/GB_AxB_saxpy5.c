@@ -18,7 +18,8 @@
 // Typically, if B is a large sparse matrix, the number of columns of A and C
 // will be large, so A and C will typically be short-and-fat dense matrices.
 // As a result, only a coarse-grain method is used, where no atomics are
-// needed.
+// needed.  If A is full and too large for the cache, the unrolled kernel
+// computes C+=A*B one k-block of A at a time (see GB_AxB_saxpy5_kblock).
 
 // The ANY monoid is not supported, since its use as accum would be unusual.
 // FIXME: if the monoid is ANY, quick return GrB_SUCCESS and done_in_place
@@ -138,6 +139,22 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int nthreads = GB_nthreads (anz + bnz, chunk, nthreads_max) ;
     int ntasks = (nthreads == 1) ? 1 : 4 * nthreads ;
+
+    // If A is full and valued, and too large to fit in cache, the unrolled
+    // kernel computes C+=A*B one k-block at a time (see GB_AxB_saxpy5_kblock),
+    // and each task can do at most GB_SAXPY5_JPANEL vectors of B.
+    bool use_kblocks = false ;
+    if (GB_as_if_full (A) && !A->iso && !A_is_pattern)
+    {
+        int64_t kblock = GB_AxB_saxpy5_kblock (A, B) ;
+        use_kblocks = (kblock < B->vlen) ;
+        if (use_kblocks)
+        { 
+            GBURBLE ("(kblock: %g) ", (double) kblock) ;
+            ntasks = GB_IMAX (ntasks, GB_ICEIL (bnvec, GB_SAXPY5_JPANEL)) ;
+        }
+    }
+
     ntasks = GB_IMIN (ntasks, bnvec) ;
     GB_WERK_PUSH (B_slice, ntasks + 1, int64_t) ;
     if (B_slice == NULL)
@@ -146,7 +163,20 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
         GB_FREE_WORKSPACE ;
         return (GrB_OUT_OF_MEMORY) ;
     }
-    GB_pslice (B_slice, B->p, bnvec, ntasks, false) ;
+    if (use_kblocks)
+    {
+        // split B into tasks with the same # of vectors each
+        for (int tid = 0 ; tid < ntasks ; tid++)
+        { 
+            B_slice [tid] = GB_PART (tid, bnvec, ntasks) ;
+        }
+        B_slice [ntasks] = bnvec ;
+    }
+    else
+    { 
+        // split B into tasks with about the same # of entries each
+        GB_pslice (B_slice, B->p, bnvec, ntasks, false) ;
+    }
 
     //--------------------------------------------------------------------------
     // define the worker for the switch factory
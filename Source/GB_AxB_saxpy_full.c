@@ -0,0 +1,211 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_full: compute C=A*B with saxpy4 or saxpy5, C full or bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy_full computes C=A*B with no mask and no accumulator, where
+// either A is sparse/hyper and B is as-if-full (with GB_AxB_saxpy4), or A is
+// as-if-full and B is sparse/hyper (with GB_AxB_saxpy5).  This is the typical
+// sparse-times-dense product with a tall-and-thin dense matrix, such as C=A*X
+// where A is the adjacency matrix of a graph and X holds a few features for
+// each node.  If the matrices are held by row, this product becomes C'=X'*A',
+// which is done by saxpy5 instead of saxpy4.
+
+// C is first created as a full matrix with all entries equal to the identity
+// value of the monoid, and then C+=A*B is computed in-place by saxpy4 or
+// saxpy5.  No workspace is needed to keep track of which entries of C are
+// present.  If B is full, C(i,j) is present if and only if A(i,:) has at least
+// one entry.  If A is full, C(:,j) is present if and only if B(:,j) has at
+// least one entry.  If any entries of C are not present, C is converted to
+// bitmap.
+
+// If saxpy4 or saxpy5 cannot be used for this semiring, GrB_NO_VALUE is
+// returned, C is freed, and the caller must use another method.
+
+#include "GB_mxm.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Marker, Marker_size) ;   \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phbix_free (C) ;                     \
+}
+
+GrB_Info GB_AxB_saxpy_full          // C = A*B with C full or bitmap
+(
+    GrB_Matrix C,                   // output, static header
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int8_t *restrict Marker = NULL ; size_t Marker_size = 0 ;
+    ASSERT (C != NULL && C->static_header) ;
+    ASSERT_MATRIX_OK (A, "A for saxpy full C=A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for saxpy full C=A*B", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for saxpy full C=A*B", GB0) ;
+    ASSERT (A->vdim == B->vlen) ;
+
+    const bool A_is_sparse = GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A) ;
+    ASSERT (GB_IMPLIES (A_is_sparse, GB_as_if_full (B))) ;
+    ASSERT (GB_IMPLIES (!A_is_sparse, GB_as_if_full (A) &&
+        (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)))) ;
+
+    //--------------------------------------------------------------------------
+    // create C as an iso full matrix, with all entries equal to the identity
+    //--------------------------------------------------------------------------
+
+    GrB_Monoid add = semiring->add ;
+    GrB_Type ztype = add->op->ztype ;
+    const int64_t cvlen = A->vlen ;
+    const int64_t cvdim = B->vdim ;
+    // set C->iso = true    OK
+    GB_OK (GB_new_bix (&C, true,    // static header
+        ztype, cvlen, cvdim, GB_Ap_null, true, GxB_FULL, false,
+        GB_HYPER_SWITCH_DEFAULT, -1, 1, true, true, Context)) ;
+    C->magic = GB_MAGIC ;
+    memcpy (C->x, add->identity, ztype->size) ;
+
+    //--------------------------------------------------------------------------
+    // C += A*B, with saxpy4 or saxpy5
+    //--------------------------------------------------------------------------
+
+    // C is converted to non-iso by saxpy4 or saxpy5, if they are used.
+    bool done = false ;
+    if (A_is_sparse)
+    { 
+        info = GB_AxB_saxpy4 (C, A, B, semiring, flipxy, &done, Context) ;
+    }
+    else
+    { 
+        info = GB_AxB_saxpy5 (C, A, B, semiring, flipxy, &done, Context) ;
+    }
+    if (info != GrB_SUCCESS)
+    { 
+        // saxpy4 and saxpy5 do not handle this semiring, or out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+    ASSERT (done) ;
+
+    //--------------------------------------------------------------------------
+    // find the rows (if A is sparse) or columns (if A is full) of C present
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    const int64_t n = A_is_sparse ? cvlen : cvdim ;
+    Marker = GB_CALLOC_WORK (n, int8_t, &Marker_size) ;
+    if (Marker == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    if (A_is_sparse)
+    {
+        // Marker [i] = 1 if A(i,:) has at least one entry
+        const int64_t *restrict Ai = A->i ;
+        const int64_t anz = GB_nnz (A) ;
+        int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < anz ; p++)
+        { 
+            const int64_t i = Ai [p] ;
+            GB_ATOMIC_WRITE
+            Marker [i] = 1 ;
+        }
+    }
+    else
+    {
+        // Marker [j] = 1 if B(:,j) has at least one entry
+        const int64_t *restrict Bp = B->p ;
+        const int64_t *restrict Bh = B->h ;
+        const int64_t bnvec = B->nvec ;
+        int nthreads = GB_nthreads (bnvec, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < bnvec ; k++)
+        { 
+            Marker [GBH (Bh, k)] = (Bp [k+1] > Bp [k]) ;
+        }
+    }
+
+    int64_t nmarked = 0 ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    int64_t t ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nmarked)
+    for (t = 0 ; t < n ; t++)
+    { 
+        nmarked += Marker [t] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert C to bitmap if any rows or columns of C are empty
+    //--------------------------------------------------------------------------
+
+    if (nmarked < n)
+    {
+        GBURBLE ("(C bitmap: %g of %g %s present) ", (double) nmarked,
+            (double) n, A_is_sparse ? "rows" : "columns") ;
+        const int64_t cnz = cvlen * cvdim ;
+        int8_t *restrict Cb = GB_MALLOC (cnz, int8_t, &(C->b_size)) ;
+        if (Cb == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        C->b = Cb ;
+        nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+        int64_t pC ;
+        if (A_is_sparse)
+        {
+            // C(i,j) is present if A(i,:) has any entries
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (pC = 0 ; pC < cnz ; pC++)
+            { 
+                Cb [pC] = Marker [pC % cvlen] ;
+            }
+            C->nvals = nmarked * cvdim ;
+        }
+        else
+        {
+            // C(:,j) is present if B(:,j) has any entries
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (pC = 0 ; pC < cnz ; pC++)
+            { 
+                Cb [pC] = Marker [pC / cvlen] ;
+            }
+            C->nvals = nmarked * cvlen ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C output for saxpy full C=A*B", GB0) ;
+    ASSERT (GB_IS_FULL (C) || GB_IS_BITMAP (C)) ;
+    return (GrB_SUCCESS) ;
+}
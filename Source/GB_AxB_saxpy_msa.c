@@ -0,0 +1,450 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_msa: compute C<M>=A*B, driven by the entries of a sparse mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This function only computes C<M>=A*B where M is very sparse compared with
+// the flop count of A*B (see GB_AxB_saxpy_msa_control).  The mask must be
+// present, not complemented, and sparse or hypersparse, and can be either
+// valued or structural.  The mask is always applied.  A and B are sparse or
+// hypersparse, and are used in their native layout; A is not transposed.
+
+// C has the same pattern as M, and C(:,j) is computed with the entries of
+// C(:,j) as a masked sparse accumulator (MSA): for each entry B(k,j), A(:,k)
+// is intersected with M(:,j), with a galloping search when one is much longer
+// than the other.  The work is O(nnz(M) + sum over B(k,j) of the cost of
+// merging A(:,k) and M(:,j)), and no entry A(i,k) is touched unless it lies
+// within the range of the row indices of M(:,j).  Entries of M not in the
+// pattern of A*B become zombies in C.
+
+// Only the generic method with typecasting is used, with the mask-driven
+// kernel in Template/GB_AxB_saxpy_msa_template.c.
+
+#include "GB_mxm.h"
+#include "GB_binop.h"
+#include "GB_ek_slice.h"
+#include "GB_binary_search.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (M_ek_slicing, int64_t) ;   \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phbix_free (C) ;                     \
+}
+
+GrB_Info GB_AxB_saxpy_msa           // C<M>=A*B, driven by the mask
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && C->static_header) ;
+    GB_WERK_DECLARE (M_ek_slicing, int64_t) ;
+    int M_nthreads, M_ntasks ;
+
+    ASSERT_MATRIX_OK (M, "M for masked saxpy C<M>=A*B", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for masked saxpy C<M>=A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for masked saxpy C<M>=A*B", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for masked saxpy C<M>=A*B", GB0) ;
+
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT (!GB_JUMBLED (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ;
+    ASSERT (A->vdim == B->vlen) ;
+    ASSERT (A->vlen == M->vlen && B->vdim == M->vdim) ;
+
+    GBURBLE ("(%s%s%s%s = %s*%s, masked saxpy) ",
+        GB_sparsity_char_matrix (M),    // C has the same sparsity as M
+        Mask_struct ? "{" : "<",
+        GB_sparsity_char_matrix (M),
+        Mask_struct ? "}" : ">",
+        GB_sparsity_char_matrix (A),
+        GB_sparsity_char_matrix (B)) ;
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+
+    GB_Opcode opcode = mult->opcode ;
+    bool op_is_first  = opcode == GB_FIRST_binop_code ;
+    bool op_is_second = opcode == GB_SECOND_binop_code ;
+    bool op_is_pair   = opcode == GB_PAIR_binop_code ;
+    bool op_is_positional = GB_OPCODE_IS_POSITIONAL (opcode) ;
+    bool A_is_pattern = false ;
+    bool B_is_pattern = false ;
+
+    if (flipxy)
+    {
+        // z = fmult (b,a) will be computed
+        A_is_pattern = op_is_first  || op_is_pair || op_is_positional ;
+        B_is_pattern = op_is_second || op_is_pair || op_is_positional ;
+    }
+    else
+    {
+        // z = fmult (a,b) will be computed
+        A_is_pattern = op_is_second || op_is_pair || op_is_positional ;
+        B_is_pattern = op_is_first  || op_is_pair || op_is_positional ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine if C is iso
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = add->op->ztype ;
+    size_t csize = ctype->size ;
+    GB_void cscalar [GB_VLA(csize)] ;
+    bool C_iso = GB_iso_AxB (cscalar, A, B, A->vdim, semiring, flipxy, false) ;
+
+    //--------------------------------------------------------------------------
+    // get M, A, and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Mp = M->p ;
+    const int64_t *restrict Mh = M->h ;
+    const int64_t *restrict Mi = M->i ;
+    const GB_void *restrict Mx = (GB_void *) (Mask_struct ? NULL : (M->x)) ;
+    const size_t msize = M->type->size ;
+    const int64_t mvlen = M->vlen ;
+    const int64_t mnz = GB_nnz (M) ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const bool A_is_hyper = GB_IS_HYPERSPARSE (A) ;
+    const bool A_iso = A->iso ;
+
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bh = B->h ;
+    const int64_t *restrict Bi = B->i ;
+    const GB_void *restrict Bx = (GB_void *) B->x ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t bnvec = B->nvec ;
+    const bool B_is_hyper = GB_IS_HYPERSPARSE (B) ;
+    const bool B_iso = B->iso ;
+
+    //--------------------------------------------------------------------------
+    // allocate C, the same size and # of entries as M
+    //--------------------------------------------------------------------------
+
+    int64_t cnvec = M->nvec ;
+    int C_sparsity = GB_IS_HYPERSPARSE (M) ? GxB_HYPERSPARSE : GxB_SPARSE ;
+
+    // set C->iso = C_iso   OK
+    GB_OK (GB_new_bix (&C, true, // sparse or hyper (from M), static header
+        ctype, M->vlen, M->vdim, GB_Ap_malloc, true,
+        C_sparsity, true, M->hyper_switch, cnvec, mnz, true, C_iso, Context)) ;
+
+    int64_t *restrict Cp = C->p ;
+    int64_t *restrict Ch = C->h ;
+    int64_t *restrict Ci = C->i ;
+
+    //--------------------------------------------------------------------------
+    // copy Mp and Mh into C
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (cnvec, chunk, nthreads_max) ;
+    GB_memcpy (Cp, Mp, (cnvec+1) * sizeof (int64_t), nthreads) ;
+    if (Mh != NULL)
+    {
+        GB_memcpy (Ch, Mh, cnvec * sizeof (int64_t), nthreads) ;
+    }
+    C->nvec_nonempty = M->nvec_nonempty ;
+    C->nvec = cnvec ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // slice the entries of M
+    //--------------------------------------------------------------------------
+
+    // Each task owns a contiguous part of the entries of M, and thus of C.
+    // Vectors of M shared by more than one task are computed in parts, each
+    // with all of B(:,j).
+
+    double work = mnz + M->nvec + GB_nnz (B) ;
+    GB_SLICE_MATRIX_WORK (M, 8, chunk, work) ;
+
+    //--------------------------------------------------------------------------
+    // build the hash indices of A->h and B->h, if needed
+    //--------------------------------------------------------------------------
+
+    // Each entry B(k,j) requires a search for A(:,k) in the hyperlist of A,
+    // and each vector M(:,j) requires a search for B(:,j) in the hyperlist of
+    // B.  Both searches take O(1) time with a hash index.
+
+    GB_hyper_hash_build (A, Context) ;
+    GB_hyper_hash_build (B, Context) ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
+    const GB_Hyper_hash B_hyper_hash = GB_hyper_hash_get (B) ;
+
+    GBURBLE ("nthreads %d ntasks %d ", M_nthreads, M_ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = A*B
+    //--------------------------------------------------------------------------
+
+    if (C_iso)
+    {
+
+        //----------------------------------------------------------------------
+        // C is iso; compute only its pattern
+        //----------------------------------------------------------------------
+
+        memcpy (C->x, cscalar, csize) ;
+        #define GB_C_ISO 1
+        #define GB_GETB(bkj,Bx,pB,B_iso) ;
+        #include "GB_AxB_saxpy_msa_template.c"
+        #undef  GB_C_ISO
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C is non-iso; use function pointers and typecasting
+        //----------------------------------------------------------------------
+
+        GB_BURBLE_MATRIX (C, "(generic C<M>=A*B) ") ;
+
+        GxB_binary_function fmult = mult->binop_function ; // NULL if positional
+        GxB_binary_function fadd  = add->op->binop_function ;
+
+        size_t asize = A_is_pattern ? 0 : A->type->size ;
+        size_t bsize = B_is_pattern ? 0 : B->type->size ;
+
+        // scalar workspace: because of typecasting, the x/y types need not
+        // be the same as the size of the A and B types.
+        // flipxy false: aik = (xtype) A(i,k) and bkj = (ytype) B(k,j)
+        // flipxy true:  aik = (ytype) A(i,k) and bkj = (xtype) B(k,j)
+        size_t xsize = mult->xtype->size ;
+        size_t ysize = mult->ytype->size ;
+        size_t aik_size = flipxy ? ysize : xsize ;
+        size_t bkj_size = flipxy ? xsize : ysize ;
+
+        GB_cast_function cast_A = NULL, cast_B = NULL ;
+        if (!A_is_pattern)
+        {
+            cast_A = GB_cast_factory (
+                (flipxy ? mult->ytype : mult->xtype)->code, A->type->code) ;
+        }
+        if (!B_is_pattern)
+        {
+            cast_B = GB_cast_factory (
+                (flipxy ? mult->xtype : mult->ytype)->code, B->type->code) ;
+        }
+
+        #define GB_C_ISO 0
+
+        if (op_is_positional)
+        {
+
+            //------------------------------------------------------------------
+            // generic semirings with positional multiply operators
+            //------------------------------------------------------------------
+
+            if (flipxy)
+            {
+                // flip a positional multiplicative operator
+                bool handled ;
+                opcode = GB_flip_binop_code (opcode, &handled) ;
+                ASSERT (handled) ;      // all positional ops can be flipped
+            }
+
+            // the values of A and B are not used
+            #define GB_GETA(aik,Ax,pA,A_iso) ;
+            #undef  GB_GETB
+            #define GB_GETB(bkj,Bx,pB,B_iso) ;
+
+            // t = the positional result
+            #define GB_CIJ_DECLARE(t) GB_CTYPE t
+
+            // Cx [p] = t
+            #define GB_PUTC(t,p) Cx [p] = t
+
+            // Cx [p] += t
+            #define GB_CIJ_UPDATE(p,t) fadd (&Cx [p], &Cx [p], &t)
+
+            int64_t offset = GB_positional_offset (opcode, NULL) ;
+
+            if (mult->ztype == GrB_INT64)
+            {
+                #define GB_CTYPE int64_t
+                switch (opcode)
+                {
+                    case GB_FIRSTI_binop_code   :   // first_i(A(i,k),y) == i
+                    case GB_FIRSTI1_binop_code  :   // first_i1(A(i,k),y) == i+1
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = i + offset
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    case GB_FIRSTJ_binop_code   :   // first_j(A(i,k),y) == k
+                    case GB_FIRSTJ1_binop_code  :   // first_j1(A(i,k),y) == k+1
+                    case GB_SECONDI_binop_code  :   // second_i(x,B(k,j)) == k
+                    case GB_SECONDI1_binop_code :   // second_i1(x,B(k,j))== k+1
+                        #undef  GB_MULT
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = k + offset
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    case GB_SECONDJ_binop_code  :   // second_j(x,B(k,j)) == j
+                    case GB_SECONDJ1_binop_code :   // second_j1(x,B(k,j))== j+1
+                        #undef  GB_MULT
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = j + offset
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    default: ;
+                }
+            }
+            else
+            {
+                #undef  GB_CTYPE
+                #define GB_CTYPE int32_t
+                switch (opcode)
+                {
+                    case GB_FIRSTI_binop_code   :   // first_i(A(i,k),y) == i
+                    case GB_FIRSTI1_binop_code  :   // first_i1(A(i,k),y) == i+1
+                        #undef  GB_MULT
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = (int32_t) (i+offset)
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    case GB_FIRSTJ_binop_code   :   // first_j(A(i,k),y) == k
+                    case GB_FIRSTJ1_binop_code  :   // first_j1(A(i,k),y) == k+1
+                    case GB_SECONDI_binop_code  :   // second_i(x,B(k,j)) == k
+                    case GB_SECONDI1_binop_code :   // second_i1(x,B(k,j))== k+1
+                        #undef  GB_MULT
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = (int32_t) (k+offset)
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    case GB_SECONDJ_binop_code  :   // second_j(x,B(k,j)) == j
+                    case GB_SECONDJ1_binop_code :   // second_j1(x,B(k,j))== j+1
+                        #undef  GB_MULT
+                        #define GB_MULT(t,aik,bkj,i,k,j) t = (int32_t) (j+offset)
+                        #include "GB_AxB_saxpy_msa_template.c"
+                        break ;
+                    default: ;
+                }
+            }
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // generic semirings with standard multiply operators
+            //------------------------------------------------------------------
+
+            // aik = A(i,k), located in Ax [A_iso?0:pA]
+            #undef  GB_GETA
+            #define GB_GETA(aik,Ax,pA,A_iso)                                \
+                GB_void aik [GB_VLA(aik_size)] ;                            \
+                if (!A_is_pattern) cast_A (aik, Ax +((A_iso) ? 0:(pA)*asize), asize)
+
+            // bkj = B(k,j), located in Bx [B_iso?0:pB]
+            #undef  GB_GETB
+            #define GB_GETB(bkj,Bx,pB,B_iso)                                \
+                GB_void bkj [GB_VLA(bkj_size)] ;                            \
+                if (!B_is_pattern) cast_B (bkj, Bx +((B_iso) ? 0:(pB)*bsize), bsize)
+
+            // t = scalar workspace for A(i,k)*B(k,j)
+            #undef  GB_CIJ_DECLARE
+            #define GB_CIJ_DECLARE(t) GB_void t [GB_VLA(csize)]
+
+            // Cx [p] = t
+            #undef  GB_PUTC
+            #define GB_PUTC(t,p) memcpy (Cx +((p)*csize), t, csize)
+
+            // Cx [p] += t
+            #undef  GB_CIJ_UPDATE
+            #define GB_CIJ_UPDATE(p,t) \
+                fadd (Cx +((p)*csize), Cx +((p)*csize), t)
+
+            #undef  GB_CTYPE
+            #define GB_CTYPE GB_void
+
+            if (op_is_first || op_is_second)
+            {
+                // fmult is not used and can be NULL (for user-defined types)
+                if (flipxy)
+                {
+                    // flip first and second
+                    bool handled ;
+                    opcode = GB_flip_binop_code (opcode, &handled) ;
+                    ASSERT (handled) ; // FIRST and SECOND ops can be flipped
+                }
+                if (opcode == GB_FIRST_binop_code)
+                {
+                    // t = A(i,k)
+                    ASSERT (B_is_pattern) ;
+                    #undef  GB_MULT
+                    #define GB_MULT(t,aik,bkj,i,k,j) memcpy (t, aik, csize)
+                    #include "GB_AxB_saxpy_msa_template.c"
+                }
+                else // opcode == GB_SECOND_binop_code
+                {
+                    // t = B(k,j)
+                    ASSERT (A_is_pattern) ;
+                    #undef  GB_MULT
+                    #define GB_MULT(t,aik,bkj,i,k,j) memcpy (t, bkj, csize)
+                    #include "GB_AxB_saxpy_msa_template.c"
+                }
+            }
+            else if (flipxy)
+            {
+                // t = B(k,j) * A(i,k)
+                #undef  GB_MULT
+                #define GB_MULT(t,aik,bkj,i,k,j) fmult (t, bkj, aik)
+                #include "GB_AxB_saxpy_msa_template.c"
+            }
+            else
+            {
+                // t = A(i,k) * B(k,j)
+                #undef  GB_MULT
+                #define GB_MULT(t,aik,bkj,i,k,j) fmult (t, aik, bkj)
+                #include "GB_AxB_saxpy_msa_template.c"
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    C->jumbled = false ;
+    ASSERT_MATRIX_OK (C, "masked saxpy: C<M> = A*B output", GB0) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (!GB_PENDING (C)) ;
+    return (GrB_SUCCESS) ;
+}
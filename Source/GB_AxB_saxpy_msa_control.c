@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_msa_control: determine when to use the mask-driven C<M>=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A*B is normally computed by GB_AxB_saxpy3, with the mask M applied
+// inside its hash or Gustavson tasks.  The saxpy3 method must still visit
+// every entry A(i,k) for each B(k,j), even if M(i,j) is zero, so its work is
+// the flop count of A*B, regardless of how sparse M is.  If M is very sparse
+// compared with the flop count, it is faster to use GB_AxB_saxpy_msa, which
+// intersects each A(:,k) with M(:,j) for each B(k,j), with a galloping search
+// in A(:,k) when M(:,j) has far fewer entries.
+
+// The work of each method is estimated from the average degrees of A, B, and
+// M, which takes O(1) time.  The flop count of saxpy3 is not computed
+// exactly, since that would take O(nnz(B)) time.
+
+#include "GB_mxm.h"
+
+GB_PUBLIC
+bool GB_AxB_saxpy_msa_control    // true: use saxpy_msa, false: saxpy3
+(
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // M must be sparse/hyper and not complemented; A and B must be sparse
+    //--------------------------------------------------------------------------
+
+    // M must also have no pending work, since its pattern is merged with A
+    // and becomes the pattern of C.  A and B are finished by the method.
+
+    if (!GB_AxB_dot3_control (M, Mask_comp) || GB_ANY_PENDING_WORK (M) ||
+        GB_IS_BITMAP (A) || GB_IS_FULL (A) ||
+        GB_IS_BITMAP (B) || GB_IS_FULL (B))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // estimate the work for saxpy3 and saxpy_msa
+    //--------------------------------------------------------------------------
+
+    // Notation: C<M>=A*B where all 3 matrices are CSC, A is m-by-k, and B is
+    // k-by-n.  The comments here assume CSC, but this method is CSC/CSR
+    // agnostic.
+
+    double mnz = GB_nnz (M) ;
+    double anz = GB_nnz (A) ;
+    double bnz = GB_nnz (B) ;
+    double k = A->vdim ;
+    double n = B->vdim ;
+
+    // average # of entries in each column of A, B, and M
+    double a_col_degree = anz / GB_IMAX (k, 1) ;
+    double b_col_degree = bnz / GB_IMAX (n, 1) ;
+    double m_col_degree = mnz / GB_IMAX (n, 1) ;
+
+    // saxpy3: each B(k,j) is multiplied by all of A(:,k), and each M(:,j)
+    // is scattered into the workspace
+    double saxpy_work = bnz * a_col_degree + mnz ;
+
+    // saxpy_msa: A(:,k) and M(:,j) are merged for each entry B(k,j)
+    double msa_work = mnz + bnz * GB_merge_work (a_col_degree, m_col_degree) ;
+
+    //--------------------------------------------------------------------------
+    // use saxpy_msa if it takes much less work
+    //--------------------------------------------------------------------------
+
+    // saxpy_msa uses only a generic kernel, with function pointers and
+    // typecasting, so it must take much less work than saxpy3.
+
+    if (4 * msa_work < saxpy_work)
+    { 
+        GBURBLE ("(M very sparse: nnz(M) %g, b_col_degree %g, est. work: "
+            "msa %g < saxpy %g) ", mnz, b_col_degree, msa_work, saxpy_work) ;
+        return (true) ;
+    }
+    else
+    { 
+        GBURBLE ("(M not very sparse: nnz(M) %g, est. work: saxpy %g, "
+            "msa %g) ", mnz, saxpy_work, msa_work) ;
+        return (false) ;
+    }
+}
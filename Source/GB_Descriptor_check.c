@@ -40,6 +40,7 @@ static GrB_Info GB_dc
         case GxB_AxB_GUSTAVSON      : GBPR0 ("Gustavson ") ; break ;
         case GxB_AxB_HASH           : GBPR0 ("hash      ") ; break ;
         case GxB_AxB_DOT            : GBPR0 ("dot       ") ; break ;
+        case GxB_AxB_OUTER          : GBPR0 ("outer     ") ; break ;
         default                     : GBPR0 ("unknown   ") ;
             info = GrB_INVALID_OBJECT ;
             ok = false ;
@@ -70,7 +71,8 @@ static GrB_Info GB_dc
         {
             // GxB_AxB_METHOD:
             if (! (v == GxB_DEFAULT || v == GxB_AxB_GUSTAVSON
-                || v == GxB_AxB_DOT || v == GxB_AxB_HASH || v == GxB_AxB_SAXPY))
+                || v == GxB_AxB_DOT || v == GxB_AxB_HASH || v == GxB_AxB_SAXPY
+                || v == GxB_AxB_OUTER))
             { 
                 ok = false ;
             }
@@ -176,6 +178,16 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("    d.compression = %d\n", D->compression) ;
     }
 
+    if (D->arena != NULL)
+    { 
+        GBPR0 ("    d.arena    = %p\n", (void *) D->arena) ;
+    }
+
+    if (D->plan != NULL)
+    { 
+        GBPR0 ("    d.plan     = %p\n", (void *) D->plan) ;
+    }
+
     return (GrB_SUCCESS) ;
 }
 
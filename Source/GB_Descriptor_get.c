@@ -66,11 +66,14 @@
 //      GxB_AxB_HASH            hash-based saxpy method
 //      GxB_AxB_SAXPY           saxpy: either Gustavson or hash
 //      GxB_AxB_DOT             dot product
+//      GxB_AxB_OUTER           outer product, for C=A*B' only
 
 //  desc->do_sort               true or false (default is false) 
 
 //  desc->nthreads_max          max # number of threads to use (auto if <= 0)
 //  desc->chunk                 chunk size for threadds
+//  desc->arena                 arena for werkspace, or NULL
+//  desc->plan                  plan for C=A*B, or NULL
 
 //      These are copied from the GrB_Descriptor into the Context.
 
@@ -112,6 +115,8 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     int nthreads_desc        = GxB_DEFAULT ;
     double chunk_desc        = GxB_DEFAULT ;
     int do_sort_desc         = GxB_DEFAULT ;
+    GxB_Arena arena_desc     = NULL ;
+    GxB_MxM_Plan plan_desc   = NULL ;
 
     // non-defaults descriptor values
     if (desc != NULL)
@@ -130,6 +135,8 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
         // threads to use in the current GraphBLAS operation.
         nthreads_desc = desc->nthreads_max ;
         chunk_desc = desc->chunk ;
+        arena_desc = desc->arena ;
+        plan_desc = desc->plan ;
     }
 
     // check for valid values of each descriptor field
@@ -140,7 +147,8 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
         !(In1_desc  == GxB_DEFAULT || In1_desc  == GrB_TRAN) ||
         !(AxB_desc  == GxB_DEFAULT || AxB_desc  == GxB_AxB_GUSTAVSON ||
           AxB_desc  == GxB_AxB_DOT ||
-          AxB_desc  == GxB_AxB_HASH || AxB_desc  == GxB_AxB_SAXPY))
+          AxB_desc  == GxB_AxB_HASH || AxB_desc  == GxB_AxB_SAXPY ||
+          AxB_desc  == GxB_AxB_OUTER))
     { 
         return (GrB_INVALID_OBJECT) ;
     }
@@ -181,6 +189,13 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     Context->nthreads_max = nthreads_desc ;
     Context->chunk = chunk_desc ;
 
+    // The arena is also copied into the Context, so that any werkspace for
+    // the method is taken from the arena (if present) instead of malloc.
+    Context->arena = arena_desc ;
+
+    // The plan is copied into the Context for GB_AxB_saxpy3.
+    Context->plan = plan_desc ;
+
     return (GrB_SUCCESS) ;
 }
 
@@ -20,6 +20,47 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GB_Context Context
 ) ;
 
+GrB_Info GB_setElements         // C (I [k], J [k]) = X [k] for k = 0:n-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const void *X,              // values to set, of size n
+    const GB_Type_code xcode,   // type of X
+    const int64_t n,            // # of entries to set
+    GB_Context Context
+) ;
+
+GrB_Info GB_extractElements     // X [k] = A (I [k], J [k]) for k = 0:n-1
+(
+    void *X,                    // output values, of size n
+    const GB_Type_code xcode,   // type of X
+    bool *Found,                // optional: Found [k] true if entry present
+    GrB_Matrix A,               // matrix to extract entries from
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const int64_t n,            // # of entries to extract
+    GB_Context Context
+) ;
+
+GrB_Info GB_Elements_sort       // check and sort a list of tuples
+(
+    // output:
+    int64_t **Wi_handle,        // index of each tuple, in sorted order
+    size_t *Wi_size_handle,
+    int64_t **Wj_handle,        // vector of each tuple, in sorted order
+    size_t *Wj_size_handle,
+    int64_t **Wk_handle,        // position of each tuple in I and J
+    size_t *Wk_size_handle,
+    // input:
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const int64_t n,            // # of tuples
+    const GrB_Matrix A,         // matrix indexed by the tuples
+    const bool sort,            // if true, sort the tuples if needed
+    GB_Context Context
+) ;
+
 GrB_Info GB_Vector_removeElement
 (
     GrB_Vector V,               // vector to remove entry from
@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+// GB_Elements_sort: check and sort the tuples for GxB_*_[set,extract]Elements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The n tuples (I [k], J [k]) are row and column indices into the matrix A,
+// or just I [k] if A is a GrB_Vector (J is NULL).  The indices are checked,
+// and GrB_INVALID_INDEX is returned if any are out of range.  Each tuple
+// refers to the entry with index i in vector j of A, where (i,j) = (I [k],
+// J [k]) if A is held by column, or (J [k], I [k]) if held by row.
+
+// If sort is true and the tuples are not already in order of vector j (and
+// index i within each vector), they are sorted, with k as a third key so that
+// duplicates remain in their original order.  The sorted tuples are returned
+// in Wi, Wj, and Wk, of size n: the tth tuple in sorted order is the tuple k =
+// Wk [t], which refers to index Wi [t] in vector Wj [t].  If the tuples are
+// already in order, or if sort is false, then Wi, Wj, and Wk are returned as
+// NULL, and the caller uses I and J in their original order.
+
+// Checking if the tuples are already sorted takes O(n/nthreads) time.  Sorting
+// them takes O((n log n)/nthreads) time, but it allows the caller to search
+// for each vector and index with monotonic searches, which is much more cache
+// friendly than a binary search for each tuple in a random order.
+
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (Wi_handle, *Wi_size_handle) ; \
+    GB_FREE_WORK (Wj_handle, *Wj_size_handle) ; \
+    GB_FREE_WORK (Wk_handle, *Wk_size_handle) ; \
+}
+
+GrB_Info GB_Elements_sort       // check and sort a list of tuples
+(
+    // output:
+    int64_t **Wi_handle,        // index of each tuple, in sorted order
+    size_t *Wi_size_handle,
+    int64_t **Wj_handle,        // vector of each tuple, in sorted order
+    size_t *Wj_size_handle,
+    int64_t **Wk_handle,        // position of each tuple in I and J
+    size_t *Wk_size_handle,
+    // input:
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const int64_t n,            // # of tuples
+    const GrB_Matrix A,         // matrix indexed by the tuples
+    const bool sort,            // if true, sort the tuples if needed
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Wi_handle != NULL && Wj_handle != NULL && Wk_handle != NULL) ;
+    ASSERT (I != NULL) ;
+    ASSERT (GB_IMPLIES (J == NULL, A->vdim <= 1)) ;
+    (*Wi_handle) = NULL ;
+    (*Wj_handle) = NULL ;
+    (*Wk_handle) = NULL ;
+
+    const GrB_Index nrows = GB_NROWS (A) ;
+    const GrB_Index ncols = GB_NCOLS (A) ;
+    const GrB_Index *Vi = (A->is_csc || J == NULL) ? I : J ;
+    const GrB_Index *Vj = (J == NULL) ? NULL : ((A->is_csc) ? J : I) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices, and check if the tuples are already sorted
+    //--------------------------------------------------------------------------
+
+    bool bad = false, sorted = true ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(||:bad) reduction(&&:sorted)
+    for (k = 0 ; k < n ; k++)
+    {
+        bad = bad || (I [k] >= nrows) || (J != NULL && J [k] >= ncols) ;
+        if (k > 0 && sorted)
+        {
+            GrB_Index i = Vi [k], ilast = Vi [k-1] ;
+            GrB_Index j = (Vj == NULL) ? 0 : Vj [k] ;
+            GrB_Index jlast = (Vj == NULL) ? 0 : Vj [k-1] ;
+            sorted = (jlast < j) || (jlast == j && ilast <= i) ;
+        }
+    }
+
+    if (bad)
+    {
+        GB_ERROR (GrB_INVALID_INDEX, "Row or column index out of range; "
+            "must be < " GBu " and < " GBu, nrows, ncols) ;
+    }
+
+    if (sorted || !sort)
+    {
+        // the tuples are used in their original order
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the tuples by vector, index, and position
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(sort " GBd " tuples) ", n) ;
+    int64_t *restrict Wi = GB_MALLOC_WORK (n, int64_t, Wi_size_handle) ;
+    int64_t *restrict Wj = GB_MALLOC_WORK (n, int64_t, Wj_size_handle) ;
+    int64_t *restrict Wk = GB_MALLOC_WORK (n, int64_t, Wk_size_handle) ;
+    (*Wi_handle) = Wi ;
+    (*Wj_handle) = Wj ;
+    (*Wk_handle) = Wk ;
+    if (Wi == NULL || Wj == NULL || Wk == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        Wi [k] = (int64_t) Vi [k] ;
+        Wj [k] = (Vj == NULL) ? 0 : ((int64_t) Vj [k]) ;
+        Wk [k] = k ;
+    }
+
+    info = GB_msort_3 (Wj, Wi, Wk, n, nthreads) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory in GB_msort_3
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    return (GrB_SUCCESS) ;
+}
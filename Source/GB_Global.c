@@ -15,6 +15,59 @@
 
 #include "GB_atomics.h"
 
+//------------------------------------------------------------------------------
+// free_pool synchronization
+//------------------------------------------------------------------------------
+
+// The shared free_pool lists are protected by an OpenMP critical section if
+// OpenMP is available, or by a pthread mutex otherwise.  If neither is
+// available, the free_pool is disabled.  The per-thread free_pool magazines
+// (see GB_Global_free_pool_get below) require pthreads, so that the blocks
+// held by a thread can be returned to the shared lists when it terminates.
+
+#if !defined ( _WIN32 ) && !defined ( GB_NO_PTHREADS )
+    #define GB_HAVE_PTHREADS 1
+    #include <pthread.h>
+#endif
+
+#if defined ( _OPENMP )
+
+    #define GB_FREE_POOL_CRITICAL(...)                      \
+    {                                                       \
+        GB_PRAGMA (omp critical(GB_free_pool))              \
+        {                                                   \
+            __VA_ARGS__ ;                                   \
+        }                                                   \
+    }
+
+#elif defined ( GB_HAVE_PTHREADS )
+
+    static pthread_mutex_t GB_free_pool_mutex = PTHREAD_MUTEX_INITIALIZER ;
+
+    #define GB_FREE_POOL_CRITICAL(...)                      \
+    {                                                       \
+        pthread_mutex_lock (&GB_free_pool_mutex) ;          \
+        {                                                   \
+            __VA_ARGS__ ;                                   \
+        }                                                   \
+        pthread_mutex_unlock (&GB_free_pool_mutex) ;        \
+    }
+
+#else
+
+    // no OpenMP and no pthreads: the free_pool is disabled
+    #define GB_FREE_POOL_DISABLED 1
+    #define GB_FREE_POOL_CRITICAL(...)                      \
+    {                                                       \
+        __VA_ARGS__ ;                                       \
+    }
+
+#endif
+
+#if defined ( GB_HAVE_PTHREADS ) && !defined ( GB_FREE_POOL_DISABLED )
+    #define GB_FREE_POOL_MAGAZINE 1
+#endif
+
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
 //------------------------------------------------------------------------------
@@ -42,6 +95,7 @@ typedef struct
 
     float bitmap_switch [GxB_NBITMAP_SWITCH] ; // default bitmap_switch
     float hyper_switch ;        // default hyper_switch for new matrices
+    int64_t hyper_hash ;        // min # of vectors for a hyperlist hash
     bool is_csc ;               // default CSR/CSC format for new matrices
 
     //--------------------------------------------------------------------------
@@ -137,6 +191,25 @@ typedef struct
     int64_t free_pool_nblocks [64] ;
     int64_t free_pool_limit [64] ;
 
+    // Each thread also holds a magazine of up to free_pool_magazine_limit [k]
+    // blocks of size 2^k, which is refilled from (or drained to) the shared
+    // free_pool [k] list in batches.  free_pool_stats holds the hit/miss
+    // counts of the shared lists, and of the magazines of threads that have
+    // terminated.
+
+    int64_t free_pool_magazine_limit [64] ;
+    int64_t free_pool_stats [GxB_MEMORY_POOL_NSTATS] [64] ;
+
+    //--------------------------------------------------------------------------
+    // modification stamps
+    //--------------------------------------------------------------------------
+
+    // Each time a matrix is created or modified, it is given a new stamp, so
+    // that anything cached in or for the matrix can be validated in O(1) time
+    // (see GB_stamp.c).
+
+    int64_t stamp ;                 // last stamp given to any matrix
+
     //--------------------------------------------------------------------------
     // CPU features
     //--------------------------------------------------------------------------
@@ -193,6 +266,7 @@ GB_Global_struct GB_Global =
         GB_BITSWITCH_33_to_64,
         GB_BITSWITCH_gt_than_64 },
     .hyper_switch = GB_HYPER_SWITCH_DEFAULT,
+    .hyper_hash = GB_HYPER_HASH_DEFAULT,
 
     .is_csc = false,    // default is GxB_BY_ROW
 
@@ -247,7 +321,7 @@ GB_Global_struct GB_Global =
     // default limits on the number of free blocks in each list:
     .free_pool_limit =
 
-    #ifdef _OPENMP
+    #if !defined ( GB_FREE_POOL_DISABLED )
     {   0,      // size 2^0 = 1 byte   none
         0,      // size 2^1 = 2        none
         0,      // size 2^2 = 4        none
@@ -330,14 +404,22 @@ GB_Global_struct GB_Global =
         0 },    // size 2^63 (4 exabytes!)
 
 #else
-    // the free pool requires an OpenMP critical section,
-    // so disable it if OpenMP is not available.
+    // the free pool requires an OpenMP critical section or a pthread mutex,
+    // so disable it if neither is available.
       { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 #endif
 
+    // the per-thread magazine limits are set by GB_Global_free_pool_init,
+    // and the free_pool statistics start out all zero.
+    .free_pool_magazine_limit = { 0 },
+    .free_pool_stats = { { 0 } },
+
+    // no matrix has been stamped yet
+    .stamp = 0,
+
     // CPU features
     .cpu_features_avx2 = false,         // x86 with AVX2
     .cpu_features_avx512f = false,      // x86 with AVX512f
@@ -400,6 +482,16 @@ void GB_Global_cpu_features_query (void)
     #endif
 }
 
+GB_PUBLIC
+void GB_Global_cpu_features_set (bool avx2, bool avx512f)
+{ 
+    // The AVX2 and AVX512F kernels can always be disabled, but they can only
+    // be enabled if the CPU supports them.
+    GB_Global_cpu_features_query ( ) ;
+    GB_Global.cpu_features_avx2    &= avx2 ;
+    GB_Global.cpu_features_avx512f &= avx512f ;
+}
+
 GB_PUBLIC
 bool GB_Global_cpu_features_avx2 (void)
 { 
@@ -471,6 +563,22 @@ float GB_Global_hyper_switch_get (void)
     return (GB_Global.hyper_switch) ;
 }
 
+//------------------------------------------------------------------------------
+// hyper_hash
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void GB_Global_hyper_hash_set (int64_t hyper_hash)
+{ 
+    GB_Global.hyper_hash = hyper_hash ;
+}
+
+GB_PUBLIC
+int64_t GB_Global_hyper_hash_get (void)
+{ 
+    return (GB_Global.hyper_hash) ;
+}
+
 //------------------------------------------------------------------------------
 // bitmap_switch
 //------------------------------------------------------------------------------
@@ -867,6 +975,17 @@ int64_t GB_Global_nmalloc_get (void)
     return (nmalloc) ;
 }
 
+//------------------------------------------------------------------------------
+// stamp
+//------------------------------------------------------------------------------
+
+int64_t GB_Global_stamp_next (void)
+{ 
+    int64_t stamp ;
+    GB_ATOMIC_CAPTURE_INC64 (stamp, GB_Global.stamp) ;
+    return (stamp + 1) ;
+}
+
 //------------------------------------------------------------------------------
 // malloc_debug
 //------------------------------------------------------------------------------
@@ -1165,44 +1284,278 @@ double GB_Global_timing_get (int k)
 // free_pool: fast access to free memory blocks
 //------------------------------------------------------------------------------
 
+// The free_pool has two levels.  The shared lists, GB_Global.free_pool [k],
+// hold free blocks of size 2^k and are protected by a critical section.  In
+// front of them, each thread holds a small magazine of free blocks of each
+// size, in thread-local storage.  Most calls to GB_Global_free_pool_get and
+// GB_Global_free_pool_put are satisfied by the magazine of the calling thread,
+// with no synchronization.  If the kth magazine is empty, it is refilled with
+// a batch of blocks from the shared list.  If it is full, a batch of blocks is
+// drained from the magazine into the shared list.  Blocks beyond the limit of
+// the shared list are freed.  When a thread terminates, or when GrB_finalize
+// is called, all blocks in its magazine are returned to the shared lists.
+
+// The hit/miss statistics are kept per size class.  Those of a magazine are
+// updated only by its own thread, without synchronization, so the totals
+// returned by GB_Global_free_pool_stats_get are approximate if other threads
+// are using GraphBLAS at the same time.
+
 // each free block contains a pointer to the next free block.  This requires
 // the free block to be at least 8 bytes in size.
 #define GB_NEXT(p) ((void **) p) [0]
 
-// free_pool_init: initialize the free_pool
-GB_PUBLIC
-void GB_Global_free_pool_init (bool clear)
-{ 
-    #ifdef _OPENMP
-        #pragma omp critical(GB_free_pool)
+// free_pool statistics, for each size class k:
+#define GB_POOL_MAGAZINE_HIT 0  // malloc satisfied by the thread's magazine
+#define GB_POOL_SHARED_HIT   1  // malloc satisfied by the shared free_pool
+#define GB_POOL_MISS         2  // malloc not satisfied by the free_pool
+#define GB_POOL_FREED        3  // block freed since the free_pool was full
+
+// limits on the default per-thread magazine
+#define GB_MAGAZINE_MAX_BLOCKS 64
+#define GB_MAGAZINE_MAX_BYTES  65536
+
+// move a block from the head of one list to the head of another
+#define GB_MOVE_BLOCK(p,src,nsrc,dst,ndst)  \
+{                                           \
+    p = src ;                               \
+    src = GB_NEXT (p) ;                     \
+    (nsrc)-- ;                              \
+    GB_NEXT (p) = dst ;                     \
+    dst = p ;                               \
+    (ndst)++ ;                              \
+}
+
+//------------------------------------------------------------------------------
+// GB_free_pool_free_list: free a list of blocks of size 2^k
+//------------------------------------------------------------------------------
+
+#if !defined ( GB_FREE_POOL_DISABLED )
+
+    static void GB_free_pool_free_list (void *p, int k)
+    {
+        size_t size = ((size_t) 1) << k ;
+        while (p != NULL)
         {
-            if (clear)
+            void *next = GB_NEXT (p) ;
+            GB_free_memory (&p, size) ;
+            p = next ;
+        }
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// per-thread magazines
+//------------------------------------------------------------------------------
+
+#if defined ( GB_FREE_POOL_MAGAZINE )
+
+    typedef struct GB_magazine_struct GB_magazine_struct ;
+
+    struct GB_magazine_struct
+    {
+        void *list [64] ;           // list [k]: free blocks of size 2^k
+        int64_t nblocks [64] ;      // # of blocks in list [k]
+        int64_t stats [GxB_MEMORY_POOL_NSTATS] [64] ;
+        GB_magazine_struct *next ;  // next magazine in the registry
+        GB_magazine_struct *prev ;  // prior magazine in the registry
+        bool registered ;           // true if in the registry
+    } ;
+
+    // the magazine of the calling thread (all zero when a thread starts)
+    static _Thread_local GB_magazine_struct GB_magazine ;
+
+    // all magazines of live threads, protected by the free_pool lock
+    static GB_magazine_struct *GB_magazine_registry = NULL ;
+
+    // pthread key used only to retire the magazine when its thread terminates
+    static pthread_key_t GB_magazine_key ;
+    static pthread_once_t GB_magazine_key_once = PTHREAD_ONCE_INIT ;
+    static bool GB_magazine_key_ok = false ;
+
+    //--------------------------------------------------------------------------
+    // GB_magazine_retire: return all blocks in a magazine to the shared lists
+    //--------------------------------------------------------------------------
+
+    // The free_pool lock must be held.  If overflow is NULL, all blocks are
+    // returned to the shared lists, regardless of free_pool_limit.
+    // Otherwise, blocks beyond the limit are placed in overflow [k] to be
+    // freed by the caller, outside of the critical section.  The statistics
+    // of the magazine are added to GB_Global.free_pool_stats.
+
+    static void GB_magazine_retire
+    (
+        GB_magazine_struct *mag,
+        void **overflow
+    )
+    {
+        if (mag->registered)
+        {
+            // remove the magazine from the registry
+            if (mag->prev != NULL) mag->prev->next = mag->next ;
+            if (mag->next != NULL) mag->next->prev = mag->prev ;
+            if (GB_magazine_registry == mag) GB_magazine_registry = mag->next ;
+            mag->next = NULL ;
+            mag->prev = NULL ;
+            mag->registered = false ;
+        }
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            int64_t noverflow = 0 ;
+            while (mag->list [k] != NULL)
             {
-                // clear the free pool
-                for (int k = 0 ; k < 64 ; k++)
+                void *p ;
+                if (overflow == NULL ||
+                    GB_Global.free_pool_nblocks [k] <
+                    GB_Global.free_pool_limit [k])
+                {
+                    GB_MOVE_BLOCK (p, mag->list [k], mag->nblocks [k],
+                        GB_Global.free_pool [k],
+                        GB_Global.free_pool_nblocks [k]) ;
+                }
+                else
                 {
-                    GB_Global.free_pool [k] = NULL ;
-                    GB_Global.free_pool_nblocks [k] = 0 ;
+                    GB_MOVE_BLOCK (p, mag->list [k], mag->nblocks [k],
+                        overflow [k], noverflow) ;
                 }
             }
-            // set the default free_pool_limit
-            for (int k = 0 ; k < 64 ; k++)
+            for (int s = 0 ; s < GxB_MEMORY_POOL_NSTATS ; s++)
             {
-                GB_Global.free_pool_limit [k] = 0 ;
+                GB_Global.free_pool_stats [s][k] += mag->stats [s][k] ;
+                mag->stats [s][k] = 0 ;
             }
-            int64_t n = 16384 ;
-            for (int k = 3 ; k <= 8 ; k++)
+            GB_Global.free_pool_stats [GB_POOL_FREED][k] += noverflow ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // GB_magazine_destroy: retire the magazine of a terminating thread
+    //--------------------------------------------------------------------------
+
+    static void GB_magazine_destroy (void *arg)
+    {
+        GB_magazine_struct *mag = (GB_magazine_struct *) arg ;
+        void *overflow [64] ;
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            overflow [k] = NULL ;
+        }
+        GB_FREE_POOL_CRITICAL (GB_magazine_retire (mag, overflow)) ;
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            GB_free_pool_free_list (overflow [k], k) ;
+        }
+    }
+
+    static void GB_magazine_key_create (void)
+    {
+        GB_magazine_key_ok =
+            (pthread_key_create (&GB_magazine_key, GB_magazine_destroy) == 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GB_magazine_get: get the magazine of the calling thread
+    //--------------------------------------------------------------------------
+
+    // Returns NULL if the magazine cannot be used, in which case the shared
+    // lists are accessed directly.
+
+    static inline GB_magazine_struct *GB_magazine_get (void)
+    {
+        GB_magazine_struct *mag = &GB_magazine ;
+        if (!mag->registered)
+        {
+            // first use of the magazine by this thread: add it to the registry
+            // and ensure it is retired when the thread terminates
+            pthread_once (&GB_magazine_key_once, GB_magazine_key_create) ;
+            if (!GB_magazine_key_ok ||
+                pthread_setspecific (GB_magazine_key, mag) != 0)
             {
-                GB_Global.free_pool_limit [k] = n ;
+                return (NULL) ;
             }
-            for (int k = 9 ; k <= 19 ; k++)
+            GB_FREE_POOL_CRITICAL (
             {
-                n = n/2 ;
-                GB_Global.free_pool_limit [k] = n ;
-            }
+                mag->prev = NULL ;
+                mag->next = GB_magazine_registry ;
+                if (GB_magazine_registry != NULL)
+                {
+                    GB_magazine_registry->prev = mag ;
+                }
+                GB_magazine_registry = mag ;
+                mag->registered = true ;
+            }) ;
         }
+        return (mag) ;
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// free_pool_init: initialize the free_pool
+//------------------------------------------------------------------------------
+
+// default per-thread magazine: at most 64 blocks, and at most 64 KB, for each
+// size class 2^3 to 2^16.
+static inline int64_t GB_free_pool_magazine_default (int k)
+{
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    return ((k >= 3 && k <= 16) ?
+        GB_IMIN (GB_MAGAZINE_MAX_BLOCKS, GB_MAGAZINE_MAX_BYTES >> k) : 0) ;
     #else
-        // OpenMP not available: disable the free pool
+    return (0) ;
+    #endif
+}
+
+#if !defined ( GB_FREE_POOL_DISABLED )
+
+// The free_pool lock must be held.  The default magazine limits are set only
+// if clear is true (by GrB_init).
+static void GB_free_pool_set_defaults (bool clear)
+{
+    if (clear)
+    {
+        // clear the free pool
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            GB_Global.free_pool [k] = NULL ;
+            GB_Global.free_pool_nblocks [k] = 0 ;
+        }
+    }
+    // set the default free_pool_limit
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        GB_Global.free_pool_limit [k] = 0 ;
+    }
+    int64_t n = 16384 ;
+    for (int k = 3 ; k <= 8 ; k++)
+    {
+        GB_Global.free_pool_limit [k] = n ;
+    }
+    for (int k = 9 ; k <= 19 ; k++)
+    {
+        n = n/2 ;
+        GB_Global.free_pool_limit [k] = n ;
+    }
+    if (clear)
+    {
+        // set the default free_pool_magazine_limit
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            GB_Global.free_pool_magazine_limit [k] =
+                GB_free_pool_magazine_default (k) ;
+        }
+    }
+}
+
+#endif
+
+GB_PUBLIC
+void GB_Global_free_pool_init (bool clear)
+{
+    #if !defined ( GB_FREE_POOL_DISABLED )
+        GB_FREE_POOL_CRITICAL (GB_free_pool_set_defaults (clear)) ;
+    #else
+        // OpenMP and pthreads not available: disable the free pool
         for (int k = 0 ; k < 64 ; k++)
         {
             GB_Global.free_pool [k] = NULL ;
@@ -1223,23 +1576,69 @@ static inline void GB_Global_free_pool_check (void *p, int k, char *where)
 }
 #endif
 
+//------------------------------------------------------------------------------
 // free_pool_get: get a block from the free_pool, or return NULL if none
+//------------------------------------------------------------------------------
+
 GB_PUBLIC
 void *GB_Global_free_pool_get (int k)
-{ 
-    #ifdef _OPENMP
+{
+    #if !defined ( GB_FREE_POOL_DISABLED )
+
         void *p = NULL ;
         ASSERT (k >= 3 && k < 64) ;
-        #pragma omp critical(GB_free_pool)
+
+        #if defined ( GB_FREE_POOL_MAGAZINE )
+        int64_t magazine_limit ;
+        GB_ATOMIC_READ
+        magazine_limit = GB_Global.free_pool_magazine_limit [k] ;
+        GB_magazine_struct *mag = (magazine_limit > 0) ?
+            GB_magazine_get ( ) : NULL ;
+        if (mag != NULL)
         {
-            p = GB_Global.free_pool [k] ;
+            int s = GB_POOL_MAGAZINE_HIT ;
+            if (mag->nblocks [k] == 0)
+            {
+                // the magazine is empty: refill it from the shared list
+                int64_t nbatch = GB_IMAX (1, magazine_limit / 2) ;
+                GB_FREE_POOL_CRITICAL (
+                {
+                    while (GB_Global.free_pool [k] != NULL &&
+                        mag->nblocks [k] < nbatch)
+                    {
+                        GB_MOVE_BLOCK (p, GB_Global.free_pool [k],
+                            GB_Global.free_pool_nblocks [k],
+                            mag->list [k], mag->nblocks [k]) ;
+                    }
+                }) ;
+                s = (mag->nblocks [k] == 0) ? GB_POOL_MISS : GB_POOL_SHARED_HIT;
+            }
+            mag->stats [s][k]++ ;
+            p = mag->list [k] ;
             if (p != NULL)
             {
-                // remove the block from the kth free_pool
-                GB_Global.free_pool_nblocks [k]-- ;
-                GB_Global.free_pool [k] = GB_NEXT (p) ;
+                // remove the block from the kth magazine
+                mag->list [k] = GB_NEXT (p) ;
+                mag->nblocks [k]-- ;
             }
         }
+        else
+        #endif
+        {
+            GB_FREE_POOL_CRITICAL (
+            {
+                p = GB_Global.free_pool [k] ;
+                if (p != NULL)
+                {
+                    // remove the block from the kth free_pool
+                    GB_Global.free_pool_nblocks [k]-- ;
+                    GB_Global.free_pool [k] = GB_NEXT (p) ;
+                }
+                GB_Global.free_pool_stats
+                    [(p == NULL) ? GB_POOL_MISS : GB_POOL_SHARED_HIT][k]++ ;
+            }) ;
+        }
+
         if (p != NULL)
         {
             // clear the next pointer inside the block, since the block needs
@@ -1249,48 +1648,131 @@ void *GB_Global_free_pool_get (int k)
             #endif
         }
         return (p) ;
+
     #else
-        // OpenMP not available: free pool not in use
+        // OpenMP and pthreads not available: free pool not in use
         return (NULL) ;
     #endif
 }
 
+//------------------------------------------------------------------------------
 // free_pool_put: put a block in the free_pool, unless it is full
+//------------------------------------------------------------------------------
+
 GB_PUBLIC
 bool GB_Global_free_pool_put (void *p, int k)
-{ 
-    #ifdef _OPENMP
+{
+    #if !defined ( GB_FREE_POOL_DISABLED )
+
         #ifdef GB_DEBUG
         GB_Global_free_pool_check (p, k, "put") ;
         #endif
         bool returned_to_pool = false ;
-        #pragma omp critical(GB_free_pool)
+
+        #if defined ( GB_FREE_POOL_MAGAZINE )
+        int64_t magazine_limit ;
+        GB_ATOMIC_READ
+        magazine_limit = GB_Global.free_pool_magazine_limit [k] ;
+        GB_magazine_struct *mag = (magazine_limit > 0) ?
+            GB_magazine_get ( ) : NULL ;
+        if (mag != NULL)
         {
-            returned_to_pool =
-                (GB_Global.free_pool_nblocks [k] <
-                 GB_Global.free_pool_limit [k]) ;
-            if (returned_to_pool)
+            if (mag->nblocks [k] >= magazine_limit)
             {
-                // add the block to the head of the free_pool list
-                GB_Global.free_pool_nblocks [k]++ ;
-                GB_NEXT (p) = GB_Global.free_pool [k] ;
-                GB_Global.free_pool [k] = p ;
+                // the magazine is full: drain a batch to the shared list
+                int64_t nbatch = GB_IMAX (1, magazine_limit / 2) ;
+                void *overflow = NULL ;
+                int64_t noverflow = 0 ;
+                GB_FREE_POOL_CRITICAL (
+                {
+                    while (mag->nblocks [k] > magazine_limit - nbatch)
+                    {
+                        void *q ;
+                        if (GB_Global.free_pool_nblocks [k] <
+                            GB_Global.free_pool_limit [k])
+                        {
+                            GB_MOVE_BLOCK (q, mag->list [k], mag->nblocks [k],
+                                GB_Global.free_pool [k],
+                                GB_Global.free_pool_nblocks [k]) ;
+                        }
+                        else
+                        {
+                            GB_MOVE_BLOCK (q, mag->list [k], mag->nblocks [k],
+                                overflow, noverflow) ;
+                        }
+                    }
+                }) ;
+                // free the blocks that do not fit in the shared list
+                mag->stats [GB_POOL_FREED][k] += noverflow ;
+                GB_free_pool_free_list (overflow, k) ;
             }
+            // add the block to the head of the kth magazine
+            GB_NEXT (p) = mag->list [k] ;
+            mag->list [k] = p ;
+            mag->nblocks [k]++ ;
+            returned_to_pool = true ;
+        }
+        else
+        #endif
+        {
+            GB_FREE_POOL_CRITICAL (
+            {
+                returned_to_pool =
+                    (GB_Global.free_pool_nblocks [k] <
+                     GB_Global.free_pool_limit [k]) ;
+                if (returned_to_pool)
+                {
+                    // add the block to the head of the free_pool list
+                    GB_Global.free_pool_nblocks [k]++ ;
+                    GB_NEXT (p) = GB_Global.free_pool [k] ;
+                    GB_Global.free_pool [k] = p ;
+                }
+                else
+                {
+                    GB_Global.free_pool_stats [GB_POOL_FREED][k]++ ;
+                }
+            }) ;
         }
         return (returned_to_pool) ;
+
     #else
         return (false) ;
     #endif
 }
 
+//------------------------------------------------------------------------------
+// free_pool_flush: return all blocks in all magazines to the shared lists
+//------------------------------------------------------------------------------
+
+// Called by GrB_finalize, when no other thread may be using GraphBLAS.  The
+// magazines are left empty and removed from the registry; a thread that
+// later uses the free_pool again places its magazine back in the registry.
+
+GB_PUBLIC
+void GB_Global_free_pool_flush (void)
+{
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    GB_FREE_POOL_CRITICAL (
+    {
+        while (GB_magazine_registry != NULL)
+        {
+            GB_magazine_retire (GB_magazine_registry, NULL) ;
+        }
+    }) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
 // free_pool_dump: check the validity of the free_pool
+//------------------------------------------------------------------------------
+
 GB_PUBLIC
 void GB_Global_free_pool_dump (int pr)
 {
-    #ifdef _OPENMP
+    #if !defined ( GB_FREE_POOL_DISABLED )
     #ifdef GB_DEBUG
     bool fail = false ;
-    #pragma omp critical(GB_free_pool)
+    GB_FREE_POOL_CRITICAL (
     {
         for (int k = 0 ; k < 64 && !fail ; k++)
         {
@@ -1320,24 +1802,29 @@ void GB_Global_free_pool_dump (int pr)
                 fail = true ;
             }
         }
-    }
+    }) ;
     ASSERT (!fail) ;
     #endif
     #endif
 }
 
+//------------------------------------------------------------------------------
 // free_pool_limit_get: get the limit on the # of blocks in the kth pool
+//------------------------------------------------------------------------------
+
+// This is called for every block allocated or freed, so it does not use the
+// free_pool lock.  The limit is only a bound on the size of the shared list,
+// which is checked again inside the critical section of GB_Global_free_pool_put.
+
 GB_PUBLIC
 int64_t GB_Global_free_pool_limit_get (int k)
-{ 
-    #ifdef _OPENMP
+{
+    #if !defined ( GB_FREE_POOL_DISABLED )
         int64_t nblocks = 0 ;
         if (k >= 3 && k < 64)
         {
-            #pragma omp critical(GB_free_pool)
-            {
-                nblocks = GB_Global.free_pool_limit [k] ;
-            }
+            GB_ATOMIC_READ
+            nblocks = GB_Global.free_pool_limit [k] ;
         }
         return (nblocks) ;
     #else
@@ -1345,17 +1832,47 @@ int64_t GB_Global_free_pool_limit_get (int k)
     #endif
 }
 
+//------------------------------------------------------------------------------
 // free_pool_limit_set: set the limit on the # of blocks in the kth pool
+//------------------------------------------------------------------------------
+
+// The blocks of size 2^k in the magazine of the calling thread are returned to
+// the shared list, and any blocks in the shared list beyond the new limit are
+// freed.  In particular, a limit of zero leaves no blocks of size 2^k in the
+// free_pool, except for those held in the magazines of other threads, which
+// are returned (and freed) when those threads terminate.
+
 GB_PUBLIC
 void GB_Global_free_pool_limit_set (int k, int64_t nblocks)
-{ 
+{
     if (k >= 3 && k < 64)
     {
-        #ifdef _OPENMP
-            #pragma omp critical(GB_free_pool)
+        #if !defined ( GB_FREE_POOL_DISABLED )
+            void *excess = NULL ;
+            int64_t nexcess = 0 ;
+            GB_FREE_POOL_CRITICAL (
             {
                 GB_Global.free_pool_limit [k] = nblocks ;
-            }
+                void *p ;
+                #if defined ( GB_FREE_POOL_MAGAZINE )
+                GB_magazine_struct *mag = &GB_magazine ;
+                while (mag->list [k] != NULL)
+                {
+                    GB_MOVE_BLOCK (p, mag->list [k], mag->nblocks [k],
+                        GB_Global.free_pool [k],
+                        GB_Global.free_pool_nblocks [k]) ;
+                }
+                #endif
+                while (GB_Global.free_pool_nblocks [k] >
+                    GB_IMAX (nblocks, 0))
+                {
+                    GB_MOVE_BLOCK (p, GB_Global.free_pool [k],
+                        GB_Global.free_pool_nblocks [k], excess, nexcess) ;
+                }
+                GB_Global.free_pool_stats [GB_POOL_FREED][k] += nexcess ;
+            }) ;
+            // free the blocks beyond the new limit
+            GB_free_pool_free_list (excess, k) ;
         #else
             {
                 GB_Global.free_pool_limit [k] = 0 ;
@@ -1364,23 +1881,141 @@ void GB_Global_free_pool_limit_set (int k, int64_t nblocks)
     }
 }
 
-// free_pool_nblocks_total:  total # of blocks in free_pool (for debug only)
+//------------------------------------------------------------------------------
+// free_pool_magazine_limit_get: get the per-thread limit of the kth magazine
+//------------------------------------------------------------------------------
+
 GB_PUBLIC
-int64_t GB_Global_free_pool_nblocks_total (void)
+int64_t GB_Global_free_pool_magazine_limit_get (int k)
+{
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+        return ((k >= 3 && k < 64) ?
+            GB_Global.free_pool_magazine_limit [k] : 0) ;
+    #else
+        return (0) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// free_pool_magazine_limit_set: set the per-thread limit of the kth magazine
+//------------------------------------------------------------------------------
+
+// A magazine that already holds more blocks than its new limit is drained
+// by its own thread, the next time it returns a block of that size.  A limit
+// of zero disables the kth magazine, so that blocks of size 2^k are taken
+// from and returned to the shared lists directly.  A negative limit selects
+// the default.
+
+GB_PUBLIC
+void GB_Global_free_pool_magazine_limit_set (int k, int64_t nblocks)
+{
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    if (k >= 3 && k < 64)
+    {
+        if (nblocks < 0) nblocks = GB_free_pool_magazine_default (k) ;
+        GB_FREE_POOL_CRITICAL (
+            GB_Global.free_pool_magazine_limit [k] = nblocks) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// free_pool_stats_get: get the hit/miss statistics of the free_pool
+//------------------------------------------------------------------------------
+
+// stats [s*64+k] is the statistic s for blocks of size 2^k, summed over the
+// shared lists, the magazines of all live threads, and those of all threads
+// that have terminated.
+
+// The free_pool lock must be held.
+static void GB_free_pool_stats_sum (int64_t *stats)
+{
+    for (int s = 0 ; s < GxB_MEMORY_POOL_NSTATS ; s++)
+    {
+        for (int k = 0 ; k < 64 ; k++)
+        {
+            stats [s*64+k] = GB_Global.free_pool_stats [s][k] ;
+        }
+    }
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    for (GB_magazine_struct *mag = GB_magazine_registry ; mag != NULL ;
+        mag = mag->next)
+    {
+        for (int s = 0 ; s < GxB_MEMORY_POOL_NSTATS ; s++)
+        {
+            for (int k = 0 ; k < 64 ; k++)
+            {
+                stats [s*64+k] += mag->stats [s][k] ;
+            }
+        }
+    }
+    #endif
+}
+
+GB_PUBLIC
+void GB_Global_free_pool_stats_get (int64_t *stats)
+{
+    GB_FREE_POOL_CRITICAL (GB_free_pool_stats_sum (stats)) ;
+}
+
+//------------------------------------------------------------------------------
+// free_pool_stats_clear: clear the hit/miss statistics of the free_pool
+//------------------------------------------------------------------------------
+
+// The free_pool lock must be held.
+static void GB_free_pool_stats_zero (void)
+{
+    memset (GB_Global.free_pool_stats, 0, sizeof (GB_Global.free_pool_stats)) ;
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    for (GB_magazine_struct *mag = GB_magazine_registry ; mag != NULL ;
+        mag = mag->next)
+    {
+        memset (mag->stats, 0, sizeof (mag->stats)) ;
+    }
+    #endif
+}
+
+GB_PUBLIC
+void GB_Global_free_pool_stats_clear (void)
+{
+    GB_FREE_POOL_CRITICAL (GB_free_pool_stats_zero ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// free_pool_nblocks_total:  total # of blocks in free_pool (for debug only)
+//------------------------------------------------------------------------------
+
+// This includes the blocks held in the magazines of all live threads.
+
+// The free_pool lock must be held.
+static int64_t GB_free_pool_count (void)
 {
     int64_t nblocks = 0 ;
-    #ifdef _OPENMP
-    #pragma omp critical(GB_free_pool)
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        nblocks += GB_Global.free_pool_nblocks [k] ;
+    }
+    #if defined ( GB_FREE_POOL_MAGAZINE )
+    for (GB_magazine_struct *mag = GB_magazine_registry ; mag != NULL ;
+        mag = mag->next)
     {
         for (int k = 0 ; k < 64 ; k++)
         {
-            nblocks += GB_Global.free_pool_nblocks [k] ;
+            nblocks += mag->nblocks [k] ;
         }
     }
     #endif
     return (nblocks) ;
 }
 
+GB_PUBLIC
+int64_t GB_Global_free_pool_nblocks_total (void)
+{
+    int64_t nblocks = 0 ;
+    GB_FREE_POOL_CRITICAL (nblocks = GB_free_pool_count ( )) ;
+    return (nblocks) ;
+}
+
 //------------------------------------------------------------------------------
 // get_wtime: return current wallclock time
 //------------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #define GB_GLOBAL_H
 
 GB_PUBLIC void     GB_Global_cpu_features_query (void) ;
+GB_PUBLIC void     GB_Global_cpu_features_set (bool avx2, bool avx512f) ;
 GB_PUBLIC bool     GB_Global_cpu_features_avx2 (void) ;
 GB_PUBLIC bool     GB_Global_cpu_features_avx512f (void) ;
 
@@ -38,6 +39,9 @@ GB_PUBLIC double   GB_Global_chunk_get (void) ;
 GB_PUBLIC void     GB_Global_hyper_switch_set (float hyper_switch) ;
 GB_PUBLIC float    GB_Global_hyper_switch_get (void) ;
 
+GB_PUBLIC void     GB_Global_hyper_hash_set (int64_t hyper_hash) ;
+GB_PUBLIC int64_t  GB_Global_hyper_hash_get (void) ;
+
 GB_PUBLIC void     GB_Global_bitmap_switch_set (int k, float b) ;
 GB_PUBLIC float    GB_Global_bitmap_switch_get (int k) ;
 GB_PUBLIC float    GB_Global_bitmap_switch_matrix_get
@@ -72,6 +76,8 @@ GB_PUBLIC void     GB_Global_malloc_tracking_set (bool malloc_tracking) ;
           void     GB_Global_nmalloc_clear (void) ;
 GB_PUBLIC int64_t  GB_Global_nmalloc_get (void) ;
 
+          int64_t  GB_Global_stamp_next (void) ;
+
 GB_PUBLIC void     GB_Global_malloc_debug_set (bool malloc_debug) ;
 GB_PUBLIC bool     GB_Global_malloc_debug_get (void) ;
 
@@ -126,9 +132,15 @@ GB_PUBLIC bool     GB_Global_memtable_find (void *p) ;
 GB_PUBLIC void     GB_Global_free_pool_init (bool clear) ;
 GB_PUBLIC void    *GB_Global_free_pool_get (int k) ;
 GB_PUBLIC bool     GB_Global_free_pool_put (void *p, int k) ;
+GB_PUBLIC void     GB_Global_free_pool_flush (void) ;
 GB_PUBLIC void     GB_Global_free_pool_dump (int pr) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_limit_get (int k) ;
 GB_PUBLIC void     GB_Global_free_pool_limit_set (int k, int64_t nblocks) ;
+GB_PUBLIC int64_t  GB_Global_free_pool_magazine_limit_get (int k) ;
+GB_PUBLIC void     GB_Global_free_pool_magazine_limit_set
+                        (int k, int64_t nblocks) ;
+GB_PUBLIC void     GB_Global_free_pool_stats_get (int64_t *stats) ;
+GB_PUBLIC void     GB_Global_free_pool_stats_clear (void) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_nblocks_total (void) ;
 
 typedef int (* GB_flush_function_t) (void) ;
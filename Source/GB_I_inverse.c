@@ -11,13 +11,35 @@
 // contiguous.  Scatter I into the I inverse buckets (Mark and Inext) for quick
 // lookup.
 
-// FUTURE:: this code is sequential.  Constructing the I inverse buckets in
-// parallel would require synchronization (a critical section for each bucket,
-// or atomics).  A more parallel approach might use qsort first, to find
-// duplicates in I, and then construct the buckets in parallel after the qsort.
-// But the time complexity would be higher.
+// Bucket i is a linked list of all positions inew where I [inew] == i, in
+// ascending order.  With a single thread, the buckets are constructed by
+// scanning I backwards.  Otherwise, the (i,inew) pairs are sorted in parallel,
+// so that each bucket becomes a contiguous run of the sorted pairs, in
+// ascending order of inew, and then all the buckets are linked in parallel.
+// The sort takes O((nI log nI)/p) time with p threads, compared with O(nI)
+// for the sequential method, but the sequential method has random access to
+// Mark and cannot use more than one thread.
 
 #include "GB_subref.h"
+#include "GB_sort.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Key, Key_size) ;         \
+    GB_FREE_WORK (&Pos, Pos_size) ;         \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_FREE_WORK (&Mark, Mark_size) ;       \
+    GB_FREE_WORK (&Inext, Inext_size) ;     \
+}
+
+// the kth sorted pair (i,inew), with i and inew packed into Key [k] if
+// i < 2^31 and inew < 2^32, or held in Key [k] and Pos [k] otherwise
+#define GB_KEY_I(k)   (pack ? (Key [k] >> 32) : Key [k])
+#define GB_KEY_POS(k) (pack ? (Key [k] & ((int64_t) 0xFFFFFFFF)) : Pos [k])
 
 GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
 (
@@ -38,14 +60,24 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     // get inputs
     //--------------------------------------------------------------------------
 
+    GrB_Info info ;
     int64_t *Mark  = NULL ; size_t Mark_size = 0 ;
     int64_t *Inext = NULL ; size_t Inext_size = 0 ;
+    int64_t *Key   = NULL ; size_t Key_size = 0 ;
+    int64_t *Pos   = NULL ; size_t Pos_size = 0 ;
     int64_t ndupl = 0 ;
 
     (*p_Mark ) = NULL ; (*p_Mark_size ) = 0 ;
     (*p_Inext) = NULL ; (*p_Inext_size) = 0 ;
     (*p_ndupl) = 0 ;
 
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nI, chunk, nthreads_max) ;
+
     //--------------------------------------------------------------------------
     // allocate workspace
     //--------------------------------------------------------------------------
@@ -55,8 +87,7 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     if (Inext == NULL || Mark == NULL)
     { 
         // out of memory
-        GB_FREE_WORK (&Mark, Mark_size) ;
-        GB_FREE_WORK (&Inext, Inext_size) ;
+        GB_FREE_ALL ;
         return (GrB_OUT_OF_MEMORY) ;
     }
 
@@ -67,24 +98,108 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     // at this point, Mark is all zero, so Mark [i] < 1 for all i in
     // the range 0 to avlen-1.
 
-    // O(nI) time; not parallel
-    for (int64_t inew = nI-1 ; inew >= 0 ; inew--)
+    if (nthreads == 1)
+    {
+
+        //----------------------------------------------------------------------
+        // sequential method: O(nI) time
+        //----------------------------------------------------------------------
+
+        for (int64_t inew = nI-1 ; inew >= 0 ; inew--)
+        {
+            int64_t i = I [inew] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            int64_t ihead = (Mark [i] - 1) ;
+            if (ihead < 0)
+            { 
+                // first time i has been seen in the list I
+                ihead = -1 ;
+            }
+            else
+            { 
+                // i has already been seen in the list I
+                ndupl++ ;
+            }
+            Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
+            Inext [inew] = ihead ;
+        }
+
+    }
+    else
     {
-        int64_t i = I [inew] ;
-        ASSERT (i >= 0 && i < avlen) ;
-        int64_t ihead = (Mark [i] - 1) ;
-        if (ihead < 0)
+
+        //----------------------------------------------------------------------
+        // parallel method: sort the (i,inew) pairs
+        //----------------------------------------------------------------------
+
+        // pack each (i,inew) pair into a single key, if it fits
+        bool pack = (avlen <= (((int64_t) 1) << 31)) &&
+                    (nI    <= (((int64_t) 1) << 32)) ;
+        Key = GB_MALLOC_WORK (nI, int64_t, &Key_size) ;
+        if (!pack)
         { 
-            // first time i has been seen in the list I
-            ihead = -1 ;
+            Pos = GB_MALLOC_WORK (nI, int64_t, &Pos_size) ;
         }
-        else
+        if (Key == NULL || (!pack && Pos == NULL))
         { 
-            // i has already been seen in the list I
-            ndupl++ ;
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nI ; k++)
+        {
+            int64_t i = I [k] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            if (pack)
+            { 
+                Key [k] = (i << 32) + k ;
+            }
+            else
+            { 
+                Key [k] = i ;
+                Pos [k] = k ;
+            }
         }
-        Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
-        Inext [inew] = ihead ;
+
+        // each inew is unique, so the sort is stable and bucket i becomes a
+        // contiguous run of pairs (i,inew) in ascending order of inew
+        info = pack ? GB_msort_1 (Key, nI, nthreads) :
+                      GB_msort_2 (Key, Pos, nI, nthreads) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // link each bucket
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndupl)
+        for (k = 0 ; k < nI ; k++)
+        {
+            int64_t i = GB_KEY_I (k) ;
+            int64_t inew = GB_KEY_POS (k) ;
+            if (k == 0 || GB_KEY_I (k-1) != i)
+            { 
+                // inew is the head of bucket i
+                Mark [i] = inew + 1 ;
+            }
+            else
+            { 
+                // i has already appeared in the list I
+                ndupl++ ;
+            }
+            Inext [inew] = (k < nI-1 && GB_KEY_I (k+1) == i) ?
+                GB_KEY_POS (k+1) : -1 ;
+        }
+
+        GB_FREE_WORKSPACE ;
     }
 
     // indices in I are now in buckets.  An index i might appear more than once
@@ -105,10 +220,13 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     #ifdef GB_DEBUG
     for (int64_t i = 0 ; i < avlen ; i++)
     {
+        int64_t inew_last = -1 ;
         GB_for_each_index_in_bucket (inew, i)
         {
             ASSERT (inew >= 0 && inew < nI) ;
             ASSERT (i == I [inew]) ;
+            ASSERT (inew_last < inew) ;
+            inew_last = inew ;
         }
     }
     #endif
@@ -122,4 +240,3 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     (*p_ndupl) = ndupl ;
     return (GrB_SUCCESS) ;
 }
-
@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_add: add a tuple to the pending tuples of the calling thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_Ingest_add is called by GB_setElement when C is in concurrent-ingest
+// mode, and may be called by many user threads at the same time, on the same
+// matrix C.  It does not access any content of C except C->Ingest (which it
+// does not modify), C->type, and C->vdim.
+
+// Each user thread is given a unique id (1, 2, 3, ...) the first time it calls
+// this method.  The thread then claims the slot (id-1) % nslots of the table,
+// or the next unclaimed slot after that one, with an atomic compare/exchange,
+// and appends its tuples to the list of pending tuples in that slot.  No other
+// thread accesses the slot until GB_wait moves its tuples into C->Pending.
+// If all slots are claimed, the thread appends its tuples to the shared slot
+// (Slots [nslots]) instead, whose owner is then used as a spin lock.
+
+// The index of the slot is cached by each thread, so the slot is found in
+// O(1) time for all but the first tuple that a thread adds to C.
+
+// If the calling thread runs out of memory, the tuples in its slot are lost,
+// and GrB_OUT_OF_MEMORY is returned.  The next GB_wait on C then clears C and
+// returns GrB_OUT_OF_MEMORY, just as if GB_setElement had run out of memory
+// when not in concurrent-ingest mode.
+
+#include "GB_Pending.h"
+#include "GB_atomics.h"
+
+#if GB_COMPILER_MSC
+    #define GB_THREAD_LOCAL __declspec(thread)
+#else
+    #define GB_THREAD_LOCAL _Thread_local
+#endif
+
+// the last thread id given out
+static int64_t GB_ingest_last_id = 0 ;
+
+// the id of the calling thread, or zero if it does not yet have an id
+static GB_THREAD_LOCAL int64_t GB_ingest_id = 0 ;
+
+// the last table used by the calling thread, and its slot in that table
+static GB_THREAD_LOCAL GB_Ingest GB_ingest_table = NULL ;
+static GB_THREAD_LOCAL int64_t GB_ingest_slot = 0 ;
+
+GrB_Info GB_Ingest_add      // add a tuple to the list of the calling thread
+(
+    GrB_Matrix C,           // matrix in concurrent-ingest mode
+    const GB_void *scalar,  // scalar to add, already typecasted to C->type
+    const int64_t i,        // index into vector
+    const int64_t j,        // vector index
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C != NULL && C->Ingest != NULL) ;
+    GB_Ingest Ingest = C->Ingest ;
+    GB_Ingest_slot *restrict Slots = Ingest->Slots ;
+    const int64_t nslots = Ingest->nslots ;
+
+    //--------------------------------------------------------------------------
+    // get the id of the calling thread
+    //--------------------------------------------------------------------------
+
+    int64_t id = GB_ingest_id ;
+    if (id == 0)
+    { 
+        // this is the first call from this thread; give it the next id
+        int64_t last ;
+        do
+        { 
+            GB_ATOMIC_READ
+            last = GB_ingest_last_id ;
+            id = last + 1 ;
+        }
+        while (!GB_ATOMIC_COMPARE_EXCHANGE_64 (&GB_ingest_last_id, last, id)) ;
+        GB_ingest_id = id ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the slot owned by this thread, or claim an unowned one
+    //--------------------------------------------------------------------------
+
+    int64_t s = GB_ingest_slot ;
+    int64_t owner ;
+    if (GB_ingest_table == Ingest)
+    { 
+        GB_ATOMIC_READ
+        owner = Slots [s].owner ;
+    }
+    else
+    { 
+        owner = 0 ;
+    }
+
+    if (GB_ingest_table != Ingest || owner != id)
+    {
+        // probe the table, starting at the home slot of this thread
+        s = (id - 1) % nslots ;
+        int64_t nprobe = 0 ;
+        while (nprobe < nslots)
+        {
+            GB_ATOMIC_READ
+            owner = Slots [s].owner ;
+            if (owner == id)
+            { 
+                // this slot is already owned by this thread
+                break ;
+            }
+            int64_t unowned = 0 ;
+            if (owner == 0 &&
+                GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Slots [s].owner), unowned, id))
+            { 
+                // this thread has claimed the slot
+                break ;
+            }
+            GB_ATOMIC_READ
+            owner = Slots [s].owner ;
+            if (owner == 0)
+            { 
+                // the compare/exchange failed spuriously; try again
+                continue ;
+            }
+            // the slot is owned by another thread; try the next one
+            s = (s + 1) % nslots ;
+            nprobe++ ;
+        }
+        if (nprobe == nslots)
+        { 
+            // all slots are owned by other threads; use the shared slot
+            s = nslots ;
+        }
+        GB_ingest_table = Ingest ;
+        GB_ingest_slot = s ;
+    }
+
+    //--------------------------------------------------------------------------
+    // lock the shared slot, if used
+    //--------------------------------------------------------------------------
+
+    if (s == nslots)
+    {
+        int64_t unlocked = 0, locked = -1 ;
+        while (!GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Slots [s].owner), unlocked,
+            locked))
+        { 
+            unlocked = 0 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // add the tuple to the slot
+    //--------------------------------------------------------------------------
+
+    // The pending operator is NULL, which is the implicit SECOND operator.
+    // The tuples are always held with their values, even if C is iso; this is
+    // resolved by GB_Ingest_merge.
+
+    bool ok = GB_Pending_add (&(Slots [s].Pending), false, scalar, C->type,
+        NULL, i, j, C->vdim > 1, Context) ;
+
+    //--------------------------------------------------------------------------
+    // unlock the shared slot, if used
+    //--------------------------------------------------------------------------
+
+    if (s == nslots)
+    { 
+        GB_ATOMIC_WRITE
+        Slots [s].owner = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // flag the table as nonempty, or as failed
+    //--------------------------------------------------------------------------
+
+    // Each flag is written only if it is not already set, so that the cache
+    // line that holds them is not written by every call to GrB_setElement.
+
+    bool flag ;
+    if (!ok)
+    { 
+        GB_ATOMIC_READ
+        flag = Ingest->failed ;
+        if (!flag)
+        { 
+            GB_ATOMIC_WRITE
+            Ingest->failed = true ;
+        }
+    }
+    GB_ATOMIC_READ
+    flag = Ingest->nonempty ;
+    if (!flag)
+    { 
+        GB_ATOMIC_WRITE
+        Ingest->nonempty = true ;
+    }
+
+    return (ok ? GrB_SUCCESS : GrB_OUT_OF_MEMORY) ;
+}
+
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_alloc: allocate the per-thread pending tuples of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The table has GB_INGEST_SLOTS slots that can each be claimed by a single
+// user thread, and one more slot that is shared by all other threads.  The
+// lists of pending tuples in each slot are allocated when the first tuple is
+// added to the slot.
+
+#include "GB_Pending.h"
+
+bool GB_Ingest_alloc        // create the per-thread pending tuples
+(
+    GB_Ingest *IHandle,     // output
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (IHandle != NULL) ;
+    (*IHandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // allocate the Ingest header
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GB_Ingest Ingest = GB_MALLOC (1, struct GB_Ingest_struct, &header_size) ;
+    if (Ingest == NULL)
+    { 
+        // out of memory
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the slots, all initially unclaimed and empty
+    //--------------------------------------------------------------------------
+
+    Ingest->header_size = header_size ;
+    Ingest->nslots = GB_INGEST_SLOTS ;
+    Ingest->nonempty = false ;
+    Ingest->failed = false ;
+    Ingest->Slots_size = 0 ;
+    Ingest->Slots = GB_CALLOC (GB_INGEST_SLOTS + 1, GB_Ingest_slot,
+        &(Ingest->Slots_size)) ;
+    if (Ingest->Slots == NULL)
+    { 
+        // out of memory
+        GB_Ingest_free (&Ingest) ;
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*IHandle) = Ingest ;
+    return (true) ;
+}
+
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_free: free the per-thread pending tuples of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_Ingest_clear discards all tuples and releases all slots, so the next
+// thread to call GrB_setElement on the matrix can claim any slot.  It is
+// called by GB_bix_free (when all the entries and pending tuples of a matrix
+// are freed) and by GB_Ingest_merge.  GB_Ingest_free frees the entire table,
+// when the matrix is freed or when concurrent-ingest mode is disabled.
+
+#include "GB_Pending.h"
+
+//------------------------------------------------------------------------------
+// GB_Ingest_clear: discard all per-thread pending tuples
+//------------------------------------------------------------------------------
+
+void GB_Ingest_clear        // discard all per-thread pending tuples
+(
+    GB_Ingest Ingest        // per-thread pending tuples to clear
+)
+{
+    if (Ingest != NULL && Ingest->Slots != NULL)
+    {
+        for (int64_t s = 0 ; s <= Ingest->nslots ; s++)
+        { 
+            GB_Pending_free (&(Ingest->Slots [s].Pending)) ;
+            Ingest->Slots [s].owner = 0 ;
+        }
+        Ingest->nonempty = false ;
+        Ingest->failed = false ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_Ingest_free: free the per-thread pending tuples
+//------------------------------------------------------------------------------
+
+void GB_Ingest_free         // free the per-thread pending tuples
+(
+    GB_Ingest *IHandle      // per-thread pending tuples to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (IHandle != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // free all slots, and the header
+    //--------------------------------------------------------------------------
+
+    GB_Ingest Ingest = (*IHandle) ;
+    if (Ingest != NULL)
+    { 
+        GB_Ingest_clear (Ingest) ;
+        GB_FREE (&(Ingest->Slots), Ingest->Slots_size) ;
+        GB_FREE (&(Ingest), Ingest->header_size) ;
+    }
+    (*IHandle) = NULL ;
+}
+
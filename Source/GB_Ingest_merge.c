@@ -0,0 +1,332 @@
+//------------------------------------------------------------------------------
+// GB_Ingest_merge: move the per-thread pending tuples into A->Pending
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_wait calls this method when A is in concurrent-ingest mode and its
+// per-thread lists hold any pending tuples.  The lists are concatenated into
+// A->Pending, in parallel, in the order of the slots that hold them, and
+// GB_wait then assembles them into A just like any other pending tuples.
+// Duplicate tuples added by the same thread are assembled in the order they
+// were added.  The order of duplicates added by different threads is not
+// specified.
+
+// Any prior pending tuples in A are assembled first, since they may have a
+// different type and pending operator than the tuples from GrB_setElement.
+// A is also unjumbled, so that the tuples can be found in it.
+// If A is bitmap or full, it is converted to sparse, since only sparse and
+// hypersparse matrices can have pending tuples.  If A is iso, it remains iso
+// only if all the tuples have its iso value.  If A has no entries, it becomes
+// iso if all the tuples have the same value, as in GB_setElement.
+
+// GB_wait requires the pending tuples to be disjoint from the live entries of
+// A, since GB_setElement normally modifies an existing entry in place.  The
+// tuples come after the entries already in A, so any entry of A that also
+// appears as a tuple becomes a zombie, and is replaced by the tuple.
+
+// The table of slots is detached from A while the tuples are moved, so that
+// the GB_wait and GB_convert_* methods called here see only A->Pending.  All
+// slots are released when this method returns, even if it fails.
+
+#include "GB_Pending.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Zombie, Zombie_size) ;       \
+    GB_WERK_POP (Offset, int64_t) ;             \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_Pending_free (&Pending) ;                \
+    GB_Ingest_clear (Ingest) ;                  \
+    A->Ingest = Ingest ;                        \
+}
+
+GrB_Info GB_Ingest_merge    // move all per-thread tuples into A->Pending
+(
+    GrB_Matrix A,           // matrix in concurrent-ingest mode
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL && A->Ingest != NULL) ;
+    GB_WERK_DECLARE (Offset, int64_t) ;
+    int64_t *restrict Zombie = NULL ; size_t Zombie_size = 0 ;
+    GB_Pending Pending = NULL ;
+
+    // detach the table from A
+    GB_Ingest Ingest = A->Ingest ;
+    A->Ingest = NULL ;
+    GB_Ingest_slot *restrict Slots = Ingest->Slots ;
+    const int64_t nslots = Ingest->nslots ;
+
+    if (Ingest->failed)
+    {
+        // a thread ran out of memory in GB_Ingest_add, and its tuples are lost
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the tuples in each slot
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (Offset, nslots + 2, int64_t) ;
+    if (Offset == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t n = 0, nlists = 0, slast = -1 ;
+    for (int64_t s = 0 ; s <= nslots ; s++)
+    {
+        Offset [s] = n ;
+        GB_Pending P = Slots [s].Pending ;
+        if (P != NULL && P->n > 0)
+        {
+            n += P->n ;
+            nlists++ ;
+            slast = s ;
+        }
+    }
+    Offset [nslots+1] = n ;
+
+    if (n == 0)
+    {
+        // no tuples were added
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(ingest: " GBd " tuples from " GBd " threads) ", n, nlists) ;
+
+    //--------------------------------------------------------------------------
+    // assemble any prior pending tuples in A, and unjumble it
+    //--------------------------------------------------------------------------
+
+    if (A->Pending != NULL || A->jumbled)
+    {
+        GB_OK (GB_wait (A, "A (ingest)", Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // convert A to sparse if it is bitmap or full
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_BITMAP (A))
+    {
+        GB_OK (GB_convert_bitmap_to_sparse (A, Context)) ;
+    }
+    else if (GB_IS_FULL (A))
+    {
+        GB_OK (GB_convert_full_to_sparse (A, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    nthreads = (int) GB_IMIN (nthreads, nlists) ;
+
+    //--------------------------------------------------------------------------
+    // check if A is, or can become, iso
+    //--------------------------------------------------------------------------
+
+    const size_t asize = A->type->size ;
+    if (A->iso || GB_nnz (A) == 0)
+    {
+        // compare each tuple with the iso value of A, or with the first tuple
+        GB_void x0 [GB_VLA(asize)] ;
+        memcpy (x0, A->iso ? ((GB_void *) A->x) : Slots [slast].Pending->x,
+            asize) ;
+        bool all_same = true ;
+        int64_t s ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+            reduction(&&:all_same)
+        for (s = 0 ; s <= nslots ; s++)
+        {
+            GB_Pending P = Slots [s].Pending ;
+            if (P == NULL) continue ;
+            const GB_void *restrict Px = P->x ;
+            for (int64_t k = 0 ; k < P->n && all_same ; k++)
+            {
+                all_same = (memcmp (Px + k * asize, x0, asize) == 0) ;
+            }
+        }
+        if (A->iso && !all_same)
+        {
+            // a tuple differs from the iso value of A
+            GB_OK (GB_convert_any_to_non_iso (A, true, Context)) ;
+        }
+        else if (!A->iso && all_same)
+        {
+            // A has no entries, and all tuples have the same value
+            GB_OK (GB_convert_any_to_iso (A, x0, Context)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // move the tuples into A->Pending
+    //--------------------------------------------------------------------------
+
+    const bool A_iso = A->iso ;
+    if (nlists == 1)
+    {
+
+        //----------------------------------------------------------------------
+        // a single thread added all the tuples: use its list as-is
+        //----------------------------------------------------------------------
+
+        Pending = Slots [slast].Pending ;
+        Slots [slast].Pending = NULL ;
+        if (A_iso)
+        {
+            GB_FREE (&(Pending->x), Pending->x_size) ;
+            Pending->x_size = 0 ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // concatenate the lists of all threads, in parallel
+        //----------------------------------------------------------------------
+
+        const bool is_matrix = (A->vdim > 1) ;
+        if (!GB_Pending_alloc (&Pending, A_iso, A->type, NULL, is_matrix, n))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int64_t *restrict Pending_i = Pending->i ;
+        int64_t *restrict Pending_j = Pending->j ;
+        GB_void *restrict Pending_x = Pending->x ;
+
+        int64_t s ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (s = 0 ; s <= nslots ; s++)
+        {
+            GB_Pending P = Slots [s].Pending ;
+            if (P == NULL || P->n == 0) continue ;
+            int64_t p = Offset [s] ;
+            memcpy (Pending_i + p, P->i, P->n * sizeof (int64_t)) ;
+            if (is_matrix)
+            {
+                memcpy (Pending_j + p, P->j, P->n * sizeof (int64_t)) ;
+            }
+            if (!A_iso)
+            {
+                memcpy (Pending_x + p * asize, P->x, P->n * asize) ;
+            }
+        }
+
+        // the list is sorted if each list is sorted and in order
+        bool sorted = true ;
+        for (s = 0 ; s <= nslots && sorted ; s++)
+        {
+            GB_Pending P = Slots [s].Pending ;
+            if (P == NULL || P->n == 0) continue ;
+            sorted = P->sorted ;
+            int64_t p = Offset [s] ;
+            if (sorted && p > 0)
+            {
+                // compare the first tuple of this list with the prior tuple
+                int64_t ilast = Pending_i [p-1], i = Pending_i [p] ;
+                int64_t jlast = is_matrix ? Pending_j [p-1] : 0 ;
+                int64_t j = is_matrix ? Pending_j [p] : 0 ;
+                sorted = (jlast < j) || (jlast == j && ilast <= i) ;
+            }
+        }
+        Pending->sorted = sorted ;
+        Pending->n = n ;
+    }
+
+    //--------------------------------------------------------------------------
+    // turn any entries of A that also appear as tuples into zombies
+    //--------------------------------------------------------------------------
+
+    if (GB_nnz (A) > A->nzombies)
+    {
+        Zombie = GB_MALLOC_WORK (n, int64_t, &Zombie_size) ;
+        if (Zombie == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        // find the position of each tuple in A, if present as a live entry
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ah = A->h ;
+        int64_t *restrict Ai = A->i ;
+        const int64_t *restrict Pending_i = Pending->i ;
+        const int64_t *restrict Pending_j = Pending->j ;
+        const int64_t avlen = A->vlen ;
+        const int64_t anvec = A->nvec ;
+        const int64_t nzombies = A->nzombies ;
+        nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            int64_t i = Pending_i [k] ;
+            int64_t j = (Pending_j == NULL) ? 0 : Pending_j [k] ;
+            int64_t pA_start, pA_end, pleft = 0, pright = anvec - 1 ;
+            bool found = GB_lookup (Ah != NULL, Ah, Ap, avlen, &pleft,
+                pright, j, &pA_start, &pA_end) ;
+            if (found)
+            { 
+                bool is_zombie ;
+                pleft = pA_start ;
+                pright = pA_end - 1 ;
+                GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found,
+                    nzombies, is_zombie) ;
+                found = found && !is_zombie ;
+            }
+            Zombie [k] = found ? pleft : -1 ;
+        }
+
+        // turn each entry found into a zombie; an entry can be found by more
+        // than one tuple, so this is done by a single thread
+        int64_t nzombies_new = 0 ;
+        for (k = 0 ; k < n ; k++)
+        {
+            int64_t p = Zombie [k] ;
+            if (p >= 0 && !GB_IS_ZOMBIE (Ai [p]))
+            { 
+                Ai [p] = GB_FLIP (Ai [p]) ;
+                nzombies_new++ ;
+            }
+        }
+        A->nzombies += nzombies_new ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace, release all slots, and return result
+    //--------------------------------------------------------------------------
+
+    A->Pending = Pending ;
+    Pending = NULL ;
+    GB_FREE_ALL ;
+    ASSERT_MATRIX_OK (A, "A with tuples from concurrent setElement", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
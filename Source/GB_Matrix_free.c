@@ -11,7 +11,7 @@
 // is freed and set to NULL if the header of A was originally dynamically
 // allocated.  Otherwise, A is not freed.
 
-#include "GB.h"
+#include "GB_Pending.h"
 
 void GB_Matrix_free             // free a matrix
 (
@@ -27,6 +27,13 @@ void GB_Matrix_free             // free a matrix
             // free all content of A
             size_t header_size = A->header_size ;
             GB_phbix_free (A) ;
+            // unmap the file of a matrix from GxB_Matrix_mmap.  This is done
+            // here and not in GB_phbix_free, since the content of A may be
+            // replaced with content that remains shallow to the mapped file
+            // (by GB_convert_sparse_to_bitmap, for example).
+            GB_munmap (&(A->mmap_base), &(A->mmap_size)) ;
+            // free the per-thread pending tuples for concurrent setElement
+            GB_Ingest_free (&(A->Ingest)) ;
             if (!(A->static_header))
             { 
                 // free the header of A itself, unless it is static
@@ -37,6 +37,54 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+GrB_Info GB_Pending_sort        // sort the pending tuples of a matrix
+(
+    GrB_Matrix A,               // matrix with pending tuples to sort
+    GB_Context Context
+) ;
+
+// GB_Pending_sort uses up to GB_PENDING_BUCKETS buckets per thread, with at
+// least GB_PENDING_BUCKETS tuples in each bucket, on average.
+#define GB_PENDING_BUCKETS 64
+
+//------------------------------------------------------------------------------
+// GB_Ingest functions: per-thread pending tuples for concurrent setElement
+//------------------------------------------------------------------------------
+
+bool GB_Ingest_alloc        // create the per-thread pending tuples
+(
+    GB_Ingest *IHandle,     // output
+    GB_Context Context
+) ;
+
+void GB_Ingest_clear        // discard all per-thread pending tuples
+(
+    GB_Ingest Ingest        // per-thread pending tuples to clear
+) ;
+
+void GB_Ingest_free         // free the per-thread pending tuples
+(
+    GB_Ingest *IHandle      // per-thread pending tuples to free
+) ;
+
+GrB_Info GB_Ingest_add      // add a tuple to the list of the calling thread
+(
+    GrB_Matrix C,           // matrix in concurrent-ingest mode
+    const GB_void *scalar,  // scalar to add, already typecasted to C->type
+    const int64_t i,        // index into vector
+    const int64_t j,        // vector index
+    GB_Context Context
+) ;
+
+GrB_Info GB_Ingest_merge    // move all per-thread tuples into A->Pending
+(
+    GrB_Matrix A,           // matrix in concurrent-ingest mode
+    GB_Context Context
+) ;
+
+// # of slots in the table, each owned by a single thread
+#define GB_INGEST_SLOTS 256
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
@@ -0,0 +1,364 @@
+//------------------------------------------------------------------------------
+// GB_Pending_sort: sort the pending tuples of a matrix, in buckets
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The pending tuples of A are appended in any order by GrB_setElement and
+// GrB_*assign, and A->Pending->sorted is true only if the entire list is in
+// order.  GB_wait calls this method to sort the list before it is assembled
+// into a matrix by GB_builder, which then skips its own sort.
+
+// The tuples are partitioned into buckets by their position in the matrix,
+// where each bucket is a contiguous range of vectors (or a contiguous range
+// of entries, for a single vector, or for a matrix small enough that the
+// position j*vlen+i of A(i,j) does not overflow).  The tuples are scattered
+// into their buckets in a single stable pass, in parallel.  Each bucket is
+// then checked and sorted independently, in parallel.  Buckets that are
+// already in order (for example, if the tuples for each vector were added in
+// order, even if they were interleaved with tuples in other vectors) are not
+// sorted at all.  A bucket that is too large for a single thread to sort
+// (if the tuples are concentrated in a few vectors) is sorted with all
+// threads.
+
+// The order of duplicate tuples is preserved, since they must be assembled in
+// the order they were added, with a dup operator that need not be
+// commutative.  If the matrix is not iso, each tuple is sorted along with its
+// original position k in the list, and the values are then gathered into
+// their sorted order.
+
+// If the list is already sorted, or is too small, or if the matrix has too
+// few positions to form at least two buckets, the tuples are left as-is.
+
+#include "GB_Pending.h"
+#include "GB_sort.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Count, Count_size) ;         \
+    GB_FREE_WORK (&Bucket, Bucket_size) ;       \
+    GB_FREE_WORK (&K2, K2_size) ;               \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_FREE (&I2, I2_size) ;                    \
+    GB_FREE (&J2, J2_size) ;                    \
+    GB_FREE (&X2, X2_size) ;                    \
+}
+
+// the bucket of a tuple (i,j)
+#define GB_BUCKET(i,j) \
+    ((int64_t) (((uint64_t) ((j) * jscale + (i) * iscale)) >> bshift))
+
+GrB_Info GB_Pending_sort        // sort the pending tuples of a matrix
+(
+    GrB_Matrix A,               // matrix with pending tuples to sort
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    GB_Pending Pending = A->Pending ;
+    if (Pending == NULL || Pending->sorted || Pending->n < GB_PENDING_BUCKETS)
+    {
+        // nothing to do; GB_builder sorts a short list of tuples itself
+        return (GrB_SUCCESS) ;
+    }
+
+    GrB_Info info ;
+    int64_t *restrict Count = NULL ; size_t Count_size = 0 ;
+    int64_t *restrict Bucket = NULL ; size_t Bucket_size = 0 ;
+    int64_t *restrict I2 = NULL ; size_t I2_size = 0 ;
+    int64_t *restrict J2 = NULL ; size_t J2_size = 0 ;
+    int64_t *restrict K2 = NULL ; size_t K2_size = 0 ;
+    GB_void *restrict X2 = NULL ; size_t X2_size = 0 ;
+
+    const int64_t n = Pending->n ;
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    const GB_void *restrict Pending_x = Pending->x ;
+    const size_t xsize = Pending->size ;
+    const int64_t vlen = A->vlen ;
+    const bool is_matrix = (Pending_j != NULL) ;
+    const bool iso = (Pending_x == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads and the # of buckets to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    // The key of a tuple (i,j) is j*vlen+i if this does not overflow, or just
+    // j otherwise (or just i if A is a single vector).  The key is in the
+    // range 0:nkeys-1, and the bucket of a tuple is its key >> bshift.
+    GrB_Index nkeys ;
+    int64_t iscale = 1, jscale = vlen ;
+    if (!is_matrix)
+    {
+        // all tuples are in a single vector; the key is just i
+        nkeys = vlen ;
+        jscale = 0 ;
+    }
+    else if (!GB_int64_multiply (&nkeys, vlen, A->vdim))
+    {
+        // j*vlen+i would overflow; the key is just j
+        nkeys = A->vdim ;
+        iscale = 0 ;
+        jscale = 1 ;
+    }
+
+    // use up to GB_PENDING_BUCKETS buckets per thread, but give each bucket
+    // at least GB_PENDING_BUCKETS tuples on average
+    int64_t nbuckets_max = GB_IMIN (GB_PENDING_BUCKETS * nthreads,
+        n / GB_PENDING_BUCKETS) ;
+    int bshift = 0 ;
+    while ((int64_t) ((nkeys - 1) >> bshift) >= nbuckets_max)
+    {
+        bshift++ ;
+    }
+    int64_t nbuckets = (int64_t) ((nkeys - 1) >> bshift) + 1 ;
+    if (nbuckets < 2)
+    {
+        // all the tuples would fall in a single bucket
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(pending sort: " GBd " buckets) ", nbuckets) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and the sorted tuples
+    //--------------------------------------------------------------------------
+
+    // Count [tid*nbuckets + b] is the # of tuples in bucket b in the tid-th
+    // slice of the tuples, and Bucket [b] is the start of bucket b in the
+    // sorted list.
+    int nslices = nthreads ;
+    Count  = GB_MALLOC_WORK (nslices * nbuckets, int64_t, &Count_size) ;
+    Bucket = GB_MALLOC_WORK (nbuckets + 1, int64_t, &Bucket_size) ;
+    I2 = GB_MALLOC (n, int64_t, &I2_size) ;
+    bool ok = (Count != NULL && Bucket != NULL && I2 != NULL) ;
+    if (is_matrix)
+    {
+        J2 = GB_MALLOC (n, int64_t, &J2_size) ;
+        ok = ok && (J2 != NULL) ;
+    }
+    if (!iso)
+    {
+        K2 = GB_MALLOC_WORK (n, int64_t, &K2_size) ;
+        X2 = GB_MALLOC (n * xsize, GB_void, &X2_size) ;    // x:OK
+        ok = ok && (K2 != NULL && X2 != NULL) ;
+    }
+    if (!ok)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the tuples in each bucket, for each slice
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nslices ; tid++)
+    {
+        int64_t *restrict Count_tid = Count + tid * nbuckets ;
+        memset (Count_tid, 0, nbuckets * sizeof (int64_t)) ;
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, n, tid, nslices) ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t j = (is_matrix) ? Pending_j [k] : 0 ;
+            Count_tid [GB_BUCKET (Pending_i [k], j)]++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // cumulative sum: bucket-major, then slice-major, for a stable scatter
+    //--------------------------------------------------------------------------
+
+    int64_t s = 0 ;
+    for (int64_t b = 0 ; b < nbuckets ; b++)
+    {
+        Bucket [b] = s ;
+        for (tid = 0 ; tid < nslices ; tid++)
+        {
+            int64_t c = Count [tid * nbuckets + b] ;
+            Count [tid * nbuckets + b] = s ;
+            s += c ;
+        }
+    }
+    Bucket [nbuckets] = s ;
+    ASSERT (s == n) ;
+
+    //--------------------------------------------------------------------------
+    // scatter the tuples into their buckets
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nslices ; tid++)
+    {
+        int64_t *restrict Count_tid = Count + tid * nbuckets ;
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, n, tid, nslices) ;
+        for (int64_t k = kstart ; k < kend ; k++)
+        {
+            int64_t i = Pending_i [k] ;
+            int64_t j = (is_matrix) ? Pending_j [k] : 0 ;
+            int64_t pdest = Count_tid [GB_BUCKET (i, j)]++ ;
+            I2 [pdest] = i ;
+            if (is_matrix)
+            {
+                J2 [pdest] = j ;
+            }
+            if (!iso)
+            {
+                K2 [pdest] = k ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort each bucket that is not already in order
+    //--------------------------------------------------------------------------
+
+    // A bucket larger than this is sorted by all threads, below.  Count is
+    // no longer needed, so Count [b] is reused to flag these buckets.
+    int64_t bigbucket = (nthreads == 1) ? n : GB_ICEIL (n, nthreads) ;
+    int64_t b, nunsorted = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nunsorted)
+    for (b = 0 ; b < nbuckets ; b++)
+    {
+        int64_t pstart = Bucket [b] ;
+        int64_t bnz = Bucket [b+1] - pstart ;
+
+        // check if the bucket is already in order
+        Count [b] = 0 ;
+        bool sorted = true ;
+        for (int64_t p = pstart + 1 ; sorted && p < pstart + bnz ; p++)
+        {
+            int64_t jlast = (is_matrix) ? J2 [p-1] : 0 ;
+            int64_t j     = (is_matrix) ? J2 [p  ] : 0 ;
+            sorted = (jlast < j) || (jlast == j && I2 [p-1] <= I2 [p]) ;
+        }
+        if (sorted) continue ;
+        nunsorted++ ;
+        if (bnz > bigbucket)
+        {
+            // flag this bucket to be sorted by all threads, below
+            Count [b] = 1 ;
+            continue ;
+        }
+
+        // sort the bucket with a single thread.  The original position k of
+        // each tuple is used as the final key, so the sort is stable.
+        int64_t *restrict I2_b = I2 + pstart ;
+        int64_t *restrict J2_b = (is_matrix) ? (J2 + pstart) : NULL ;
+        int64_t *restrict K2_b = (iso) ? NULL : (K2 + pstart) ;
+        if (is_matrix)
+        {
+            if (iso)
+            {
+                GB_qsort_2 (J2_b, I2_b, bnz) ;
+            }
+            else
+            {
+                GB_qsort_3 (J2_b, I2_b, K2_b, bnz) ;
+            }
+        }
+        else
+        {
+            if (iso)
+            {
+                GB_qsort_1 (I2_b, bnz) ;
+            }
+            else
+            {
+                GB_qsort_2 (I2_b, K2_b, bnz) ;
+            }
+        }
+    }
+
+    GBURBLE ("(" GBd " sorted) ", nunsorted) ;
+
+    // sort any large buckets with all threads
+    info = GrB_SUCCESS ;
+    for (b = 0 ; b < nbuckets && info == GrB_SUCCESS ; b++)
+    {
+        if (Count [b] == 0) continue ;
+        int64_t pstart = Bucket [b] ;
+        int64_t bnz = Bucket [b+1] - pstart ;
+        int64_t *restrict I2_b = I2 + pstart ;
+        int64_t *restrict J2_b = (is_matrix) ? (J2 + pstart) : NULL ;
+        int64_t *restrict K2_b = (iso) ? NULL : (K2 + pstart) ;
+        if (is_matrix)
+        {
+            info = (iso) ? GB_msort_2 (J2_b, I2_b, bnz, nthreads) :
+                GB_msort_3 (J2_b, I2_b, K2_b, bnz, nthreads) ;
+        }
+        else
+        {
+            info = (iso) ? GB_msort_1 (I2_b, bnz, nthreads) :
+                GB_msort_2 (I2_b, K2_b, bnz, nthreads) ;
+        }
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory in GB_msort_*
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gather the values into their sorted order
+    //--------------------------------------------------------------------------
+
+    if (!iso)
+    {
+        int64_t p ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (p = 0 ; p < n ; p++)
+        {
+            memcpy (X2 + p * xsize, Pending_x + K2 [p] * xsize, xsize) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the pending tuples with the sorted tuples
+    //--------------------------------------------------------------------------
+
+    GB_FREE (&(Pending->i), Pending->i_size) ;
+    GB_FREE (&(Pending->j), Pending->j_size) ;
+    GB_FREE (&(Pending->x), Pending->x_size) ;
+    Pending->i = I2 ; Pending->i_size = I2_size ;
+    Pending->j = J2 ; Pending->j_size = J2_size ;
+    Pending->x = X2 ; Pending->x_size = X2_size ;
+    Pending->nmax = n ;
+    Pending->sorted = true ;
+
+    #ifdef GB_DEBUG
+    for (int64_t p = 1 ; p < n ; p++)
+    {
+        int64_t jlast = (is_matrix) ? J2 [p-1] : 0 ;
+        int64_t j     = (is_matrix) ? J2 [p  ] : 0 ;
+        ASSERT ((jlast < j) || (jlast == j && I2 [p-1] <= I2 [p])) ;
+    }
+    #endif
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
@@ -49,10 +49,18 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
     s->b = NULL ; s->b_size = 0 ; s->b_shallow = false ;
     s->i = NULL ; s->i_size = 0 ; s->i_shallow = false ;
     s->x = Sx   ; s->x_size = type->size ; s->x_shallow = true ;
+    s->mmap_base = NULL ; s->mmap_size = 0 ;
 
     s->nvals = 0 ;
 
     s->Pending = NULL ;
+    s->Ingest = NULL ;
+    s->hyper_hash = NULL ;
+    s->AT = NULL ;
+    s->AT_stamp = 0 ;
+    s->push_pull = false ;
+    s->saxpy3_cache = NULL ;
+    s->stamp = GB_Global_stamp_next ( ) ;
     s->nzombies = 0 ;
 
     s->hyper_switch  = GxB_NEVER_HYPER ;
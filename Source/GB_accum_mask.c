@@ -428,6 +428,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     //--------------------------------------------------------------------------
 
     GB_FREE_ALL ;
+    GB_stamp (C) ;
     ASSERT_MATRIX_OK (C, "C<M>=accum(C,T)", GB0) ;
     return (GB_block (C, Context)) ;
 }
@@ -152,14 +152,32 @@ GrB_Info GB_add             // C=A+B, C<M>=A+B, or C<!M>=A+B
         // C is sparse or hypersparse: slice and analyze the C matrix
         //----------------------------------------------------------------------
 
-        // phase1a: split C into tasks
-        info = GB_ewise_slice (
-            // computed by phase1a
-            &TaskList, &TaskList_size, &C_ntasks, &C_nthreads,
-            // computed by phase0:
-            Cnvec, Ch, C_to_M, C_to_A, C_to_B, Ch_is_Mh,
-            // original input:
-            (apply_mask) ? M : NULL, A, B, Context) ;
+        // phase1a: split C into tasks.  If the mask is applied here, and M
+        // is sparse or hypersparse and not complemented, then the work is
+        // driven by the entries of M, and C is sliced by the entries of M.
+        // Otherwise, C is sliced by the entries of A and B.
+        if (apply_mask && !Mask_comp &&
+            (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)))
+        { 
+            GBURBLE ("(mask-driven) ") ;
+            info = GB_add_mask_slice (
+                // computed by phase1a
+                &TaskList, &TaskList_size, &C_ntasks, &C_nthreads,
+                // computed by phase0:
+                Cnvec, Ch, C_to_M, C_to_A, C_to_B, Ch_is_Mh,
+                // original input:
+                M, A, B, Context) ;
+        }
+        else
+        { 
+            info = GB_ewise_slice (
+                // computed by phase1a
+                &TaskList, &TaskList_size, &C_ntasks, &C_nthreads,
+                // computed by phase0:
+                Cnvec, Ch, C_to_M, C_to_A, C_to_B, Ch_is_Mh,
+                // original input:
+                (apply_mask) ? M : NULL, A, B, Context) ;
+        }
         if (info != GrB_SUCCESS)
         { 
             // out of memory; free everything allocated by GB_add_phase0
@@ -109,6 +109,31 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
     GB_Context Context
 ) ;
 
+GrB_Info GB_add_mask_slice
+(
+    // output:
+    GB_task_struct **p_TaskList,    // array of structs
+    size_t *p_TaskList_size,        // size of TaskList
+    int *p_ntasks,                  // # of tasks constructed
+    int *p_nthreads,                // # of threads for eWise operation
+    // input:
+    const int64_t Cnvec,            // # of vectors of C
+    const int64_t *restrict Ch,     // vectors of C, if hypersparse
+    const int64_t *restrict C_to_M, // mapping of C to M
+    const int64_t *restrict C_to_A, // mapping of C to A
+    const int64_t *restrict C_to_B, // mapping of C to B
+    bool Ch_is_Mh,                  // if true, then Ch == Mh
+    const GrB_Matrix M,             // mask matrix to slice
+    const GrB_Matrix A,             // matrix to slice
+    const GrB_Matrix B,             // matrix to slice
+    GB_Context Context
+) ;
+
+// GB_MASK_VERY_SPARSE is true if C<M>=A+B, C<M>=A.*B or C<M>=accum(C,T) is
+// being computed, and the mask M is very sparse compared with A and B.
+#define GB_MASK_VERY_SPARSE(mfactor,M,A,B) \
+    ((mfactor) * GB_nnz (M) < GB_nnz (A) + GB_nnz (B))
+
 int GB_add_sparsity         // return the sparsity structure for C
 (
     // output:
@@ -0,0 +1,414 @@
+//------------------------------------------------------------------------------
+// GB_add_mask_slice: slice C<M>=A+B by the entries of the mask M
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Constructs a set of tasks to compute C<M>=A+B, when C and M are sparse or
+// hypersparse, and M is not complemented.  In this case, GB_add_phase1 and
+// GB_add_phase2 iterate over the entries of each vector M(:,j), and look up
+// each A(i,j) and B(i,j), via a binary search if A or B are sparse or
+// hypersparse, or in O(1) time if they are bitmap or full.  The work is thus
+// proportional to nnz(M), not nnz(A)+nnz(B).
+
+// GB_ewise_slice ignores the mask when computing where to slice the work,
+// which gives a poor schedule when M is very sparse compared with A and B:
+// the number of threads and tasks depends on nnz(A)+nnz(B), and the work for
+// a single task can be very imbalanced.  Here, the work for each vector C(:,j)
+// is estimated as nnz(M(:,j)), and vectors with many entries in M(:,j) are
+// split into fine tasks with an equal number of entries of M.  Each fine task
+// finds its part of A(:,j) and B(:,j) with a binary search.
+
+// The TaskList constructed here has the same form as the one constructed by
+// GB_ewise_slice, and is used by GB_add_phase1 and GB_add_phase2 in the same
+// way.
+
+// M: sparse or hypersparse, not jumbled.
+// A, B: any sparsity structure (hypersparse, sparse, bitmap, or full).
+// C: constructed as sparse or hypersparse in the caller.
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_WERK_POP (Coarse, int64_t) ;             \
+    GB_FREE_WORK (&Cwork, Cwork_size) ;         \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_FREE_WORK (&TaskList, TaskList_size) ;   \
+}
+
+#include "GB_add.h"
+
+//------------------------------------------------------------------------------
+// GB_add_mask_slice_find: find A(ilo:ihi-1,kA) or B(ilo:ihi-1,kB)
+//------------------------------------------------------------------------------
+
+static inline void GB_add_mask_slice_find
+(
+    // output:
+    int64_t *p_pX,                  // X(ilo:ihi-1,kX) starts at pX
+    int64_t *p_pX_end,              // and ends at pX_end-1
+    // input:
+    const int64_t ilo,              // first index in the slice
+    const int64_t ihi,              // last index in the slice, plus one
+    const int64_t pX_start,         // X(:,kX) is in X [pX_start:pX_end-1]
+    const int64_t pX_end,
+    const int64_t *restrict Xi      // indices of X, or NULL if bitmap/full
+)
+{
+    if (pX_end == pX_start)
+    { 
+        // X(:,kX) is empty, or not present
+        (*p_pX    ) = -1 ;
+        (*p_pX_end) = -1 ;
+    }
+    else if (Xi == NULL)
+    { 
+        // X(:,kX) is bitmap or full
+        (*p_pX    ) = pX_start + ilo ;
+        (*p_pX_end) = pX_start + ihi ;
+    }
+    else
+    { 
+        // X(:,kX) is sparse; find the first entries with index >= ilo and
+        // >= ihi, using a binary search.  Since pright starts at pX_end, one
+        // past the end of X(:,kX), each search ends with pleft == pright at
+        // the first entry >= the index, or at pX_end if there is none.
+        int64_t pleft = pX_start, pright = pX_end ;
+        GB_TRIM_BINARY_SEARCH (ilo, Xi, pleft, pright) ;
+        (*p_pX) = pleft ;
+        pright = pX_end ;
+        GB_TRIM_BINARY_SEARCH (ihi, Xi, pleft, pright) ;
+        (*p_pX_end) = pleft ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_add_mask_slice
+//------------------------------------------------------------------------------
+
+GrB_Info GB_add_mask_slice
+(
+    // output:
+    GB_task_struct **p_TaskList,    // array of structs
+    size_t *p_TaskList_size,        // size of TaskList
+    int *p_ntasks,                  // # of tasks constructed
+    int *p_nthreads,                // # of threads for eWise operation
+    // input:
+    const int64_t Cnvec,            // # of vectors of C
+    const int64_t *restrict Ch,     // vectors of C, if hypersparse
+    const int64_t *restrict C_to_M, // mapping of C to M
+    const int64_t *restrict C_to_A, // mapping of C to A
+    const int64_t *restrict C_to_B, // mapping of C to B
+    bool Ch_is_Mh,                  // if true, then Ch == Mh
+    const GrB_Matrix M,             // mask matrix to slice
+    const GrB_Matrix A,             // matrix to slice
+    const GrB_Matrix B,             // matrix to slice
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (p_TaskList != NULL) ;
+    ASSERT (p_TaskList_size != NULL) ;
+    ASSERT (p_ntasks != NULL) ;
+    ASSERT (p_nthreads != NULL) ;
+
+    ASSERT_MATRIX_OK (M, "M for add_mask_slice", GB0) ;
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT (!GB_JUMBLED (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+
+    ASSERT_MATRIX_OK (A, "A for add_mask_slice", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    ASSERT_MATRIX_OK (B, "B for add_mask_slice", GB0) ;
+    ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_PENDING (B)) ;
+
+    (*p_TaskList  ) = NULL ;
+    (*p_TaskList_size) = 0 ;
+    (*p_ntasks    ) = 0 ;
+    (*p_nthreads  ) = 1 ;
+
+    int64_t *restrict Cwork = NULL ; size_t Cwork_size = 0 ;
+    GB_WERK_DECLARE (Coarse, int64_t) ;     // size ntasks1+1
+    int ntasks1 = 0 ;
+
+    //--------------------------------------------------------------------------
+    // determine # of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the initial TaskList
+    //--------------------------------------------------------------------------
+
+    GB_task_struct *restrict TaskList = NULL ; size_t TaskList_size = 0 ;
+    int max_ntasks = 0 ;
+    int ntasks0 = (nthreads_max == 1) ? 1 : (32 * nthreads_max) ;
+    GB_REALLOC_TASK_WORK (TaskList, ntasks0, max_ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // check for quick return for a single task
+    //--------------------------------------------------------------------------
+
+    if (Cnvec == 0 || ntasks0 == 1)
+    { 
+        // construct a single coarse task that computes all of C
+        TaskList [0].kfirst = 0 ;
+        TaskList [0].klast  = Cnvec-1 ;
+        (*p_TaskList  ) = TaskList ;
+        (*p_TaskList_size) = TaskList_size ;
+        (*p_ntasks    ) = (Cnvec == 0) ? 0 : 1 ;
+        (*p_nthreads  ) = 1 ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get M, A, and B
+    //--------------------------------------------------------------------------
+
+    const int64_t vlen = M->vlen ;
+    const int64_t *restrict Mp = M->p ;
+    const int64_t *restrict Mi = M->i ;
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ai = A->i ;
+    const int64_t *restrict Bp = B->p ;
+    const int64_t *restrict Bi = B->i ;
+    bool Ch_is_Ah = (Ch != NULL && A->h != NULL && Ch == A->h) ;
+    bool Ch_is_Bh = (Ch != NULL && B->h != NULL && Ch == B->h) ;
+    Ch_is_Mh = Ch_is_Mh || (Ch != NULL && M->h != NULL && Ch == M->h) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Cwork = GB_MALLOC_WORK (Cnvec+1, int64_t, &Cwork_size) ;
+    if (Cwork == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // estimate the work for each vector of C, from the entries in M
+    //--------------------------------------------------------------------------
+
+    int nthreads_for_Cwork = GB_nthreads (Cnvec, chunk, nthreads_max) ;
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads_for_Cwork) schedule(static)
+    for (k = 0 ; k < Cnvec ; k++)
+    { 
+        int64_t kM = (C_to_M != NULL) ? C_to_M [k] :
+            (Ch_is_Mh ? k : GBH (Ch, k)) ;
+        const int64_t mknz = (kM < 0) ? 0 : (Mp [kM+1] - Mp [kM]) ;
+        Cwork [k] = mknz + 1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace Cwork with its cumulative sum
+    //--------------------------------------------------------------------------
+
+    GB_cumsum (Cwork, Cnvec, NULL, nthreads_for_Cwork, Context) ;
+    double cwork = (double) Cwork [Cnvec] ;
+
+    //--------------------------------------------------------------------------
+    // determine # of threads and tasks for the eWise operation
+    //--------------------------------------------------------------------------
+
+    int nthreads = GB_nthreads (cwork, chunk, nthreads_max) ;
+
+    ntasks0 = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    double target_task_size = cwork / (double) (ntasks0) ;
+    target_task_size = GB_IMAX (target_task_size, chunk) ;
+    ntasks1 = cwork / target_task_size ;
+    ntasks1 = GB_IMAX (ntasks1, 1) ;
+
+    //--------------------------------------------------------------------------
+    // slice the work into coarse tasks
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (Coarse, ntasks1 + 1, int64_t) ;
+    if (Coarse == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_pslice (Coarse, Cwork, Cnvec, ntasks1, false) ;
+
+    //--------------------------------------------------------------------------
+    // construct all tasks, both coarse and fine
+    //--------------------------------------------------------------------------
+
+    int ntasks = 0 ;
+
+    for (int t = 0 ; t < ntasks1 ; t++)
+    {
+
+        //----------------------------------------------------------------------
+        // coarse task computes C (:,k:klast)
+        //----------------------------------------------------------------------
+
+        int64_t k = Coarse [t] ;
+        int64_t klast  = Coarse [t+1] - 1 ;
+
+        if (k >= Cnvec)
+        { 
+
+            //------------------------------------------------------------------
+            // all tasks have been constructed
+            //------------------------------------------------------------------
+
+            break ;
+
+        }
+        else if (k < klast)
+        { 
+
+            //------------------------------------------------------------------
+            // coarse task has 2 or more vectors
+            //------------------------------------------------------------------
+
+            GB_REALLOC_TASK_WORK (TaskList, ntasks + 1, max_ntasks) ;
+            TaskList [ntasks].kfirst = k ;
+            TaskList [ntasks].klast  = klast ;
+            ntasks++ ;
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // coarse task has 0 or 1 vectors
+            //------------------------------------------------------------------
+
+            // Vector k must be removed from the work done by this and any
+            // other coarse-grain task, and split into one or more fine-grain
+            // tasks, as done by GB_ewise_slice.
+
+            for (int tt = t ; tt < ntasks1 ; tt++)
+            {
+                // remove k from the initial slice tt
+                if (Coarse [tt] == k)
+                { 
+                    // remove k from task tt
+                    Coarse [tt] = k+1 ;
+                }
+                else
+                { 
+                    // break, k not in task tt
+                    break ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // get the vectors of C, M, A, and B
+            //------------------------------------------------------------------
+
+            int64_t j = GBH (Ch, k) ;
+            int64_t kM = (C_to_M != NULL) ? C_to_M [k] : (Ch_is_Mh ? k : j) ;
+            int64_t kA = (C_to_A != NULL) ? C_to_A [k] : (Ch_is_Ah ? k : j) ;
+            int64_t kB = (C_to_B != NULL) ? C_to_B [k] : (Ch_is_Bh ? k : j) ;
+            int64_t pM_start = (kM < 0) ? (-1) : Mp [kM] ;
+            int64_t pM_end   = (kM < 0) ? (-1) : Mp [kM+1] ;
+            int64_t pA_start = (kA < 0) ? (-1) : GBP (Ap, kA, vlen) ;
+            int64_t pA_end   = (kA < 0) ? (-1) : GBP (Ap, kA+1, vlen) ;
+            int64_t pB_start = (kB < 0) ? (-1) : GBP (Bp, kB, vlen) ;
+            int64_t pB_end   = (kB < 0) ? (-1) : GBP (Bp, kB+1, vlen) ;
+            int64_t mknz = pM_end - pM_start ;
+
+            //------------------------------------------------------------------
+            // determine the # of fine-grain tasks to create for vector k
+            //------------------------------------------------------------------
+
+            double ckwork = Cwork [k+1] - Cwork [k] ;
+            int64_t nfine = ckwork / target_task_size ;
+            nfine = GB_IMIN (nfine, mknz) ;
+            nfine = GB_IMAX (nfine, 1) ;
+
+            // make the TaskList bigger, if needed
+            GB_REALLOC_TASK_WORK (TaskList, ntasks + nfine, max_ntasks) ;
+
+            //------------------------------------------------------------------
+            // create the fine-grain tasks
+            //------------------------------------------------------------------
+
+            if (nfine == 1)
+            { 
+
+                //--------------------------------------------------------------
+                // this is a single coarse task for all of vector k
+                //--------------------------------------------------------------
+
+                TaskList [ntasks].kfirst = k ;
+                TaskList [ntasks].klast  = k ;
+                ntasks++ ;
+
+            }
+            else
+            {
+
+                //--------------------------------------------------------------
+                // slice vector k into nfine fine tasks
+                //--------------------------------------------------------------
+
+                // Fine task tfine does the entries M(ilo:ihi-1,j), which are
+                // in Mi [pM:pM_end-1], and the corresponding parts of A(:,j)
+                // and B(:,j).  The first task starts at ilo = 0 and the last
+                // task ends at ihi = vlen.
+
+                for (int64_t tfine = 0 ; tfine < nfine ; tfine++)
+                { 
+                    int64_t pM = pM_start + (tfine * mknz) / nfine ;
+                    int64_t pM_last = pM_start + ((tfine+1) * mknz) / nfine ;
+                    int64_t ilo = (tfine == 0) ? 0 : Mi [pM] ;
+                    int64_t ihi = (tfine == nfine-1) ? vlen : Mi [pM_last] ;
+                    ASSERT (ntasks < max_ntasks) ;
+                    TaskList [ntasks].kfirst = k ;
+                    TaskList [ntasks].klast  = -1 ; // this is a fine task
+                    TaskList [ntasks].pM     = pM ;
+                    TaskList [ntasks].pM_end = pM_last ;
+                    GB_add_mask_slice_find (
+                        &(TaskList [ntasks].pA), &(TaskList [ntasks].pA_end),
+                        ilo, ihi, pA_start, pA_end, Ai) ;
+                    GB_add_mask_slice_find (
+                        &(TaskList [ntasks].pB), &(TaskList [ntasks].pB_end),
+                        ilo, ihi, pB_start, pB_end, Bi) ;
+                    TaskList [ntasks].len = ihi - ilo ;
+                    ntasks++ ;
+                }
+            }
+        }
+    }
+
+    ASSERT (ntasks <= max_ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*p_TaskList  ) = TaskList ;
+    (*p_TaskList_size) = TaskList_size ;
+    (*p_ntasks    ) = ntasks ;
+    (*p_nthreads  ) = nthreads ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -73,7 +73,8 @@ static inline bool GB_allocate_result
     int64_t *restrict *Ch_handle,        size_t *Ch_size_handle,
     int64_t *restrict *C_to_M_handle,    size_t *C_to_M_size_handle,
     int64_t *restrict *C_to_A_handle,    size_t *C_to_A_size_handle,
-    int64_t *restrict *C_to_B_handle,    size_t *C_to_B_size_handle
+    int64_t *restrict *C_to_B_handle,    size_t *C_to_B_size_handle,
+    GB_Context Context
 )
 {
     bool ok = true ;
@@ -270,7 +271,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             &Ch,    &Ch_size,
             NULL,   NULL,
             (A_is_hyper) ? (&C_to_A) : NULL, &C_to_A_size,
-            (B_is_hyper) ? (&C_to_B) : NULL, &C_to_B_size))
+            (B_is_hyper) ? (&C_to_B) : NULL, &C_to_B_size, Context))
         { 
             // out of memory
             GB_FREE_WORKSPACE ;
@@ -416,7 +417,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             &Ch,    &Ch_size,
             (M_is_hyper) ? (&C_to_M) : NULL, &C_to_M_size,
             &C_to_A, &C_to_A_size,
-            &C_to_B, &C_to_B_size))
+            &C_to_B, &C_to_B_size, Context))
         { 
             // out of memory
             GB_FREE_WORKSPACE ;
@@ -570,7 +571,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             NULL, NULL,
             (M_is_hyper) ? (&C_to_M) : NULL, &C_to_M_size,
             &C_to_A, &C_to_A_size,
-            NULL, NULL))
+            NULL, NULL, Context))
         { 
             // out of memory
             GB_FREE_WORKSPACE ;
@@ -610,7 +611,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             NULL, NULL,
             (M_is_hyper) ? (&C_to_M) : NULL, &C_to_M_size,
             NULL, NULL,
-            &C_to_B, &C_to_B_size))
+            &C_to_B, &C_to_B_size, Context))
         { 
             // out of memory
             GB_FREE_WORKSPACE ;
@@ -649,7 +650,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
             NULL, NULL,
             (M_is_hyper) ? (&C_to_M) : NULL, &C_to_M_size,
             NULL, NULL,
-            NULL, NULL))
+            NULL, NULL, Context))
         { 
             // out of memory
             GB_FREE_WORKSPACE ;
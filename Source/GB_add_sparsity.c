@@ -86,7 +86,7 @@ int GB_add_sparsity         // return the sparsity structure for C
     {
 
         if (M_is_sparse_or_hyper)
-        { 
+        {
 
             //      ------------------------------------------
             //      C      <M> =        A       +       B
@@ -101,20 +101,22 @@ int GB_add_sparsity         // return the sparsity structure for C
             //      sparse  sparse      full            bitmap
             //      sparse  sparse      full            full  
 
-            // TODO: if M and A and/or B are all sparse, use the mask only if:
-            // 8*nnz(M) <= ( (A sparse or hyper) ? nnz(A) : 0 ) +
-            //             ( (B sparse or hyper) ? nnz(B) : 0 )
-            // if A and B are both bitmap or full, then always use the mask.
-            // GB_sparse_add_template handles this case, but exploiting the
-            // mask can be asympotically slow, when C and M are sparse, and A
-            // and/or B are sparse.
-
-            // TODO: check the sparse_mask_is_easy condition:  use M
-            // if Mask_struct is true, A is not bitmap, B is not bitmap,
-            // and one of the 3 conditions holds.  In this case, ignore the
-            // 8*nnz(M) <= (...) test, and always use the mask.
-
-            // TODO: See the GB_MASK_VERY_SPARSE (M, A, B) macro for this test.
+            // If the mask is used, GB_add iterates over the entries of M and
+            // finds each A(i,j) and B(i,j) with a binary search if A or B are
+            // sparse/hyper, or in O(1) time if they are bitmap/full (see
+            // GB_add_mask_slice).  This takes O(nnz(M)*log(n)) time, while
+            // computing C=A+B takes O(nnz(A)+nnz(B)) time.  So if M, A, and B
+            // are all sparse/hyper, the mask is used only if it is very
+            // sparse compared with A and B, or if it is easy to use because
+            // A or B are aliased to M.  Otherwise, C=A+B is computed and the
+            // mask is applied later.  If A or B are bitmap or full, the mask
+            // is always used, since C=A+B could have many more entries.
+
+            if (A_is_sparse_or_hyper && B_is_sparse_or_hyper &&
+                M != A && M != B)
+            { 
+                (*apply_mask) = GB_MASK_VERY_SPARSE (8, M, A, B) ;
+            }
 
             C_sparsity = GxB_SPARSE ;
 
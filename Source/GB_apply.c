@@ -302,6 +302,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
                 C->iso = true ; // OK
                 info = GB_convert_any_to_iso (C, NULL, Context) ;
             }
+            GB_stamp (C) ;
         }
         return (info) ;
     }
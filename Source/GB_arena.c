@@ -0,0 +1,294 @@
+//------------------------------------------------------------------------------
+// GB_arena: allocate and free werkspace from a GxB_Arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the descriptor of a user-callable method holds a GxB_Arena, it is copied
+// into the Context by GB_Descriptor_get.  All werkspace allocated by
+// GB_MALLOC_WORK, GB_CALLOC_WORK, GB_REALLOC_WORK, and by GB_WERK_PUSH (when
+// the werkspace does not fit in the Context->Werk stack) is then taken from
+// the arena with a simple bump allocator.  A request that does not fit in the
+// arena is allocated with GB_malloc_memory instead.
+
+// Blocks are freed by GB_FREE_WORK and GB_WERK_POP, in any order.  If the
+// block is at the top of the arena, the space is reclaimed immediately.
+// Otherwise, the space is reclaimed when the last live block in the arena is
+// freed.  All werkspace is freed before the user-callable method returns, so
+// the entire arena is always released in O(1) time at the end of each method.
+
+// The arena may be accessed by multiple OpenMP threads inside GraphBLAS, so
+// the allocator is protected with a critical section.  An arena can be used
+// by only one user thread at a time, however, just like a GrB_Matrix.
+
+#include "GB.h"
+
+// blocks in the arena are aligned to a cache line
+#define GB_ARENA_ALIGN 64
+#define GB_ARENA_ROUND(s) \
+    (((s) + (GB_ARENA_ALIGN-1)) & (~((size_t) (GB_ARENA_ALIGN-1))))
+
+//------------------------------------------------------------------------------
+// GB_arena_owns: true if p was allocated from the arena
+//------------------------------------------------------------------------------
+
+static inline bool GB_arena_owns
+(
+    const GxB_Arena arena,
+    const void *p
+)
+{
+    return (arena != NULL && p != NULL &&
+        ((GB_void *) p) >= arena->space &&
+        ((GB_void *) p) <  arena->space + arena->space_size) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_malloc: allocate a block from the arena
+//------------------------------------------------------------------------------
+
+// Returns NULL if the Context has no arena, or if the block does not fit.  The
+// block is not initialized.
+
+static void *GB_arena_malloc
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    bool *failed,           // true if a failure is simulated (for testing)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    (*failed) = false ;
+    GxB_Arena arena = (Context == NULL) ? NULL : Context->arena ;
+    if (arena == NULL)
+    {
+        // no arena; use malloc instead
+        return (NULL) ;
+    }
+
+    // make sure at least one item of at least one byte is allocated
+    nitems = GB_IMAX (1, nitems) ;
+    size_of_item = GB_IMAX (1, size_of_item) ;
+    size_t size ;
+    bool ok = GB_size_t_multiply (&size, nitems, size_of_item) ;
+    if (!ok || size > arena->space_size)
+    {
+        // the block can never fit in the arena
+        #pragma omp atomic update
+        arena->noverflow++ ;
+        return (NULL) ;
+    }
+    size = GB_ARENA_ROUND (size) ;
+
+    if (GB_Global_malloc_tracking_get ( ) && GB_Global_malloc_debug_get ( ))
+    {
+        // brutal memory debug; pretend to fail if (count-- <= 0).
+        if (GB_Global_malloc_debug_count_decrement ( ))
+        {
+            (*failed) = true ;
+            return (NULL) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // bump-allocate the block
+    //--------------------------------------------------------------------------
+
+    GB_void *p = NULL ;
+    #pragma omp critical(GB_arena)
+    {
+        if (size <= arena->space_size - arena->top)
+        {
+            p = arena->space + arena->top ;
+            arena->top += size ;
+            arena->nlive++ ;
+            arena->highwater = GB_IMAX (arena->highwater, arena->top) ;
+        }
+        else
+        {
+            arena->noverflow++ ;
+        }
+    }
+
+    (*size_allocated) = (p == NULL) ? 0 : size ;
+    return ((void *) p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_arena_free: free a block from the arena
+//------------------------------------------------------------------------------
+
+static void GB_arena_free
+(
+    GxB_Arena arena,
+    GB_void *p,             // block to free, owned by the arena
+    size_t size_allocated   // size of the block
+)
+{
+    #pragma omp critical(GB_arena)
+    {
+        ASSERT (arena->nlive > 0) ;
+        arena->nlive-- ;
+        if (arena->nlive == 0)
+        {
+            // the arena is now empty
+            arena->top = 0 ;
+        }
+        else if (p + size_allocated == arena->space + arena->top)
+        {
+            // the block is at the top of the arena
+            arena->top = (size_t) (p - arena->space) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_malloc_work: allocate werkspace
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void *GB_malloc_work        // allocate workspace
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    bool failed ;
+    void *p = GB_arena_malloc (nitems, size_of_item, size_allocated, &failed,
+        Context) ;
+    if (p == NULL && !failed)
+    {
+        p = GB_malloc_memory (nitems, size_of_item, size_allocated) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_calloc_work: allocate werkspace and set it to zero
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void *GB_calloc_work        // allocate workspace, set to zero
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    bool failed ;
+    void *p = GB_arena_malloc (nitems, size_of_item, size_allocated, &failed,
+        Context) ;
+    if (p != NULL)
+    {
+        // clear the block of memory with a parallel memset
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        GB_memset (p, 0, (*size_allocated), nthreads_max) ;
+    }
+    else if (!failed)
+    {
+        p = GB_calloc_memory (nitems, size_of_item, size_allocated, Context) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_realloc_work: reallocate werkspace
+//------------------------------------------------------------------------------
+
+// On output, if ok is true, p points to the new block, with the same content
+// as the old block (up to the smaller of the two sizes).  Otherwise, p points
+// to the old block, which is unchanged.
+
+GB_PUBLIC
+void *GB_realloc_work       // reallocate workspace
+(
+    size_t nitems_new,      // new number of items in the object
+    size_t size_of_item,    // sizeof each item
+    // input/output
+    void *p,                // old workspace to reallocate
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    bool *ok,               // true if successful, false otherwise
+    GB_Context Context
+)
+{
+
+    GxB_Arena arena = (Context == NULL) ? NULL : Context->arena ;
+    if (p == NULL)
+    {
+        // allocate a new block
+        p = GB_malloc_work (nitems_new, size_of_item, size_allocated, Context) ;
+        (*ok) = (p != NULL) ;
+        return (p) ;
+    }
+    else if (!GB_arena_owns (arena, p))
+    {
+        // the old block was allocated by malloc
+        return (GB_realloc_memory (nitems_new, size_of_item, p,
+            size_allocated, ok, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // move the block out of the arena, or to a new place in the arena
+    //--------------------------------------------------------------------------
+
+    size_t oldsize = (*size_allocated) ;
+    size_t newsize ;
+    void *pnew = GB_malloc_work (nitems_new, size_of_item, &newsize, Context) ;
+    (*ok) = (pnew != NULL) ;
+    if (pnew == NULL)
+    {
+        // out of memory; the old block is unchanged
+        return (p) ;
+    }
+    memcpy (pnew, p, GB_IMIN (oldsize, newsize)) ;
+    GB_arena_free (arena, (GB_void *) p, oldsize) ;
+    (*size_allocated) = newsize ;
+    return (pnew) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_free_work: free werkspace
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void GB_free_work           // free workspace
+(
+    // input/output
+    void **p,               // pointer to workspace to free
+    // input
+    size_t size_allocated,  // # of bytes actually allocated
+    GB_Context Context
+)
+{
+    if (p != NULL && (*p) != NULL)
+    {
+        GxB_Arena arena = (Context == NULL) ? NULL : Context->arena ;
+        if (GB_arena_owns (arena, *p))
+        {
+            // return the block to the arena
+            GB_arena_free (arena, (GB_void *) (*p), size_allocated) ;
+            (*p) = NULL ;
+        }
+        else
+        {
+            // the block was allocated by malloc
+            GB_dealloc_memory (p, size_allocated) ;
+        }
+    }
+}
@@ -179,6 +179,10 @@ GrB_Info GB_assign_prep
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (M) ;
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
 
+    // tuples from concurrent setElement into C must be assembled before any
+    // pending tuples are added to C by this assignment
+    GB_WAIT_IF (GB_INGEST (C), C, "C") ;
+
     // some kernels allow for M and A to be jumbled
     ASSERT (GB_JUMBLED_OK (M)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
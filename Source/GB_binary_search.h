@@ -62,6 +62,35 @@
 }
 #endif
 
+//------------------------------------------------------------------------------
+// GB_GALLOP_SEARCH: galloping (exponential) search
+//------------------------------------------------------------------------------
+
+// Search for integer i in the list X [pleft...pend-1], where the entries
+// near X [pleft] are the most likely to be the target.  The probes X [pleft],
+// X [pleft+1], X [pleft+3], X [pleft+7], ... are checked until one is found
+// that is >= i, and then a binary search is done between the last two probes.
+// This takes O(log(d)) time if the result is d positions from the start,
+// instead of O(log(pend-pleft)) for GB_TRIM_BINARY_SEARCH.  On output, pleft
+// has the same meaning as GB_TRIM_BINARY_SEARCH (i, X, pleft, pend-1):
+// X [original_pleft ... pleft-1] < i, and X [pleft] >= i unless pleft is
+// pend-1 (or pleft is pend if the list is empty).
+
+#define GB_GALLOP_SEARCH(i,X,pleft,pend)                                    \
+{                                                                           \
+    int64_t plast = (pend) - 1 ;                                            \
+    int64_t pright = pleft ;                                                \
+    int64_t gallop = 1 ;                                                    \
+    while (pright < plast && X [pright] < i)                                \
+    {                                                                       \
+        /* X [pleft ... pright] < i; gallop forward */                      \
+        pleft = pright + 1 ;                                                \
+        pright = (pright + gallop < plast) ? (pright + gallop) : plast ;    \
+        gallop = gallop << 1 ;                                              \
+    }                                                                       \
+    GB_TRIM_BINARY_SEARCH (i, X, pleft, pright) ;                           \
+}
+
 //------------------------------------------------------------------------------
 // GB_BINARY_SEARCH: binary search and check if found
 //------------------------------------------------------------------------------
@@ -20,13 +20,18 @@
 // GB_bitmap_AxB_saxpy: compute C=A*B, C<M>=A*B, or C<!M>=A*B
 //------------------------------------------------------------------------------
 
-// TODO: also pass in the user's C and the accum operator, and done_in_place,
-// like GB_AxB_dot4.
+// If C_in_place is true, then C is the user's input matrix, which is bitmap or
+// as-if-full, and C<#M>+=A*B is computed in-place.  The accum operator is the
+// same as the monoid of the semiring, and the type of C matches the monoid
+// type.  C is not iso on output.  If C is full on input, it is converted to
+// bitmap with all entries present; GB_conform converts it back to full when
+// done.  If the mask is present, C_replace is false.
 
 GB_PUBLIC                           // for testing only
 GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or C_in
+    const bool C_in_place,          // if true, C+=A*B is done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M,             // optional mask matrix
@@ -46,7 +51,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
 
     GrB_Info info ;
 
-    ASSERT (C != NULL && C->static_header) ;
+    ASSERT (C != NULL && (C->static_header || C_in_place)) ;
 
     ASSERT_MATRIX_OK_OR_NULL (M, "M for bitmap saxpy A*B", GB0) ;
     ASSERT (!GB_PENDING (M)) ;
@@ -65,25 +70,39 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
 
     ASSERT_SEMIRING_OK (semiring, "semiring for bitmap saxpy A*B", GB0) ;
     ASSERT (A->vdim == B->vlen) ;
+    ASSERT (GB_IMPLIES (C_in_place, !C_iso
+        && (GB_IS_BITMAP (C) || GB_as_if_full (C))
+        && C->type == semiring->add->op->ztype)) ;
 
     //--------------------------------------------------------------------------
-    // construct C
+    // construct C, or convert the user's C to non-iso bitmap
     //--------------------------------------------------------------------------
 
-    // TODO: If C is the right type on input, and accum is the same as the
-    // monoid, then do not create C, but compute in-place instead.
-
-    // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which case
-    // it is calloc'ed.
-
     GrB_Type ctype = semiring->add->op->ztype ;
-    int64_t cnzmax = 1 ;
-    (void) GB_int64_multiply ((GrB_Index *) &cnzmax, A->vlen, B->vdim) ;
-    // set C->iso = C_iso   OK
-    GB_OK (GB_new_bix (&C, true, // static header
-        ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
-        GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso, Context)) ;
-    C->magic = GB_MAGIC ;
+    if (C_in_place)
+    { 
+        // C is the user's input matrix.  If C is as-if-full, all entries of
+        // the bitmap are present.
+        ASSERT (C->vlen == A->vlen && C->vdim == B->vdim) ;
+        GBURBLE ("(in-place) ") ;
+        if (C->iso)
+        { 
+            GB_OK (GB_convert_any_to_non_iso (C, true, Context)) ;
+        }
+        GB_OK (GB_convert_any_to_bitmap (C, Context)) ;
+    }
+    else
+    { 
+        // Cb is set to all zero.  C->x is malloc'd unless C is iso, in which
+        // case it is calloc'ed.
+        int64_t cnzmax = 1 ;
+        (void) GB_int64_multiply ((GrB_Index *) &cnzmax, A->vlen, B->vdim) ;
+        // set C->iso = C_iso   OK
+        GB_OK (GB_new_bix (&C, true, // static header
+            ctype, A->vlen, B->vdim, GB_Ap_null, true, GxB_BITMAP, true,
+            GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso, Context)) ;
+        C->magic = GB_MAGIC ;
+    }
 
     //--------------------------------------------------------------------------
     // get the semiring operators
@@ -179,6 +179,7 @@ GrB_Info GB_bitmap_expand_to_hyper
 
     // free the bitmap, if present
     GB_FREE ((&C->b), C->b_size) ;
+    GB_stamp (C) ;
 
     // C is now sparse or hypersparse
     ASSERT_MATRIX_OK (C, "C expanded from bitmap/full to hyper", GB0) ;
@@ -76,5 +76,12 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
 
     // free the list of pending tuples
     GB_Pending_free (&(A->Pending)) ;
+
+    // discard any tuples from concurrent setElement, but remain in
+    // concurrent-ingest mode
+    GB_Ingest_clear (A->Ingest) ;
+
+    // the content of A has been freed
+    GB_stamp (A) ;
 }
 
@@ -28,7 +28,8 @@
 // STEP 1: copy user input.  O(e/p) read/write per thread, or skipped.
 
 // STEP 2: sort the tuples.  Time: O((e log e)/p), read/write, or skipped if
-//         the tuples are already sorted.
+//         the tuples are already sorted.  If the indices fit in 32 bits,
+//         each (j,i) pair is packed into a single 64-bit key for the sort.
 
 // STEP 3: count vectors and duplicates.  O(e/p) reads, per thread, if no
 //         duplicates, or skipped if already done.  O(e/p) read/writes
@@ -82,6 +83,10 @@
 // J_work and S_work are freed on output.  S_work is not transplanted into
 // C->x.
 
+// I_work, J_work, and S_work are either transplanted into T or freed by
+// GB_builder with GB_FREE, so the caller must allocate them with GB_MALLOC,
+// never with GB_MALLOC_WORK (which may take them from a GxB_Arena).
+
 // For iso inputs/outputs: T and Sx have the same iso property.  If
 // they are iso, then dup is always NULL.  Duplicates may or may not appear
 // if T and Sx are iso.
@@ -114,6 +119,11 @@
 #define GB_J_WORK(t) (((t) < 0) ? -1 : ((J_work == NULL) ? 0 : J_work [t]))
 #define GB_K_WORK(t) (((t) < 0) ? -1 : ((K_work == NULL) ? t : K_work [t]))
 
+// (j,i) can be packed into a single int64_t key if i < 2^32 and j < 2^31
+#define GB_BUILDER_PACK_IMASK ((int64_t) 0xFFFFFFFF)
+#define GB_BUILDER_PACK_OK(vlen,vdim) \
+    ((vlen) <= (((int64_t) 1) << 32) && (vdim) <= (((int64_t) 1) << 31))
+
 #define GB_FREE_WORKSPACE                           \
 {                                                   \
     GB_WERK_POP (Work, int64_t) ;                   \
@@ -564,7 +574,51 @@ GrB_Info GB_builder                 // build a matrix from tuples
             // sort a set of (j,i,k) tuples
             //------------------------------------------------------------------
 
-            if (S_iso)
+            if (GB_BUILDER_PACK_OK (vlen, vdim))
+            {
+
+                //--------------------------------------------------------------
+                // sort the tuples with (j,i) packed into a single key
+                //--------------------------------------------------------------
+
+                // If i < 2^32 and j < 2^31, the pair (j,i) is packed into a
+                // single 64-bit key, (j << 32) + i, held in J_work.  The keys
+                // sort in the same order as the (j,i) pairs, and the sort
+                // moves half as many indices, and compares one key instead
+                // of two.  The pairs are then unpacked into J_work and
+                // I_work.
+
+                int64_t k ;
+                #pragma omp parallel for num_threads(nthreads) schedule(static)
+                for (k = 0 ; k < nvals ; k++)
+                { 
+                    J_work [k] = (J_work [k] << 32) + I_work [k] ;
+                }
+
+                if (S_iso)
+                { 
+                    // K_work is NULL; only sort the (j,i) keys
+                    info = GB_msort_1 (J_work, nvals, nthreads) ;
+                }
+                else
+                { 
+                    info = GB_msort_2 (J_work, K_work, nvals, nthreads) ;
+                }
+
+                if (info == GrB_SUCCESS)
+                {
+                    #pragma omp parallel for num_threads(nthreads) \
+                        schedule(static)
+                    for (k = 0 ; k < nvals ; k++)
+                    { 
+                        int64_t key = J_work [k] ;
+                        I_work [k] = key & GB_BUILDER_PACK_IMASK ;
+                        J_work [k] = key >> 32 ;
+                    }
+                }
+
+            }
+            else if (S_iso)
             { 
                 // K_work is NULL; only sort (j,i)
                 info = GB_msort_2 (J_work, I_work, nvals, nthreads) ;
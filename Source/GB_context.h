@@ -39,6 +39,8 @@ typedef struct
     size_t *logger_size_handle ;
     int nthreads_max ;              // max # of threads to use
     int pwerk ;                     // top of Werk stack, initially zero
+    GxB_Arena arena ;               // arena for werkspace, from descriptor
+    GxB_MxM_Plan plan ;             // plan for C=A*B, from descriptor
 }
 GB_Context_struct ;
 
@@ -66,11 +68,22 @@ typedef GB_Context_struct *GB_Context ;
     /* get the pointer to where any error will be logged */         \
     Context->logger_handle = NULL ;                                 \
     Context->logger_size_handle = NULL ;                            \
-    /* initialize the Werk stack */                                 \
-    Context->pwerk = 0 ;
-
-// C is a matrix, vector, scalar, or descriptor
+    /* initialize the Werk stack; no arena unless in descriptor */  \
+    Context->pwerk = 0 ;                                            \
+    Context->arena = NULL ;                                         \
+    /* no plan for C=A*B unless in descriptor */                    \
+    Context->plan = NULL ;
+
+// C is a matrix, vector, or scalar that is modified by the method, so it is
+// given a new modification stamp, and any cached transpose of C is freed
+// (see GB_stamp)
 #define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_LOGGER (C, where_string)                               \
+    GB_stamp ((GrB_Matrix) (C)) ;
+
+// C is a descriptor, or a matrix, vector, or scalar whose values and pattern
+// are not modified by the method (GrB_wait)
+#define GB_WHERE_LOGGER(C,where_string)                             \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
@@ -84,6 +97,26 @@ typedef GB_Context_struct *GB_Context ;
         Context->logger_size_handle = &(C->logger_size) ;           \
     }
 
+// create the Context for GrB_*_setElement.  If C is in concurrent-ingest mode,
+// other user threads may be calling GrB_*_setElement on C at the same time,
+// so no error is logged in C, and C is stamped by GB_wait instead, when the
+// tuples are assembled.
+#define GB_WHERE_SETELEMENT(C,where_string)                         \
+    if (!GB_Global_GrB_init_called_get ( ))                         \
+    {                                                               \
+        return (GrB_PANIC) ; /* GrB_init not called */              \
+    }                                                               \
+    GB_CONTEXT (where_string)                                       \
+    if (C != NULL && C->Ingest == NULL)                             \
+    {                                                               \
+        /* free any prior error logged in the object */             \
+        GB_FREE (&(C->logger), C->logger_size) ;                    \
+        Context->logger_handle = &(C->logger) ;                     \
+        Context->logger_size_handle = &(C->logger_size) ;           \
+        /* C is modified; give it a new stamp */                    \
+        GB_stamp ((GrB_Matrix) (C)) ;                               \
+    }
+
 // create the Context, with no error logging
 #define GB_WHERE1(where_string)                                     \
     if (!GB_Global_GrB_init_called_get ( ))                         \
@@ -238,8 +238,9 @@ static inline bool GB_as_if_full
     // zombies, pending tuples, and jumbled status are checked.
     // A can have any sparsity structure: hyper, sparse, bitmap, or full.
     // It can be converted to full.
-    if (A == NULL)
-    { 
+    if (A == NULL || GB_INGEST (A))
+    {
+        // A is NULL, or has tuples from concurrent setElement not yet in A
         return (false) ;
     }
     if (GB_IS_FULL (A))
@@ -85,6 +85,7 @@ GrB_Info GB_convert_any_to_iso // convert non-iso matrix to iso
     //--------------------------------------------------------------------------
 
     A->iso = true ;     // OK: convert_any_to_iso
+    GB_stamp (A) ;
     ASSERT_MATRIX_OK (A, "A converted to iso", GB0) ;
     return (GrB_SUCCESS) ;
 }
@@ -79,6 +79,7 @@ GrB_Info GB_convert_any_to_non_iso // convert iso matrix to non-iso
     //--------------------------------------------------------------------------
 
     A->iso = false ;        // OK: convert_any_to_non_iso
+    GB_stamp (A) ;
     ASSERT_MATRIX_OK (A, "A converted to non-iso", GB0) ;
     return (GrB_SUCCESS) ;
 }
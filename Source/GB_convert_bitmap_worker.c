@@ -149,6 +149,11 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
 
     // TODO: add type-specific versions for built-in types
 
+    // GB_SKIP_WORD (p,pend) is true if p starts a word of 8 entries of the
+    // bitmap that lies in [p,pend) and has no entries present
+    #define GB_SKIP_WORD(p,pend)                                        \
+        (((p) & 7) == 0 && (p) + 8 <= (pend) && GB_bitmap_word (Ab, p) == 0)
+
     const GB_void *restrict Ax = (GB_void *) (A->x) ;
     const bool A_iso = A->iso ;
     const bool numeric = (Ax_new != NULL && Ax != NULL) ;
@@ -167,9 +172,16 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
             // gather from the bitmap into the new A (:,j)
             int64_t pnew = Ap [j] ;
             int64_t pA_start = j * avlen ;
+            int64_t pA_end = pA_start + avlen ;
             for (int64_t i = 0 ; i < avlen ; i++)
             {
                 int64_t p = i + pA_start ;
+                if (GB_SKIP_WORD (p, pA_end))
+                { 
+                    // none of A (i:i+7,j) are present
+                    i += 7 ;
+                    continue ;
+                }
                 if (Ab [p])
                 {
                     // A(i,j) is in the bitmap
@@ -207,10 +219,17 @@ GrB_Info GB_convert_bitmap_worker   // extract CSC/CSR or triplets from bitmap
                 // gather from the bitmap into the new A (:,j)
                 int64_t pnew = Ap [j] + Wtask [j] ;
                 int64_t pA_start = j * avlen ;
+                int64_t pA_end = pA_start + iend ;
                 for (int64_t i = istart ; i < iend ; i++)
                 {
                     // see if A(i,j) is present in the bitmap
                     int64_t p = i + pA_start ;
+                    if (GB_SKIP_WORD (p, pA_end))
+                    { 
+                        // none of A (i:i+7,j) are present
+                        i += 7 ;
+                        continue ;
+                    }
                     if (Ab [p])
                     {
                         // A(i,j) is in the bitmap
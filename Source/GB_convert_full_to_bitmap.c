@@ -55,6 +55,7 @@ GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
 
     GB_memset (A->b, 1, anz, nthreads) ;
     A->nvals = anz ;
+    GB_stamp (A) ;
 
     //--------------------------------------------------------------------------
     // return result
@@ -123,6 +123,7 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         A->h = Ah_new ; A->h_size = Ah_new_size ;
         A->p_shallow = false ;
         A->h_shallow = false ;
+        GB_stamp (A) ;
 
         //----------------------------------------------------------------------
         // construct the new hyperlist in the new A->p and A->h
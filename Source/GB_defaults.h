@@ -23,6 +23,9 @@
 // by default, give each thread at least 64K units of work to do
 #define GB_CHUNK_DEFAULT (64*1024)
 
+// hyperlists with at least this many vectors get a hash index
+#define GB_HYPER_HASH_DEFAULT 1024
+
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
@@ -163,15 +163,15 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             // decompress Cp, Ch, and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
                 Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s, Context)) ;
+                sizeof (int64_t), &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->h), &(C->h_size),
                 Ch_len, blob, blob_size, Ch_Sblocks, Ch_nblocks, Ch_method,
-                &s, Context)) ;
+                sizeof (int64_t), &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
                 Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s, Context)) ;
+                sizeof (int64_t), &s, Context)) ;
             break ;
 
         case GxB_SPARSE : 
@@ -179,11 +179,11 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             // decompress Cp and Ci
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->p), &(C->p_size),
                 Cp_len, blob, blob_size, Cp_Sblocks, Cp_nblocks, Cp_method,
-                &s, Context)) ;
+                sizeof (int64_t), &s, Context)) ;
 
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->i), &(C->i_size),
                 Ci_len, blob, blob_size, Ci_Sblocks, Ci_nblocks, Ci_method,
-                &s, Context)) ;
+                sizeof (int64_t), &s, Context)) ;
             break ;
 
         case GxB_BITMAP : 
@@ -191,7 +191,7 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
             // decompress Cb
             GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->b), &(C->b_size),
                 Cb_len, blob, blob_size, Cb_Sblocks, Cb_nblocks, Cb_method,
-                &s, Context)) ;
+                sizeof (int8_t), &s, Context)) ;
             break ;
 
         case GxB_FULL : 
@@ -201,7 +201,8 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
 
     // decompress Cx
     GB_OK (GB_deserialize_from_blob ((GB_void **) &(C->x), &(C->x_size), Cx_len,
-        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, &s, Context)) ;
+        blob, blob_size, Cx_Sblocks, Cx_nblocks, Cx_method, typesize, &s,
+        Context)) ;
     C->magic = GB_MAGIC ;
 
     //--------------------------------------------------------------------------
@@ -15,11 +15,11 @@
 
 #include "GB.h"
 #include "GB_serialize.h"
-#include "GB_lz4.h"
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE (&X, X_size) ;  \
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORK (&W, W_size) ;     \
+    GB_FREE (&X, X_size) ;          \
 }
 
 GrB_Info GB_deserialize_from_blob
@@ -34,6 +34,7 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method,             // compression method used for each block
+    size_t esize,               // size of each entry of X
     // input/output:
     size_t *s_handle,           // location to write into the blob
     GB_Context Context
@@ -56,10 +57,14 @@ GrB_Info GB_deserialize_from_blob
     // parse the method
     //--------------------------------------------------------------------------
 
-    bool intel ;
+    bool intel, delta, shuffle ;
     int32_t algo, level ;
-    GB_serialize_method (&intel, &algo, &level, method) ;
-    // method = (intel ? GxB_COMPRESSION_INTEL : 0) + (algo) + (level) ;
+    GB_serialize_method (&intel, &delta, &shuffle, &algo, &level, method) ;
+    // method = (intel ? GxB_COMPRESSION_INTEL : 0) +
+    //      (delta ? GxB_COMPRESSION_DELTA : 0) +
+    //      (shuffle ? GxB_COMPRESSION_SHUFFLE : 0) + (algo) + (level) ;
+    GB_void *W = NULL ;
+    size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // allocate the output array
@@ -106,14 +111,47 @@ GrB_Info GB_deserialize_from_blob
         }
 
     }
-    else if (algo == GxB_COMPRESSION_LZ4 || algo == GxB_COMPRESSION_LZ4HC)
+    else if (algo == GxB_COMPRESSION_LZ4 || algo == GxB_COMPRESSION_LZ4HC
+          || algo == GxB_COMPRESSION_ZSTD)
     {
 
         //----------------------------------------------------------------------
-        // LZ4 / LZ4HC compression
+        // LZ4 / LZ4HC / ZSTD compression
         //----------------------------------------------------------------------
 
         int nthreads = GB_IMIN (nthreads_max, nblocks) ;
+        shuffle = shuffle && (esize > 1) && !delta ;
+        if (delta && (esize != sizeof (int64_t) ||
+            X_len % sizeof (int64_t) != 0 || nblocks <= 0))
+        {
+            // blob is invalid: only int64_t arrays can be delta-encoded
+            GB_FREE_ALL ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        size_t wsize = 0 ;
+        if (delta)
+        { 
+            // workspace for each thread to hold a delta-encoded block
+            int64_t n = X_len / sizeof (int64_t) ;
+            wsize = GB_DELTA_BOUND (sizeof (int64_t) * GB_ICEIL (n, nblocks)) ;
+        }
+        else if (shuffle)
+        { 
+            // workspace for each thread to hold a shuffled block
+            wsize = ((nblocks == 0) ? 0 : GB_ICEIL (X_len, nblocks)) + 1 ;
+        }
+        if (shuffle || delta)
+        { 
+            // allocate workspace for each thread
+            W = GB_MALLOC_WORK (nthreads * wsize, GB_void, &W_size) ;
+            if (W == NULL)
+            { 
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+
         int32_t blockid ;
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic) \
             reduction(&&:ok)
@@ -121,7 +159,8 @@ GrB_Info GB_deserialize_from_blob
         {
             // get the start and end of the compressed and uncompressed blocks
             int64_t kstart, kend ;
-            GB_PARTITION (kstart, kend, X_len, blockid, nblocks) ;
+            GB_SERIALIZE_PARTITION (kstart, kend, X_len, blockid, nblocks,
+                delta) ;
             int64_t s_start = (blockid == 0) ? 0 : Sblocks [blockid-1] ;
             int64_t s_end   = Sblocks [blockid] ;
             size_t  s_size  = s_end - s_start ;
@@ -143,12 +182,11 @@ GrB_Info GB_deserialize_from_blob
                 // This is safe and secure so far.  The contents of X are
                 // not yet checked, however.  That step is done in
                 // GB_deserialize, if requested.
-                const char *src = (const char *) (blob + s + s_start) ;
-                char *dst = (char *) (X + kstart) ;
-                int src_size = (int) s_size ;
-                int dst_size = (int) d_size ;
-                int u = LZ4_decompress_safe (src, dst, src_size, dst_size) ;
-                if (u != dst_size)
+                GB_void *Wt = (W == NULL) ? NULL :
+                    (W + GB_OPENMP_GET_THREAD_ID * wsize) ;
+                if (!GB_deserialize_block (X + kstart, d_size,
+                    blob + s + s_start, s_size, algo, shuffle ? esize : 0,
+                    delta, Wt))
                 {
                     // blob is invalid
                     ok = false ;
@@ -162,6 +200,7 @@ GrB_Info GB_deserialize_from_blob
         ok = false ;
     }
 
+    GB_FREE_WORK (&W, W_size) ;
     if (!ok)
     {
         // decompression failure; blob is invalid
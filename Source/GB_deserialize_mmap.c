@@ -0,0 +1,264 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_mmap: create a GrB_Matrix from a memory-mapped file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The file was written by GxB_Matrix_serialize_mmap, and has been mapped into
+// memory by GB_mmap.  No data is copied.  Instead, C->p, C->h, C->b, C->i,
+// and C->x become shallow pointers into the mapped file, and C takes
+// ownership of the mapping.  This takes O(1) time.
+
+// The header and the sizes of each array are checked, to ensure the arrays
+// lie inside the mapped file and have the sizes required by the dimensions and
+// the sparsity structure of the matrix.  The contents of the arrays are not
+// checked, however, just as with GB_deserialize.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (&C) ;                   \
+}
+
+GrB_Info GB_deserialize_mmap        // create a matrix from a mapped file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix, with shallow content
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *base,            // the mapped file
+    size_t size,                    // size of the mapped file
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (base != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    const GB_void *blob = base ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    size_t s = 0 ;
+
+    if (size < GB_BLOB_HEADER_SIZE)
+    { 
+        // file is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (blob_size, size_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+
+    if (blob_size != GB_BLOB_MMAP
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code
+        || (typecode == GB_UDT_code &&
+            size < GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN))
+    { 
+        // file is invalid
+        return (GrB_INVALID_OBJECT)  ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    { 
+        // file is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        { 
+            // file is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    { 
+        // built-in type must match type_expected
+        // file is invalid
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the dimensions and the size of each array
+    //--------------------------------------------------------------------------
+
+    bool ok = (vlen >= 0 && vlen <= GB_NMAX && vdim >= 0 && vdim <= GB_NMAX
+        && nvec >= 0 && nvec <= vdim && typesize > 0
+        && Cp_method <= GxB_COMPRESSION_NONE
+        && Ch_method <= GxB_COMPRESSION_NONE
+        && Cb_method <= GxB_COMPRESSION_NONE
+        && Ci_method <= GxB_COMPRESSION_NONE
+        && Cx_method <= GxB_COMPRESSION_NONE
+        && Cp_nblocks == (Cp_len > 0) && Ch_nblocks == (Ch_len > 0)
+        && Cb_nblocks == (Cb_len > 0) && Ci_nblocks == (Ci_len > 0)
+        && Cx_nblocks == (Cx_len > 0)) ;
+
+    // find the start of each array in the file, and ensure each array lies
+    // within the file
+    const GB_void *Cp = NULL, *Ch = NULL, *Cb = NULL, *Ci = NULL, *Cx = NULL ;
+    #define GB_MMAP_ARRAY(X,X_len)                                          \
+        if (ok && X_len > 0)                                                \
+        {                                                                   \
+            s = GB_MMAP_ROUND (s) ;                                         \
+            ok = (s <= size) && ((uint64_t) X_len <= size - s) ;            \
+            X = base + s ;                                                  \
+            s += X_len ;                                                    \
+        }
+    GB_MMAP_ARRAY (Cp, Cp_len) ;
+    GB_MMAP_ARRAY (Ch, Ch_len) ;
+    GB_MMAP_ARRAY (Cb, Cb_len) ;
+    GB_MMAP_ARRAY (Ci, Ci_len) ;
+    GB_MMAP_ARRAY (Cx, Cx_len) ;
+
+    // ensure the arrays have the right size for the sparsity structure,
+    // taking care to avoid integer overflow
+    if (ok)
+    {
+        int64_t anz = 0 ;
+        switch (sparsity)
+        {
+            case GxB_HYPERSPARSE :
+                ok = ((uint64_t) Ch_len == sizeof (int64_t) * (uint64_t) nvec) ;
+                // fall through to check Cp and Ci
+            case GxB_SPARSE :
+                ok = ok && ((uint64_t) Cp_len ==
+                        sizeof (int64_t) * (uint64_t) (nvec+1))
+                        && (sparsity == GxB_HYPERSPARSE || nvec == vdim)
+                        && Cb_len == 0 ;
+                if (ok)
+                {
+                    memcpy (&anz, Cp + nvec * sizeof (int64_t),
+                        sizeof (int64_t)) ;
+                    ok = (anz >= 0 && anz <= Ci_len / 8 && Ci_len == 8 * anz) ;
+                }
+                break ;
+            case GxB_BITMAP :
+            case GxB_FULL :
+                ok = (Cp_len == 0 && Ch_len == 0 && Ci_len == 0 && nvec == vdim
+                    && (vdim == 0 || vlen <= INT64_MAX / vdim)) ;
+                anz = ok ? (vlen * vdim) : 0 ;
+                ok = ok && (sparsity == GxB_FULL ? (Cb_len == 0) :
+                    (Cb_len == anz)) ;
+                break ;
+            default :
+                ok = false ;
+        }
+        int64_t xnz = iso ? 1 : anz ;
+        ok = ok && (xnz <= Cx_len / typesize) && (Cx_len == typesize * xnz) ;
+    }
+
+    if (!ok)
+    { 
+        // file is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the header of the output matrix C
+    //--------------------------------------------------------------------------
+
+    // allocate the matrix with info from the header
+    GB_OK (GB_new (&C, false, ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec, Context)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    // the matrix has no pending work
+    ASSERT (C->Pending == NULL) ;
+    ASSERT (C->nzombies == 0) ;
+    ASSERT (!C->jumbled) ;
+
+    //--------------------------------------------------------------------------
+    // point the content of C into the mapped file
+    //--------------------------------------------------------------------------
+
+    // An array that is present but empty (such as C->i of a sparse matrix with
+    // no entries) points to the start of the file, and is never accessed.
+    #define GB_MMAP_SHALLOW(X,X_size,X_shallow,Xfile,X_len,present)         \
+        if (present)                                                        \
+        {                                                                   \
+            C->X = (void *) ((Xfile == NULL) ? base : Xfile) ;              \
+            C->X_size = (size_t) X_len ;                                    \
+            C->X_shallow = true ;                                           \
+        }
+
+    bool is_hyper  = (sparsity == GxB_HYPERSPARSE) ;
+    bool is_sparse = (sparsity == GxB_SPARSE) || is_hyper ;
+    GB_MMAP_SHALLOW (p, p_size, p_shallow, Cp, Cp_len, is_sparse) ;
+    GB_MMAP_SHALLOW (h, h_size, h_shallow, Ch, Ch_len, is_hyper) ;
+    GB_MMAP_SHALLOW (b, b_size, b_shallow, Cb, Cb_len,
+        sparsity == GxB_BITMAP) ;
+    GB_MMAP_SHALLOW (i, i_size, i_shallow, Ci, Ci_len, is_sparse) ;
+    GB_MMAP_SHALLOW (x, x_size, x_shallow, Cx, Cx_len, true) ;
+
+    // C now owns the mapping
+    C->mmap_base = (void *) base ;
+    C->mmap_size = size ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from mmap", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,469 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_stream: decompress and deserialize a stream into a GrB_Matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A parallel decompression of a stream created by GB_serialize_stream into a
+// GrB_Matrix.  The stream is read with a user-provided read_function, and the
+// blocks of each array are decompressed directly into the arrays of the
+// matrix.  A single thread reads one wave of compressed blocks from the stream
+// while the other threads decompress the prior wave, so at most 2*nthreads
+// compressed blocks are held in workspace at any one time.  Uncompressed
+// arrays are read directly into the matrix, with no workspace at all.
+
+// Only the bytes of the serialized matrix are read from the stream, so the
+// stream may hold other data before and after the serialized matrix.  If the
+// input stream is mangled, this method is still safe, since it performs the
+// same sanity checks as GB_deserialize to ensure no out-of-bounds indexing of
+// arrays.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&T, T_size) ;             \
+    GB_FREE_WORK (&W, W_size) ;             \
+    GB_FREE_WORK (&Wsize, Wsize_size) ;     \
+    GB_Matrix_free (&C) ;                   \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_read_array: read a single array from the stream
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_stream_read_array
+(
+    // output:
+    GB_void **X_handle,         // uncompressed output array
+    size_t *X_size_handle,      // size of X as allocated
+    // input:
+    GxB_stream_read_function read_function,
+    void *stream,
+    int64_t X_len,              // size of X in bytes
+    int32_t nblocks,            // # of compressed blocks for this array
+    int32_t method,             // compression method used for each block
+    size_t esize,               // size of each entry of X
+    GB_void *T,                 // workspace for shuffled or encoded blocks
+    size_t tsize,               // size of each thread's workspace in T
+    GB_void *W,                 // workspace of size 2*nslots*wsize
+    int64_t *Wsize,             // workspace of size 2*nslots
+    size_t wsize,               // size of each slot in W
+    int nslots,                 // # of blocks in a wave
+    int nthreads,
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    (*X_handle) = NULL ;
+    (*X_size_handle) = 0 ;
+
+    bool intel, delta, shuffle ;
+    int32_t algo, level ;
+    GB_serialize_method (&intel, &delta, &shuffle, &algo, &level, method) ;
+    shuffle = shuffle && (esize > 1) && !delta ;
+
+    if (X_len < 0 || (X_len == 0 && nblocks != 0))
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+    else if (X_len == 0)
+    {
+        // the array is empty
+        return (GrB_SUCCESS) ;
+    }
+    else if (algo == GxB_COMPRESSION_NONE)
+    {
+        // an uncompressed array is a single block
+        if (nblocks != 1) return (GrB_INVALID_OBJECT) ;
+    }
+    else if (algo == GxB_COMPRESSION_LZ4 || algo == GxB_COMPRESSION_LZ4HC
+          || algo == GxB_COMPRESSION_ZSTD)
+    {
+        // each compressed block is at most GB_STREAM_BLOCKSIZE bytes
+        if (nblocks != GB_ICEIL (X_len, GB_STREAM_BLOCKSIZE) || W == NULL
+            || ((shuffle || delta) && T == NULL) || (delta &&
+            (esize != sizeof (int64_t) || X_len % sizeof (int64_t) != 0)))
+        {
+            // stream is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+    else
+    {
+        // unknown compression method
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output array
+    //--------------------------------------------------------------------------
+
+    size_t X_size = 0 ;
+    GB_void *X = GB_MALLOC (X_len, GB_void, &X_size) ;  // OK
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    bool ok = true, read_ok = true ;
+
+    if (algo == GxB_COMPRESSION_NONE)
+    {
+
+        //----------------------------------------------------------------------
+        // no compression; read the array directly into X
+        //----------------------------------------------------------------------
+
+        int64_t s_size = 0 ;
+        read_ok = read_function (stream, &s_size, sizeof (int64_t)) ;
+        ok = (s_size == X_len) ;
+        read_ok = read_ok && ok && read_function (stream, X, (size_t) X_len) ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // LZ4 / LZ4HC / ZSTD: read and decompress each wave of blocks
+        //----------------------------------------------------------------------
+
+        int32_t nwaves = GB_ICEIL (nblocks, nslots) ;
+
+        for (int32_t wave = 0 ; wave <= nwaves && ok && read_ok ; wave++)
+        {
+            // blocks in this wave are read into W [set], where set is 0 or 1,
+            // while blocks from the prior wave are decompressed from
+            // W [1-set].
+            int set = wave % 2 ;
+            int32_t first = wave * nslots ;
+            int32_t last  = GB_IMIN (first + nslots, nblocks) ;
+            int32_t prior = GB_IMAX (first - nslots, 0) ;
+            int32_t prior_last = GB_IMIN (first, nblocks) ;
+
+            #pragma omp parallel num_threads(nthreads)
+            {
+
+                //--------------------------------------------------------------
+                // read the current wave from the stream, with a single thread
+                //--------------------------------------------------------------
+
+                #pragma omp single nowait
+                {
+                    for (int32_t blockid = first ;
+                         blockid < last && read_ok ; blockid++)
+                    {
+                        int slot = set * nslots + (blockid - first) ;
+                        int64_t s_size = 0 ;
+                        read_ok = read_function (stream, &s_size,
+                            sizeof (int64_t)) ;
+                        if (read_ok &&
+                            (s_size <= 0 || s_size > (int64_t) wsize))
+                        {
+                            // stream is invalid; guard against an unsafe read
+                            read_ok = false ;
+                        }
+                        read_ok = read_ok &&
+                            read_function (stream, W + slot * wsize,
+                                (size_t) s_size) ;
+                        Wsize [slot] = s_size ;
+                    }
+                }
+
+                //--------------------------------------------------------------
+                // decompress the prior wave into X
+                //--------------------------------------------------------------
+
+                int32_t blockid ;
+                #pragma omp for schedule(dynamic) reduction(&&:ok) nowait
+                for (blockid = prior ; blockid < prior_last ; blockid++)
+                {
+                    // uncompress the block from its slot in W
+                    // into X [kstart:kend-1]
+                    int64_t kstart, kend ;
+                    GB_SERIALIZE_PARTITION (kstart, kend, X_len, blockid,
+                        nblocks, delta) ;
+                    int slot = (1-set) * nslots + (blockid - prior) ;
+                    GB_void *Tt = (shuffle || delta) ?
+                        (T + GB_OPENMP_GET_THREAD_ID * tsize) : NULL ;
+                    // stream is invalid if the block does not decompress
+                    // into exactly kend-kstart bytes
+                    ok = ok && GB_deserialize_block (X + kstart, kend - kstart,
+                        W + slot * wsize, (size_t) Wsize [slot], algo,
+                        shuffle ? esize : 0, delta, Tt) ;
+                }
+            }
+        }
+    }
+
+    if (!ok || !read_ok)
+    {
+        // read or decompression failure; stream is invalid
+        GB_FREE (&X, X_size) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result: X and its size
+    //--------------------------------------------------------------------------
+
+    (*X_handle) = X ;
+    (*X_size_handle) = X_size ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function read_function,     // reads from the stream
+    void *stream,                   // stream to read from
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (read_function != NULL && Chandle != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Matrix C = NULL ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    GB_void *T = NULL ; size_t T_size = 0 ;
+    int64_t *Wsize = NULL ; size_t Wsize_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // read the content of the header (160 bytes)
+    //--------------------------------------------------------------------------
+
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    size_t s = 0 ;
+
+    if (!read_function (stream, blob, GB_BLOB_HEADER_SIZE))
+    {
+        // stream is invalid
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    GB_BLOB_READ (blob_size, size_t) ;
+    GB_BLOB_READ (typecode, int32_t) ;
+
+    if (blob_size != GB_BLOB_STREAM
+        || typecode < GB_BOOL_code || typecode > GB_UDT_code)
+    {
+        // stream is invalid, or it holds a blob instead
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    GB_BLOB_READ (version, int32_t) ;
+    GB_BLOB_READ (vlen, int64_t) ;
+    GB_BLOB_READ (vdim, int64_t) ;
+    GB_BLOB_READ (nvec, int64_t) ;
+    GB_BLOB_READ (nvec_nonempty, int64_t) ;
+    GB_BLOB_READ (nvals, int64_t) ;
+    GB_BLOB_READ (typesize, int64_t) ;
+    GB_BLOB_READ (Cp_len, int64_t) ;
+    GB_BLOB_READ (Ch_len, int64_t) ;
+    GB_BLOB_READ (Cb_len, int64_t) ;
+    GB_BLOB_READ (Ci_len, int64_t) ;
+    GB_BLOB_READ (Cx_len, int64_t) ;
+    GB_BLOB_READ (hyper_switch, float) ;
+    GB_BLOB_READ (bitmap_switch, float) ;
+    GB_BLOB_READ (sparsity_control, int32_t) ;
+    GB_BLOB_READ (sparsity_iso_csc, int32_t) ;
+    GB_BLOB_READ (Cp_nblocks, int32_t) ; GB_BLOB_READ (Cp_method, int32_t) ;
+    GB_BLOB_READ (Ch_nblocks, int32_t) ; GB_BLOB_READ (Ch_method, int32_t) ;
+    GB_BLOB_READ (Cb_nblocks, int32_t) ; GB_BLOB_READ (Cb_method, int32_t) ;
+    GB_BLOB_READ (Ci_nblocks, int32_t) ; GB_BLOB_READ (Ci_method, int32_t) ;
+    GB_BLOB_READ (Cx_nblocks, int32_t) ; GB_BLOB_READ (Cx_method, int32_t) ;
+
+    int32_t sparsity = sparsity_iso_csc / 4 ;
+    bool iso = ((sparsity_iso_csc & 2) == 2) ;
+    bool is_csc = ((sparsity_iso_csc & 1) == 1) ;
+
+    //--------------------------------------------------------------------------
+    // determine the matrix type
+    //--------------------------------------------------------------------------
+
+    GB_Type_code ccode = (GB_Type_code) typecode ;
+    GrB_Type ctype = GB_code_type (ccode, type_expected) ;
+
+    // ensure the type has the right size
+    if (ctype == NULL || ctype->size != typesize)
+    {
+        // stream is invalid; type is missing or the wrong size
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (ccode == GB_UDT_code)
+    {
+        // user-defined name is 128 bytes, if present
+        // ensure the user-defined type has the right name
+        ASSERT (ctype == type_expected) ;
+        if (!read_function (stream, blob + s, GxB_MAX_NAME_LEN))
+        {
+            // stream is invalid
+            return (GrB_INVALID_OBJECT) ;
+        }
+        if (strncmp ((const char *) (blob + s), ctype->name,
+            GxB_MAX_NAME_LEN) != 0)
+        {
+            // stream is invalid
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        s += GxB_MAX_NAME_LEN ;
+    }
+    else if (type_expected != NULL && ctype != type_expected)
+    {
+        // built-in type must match type_expected
+        // stream is invalid
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the output matrix C
+    //--------------------------------------------------------------------------
+
+    // allocate the matrix with info from the header
+    GB_OK (GB_new (&C, false, ctype, vlen, vdim, GB_Ap_null, is_csc,
+        sparsity, hyper_switch, nvec, Context)) ;
+
+    C->nvec = nvec ;
+    C->nvec_nonempty = nvec_nonempty ;
+    C->nvals = nvals ;
+    C->bitmap_switch = bitmap_switch ;
+    C->sparsity_control = sparsity_control ;
+    C->iso = iso ;
+
+    // the matrix has no pending work
+    ASSERT (C->Pending == NULL) ;
+    ASSERT (C->nzombies == 0) ;
+    ASSERT (!C->jumbled) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for two waves of compressed blocks
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nslots = 0, nthreads = 1 ;
+    size_t wsize = 0, tsize = 0 ;
+    if (Cp_method > GxB_COMPRESSION_NONE || Ch_method > GxB_COMPRESSION_NONE ||
+        Cb_method > GxB_COMPRESSION_NONE || Ci_method > GxB_COMPRESSION_NONE ||
+        Cx_method > GxB_COMPRESSION_NONE)
+    {
+        int64_t maxlen = GB_IMAX (Cp_len, Ch_len) ;
+        maxlen = GB_IMAX (maxlen, Cb_len) ;
+        maxlen = GB_IMAX (maxlen, Ci_len) ;
+        maxlen = GB_IMAX (maxlen, Cx_len) ;
+        int64_t maxblocks = GB_ICEIL (maxlen, GB_STREAM_BLOCKSIZE) ;
+        nthreads = GB_nthreads (maxlen, chunk, nthreads_max) ;
+        nslots = (int) GB_IMIN (nthreads, maxblocks) ;
+        nslots = GB_IMAX (nslots, 1) ;
+        // the largest uncompressed or delta-encoded block.  Cx is never
+        // delta-encoded, but the stream may be corrupted.
+        bool delta = GB_SERIALIZE_DELTA (Cp_method) ||
+            GB_SERIALIZE_DELTA (Ch_method) || GB_SERIALIZE_DELTA (Ci_method) ||
+            GB_SERIALIZE_DELTA (Cx_method) ;
+        tsize = delta ? GB_DELTA_BOUND (GB_STREAM_BLOCKSIZE) :
+            GB_STREAM_BLOCKSIZE ;
+        // the largest compressed block for any method
+        wsize = GB_IMAX (GB_serialize_bound (GxB_COMPRESSION_LZ4,  tsize),
+                         GB_serialize_bound (GxB_COMPRESSION_ZSTD, tsize)) ;
+        W = GB_MALLOC_WORK (2 * nslots * wsize, GB_void, &W_size) ;
+        Wsize = GB_MALLOC_WORK (2 * nslots, int64_t, &Wsize_size) ;
+        if (delta || GB_SERIALIZE_SHUFFLE (Cp_method) ||
+            GB_SERIALIZE_SHUFFLE (Ch_method) ||
+            GB_SERIALIZE_SHUFFLE (Ci_method) ||
+            GB_SERIALIZE_SHUFFLE (Cx_method))
+        { 
+            // workspace for each thread to hold a shuffled or encoded block
+            T = GB_MALLOC_WORK (nthreads * tsize, GB_void, &T_size) ;
+            if (T == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+        if (W == NULL || Wsize == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // read and decompress each array (Cp, Ch, Cb, Ci, and Cx)
+    //--------------------------------------------------------------------------
+
+    #define GB_STREAM_READ(X,X_size,X_len,X_esize,X_nblocks,X_method)       \
+        GB_OK (GB_stream_read_array ((GB_void **) &(X), &(X_size),          \
+            read_function, stream, X_len, X_nblocks, X_method, X_esize,     \
+            T, tsize, W, Wsize, wsize, nslots, nthreads, Context)) ;
+
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            // read Cp, Ch, and Ci
+            GB_STREAM_READ (C->p, C->p_size, Cp_len, sizeof (int64_t),
+                Cp_nblocks, Cp_method) ;
+            GB_STREAM_READ (C->h, C->h_size, Ch_len, sizeof (int64_t),
+                Ch_nblocks, Ch_method) ;
+            GB_STREAM_READ (C->i, C->i_size, Ci_len, sizeof (int64_t),
+                Ci_nblocks, Ci_method) ;
+            break ;
+
+        case GxB_SPARSE :
+            // read Cp and Ci
+            GB_STREAM_READ (C->p, C->p_size, Cp_len, sizeof (int64_t),
+                Cp_nblocks, Cp_method) ;
+            GB_STREAM_READ (C->i, C->i_size, Ci_len, sizeof (int64_t),
+                Ci_nblocks, Ci_method) ;
+            break ;
+
+        case GxB_BITMAP :
+            // read Cb
+            GB_STREAM_READ (C->b, C->b_size, Cb_len, sizeof (int8_t),
+                Cb_nblocks, Cb_method) ;
+            break ;
+
+        case GxB_FULL :
+            break ;
+        default: ;
+    }
+
+    // read Cx
+    GB_STREAM_READ (C->x, C->x_size, Cx_len, typesize,
+        Cx_nblocks, Cx_method) ;
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK (&T, T_size) ;
+    GB_FREE_WORK (&W, W_size) ;
+    GB_FREE_WORK (&Wsize, Wsize_size) ;
+    (*Chandle) = C ;
+    ASSERT_MATRIX_OK (*Chandle, "Final result from deserialize stream", GB0) ;
+    return (GrB_SUCCESS) ;
+}
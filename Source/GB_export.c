@@ -109,6 +109,13 @@ GrB_Info GB_export      // export/unpack a matrix in any format
         default: ;
     }
 
+    if ((*A)->mmap_base != NULL)
+    { 
+        // the content of a memory-mapped matrix is owned by the mapped file
+        GB_ERROR (GrB_INVALID_VALUE, "%s", "A memory-mapped matrix cannot be "
+            "exported or unpacked; use GrB_Matrix_dup to copy it first") ;
+    }
+
     //--------------------------------------------------------------------------
     // allocate new space for Ap and Ah if unpacking
     //--------------------------------------------------------------------------
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// GB_extractElements: extract a list of entries, X [k] = A (I [k], J [k])
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extract the values of n entries, X [k] = A (I [k], J [k]) for k = 0:n-1,
+// typecasting from the type of A to the type of X, as needed.  If A is a
+// GrB_Vector, J is NULL, and X [k] = A (I [k]).  The result is the same as n
+// calls to GrB_*_extractElement, but the entries are found in parallel.
+
+// If A (I [k], J [k]) is present, X [k] is set to its value and Found [k] is
+// set true.  Otherwise, X [k] is not modified, and Found [k] is set false.
+// Found is optional; if NULL, it is not modified.  Returns GrB_SUCCESS if all
+// entries are present, or GrB_NO_VALUE if any are not.
+
+// If A is sparse or hypersparse, the tuples are first sorted by vector (unless
+// already sorted), and each task then finds its vectors and indices with
+// monotonic searches: the search for each vector in the hyperlist, and for
+// each index in the vector, starts where the search for the prior tuple
+// ended.  If A is hypersparse with many vectors, each vector is instead found
+// in O(1) time with the hash index of A->h (see GB_hyper_hash_build).  If A is bitmap or full, each entry is found in O(1) time, and the
+// tuples are not sorted.
+
+#include "GB.h"
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORK (&Wi, Wi_size) ;               \
+    GB_FREE_WORK (&Wj, Wj_size) ;               \
+    GB_FREE_WORK (&Wk, Wk_size) ;               \
+}
+
+GrB_Info GB_extractElements     // X [k] = A (I [k], J [k]) for k = 0:n-1
+(
+    void *X,                    // output values, of size n
+    const GB_Type_code xcode,   // type of X
+    bool *Found,                // optional: Found [k] true if entry present
+    GrB_Matrix A,               // matrix to extract entries from
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const int64_t n,            // # of entries to extract
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Wi = NULL ; size_t Wi_size = 0 ;
+    int64_t *restrict Wj = NULL ; size_t Wj_size = 0 ;
+    int64_t *restrict Wk = NULL ; size_t Wk_size = 0 ;
+
+    ASSERT (A != NULL) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+    GB_RETURN_IF_NULL (X) ;
+    GB_RETURN_IF_NULL (I) ;
+    if (n == 0)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+    ASSERT (GB_IMPLIES (J == NULL, A->vdim <= 1)) ;
+
+    // xcode and A must be compatible
+    GB_Type_code acode = A->type->code ;
+    if (!GB_code_compatible (xcode, acode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Entries of type [%s] cannot be typecast to output of type [%s]",
+            A->type->name, GB_code_string (xcode)) ;
+    }
+
+    // delete any lingering zombies, assemble any pending tuples, and unjumble
+    if (GB_ANY_PENDING_WORK (A))
+    {
+        GB_OK (GB_wait (A, "A (extractElements)", Context)) ;
+    }
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // check and sort the indices
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const int8_t  *restrict Ab = A->b ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+    const bool A_iso = A->iso ;
+    const bool A_is_sparse_or_hyper = (Ap != NULL) ;
+    const int64_t anz = GB_nnz (A) ;
+
+    // the vectors of a hypersparse A are found with the hash index of A->h
+    GB_hyper_hash_build (A, Context) ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
+
+    GB_OK (GB_Elements_sort (&Wi, &Wi_size, &Wj, &Wj_size, &Wk, &Wk_size,
+        I, J, n, A, A_is_sparse_or_hyper && anz > 0, Context)) ;
+
+    const GrB_Index *Vi = (A->is_csc || J == NULL) ? I : J ;
+    const GrB_Index *Vj = (J == NULL) ? NULL : ((A->is_csc) ? J : I) ;
+
+    //--------------------------------------------------------------------------
+    // get the typecasting function
+    //--------------------------------------------------------------------------
+
+    const size_t asize = A->type->size ;
+    const size_t xsize = GB_code_size (xcode, asize) ;
+    GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+    GB_void *restrict Xout = (GB_void *) X ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (4 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, n) ;
+
+    //--------------------------------------------------------------------------
+    // find each entry
+    //--------------------------------------------------------------------------
+
+    int64_t nmissing = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nmissing)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend ;
+        GB_PARTITION (tstart, tend, n, tid, ntasks) ;
+        int64_t jlast = -1, pA_start = 0, pA_end = 0, pleft_h = 0, pstart = 0 ;
+        bool jfound = false ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+
+            //------------------------------------------------------------------
+            // get the tth tuple, which refers to A(i,j)
+            //------------------------------------------------------------------
+
+            int64_t k = (Wk == NULL) ? t : Wk [t] ;
+            int64_t i = (Wi == NULL) ? Vi [t] : Wi [t] ;
+            int64_t j = (Wj == NULL) ? ((Vj == NULL) ? 0 : Vj [t]) : Wj [t] ;
+
+            //------------------------------------------------------------------
+            // find A(i,j)
+            //------------------------------------------------------------------
+
+            bool found ;
+            int64_t p ;
+            if (anz == 0)
+            {
+                // A has no entries
+                found = false ;
+                p = 0 ;
+            }
+            else if (A_is_sparse_or_hyper)
+            {
+                if (j != jlast)
+                {
+                    // find vector j, with the hash index of A->h if present;
+                    // otherwise the tuples are sorted, so the search in the
+                    // hyperlist starts where the last one ended
+                    jfound = GB_hyper_hash_lookup (Ah != NULL, Ah, Ap, avlen,
+                        A_hyper_hash, &pleft_h, anvec - 1, j,
+                        &pA_start, &pA_end) ;
+                    jlast = j ;
+                    pstart = pA_start ;
+                }
+                found = false ;
+                p = pstart ;
+                if (jfound)
+                {
+                    // find index i in vector j, starting where the search for
+                    // the last index in this vector ended
+                    int64_t pright = pA_end - 1 ;
+                    GB_BINARY_SEARCH (i, Ai, p, pright, found) ;
+                    pstart = p ;
+                }
+            }
+            else
+            {
+                // A is bitmap or full
+                p = i + j * avlen ;
+                found = (Ab == NULL) ? true : (Ab [p] == 1) ;
+            }
+
+            //------------------------------------------------------------------
+            // extract the entry
+            //------------------------------------------------------------------
+
+            if (found)
+            {
+                // X [k] = (xtype) A(i,j)
+                cast_A_to_X (Xout + k * xsize, Ax + (A_iso ? 0 : p * asize),
+                    asize) ;
+            }
+            else
+            {
+                nmissing++ ;
+            }
+            if (Found != NULL)
+            {
+                Found [k] = found ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    #pragma omp flush
+    return ((nmissing == 0) ? GrB_SUCCESS : GrB_NO_VALUE) ;
+}
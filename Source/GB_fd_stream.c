@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_fd_stream: read and write a stream held in a file descriptor
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_fd_write and GB_fd_read are the GxB_stream_write_function and
+// GxB_stream_read_function used by GxB_Matrix_serialize_fd,
+// GxB_Matrix_deserialize_fd, and GxB_Matrix_serialize_mmap.  The stream is a
+// pointer to an int, the file descriptor for a file, pipe, or socket.  The
+// POSIX read and write are retried on a partial transfer, or if interrupted by
+// a signal.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#if defined ( _WIN32 )
+#include <io.h>
+#define GB_READ  _read
+#define GB_WRITE _write
+#else
+#include <unistd.h>
+#define GB_READ  read
+#define GB_WRITE write
+#endif
+
+//------------------------------------------------------------------------------
+// GB_fd_write: write a buffer to a file descriptor
+//------------------------------------------------------------------------------
+
+bool GB_fd_write (void *stream, const void *buffer, size_t size)
+{
+    int fd = *((int *) stream) ;
+    const GB_void *p = (const GB_void *) buffer ;
+    while (size > 0)
+    {
+        // write at most 1GB at a time, and retry on a partial write
+        size_t n = GB_IMIN (size, 1024*1024*1024) ;
+        int64_t result = (int64_t) GB_WRITE (fd, p, n) ;
+        if (result < 0 && errno == EINTR)
+        { 
+            // interrupted by a signal; try again
+            continue ;
+        }
+        if (result <= 0)
+        { 
+            // the write failed
+            return (false) ;
+        }
+        p += result ;
+        size -= result ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_fd_read: read a buffer from a file descriptor
+//------------------------------------------------------------------------------
+
+bool GB_fd_read (void *stream, void *buffer, size_t size)
+{
+    int fd = *((int *) stream) ;
+    GB_void *p = (GB_void *) buffer ;
+    while (size > 0)
+    {
+        // read at most 1GB at a time, and retry on a partial read
+        size_t n = GB_IMIN (size, 1024*1024*1024) ;
+        int64_t result = (int64_t) GB_READ (fd, p, n) ;
+        if (result < 0 && errno == EINTR)
+        { 
+            // interrupted by a signal; try again
+            continue ;
+        }
+        if (result <= 0)
+        { 
+            // the read failed, or the end of the file was reached
+            return (false) ;
+        }
+        p += result ;
+        size -= result ;
+    }
+    return (true) ;
+}
@@ -12,6 +12,12 @@
 void GB_free_pool_finalize (void)
 {
 
+    //--------------------------------------------------------------------------
+    // return the blocks in all per-thread magazines to the shared free_pool
+    //--------------------------------------------------------------------------
+
+    GB_Global_free_pool_flush ( ) ;
+
     //--------------------------------------------------------------------------
     // free all memory pools
     //--------------------------------------------------------------------------
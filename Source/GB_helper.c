@@ -28,6 +28,7 @@
 //------------------------------------------------------------------------------
 
 #define GB_ALLOCATE_WORK(work_type)                                         \
+    GB_Context Context = NULL ; /* no arena for these functions */          \
     size_t Work_size ;                                                      \
     work_type *Work = GB_MALLOC_WORK (nthreads, work_type, &Work_size) ;    \
     if (Work == NULL) return (false) ;
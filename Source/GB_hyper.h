@@ -49,5 +49,111 @@ GrB_Info GB_hypermatrix_prune
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// hash index of the hyperlist
+//------------------------------------------------------------------------------
+
+void GB_hyper_hash_build        // build the hash index of A->h, if needed
+(
+    GrB_Matrix A,               // matrix to index
+    GB_Context Context
+) ;
+
+void GB_hyper_hash_free         // free the hash index of A->h, if present
+(
+    GrB_Matrix A                // matrix with hash index to free
+) ;
+
+// Fibonacci hashing: multiply j by 2^64 / golden ratio, and keep the top bits
+#define GB_HYPER_HASH(j,shift) \
+    ((uint64_t) (((uint64_t) (j)) * 0x9E3779B97F4A7C15ULL) >> (shift))
+
+// GB_hyper_hash_get: return the hash index of A->h, or NULL if not present
+static inline GB_Hyper_hash GB_hyper_hash_get
+(
+    const GrB_Matrix A
+)
+{
+    GB_Hyper_hash Y = (A == NULL) ? NULL : A->hyper_hash ;
+    if (Y == NULL || Y->h != A->h || Y->nvec != A->nvec)
+    { 
+        // the hash index is not present, or does not match A->h
+        return (NULL) ;
+    }
+    return (Y) ;
+}
+
+// GB_hyper_hash_find: find k so that j == Ah [k], or return -1 if not found
+static inline int64_t GB_hyper_hash_find
+(
+    const GB_Hyper_hash Y,          // hash index of Ah
+    const int64_t j                 // vector to find
+)
+{
+    const int64_t *restrict Slot = Y->Slot ;
+    uint64_t b = GB_HYPER_HASH (j, Y->hash_shift) ;
+    while (true)
+    {
+        // the (j,k) pair for bucket b is in Slot [2*b] and Slot [2*b+1]
+        int64_t jb = Slot [2*b] ;
+        if (jb == j)
+        { 
+            // found j = Ah [k]
+            return (Slot [2*b+1]) ;
+        }
+        else if (jb < 0)
+        { 
+            // empty slot: j is not in the hyperlist
+            return (-1) ;
+        }
+        // linear probing
+        b = (b + 1) & Y->hash_bits ;
+    }
+}
+
+// GB_hyper_hash_lookup: find j = Ah [k], with the hash index Y if present.
+// This is the same as GB_lookup, except that if Y is not NULL, the vector is
+// found in O(1) time.  If found, pleft is set to k, so a subsequent binary
+// search in Ah can still start at pleft.  If not found, pleft is unchanged.
+static inline bool GB_hyper_hash_lookup
+(
+    const bool A_is_hyper,          // true if A is hypersparse
+    const int64_t *restrict Ah,     // A->h [0..A->nvec-1]: list of vectors
+    const int64_t *restrict Ap,     // A->p [0..A->nvec  ]: pointers to vectors
+    const int64_t avlen,            // A->vlen
+    const GB_Hyper_hash Y,          // hash index of Ah, or NULL
+    int64_t *restrict pleft,        // look only in A->h [pleft..pright]
+    int64_t pright,                 // normally A->nvec-1, but can be trimmed
+    const int64_t j,                // vector to find, as j = Ah [k]
+    int64_t *restrict pstart,       // start of vector: Ap [k]
+    int64_t *restrict pend          // end of vector: Ap [k+1]
+)
+{
+    if (Y == NULL)
+    { 
+        // binary search of Ah
+        return (GB_lookup (A_is_hyper, Ah, Ap, avlen, pleft, pright, j,
+            pstart, pend)) ;
+    }
+    ASSERT (A_is_hyper) ;
+    int64_t k = GB_hyper_hash_find (Y, j) ;
+    if (k >= 0)
+    { 
+        // j appears in the hyperlist at Ah [k]
+        ASSERT (Ah [k] == j) ;
+        (*pleft)  = k ;
+        (*pstart) = Ap [k] ;
+        (*pend)   = Ap [k+1] ;
+        return (true) ;
+    }
+    else
+    { 
+        // j does not appear in the hyperlist Ah
+        (*pstart) = -1 ;
+        (*pend)   = -1 ;
+        return (false) ;
+    }
+}
+
 #endif
 
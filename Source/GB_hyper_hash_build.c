@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// GB_hyper_hash_build: build the hash index of the hyperlist of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A is hypersparse with at least GB_Global_hyper_hash_get ( ) vectors (see
+// GxB_HYPER_HASH), a hash index of A->h is built, so that GB_hyper_hash_lookup
+// can find any vector j = A->h [k] in O(1) time rather than with a binary
+// search.  Nothing is done if A is not hypersparse, if A->h is too short, or if
+// the hash index is already present.  The hash index is optional: if out of
+// memory, it is not built, and the callers use a binary search instead.
+
+// The table has hash_size buckets, the smallest power of 2 that is at least
+// 4/3 the number of vectors, so at most 3/4 of the buckets are occupied.  Each
+// bucket holds a (j,k) pair, in adjacent int64_t's, so that a lookup usually
+// touches a single cache line.  The table is filled in parallel: each thread
+// claims an empty bucket with an atomic compare/exchange, and uses linear
+// probing if it is already claimed.  The final table does not depend on the
+// order in which the buckets are claimed.
+
+// A is not modified except for A->hyper_hash.  Two user threads may both use
+// A as a read-only input at the same time, and both may try to build the hash
+// index.  The index is thus attached to A with an atomic compare/exchange, and
+// the loser frees its copy.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+void GB_hyper_hash_build        // build the hash index of A->h, if needed
+(
+    GrB_Matrix A,               // matrix to index
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->h == NULL || A->nvec <= 0 ||
+        A->nvec < GB_Global_hyper_hash_get ( ))
+    { 
+        // no need for a hash index
+        return ;
+    }
+
+    if (GB_hyper_hash_get (A) != NULL)
+    { 
+        // the hash index is already present
+        return ;
+    }
+
+    // free any prior hash index that no longer matches A->h
+    GB_hyper_hash_free (A) ;
+
+    const int64_t *restrict Ah = A->h ;
+    const int64_t anvec = A->nvec ;
+
+    //--------------------------------------------------------------------------
+    // determine the size of the table
+    //--------------------------------------------------------------------------
+
+    int hash_log2 = 1 ;
+    while ((((int64_t) 1) << hash_log2) < (anvec + anvec/3 + 1))
+    { 
+        hash_log2++ ;
+    }
+    int64_t hash_size = ((int64_t) 1) << hash_log2 ;
+
+    //--------------------------------------------------------------------------
+    // allocate the hash index
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GB_Hyper_hash Y = GB_MALLOC (1, struct GB_Hyper_hash_struct, &header_size) ;
+    if (Y == NULL)
+    { 
+        // out of memory; do not build the hash index
+        return ;
+    }
+    Y->header_size = header_size ;
+    Y->Slot_size = 0 ;
+    Y->Slot = GB_MALLOC (2 * hash_size, int64_t, &(Y->Slot_size)) ;
+    if (Y->Slot == NULL)
+    { 
+        // out of memory; do not build the hash index
+        GB_FREE (&Y, header_size) ;
+        return ;
+    }
+    Y->hash_bits = (uint64_t) (hash_size - 1) ;
+    Y->hash_shift = 64 - hash_log2 ;
+    Y->h = Ah ;
+    Y->nvec = anvec ;
+
+    GB_BURBLE_N (anvec, "(hyper_hash " GBd ") ", anvec) ;
+
+    //--------------------------------------------------------------------------
+    // clear the table
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (2 * hash_size, chunk, nthreads_max) ;
+    int64_t *restrict Slot = Y->Slot ;
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (b = 0 ; b < hash_size ; b++)
+    { 
+        Slot [2*b] = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert each vector j = Ah [k] into the table
+    //--------------------------------------------------------------------------
+
+    const int hash_shift = Y->hash_shift ;
+    const uint64_t hash_bits = Y->hash_bits ;
+    nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        int64_t j = Ah [k] ;
+        uint64_t bk = GB_HYPER_HASH (j, hash_shift) ;
+        while (true)
+        {
+            // try to claim the empty bucket bk for j
+            int64_t empty = -1 ;
+            if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(Slot [2*bk]), empty, j))
+            { 
+                // bucket bk has been claimed for j = Ah [k]
+                Slot [2*bk+1] = k ;
+                break ;
+            }
+            int64_t jb ;
+            GB_ATOMIC_READ
+            jb = Slot [2*bk] ;
+            if (jb >= 0)
+            { 
+                // bucket bk is already claimed; try the next one
+                bk = (bk + 1) & hash_bits ;
+            }
+            // otherwise the compare/exchange failed spuriously; try again
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // attach the hash index to A, unless another thread has already done so
+    //--------------------------------------------------------------------------
+
+    int64_t expected = 0 ;
+    int64_t desired = (int64_t) Y ;
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_64 ((int64_t *) (&(A->hyper_hash)),
+        expected, desired))
+    {
+        GB_Hyper_hash Y_current ;
+        GB_ATOMIC_READ
+        Y_current = A->hyper_hash ;
+        if (Y_current != NULL)
+        { 
+            // another thread has attached its own hash index to A
+            GB_FREE (&(Y->Slot), Y->Slot_size) ;
+            GB_FREE (&Y, header_size) ;
+            break ;
+        }
+        expected = 0 ;
+    }
+}
+
@@ -0,0 +1,28 @@
+//------------------------------------------------------------------------------
+// GB_hyper_hash_free: free the hash index of the hyperlist of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This must be called whenever A->h is freed, replaced, or modified.
+
+#include "GB.h"
+
+void GB_hyper_hash_free         // free the hash index of A->h, if present
+(
+    GrB_Matrix A                // matrix with hash index to free
+)
+{
+
+    if (A != NULL && A->hyper_hash != NULL)
+    { 
+        GB_Hyper_hash Y = A->hyper_hash ;
+        GB_FREE (&(Y->Slot), Y->Slot_size) ;
+        GB_FREE (&Y, Y->header_size) ;
+        A->hyper_hash = NULL ;
+    }
+}
+
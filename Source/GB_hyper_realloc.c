@@ -41,7 +41,8 @@ GrB_Info GB_hyper_realloc
         // old size of A->p and A->h
         int64_t plen_old = A->plen ;
 
-        // change the size of A->h and A->p
+        // change the size of A->h and A->p; this may move A->h
+        GB_hyper_hash_free (A) ;
         bool ok1 = true, ok2 = true ;
         GB_REALLOC (A->p, plen_new+1, int64_t, &(A->p_size), &ok1, Context) ;
         GB_REALLOC (A->h, plen_new,   int64_t, &(A->h_size), &ok2, Context) ;
@@ -40,6 +40,27 @@ GrB_Matrix GB_hyper_shallow         // return C
     // flag the header of C as static
     C->static_header = true ;
 
+    // the mapped file, if any, remains owned by A
+    C->mmap_base = NULL ;
+    C->mmap_size = 0 ;
+
+    // the per-thread pending tuples, if any, remain owned by A
+    C->Ingest = NULL ;
+
+    // C has no hyperlist, so it has no hash index of its hyperlist
+    C->hyper_hash = NULL ;
+
+    // the cached transpose of A, if any, remains owned by A
+    C->AT = NULL ;
+    C->AT_stamp = 0 ;
+    C->push_pull = false ;
+
+    // the cached saxpy3 tasks of A, if any, remain owned by A
+    C->saxpy3_cache = NULL ;
+
+    // C has a different data structure than A, so it has its own stamp
+    C->stamp = GB_Global_stamp_next ( ) ;
+
     // remove the hyperlist
     C->h = NULL ;
     C->h_shallow = false ;
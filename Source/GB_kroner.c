@@ -12,23 +12,23 @@
 // different.  The type of C is the type of z.  C is hypersparse if either A
 // or B are hypersparse.
 
-// FUTURE: this would be faster with built-in types and operators.
-
-// FUTURE: at most one thread is used for each vector of C=kron(A,B).  The
-// matrix C is normally very large, but if both A and B are n-by-1, then C is
-// n^2-by-1 and only a single thread is used.  A better method for this case
-// would construct vectors of C in parallel.
-
-// FUTURE: each vector C(:,k) takes O(nnz(C(:,k))) work, but this is not
-// accounted for in the parallel load-balancing.
+// The pattern of C is computed first, and then the entries of C are sliced
+// with GB_ek_slice, so that the work is balanced across the threads even if
+// C has very few vectors (if A and B are both n-by-1, for example, C is
+// n^2-by-1).  Each task computes a contiguous part of C, which may start and
+// end in the middle of a vector of C.  Built-in operators (TIMES, PLUS, FIRST,
+// and SECOND on the 32 and 64-bit integer and floating-point types) with no
+// typecasting use a typed kernel; all other cases use the generic method.
 
 #include "GB_kron.h"
 #include "GB_emult.h"
+#include "GB_ek_slice.h"
 
-#define GB_FREE_WORKSPACE   \
-{                           \
-    GB_phbix_free (A2) ;    \
-    GB_phbix_free (B2) ;    \
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_phbix_free (A2) ;                    \
+    GB_phbix_free (B2) ;                    \
+    GB_WERK_POP (C_ek_slicing, int64_t) ;   \
 }
 
 #define GB_FREE_ALL         \
@@ -57,6 +57,7 @@ GrB_Info GB_kroner                  // C = kron (A,B)
     GrB_Info info ;
     ASSERT (C != NULL && C->static_header) ;
 
+    GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
     struct GB_Matrix_opaque A2_header, B2_header ;
     GrB_Matrix A2 = GB_clear_static_header (&A2_header) ;
     GrB_Matrix B2 = GB_clear_static_header (&B2_header) ;
@@ -264,135 +265,152 @@ GrB_Info GB_kroner                  // C = kron (A,B)
         }
     }
 
+    //--------------------------------------------------------------------------
+    // slice the entries of C
+    //--------------------------------------------------------------------------
+
+    int C_nthreads, C_ntasks ;
+    GB_SLICE_MATRIX (C, 8, chunk) ;
+
     //--------------------------------------------------------------------------
     // C = kron (A,B)
     //--------------------------------------------------------------------------
 
     const bool A_iso = A->iso ;
     const bool B_iso = B->iso ;
+    bool done = false ;
 
-    #pragma omp parallel for num_threads(nthreads) schedule(guided)
-    for (kC = 0 ; kC < cnvec ; kC++)
-    {
-        int64_t kA = kC / bnvec ;
-        int64_t kB = kC % bnvec ;
-
-        // get B(:,jB), the (kB)th vector of B
-        int64_t jB = GBH (Bh, kB) ;
-        int64_t pB_start = GBP (Bp, kB, bvlen) ;
-        int64_t pB_end   = GBP (Bp, kB+1, bvlen) ;
-        int64_t bknz = pB_start - pB_end ;
-        if (bknz == 0) continue ;
-        GB_void bwork [GB_VLA(bsize)] ;
-        if (!B_is_pattern && B_iso)
-        { 
-            cast_B (bwork, Bx, bsize) ;
-        }
+    if (C_iso)
+    { 
 
-        // get C(:,jC), the (kC)th vector of C
-        // int64_t kC = kA * bnvec + kB ;
-        int64_t pC = GBP (Cp, kC, cvlen) ;
+        //----------------------------------------------------------------------
+        // C is iso: only the pattern of C is computed
+        //----------------------------------------------------------------------
 
-        // get A(:,jA), the (kA)th vector of A
-        int64_t jA = GBH (Ah, kA) ;
-        int64_t pA_start = GBP (Ap, kA, avlen) ;
-        int64_t pA_end   = GBP (Ap, kA+1, avlen) ;
-        GB_void awork [GB_VLA(asize)] ;
-        if (!A_is_pattern && A_iso)
-        { 
-            cast_A (awork, Ax, asize) ;
+        #define GB_KRON_OP(pC,pA,pB,iA,iB,kA,kB) ;
+        #include "GB_kroner_template.c"
+        #undef  GB_KRON_OP
+        done = true ;
+
+    }
+    else if (op_is_positional)
+    { 
+
+        //----------------------------------------------------------------------
+        // C = kron (A,B) with a positional operator
+        //----------------------------------------------------------------------
+
+        #define GB_KRON_OP(pC,pA,pB,iA,iB,kA,kB)                            \
+        {                                                                   \
+            int64_t z = 0 ;                                                 \
+            switch (opcode)                                                 \
+            {                                                               \
+                case GB_FIRSTI_binop_code   : /* z = iA   */                \
+                case GB_FIRSTI1_binop_code  : /* z = iA+1 */                \
+                    z = iA ;                                                \
+                    break ;                                                 \
+                case GB_FIRSTJ_binop_code   : /* z = jA   */                \
+                case GB_FIRSTJ1_binop_code  : /* z = jA+1 */                \
+                    z = GBH (Ah, kA) ;                                      \
+                    break ;                                                 \
+                case GB_SECONDI_binop_code  : /* z = iB   */                \
+                case GB_SECONDI1_binop_code : /* z = iB+1 */                \
+                    z = iB ;                                                \
+                    break ;                                                 \
+                case GB_SECONDJ_binop_code  : /* z = jB   */                \
+                case GB_SECONDJ1_binop_code : /* z = jB+1 */                \
+                    z = GBH (Bh, kB) ;                                      \
+                    break ;                                                 \
+                default: ;                                                  \
+            }                                                               \
+            if (is64)                                                       \
+            {                                                               \
+                Cx_int64 [pC] = z + offset ;                                \
+            }                                                               \
+            else                                                            \
+            {                                                               \
+                Cx_int32 [pC] = (int32_t) (z + offset) ;                    \
+            }                                                               \
         }
+        #include "GB_kroner_template.c"
+        #undef  GB_KRON_OP
+        done = true ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C = kron (A,B) with a built-in operator and no typecasting
+        //----------------------------------------------------------------------
 
-        for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+        #ifndef GBCOMPACT
+        GB_Type_code ccode = ctype->code ;
+        if ((A_is_pattern || A->type == ctype) &&
+            (B_is_pattern || B->type == ctype) &&
+            op->xtype == ctype && op->ytype == ctype)
         {
-            // awork = A(iA,jA), typecasted to op->xtype
-            int64_t iA = GBI (Ai, pA, avlen) ;
-            int64_t iAblock = iA * bvlen ;
-            if (!A_is_pattern && !A_iso)
-            { 
-                cast_A (awork, Ax + (pA*asize), asize) ;
+            #define GB_KRON_OP(pC,pA,pB,iA,iB,kA,kB)                        \
+            {                                                               \
+                GB_KRON_MULT (((GB_CTYPE *) Cx) [pC],                       \
+                    ((const GB_CTYPE *) Ax) [A_iso ? 0 : (pA)],             \
+                    ((const GB_CTYPE *) Bx) [B_iso ? 0 : (pB)]) ;           \
             }
-            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+            switch (opcode)
             {
-                // bwork = B(iB,jB), typecasted to op->ytype
-                int64_t iB = GBI (Bi, pB, bvlen) ;
-                if (!B_is_pattern && !B_iso)
-                { 
-                    cast_B (bwork, Bx +(pB*bsize), bsize) ;
-                }
-                // C(iC,jC) = A(iA,jA) * B(iB,jB)
-                if (!C_is_full)
-                { 
-                    int64_t iC = iAblock + iB ;
-                    Ci [pC] = iC ;
-                }
-                if (op_is_positional)
-                {
-                    // positional binary operator
-                    switch (opcode)
-                    {
-                        case GB_FIRSTI_binop_code   : 
-                            // z = first_i(A(iA,jA),y) == iA
-                        case GB_FIRSTI1_binop_code  : 
-                            // z = first_i1(A(iA,jA),y) == iA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iA + offset) ;
-                            }
-                            break ;
-                        case GB_FIRSTJ_binop_code   : 
-                            // z = first_j(A(iA,jA),y) == jA
-                        case GB_FIRSTJ1_binop_code  : 
-                            // z = first_j1(A(iA,jA),y) == jA+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jA + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jA + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDI_binop_code  : 
-                            // z = second_i(x,B(iB,jB)) == iB
-                        case GB_SECONDI1_binop_code : 
-                            // z = second_i1(x,B(iB,jB)) == iB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = iB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (iB + offset) ;
-                            }
-                            break ;
-                        case GB_SECONDJ_binop_code  : 
-                            // z = second_j(x,B(iB,jB)) == jB
-                        case GB_SECONDJ1_binop_code : 
-                            // z = second_j1(x,B(iB,jB)) == jB+1
-                            if (is64)
-                            { 
-                                Cx_int64 [pC] = jB + offset ;
-                            }
-                            else
-                            { 
-                                Cx_int32 [pC] = (int32_t) (jB + offset) ;
-                            }
-                            break ;
-                        default: ;
-                    }
-                }
-                else if (!C_iso)
-                { 
-                    // standard binary operator
-                    fmult (Cx +(pC*csize), awork, bwork) ;
-                }
-                pC++ ;
+                case GB_TIMES_binop_code  :     // z = x * y
+                    #define GB_KRON_MULT(z,x,y) z = (x) * (y)
+                    #include "GB_kroner_type_factory.c"
+                    #undef  GB_KRON_MULT
+                    break ;
+                case GB_PLUS_binop_code   :     // z = x + y
+                    #define GB_KRON_MULT(z,x,y) z = (x) + (y)
+                    #include "GB_kroner_type_factory.c"
+                    #undef  GB_KRON_MULT
+                    break ;
+                case GB_FIRST_binop_code  :     // z = x
+                    #define GB_KRON_MULT(z,x,y) z = (x)
+                    #include "GB_kroner_type_factory.c"
+                    #undef  GB_KRON_MULT
+                    break ;
+                case GB_SECOND_binop_code :     // z = y
+                    #define GB_KRON_MULT(z,x,y) z = (y)
+                    #include "GB_kroner_type_factory.c"
+                    #undef  GB_KRON_MULT
+                    break ;
+                default: ;
+            }
+            #undef  GB_KRON_OP
+        }
+        #endif
+
+        //----------------------------------------------------------------------
+        // C = kron (A,B) with typecasting or user-defined types and operators
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            GBURBLE ("(generic kron) ") ;
+            const size_t xsize = A_is_pattern ? 1 : op->xtype->size ;
+            const size_t ysize = B_is_pattern ? 1 : op->ytype->size ;
+            #define GB_KRON_OP(pC,pA,pB,iA,iB,kA,kB)                        \
+            {                                                               \
+                /* awork = A(iA,jA) and bwork = B(iB,jB), typecasted */     \
+                GB_void awork [GB_VLA(xsize)] ;                             \
+                GB_void bwork [GB_VLA(ysize)] ;                             \
+                if (!A_is_pattern)                                          \
+                {                                                           \
+                    cast_A (awork, Ax + (A_iso ? 0 : (pA)*asize), asize) ;  \
+                }                                                           \
+                if (!B_is_pattern)                                          \
+                {                                                           \
+                    cast_B (bwork, Bx + (B_iso ? 0 : (pB)*bsize), bsize) ;  \
+                }                                                           \
+                fmult (Cx + ((pC)*csize), awork, bwork) ;                   \
             }
+            #include "GB_kroner_template.c"
+            #undef  GB_KRON_OP
+            done = true ;
         }
     }
 
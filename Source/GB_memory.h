@@ -169,16 +169,66 @@ void GB_memset                  // parallel memset
 // malloc/calloc/realloc/free: for workspace
 //------------------------------------------------------------------------------
 
-// These macros currently do the same thing as the 4 macros above, but that may
-// change in the future.  Even if they always do the same thing, it's useful to
-// tag the source code for the allocation of workspace differently from the
-// allocation of permament space for a GraphBLAS object, such as a GrB_Matrix.
+// These macros allocate and free workspace that is never transplanted into a
+// GraphBLAS object.  If the descriptor of the user-callable method holds a
+// GxB_Arena, the workspace is taken from the arena (see GB_arena.c) and
+// otherwise by the 4 macros above.  Workspace allocated with these macros must
+// be freed with GB_FREE_WORK and the same Context, never with GB_FREE.
+
+GB_PUBLIC
+void *GB_malloc_work        // allocate workspace
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    GB_Context Context
+) ;
+
+GB_PUBLIC
+void *GB_calloc_work        // allocate workspace, set to zero
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    GB_Context Context
+) ;
+
+GB_PUBLIC
+void *GB_realloc_work       // reallocate workspace
+(
+    size_t nitems_new,      // new number of items in the object
+    size_t size_of_item,    // sizeof each item
+    // input/output
+    void *p,                // old workspace to reallocate
+    // output
+    size_t *size_allocated, // # of bytes actually allocated
+    bool *ok,               // true if successful, false otherwise
+    GB_Context Context
+) ;
+
+GB_PUBLIC
+void GB_free_work           // free workspace
+(
+    // input/output
+    void **p,               // pointer to workspace to free
+    // input
+    size_t size_allocated,  // # of bytes actually allocated
+    GB_Context Context
+) ;
+
+#define GB_CALLOC_WORK(n,type,s) \
+    (type *) GB_calloc_work (n, sizeof (type), s, Context)
+
+#define GB_MALLOC_WORK(n,type,s) \
+    (type *) GB_malloc_work (n, sizeof (type), s, Context)
 
-#define GB_CALLOC_WORK(n,type,s) GB_CALLOC(n,type,s)
-#define GB_MALLOC_WORK(n,type,s) GB_MALLOC(n,type,s)
 #define GB_REALLOC_WORK(p,nnew,type,s,ok,Context) \
-             GB_REALLOC(p,nnew,type,s,ok,Context) 
-#define GB_FREE_WORK(p,s) GB_FREE(p,s)
+    p = (type *) GB_realloc_work (nnew, sizeof (type), \
+        (void *) p, s, ok, Context)
 
-#endif
+#define GB_FREE_WORK(p,s) \
+    GB_free_work ((void **) p, s, Context)
 
+#endif
@@ -7,7 +7,7 @@
 
 //------------------------------------------------------------------------------
 
-#include "GB.h"
+#include "GB_AxB_saxpy3.h"
 
 GrB_Info GB_memoryUsage     // count # allocated blocks and their sizes
 (
@@ -30,7 +30,7 @@ GrB_Info GB_memoryUsage     // count # allocated blocks and their sizes
     // count the allocated blocks and their sizes
     //--------------------------------------------------------------------------
 
-    // a matrix contains 0 to 10 dynamically malloc'd blocks
+    // a matrix contains 0 to 12 dynamically malloc'd blocks
     (*nallocs) = 0 ;
     (*mem_deep) = 0 ;
     (*mem_shallow) = 0 ;
@@ -138,6 +138,30 @@ GrB_Info GB_memoryUsage     // count # allocated blocks and their sizes
         (*mem_deep) += Pending->x_size ;
     }
 
+    if (A->hyper_hash != NULL)
+    { 
+        (*nallocs) += 2 ;
+        (*mem_deep) += A->hyper_hash->header_size + A->hyper_hash->Slot_size ;
+    }
+
+    if (A->AT != NULL)
+    { 
+        // the cached transpose of A is never shallow
+        int64_t AT_nallocs ;
+        size_t AT_mem_deep, AT_mem_shallow ;
+        GB_memoryUsage (&AT_nallocs, &AT_mem_deep, &AT_mem_shallow, A->AT) ;
+        (*nallocs) += AT_nallocs ;
+        (*mem_deep) += AT_mem_deep ;
+    }
+
+    struct GB_saxpy3_cache_struct *entry ;
+    for (entry = A->saxpy3_cache ; entry != NULL ; entry = entry->next)
+    { 
+        // the cached saxpy3 tasks of A are never shallow
+        (*nallocs) += 1 + (entry->SaxpyTasks != NULL) ;
+        (*mem_deep) += entry->header_size + entry->SaxpyTasks_size ;
+    }
+
     #pragma omp flush
     return (GrB_SUCCESS) ;
 }
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// GB_mmap: map a file into memory, or unmap it
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_mmap maps an entire file into memory, read-only, for GxB_Matrix_mmap.
+// The mapping is shared, so the pages of the file are held once in the
+// operating system page cache, no matter how many processes map the same file.
+// GB_munmap releases the mapping held by a matrix, when the content of the
+// matrix is freed.  Memory-mapped matrices are not supported on Windows.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#if !defined ( _WIN32 )
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define GB_HAS_MMAP 1
+#endif
+
+//------------------------------------------------------------------------------
+// GB_mmap: map a file into memory
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mmap                    // map a file into memory, read-only
+(
+    // output:
+    GB_void **base_handle,          // the mapped file
+    size_t *size_handle,            // size of the mapped file
+    // input:
+    int fd                          // file descriptor of the file to map
+)
+{
+
+    (*base_handle) = NULL ;
+    (*size_handle) = 0 ;
+
+    #if GB_HAS_MMAP
+    {
+        // get the size of the file
+        struct stat st ;
+        if (fstat (fd, &st) != 0)
+        { 
+            // fd is not a valid file descriptor
+            return (GrB_INVALID_VALUE) ;
+        }
+        if (!S_ISREG (st.st_mode) || st.st_size < GB_BLOB_HEADER_SIZE)
+        { 
+            // fd is not a file, or the file is too small to hold a matrix
+            return (GrB_INVALID_OBJECT) ;
+        }
+
+        // map the entire file
+        size_t size = (size_t) st.st_size ;
+        void *base = mmap (NULL, size, PROT_READ, MAP_SHARED, fd, 0) ;
+        if (base == MAP_FAILED)
+        { 
+            // the file cannot be mapped
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        (*base_handle) = (GB_void *) base ;
+        (*size_handle) = size ;
+        return (GrB_SUCCESS) ;
+    }
+    #else
+    { 
+        // mmap is not available
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_munmap: unmap a file
+//------------------------------------------------------------------------------
+
+void GB_munmap                  // unmap a file mapped by GB_mmap
+(
+    // input/output:
+    void **base_handle,         // the mapped file; set to NULL on output
+    size_t *size_handle         // size of the mapped file; set to 0 on output
+)
+{
+
+    if (base_handle != NULL && (*base_handle) != NULL)
+    { 
+        #if GB_HAS_MMAP
+        munmap (*base_handle, *size_handle) ;
+        #endif
+        (*base_handle) = NULL ;
+        (*size_handle) = 0 ;
+    }
+}
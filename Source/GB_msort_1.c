@@ -324,6 +324,8 @@ GrB_Info GB_msort_1     // sort array A of size 1-by-n
     // allocate workspace
     //--------------------------------------------------------------------------
 
+    // this method has no Context, so W is never allocated from an arena
+    GB_Context Context = NULL ;
     int64_t *restrict W = NULL ; size_t W_size = 0 ;
     W = GB_MALLOC_WORK (n + 6*ntasks + 1, int64_t, &W_size) ;
     if (W == NULL)
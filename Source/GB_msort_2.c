@@ -337,6 +337,8 @@ GrB_Info GB_msort_2    // sort array A of size 2-by-n, using 2 keys (A [0:1][])
     // allocate workspace
     //--------------------------------------------------------------------------
 
+    // this method has no Context, so W is never allocated from an arena
+    GB_Context Context = NULL ;
     int64_t *restrict W = NULL ; size_t W_size = 0 ;
     W = GB_MALLOC_WORK (2*n + 6*ntasks + 1, int64_t, &W_size) ;
     if (W == NULL)
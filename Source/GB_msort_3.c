@@ -349,6 +349,8 @@ GrB_Info GB_msort_3    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     // allocate workspace
     //--------------------------------------------------------------------------
 
+    // this method has no Context, so W is never allocated from an arena
+    GB_Context Context = NULL ;
     int64_t *restrict W = NULL ; size_t W_size = 0 ;
     W = GB_MALLOC_WORK (3*n + 6*ntasks + 1, int64_t, &W_size) ;
     if (W == NULL)
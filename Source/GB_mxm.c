@@ -127,15 +127,19 @@ GrB_Info GB_mxm                     // C<M> = A*B
     // dense with all entries present.  C can have any sparsity structure;
     // its pattern is ignored.
 
-    // If C is bitmap, then it can always be be done in-place (assuming the
-    // type of C is OK).  The accum operator need not be present.  GB_AxB_meta
-    // can easily insert non-entries into C and check for non-entries, via the
-    // bitmap.
+    // If C is bitmap, then C+=A*B and C<#M>+=A*B can also be done in-place,
+    // with the same conditions on the accum operator and C_replace.
+    // GB_AxB_meta can easily insert non-entries into C and check for
+    // non-entries, via the bitmap.
 
     // To compute C in-place, its type must match the accum->ztype, or the
     // semiring->add->ztype if accum is not present.  To compute in-place,
     // C must also not be transposed, and it cannot be aliased with M, A, or B.
 
+    // The one exception is C=A*D or C=D*B where D is diagonal, with no mask or
+    // accum, and where C is aliased with A or B, respectively.  The pattern of
+    // C does not change, and its values are scaled in-place.
+
 // for (int k = 0 ; k < 40 ; k++) GB_Global_timing_clear (k) ;
 
     bool mask_applied = false ;
@@ -155,6 +159,7 @@ GrB_Info GB_mxm                     // C<M> = A*B
     if (done_in_place)
     { 
         // C has been computed in-place; no more work to do
+        GB_stamp (C) ;
         GB_phbix_free (MT) ;
         GB_OK (GB_conform (C, Context)) ;
         ASSERT_MATRIX_OK (C, "C from GB_mxm (in-place)", GB0) ;
@@ -78,7 +78,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
 GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or B
     const GrB_Matrix D,             // diagonal input matrix
     const GrB_Matrix B,             // input matrix
     const GrB_Semiring semiring,    // semiring that defines C=D*A
@@ -88,7 +88,7 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
 
 GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or A
     const GrB_Matrix A,             // input matrix
     const GrB_Matrix D,             // diagonal input matrix
     const GrB_Semiring semiring,    // semiring that defines C=A*D
@@ -96,6 +96,38 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
     GB_Context Context
 ) ;
 
+GrB_Info GB_AxB_outer               // C = A*B' via outer products
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, not transposed
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+) ;
+
+bool GB_AxB_outer_ok                // true if GB_AxB_outer can compute A*B'
+(
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const GrB_Semiring semiring     // semiring that defines C=A*B'
+) ;
+
+int64_t GB_AxB_outer_flops          // return the total flop count
+(
+    // output:
+    int64_t *restrict Wf,           // flops for each vector of A, or NULL
+    int64_t *restrict Wk,           // vector kB of B for each kA, or NULL
+    // input:
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    GB_Context Context
+) ;
+
+// GB_AxB_meta uses GB_AxB_outer for C=A*B' if the outer products take no more
+// than GB_AXB_OUTER_RATIO flops per entry of B, since the alternative is to
+// transpose B and then use saxpy3.
+#define GB_AXB_OUTER_RATIO 2
 
 bool GB_AxB_semiring_builtin        // true if semiring is builtin
 (
@@ -117,7 +149,8 @@ bool GB_AxB_semiring_builtin        // true if semiring is builtin
 GB_PUBLIC
 GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 (
-    GrB_Matrix C,                   // output matrix, static header
+    GrB_Matrix C,                   // output matrix, static header, or C_in
+    const bool C_in_place,          // if true, C+=A'*B is done in-place
     const bool C_iso,               // true if C is iso
     const GB_void *cscalar,         // iso value of C
     const GrB_Matrix M_in,          // mask matrix for C<!M>=A'*B, may be NULL
@@ -161,6 +194,9 @@ GrB_Info GB_AxB_dot3_slice
     int *p_nthreads,                // # of threads to use
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix, with the same pattern as C
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
     GB_Context Context
 ) ;
 
@@ -223,6 +259,35 @@ static inline bool GB_AxB_dot4_control
         && (accum == semiring->add->op) && (C_in->type == accum->ztype)) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_AxB_dot2_in_place_control: determine if dot2 can compute C+=A'*B in-place
+//------------------------------------------------------------------------------
+
+// C += A'*B (or C += A*B) where C is bitmap or as-if-full, and is modified
+// in-place by the dot2 method.  This is used when dot4 cannot be used: if C
+// is bitmap, or if the semiring is not built-in.  The ANY monoid is not
+// supported.  A and B cannot be hypersparse, since dot2 then computes C with
+// fewer rows and columns, and expands it when done.
+
+static inline bool GB_AxB_dot2_in_place_control
+(
+    const bool C_out_iso,       // true if C is iso on output; must be false
+    const GrB_Matrix C_in,      // must be present, and bitmap or as-if-full
+    const GrB_Matrix M,         // must be NULL
+    const GrB_BinaryOp accum,   // accum must match the monoid
+    const GrB_Semiring semiring,
+    const GrB_Matrix A,         // must not be hypersparse
+    const GrB_Matrix B          // must not be hypersparse
+)
+{
+    return (!C_out_iso && C_in != NULL
+        && (GB_IS_BITMAP (C_in) || GB_as_if_full (C_in))
+        && (M == NULL) && (accum != NULL)
+        && (accum == semiring->add->op) && (C_in->type == accum->ztype)
+        && (accum->opcode != GB_ANY_binop_code)
+        && !GB_IS_HYPERSPARSE (A) && !GB_IS_HYPERSPARSE (B)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot3_control: determine if the dot3 method should be used
 //------------------------------------------------------------------------------
@@ -253,6 +318,78 @@ bool GB_AxB_dot2_control  // true: use dot2, false: use saxpy
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_msa: C<M>=A*B driven by a very sparse mask
+//------------------------------------------------------------------------------
+
+// C<M>=A*B where M is very sparse compared with the work of saxpy3, and all
+// matrices are sparse or hypersparse.  A is not transposed; each A(:,k) is
+// intersected with M(:,j) for each entry B(k,j).
+
+GrB_Info GB_AxB_saxpy_msa           // C<M>=A*B, driven by the mask
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix B,             // input matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+) ;
+
+GB_PUBLIC
+bool GB_AxB_saxpy_msa_control    // true: use saxpy_msa, false: saxpy3
+(
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+) ;
+
+// estimate the work to merge two sparse vectors with x and y entries
+static inline double GB_merge_work (double x, double y)
+{
+    double xmin = GB_IMIN (x, y) ;
+    double xmax = GB_IMAX (x, y) ;
+    if (xmax > 8 * xmin)
+    { 
+        // galloping search for each entry of the shorter vector
+        return (xmin * (1 + log2 (1 + xmax / GB_IMAX (xmin, 1)))) ;
+    }
+    else
+    { 
+        // linear-time merge
+        return (xmin + xmax) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_push_pull: select push (saxpy) or pull (dot) for w<M>=A*u
+//------------------------------------------------------------------------------
+
+// If A is in push/pull mode (see GxB_PUSH_PULL), GrB_mxv and GrB_vxm select
+// the saxpy or dot product method from the # of entries in u and M, and use
+// either A or its cached transpose A->AT, whichever does not need to be
+// transposed for the selected method.
+
+GrB_Info GB_AxB_push_pull       // select push or pull for w<M>=A*u
+(
+    // input/output:
+    GrB_Matrix *A_handle,           // A on input, A or A->AT on output
+    bool *A_transpose,              // true if A' is used; negated if A->AT
+                                    // is returned in *A_handle
+    GrB_Desc_Value *AxB_method,     // set to GxB_AxB_SAXPY or GxB_AxB_DOT
+    // input:
+    const GrB_Matrix w,             // output vector (not modified)
+    const GrB_Matrix M,             // optional mask for w
+    const bool Mask_comp,           // if true, use !M
+    const GrB_Matrix u,             // input vector
+    const GrB_Semiring semiring,    // semiring that defines w=A*u
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_iso_AxB: determine if C=A*B results in an iso matrix C
 //------------------------------------------------------------------------------
@@ -299,6 +436,8 @@ void GB_AxB_meta_adotb_control
 #define GB_USE_COLSCALE 1
 #define GB_USE_DOT      2
 #define GB_USE_SAXPY    3
+#define GB_USE_OUTER    4
+#define GB_USE_MSA      5
 
 #endif
 
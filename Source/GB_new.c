@@ -31,7 +31,7 @@
 // returned as NULL, and the existing header is freed as well, if non-NULL on
 // input.
 
-#include "GB.h"
+#include "GB_Pending.h"
 
 GB_PUBLIC
 GrB_Info GB_new                 // create matrix, except for indices & values
@@ -162,11 +162,32 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
+    A->mmap_base = NULL ; A->mmap_size = 0 ;
 
     A->nvals = 0 ;              // for bitmapped matrices only
     A->nzombies = 0 ;
     A->jumbled = false ;
     A->Pending = NULL ;
+    if (allocated_header)
+    { 
+        // a new matrix is not in concurrent-ingest or push/pull mode
+        A->Ingest = NULL ;
+        A->hyper_hash = NULL ;
+        A->AT = NULL ;
+        A->AT_stamp = 0 ;
+        A->push_pull = false ;
+        A->saxpy3_cache = NULL ;
+    }
+    else
+    { 
+        // a reused header remains in concurrent-ingest and push/pull mode, if
+        // enabled, but its per-thread pending tuples are discarded
+        GB_Ingest_clear (A->Ingest) ;
+        GB_hyper_hash_free (A) ;
+    }
+    // A is new; this also frees the cached transpose and saxpy3 tasks of a
+    // reused header
+    GB_stamp (A) ;
     A->iso = false ;            // OK: if iso, burble in the caller
 
     //--------------------------------------------------------------------------
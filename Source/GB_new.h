@@ -89,6 +89,13 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_munmap                  // unmap a file mapped by GB_mmap
+(
+    // input/output:
+    void **base_handle,         // the mapped file; set to NULL on output
+    size_t *size_handle         // size of the mapped file; set to 0 on output
+) ;
+
 void GB_phbix_free              // free all content of a matrix
 (
     GrB_Matrix A                // matrix with content to free
@@ -99,5 +106,20 @@ void GB_Matrix_free             // free a matrix
     GrB_Matrix *Ahandle         // handle of matrix to free
 ) ;
 
+void GB_transpose_cache_free    // free the cached transpose of A, if present
+(
+    GrB_Matrix A                // matrix with cached transpose to free
+) ;
+
+void GB_AxB_saxpy3_cache_free   // free the cached saxpy3 tasks of B, if any
+(
+    GrB_Matrix B                // matrix with cached tasks to free
+) ;
+
+void GB_stamp                   // give A a new modification stamp
+(
+    GrB_Matrix A                // matrix that has been modified
+) ;
+
 #endif
 
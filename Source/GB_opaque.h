@@ -458,6 +458,51 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int compression ;       // compression method for GxB_Matrix_serialize
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
     int import ;            // if zero (default), trust input data
+    GxB_Arena arena ;       // arena for werkspace, or NULL (not owned)
+    GxB_MxM_Plan plan ;     // plan for C=A*B, or NULL (not owned)
+} ;
+
+//------------------------------------------------------------------------------
+// GxB_Arena: a user-owned region for transient werkspace
+//------------------------------------------------------------------------------
+
+// An arena is attached to a descriptor with GxB_set (desc, GxB_ARENA, arena).
+// Werkspace that does not fit in the Context->Werk stack is bump-allocated
+// from the arena (see GB_arena.c).  The arena is released in O(1) time when
+// the last block allocated from it is freed, which always occurs before the
+// user-callable method returns.
+
+struct GB_Arena_opaque      // content of GxB_Arena
+{
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    GB_void *space ;        // the arena itself, of size space_size
+    size_t space_size ;     // size of the malloc'd block for space
+    size_t top ;            // space [0:top-1] is in use
+    int64_t nlive ;         // # of blocks currently allocated from the arena
+    size_t highwater ;      // max value of top
+    int64_t noverflow ;     // # of requests that did not fit in the arena
+} ;
+
+//------------------------------------------------------------------------------
+// GxB_MxM_Plan: a reusable symbolic analysis for C=A*B
+//------------------------------------------------------------------------------
+
+// A plan is attached to a descriptor with GxB_set (desc, GxB_MXM_PLAN, plan).
+// The analysis itself is held in a GB_saxpy3_plan_struct, which is defined in
+// GB_AxB_saxpy3.h, and created, reused, or replaced by GB_AxB_saxpy3 (see
+// GB_AxB_saxpy3_plan.c).  saxpy3 [0] is the analysis of C<#M>=A*B, and
+// saxpy3 [1] records a problem for which the mask M was discarded (in which
+// case the analysis in saxpy3 [0] is for C=A*B).  Either is NULL if not built.
+
+struct GB_MxM_Plan_opaque   // content of GxB_MxM_Plan
+{
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    struct GB_saxpy3_plan_struct *saxpy3 [2] ;  // saxpy3 analysis, or NULL
+    size_t saxpy3_size [2] ;    // size of each malloc'd block, or 0
+    int64_t nbuild ;        // # of times the plan has been built
+    int64_t nreuse ;        // # of times the plan has been reused
 } ;
 
 //------------------------------------------------------------------------------
@@ -486,6 +531,64 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+//------------------------------------------------------------------------------
+// GB_Ingest data structure: per-thread pending tuples for a matrix
+//------------------------------------------------------------------------------
+
+// A matrix in concurrent-ingest mode (see GxB_CONCURRENT_INGEST) holds a table
+// of slots.  Each user thread that calls GrB_setElement on the matrix claims
+// its own slot, and appends its tuples to the list of pending tuples in that
+// slot, with no locks.  The last slot is shared by any threads that cannot
+// claim a slot of their own; its owner is used as a spin lock.  GB_wait moves
+// all the tuples into A->Pending.  See GB_Ingest_add.c and GB_Ingest_merge.c.
+
+typedef struct
+{
+    int64_t owner ;         // id of the thread that owns this slot, or zero
+    GB_Pending Pending ;    // tuples added by the thread that owns this slot
+    int64_t unused [6] ;    // pad each slot to 64 bytes
+}
+GB_Ingest_slot ;
+
+struct GB_Ingest_struct     // per-thread pending tuples for a matrix
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    GB_Ingest_slot *Slots ; // array of size nslots+1
+    size_t Slots_size ;
+    int64_t nslots ;        // # of slots owned by a single thread
+    bool nonempty ;         // true if any slot may have pending tuples
+    bool failed ;           // true if any thread ran out of memory
+} ;
+
+typedef struct GB_Ingest_struct *GB_Ingest ;
+
+//------------------------------------------------------------------------------
+// GB_Hyper_hash data structure: hash index of the hyperlist of a matrix
+//------------------------------------------------------------------------------
+
+// The hyperlist A->h of a hypersparse matrix is sorted, so vector j is found
+// with a binary search, in O(log (A->nvec)) time.  For matrices with many
+// vectors, each search takes many cache misses.  A->hyper_hash is an optional
+// hash index of A->h that finds j in O(1) time.  It is a table of (j,k) pairs
+// with linear probing, where j = A->h [k], and j is -1 for an empty slot.  The
+// table is built on demand by GB_hyper_hash_build, and freed by
+// GB_hyper_hash_free whenever A->h changes.  As a safeguard, the table also
+// records A->h and A->nvec at the time it was built, and GB_hyper_hash_get
+// ignores a table that does not match the current hyperlist of A.
+
+struct GB_Hyper_hash_struct // hash index of the hyperlist A->h
+{
+    size_t header_size ;    // size of the malloc'd block for this struct
+    int64_t *Slot ;         // table of size 2*hash_size: (j,k) pairs
+    size_t Slot_size ;
+    uint64_t hash_bits ;    // hash_size-1, where hash_size is a power of 2
+    int hash_shift ;        // 64 - log2 (hash_size)
+    const int64_t *h ;      // A->h when the table was built
+    int64_t nvec ;          // A->nvec when the table was built
+} ;
+
+typedef struct GB_Hyper_hash_struct *GB_Hyper_hash ;
+
 //------------------------------------------------------------------------------
 // scalar, vector, and matrix types
 //------------------------------------------------------------------------------
@@ -526,5 +629,29 @@ static inline GrB_Matrix GB_clear_static_header // clear a static header
 #define GBB(Ab,p)       ((Ab == NULL) ? 1 : Ab [p])
 #define GBX(Ax,p,A_iso) (Ax [(A_iso) ? 0 : (p)])
 
+//------------------------------------------------------------------------------
+// Accessing a bitmap 8 entries at a time
+//------------------------------------------------------------------------------
+
+// GB_bitmap_word (Ab, p) returns Ab [p:p+7] as a single 64-bit word, or a word
+// with all 8 bytes equal to 1 if Ab is NULL (A is full).  If each byte is 0 or
+// 1 (as in any valid bitmap matrix), the word is zero if none of the 8 entries
+// are present.  The bitmap assign and saxpy methods use other values of Cb [p]
+// to mark entries while C is being computed.
+
+#define GB_BITMAP_WORD_ONES 0x0101010101010101ULL
+
+static inline uint64_t GB_bitmap_word
+(
+    const int8_t *restrict Ab,      // bitmap, or NULL if A is full
+    int64_t p                       // get Ab [p:p+7]
+)
+{
+    if (Ab == NULL) return (GB_BITMAP_WORD_ONES) ;
+    uint64_t w ;
+    memcpy (&w, Ab + p, sizeof (uint64_t)) ;
+    return (w) ;
+}
+
 #endif
 
@@ -42,6 +42,12 @@ void GB_ph_free                 // free A->p and A->h of a matrix
     A->p_size = 0 ;
     A->p_shallow = false ;
 
+    // free the hash index of A->h, if present
+    GB_hyper_hash_free (A) ;
+
+    // A is modified; this also frees the cached transpose of A, if present
+    GB_stamp (A) ;
+
     // free A->h unless it is shallow
     if (!A->h_shallow)
     { 
@@ -244,7 +244,8 @@ GrB_Info GB_resize              // change the size of a matrix
         GB_OK (GB_convert_any_to_hyper (A, Context)) ;
         ASSERT (GB_IS_HYPERSPARSE (A)) ;
 
-        // resize the number of sparse vectors
+        // resize the number of sparse vectors; this changes the hyperlist
+        GB_hyper_hash_free (A) ;
         int64_t *restrict Ah = A->h ;
         int64_t *restrict Ap = A->p ;
         A->vdim = vdim_new ;
@@ -748,6 +748,7 @@ GrB_Info GB_selector
         if (A->h != NULL && C_nvec_nonempty < anvec)
         {
             // prune empty vectors from Ah and Ap
+            GB_hyper_hash_free (A) ;
             int64_t cnvec = 0 ;
             for (int64_t k = 0 ; k < anvec ; k++)
             {
@@ -780,6 +781,7 @@ GrB_Info GB_selector
         A->nvec_nonempty = C_nvec_nonempty ;
         A->jumbled = A_jumbled ;        // A remains jumbled (in-place select)
         A->iso = C_iso ;                // OK: burble already done above
+        GB_stamp (A) ;
 
         // the NONZOMBIE opcode may have removed all zombies, but A->nzombie
         // is still nonzero.  It is set to zero in GB_wait.
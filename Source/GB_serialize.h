@@ -25,12 +25,28 @@ void GB_serialize_method
 (
     // output
     bool *intel,                    // if true, use Intel IPPS (if available)
+    bool *delta,                    // if true, delta-encode integer arrays
+    bool *shuffle,                  // if true, shuffle the bytes of each block
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
     // input
     int32_t method
 ) ;
 
+int32_t GB_serialize_array_method   // method to use for a single array
+(
+    int32_t method,                 // method requested for the matrix
+    size_t esize                    // size of each entry of the array
+) ;
+
+// true if the method includes GxB_COMPRESSION_DELTA or GxB_COMPRESSION_SHUFFLE
+#define GB_SERIALIZE_DELTA(method)                                      \
+    ((method) > 0 && ((method) % GxB_COMPRESSION_INTEL) >=              \
+        GxB_COMPRESSION_DELTA)
+#define GB_SERIALIZE_SHUFFLE(method)                                    \
+    ((method) > 0 && (((method) % GxB_COMPRESSION_INTEL) %              \
+        GxB_COMPRESSION_DELTA) >= GxB_COMPRESSION_SHUFFLE)
+
 GrB_Info GB_deserialize             // deserialize a matrix from a blob
 (
     // output:
@@ -42,6 +58,51 @@ GrB_Info GB_deserialize             // deserialize a matrix from a blob
     GB_Context Context
 ) ;
 
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_stream_write_function write_function,   // writes to the stream
+    void *stream,                   // stream to write to
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    bool mmap_layout,               // if true, use the layout for mmap
+    GB_Context Context
+) ;
+
+GrB_Info GB_deserialize_stream      // deserialize a matrix from a stream
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix created from the stream
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    GxB_stream_read_function read_function,     // reads from the stream
+    void *stream,                   // stream to read from
+    GB_Context Context
+) ;
+
+GrB_Info GB_deserialize_mmap        // create a matrix from a mapped file
+(
+    // output:
+    GrB_Matrix *Chandle,            // output matrix, with shallow content
+    // input:
+    GrB_Type type_expected,         // type expected (NULL for any built-in)
+    const GB_void *base,            // the mapped file
+    size_t size,                    // size of the mapped file
+    GB_Context Context
+) ;
+
+bool GB_fd_write (void *stream, const void *buffer, size_t size) ;
+bool GB_fd_read  (void *stream, void *buffer, size_t size) ;
+
+GrB_Info GB_mmap                    // map a file into memory, read-only
+(
+    // output:
+    GB_void **base_handle,          // the mapped file
+    size_t *size_handle,            // size of the mapped file
+    // input:
+    int fd                          // file descriptor of the file to map
+) ;
+
 typedef struct
 {
     void *p ;                   // pointer to the compressed block
@@ -64,6 +125,7 @@ GrB_Info GB_serialize_array
     bool dryrun,                        // if true, just esimate the size
     GB_void *X,                         // input array of size len
     int64_t len,                        // size of X, in bytes
+    size_t esize,                       // size of each entry of X
     int32_t method,                     // compression method requested
     bool intel,                         // if true, use Intel IPPS
     int32_t algo,                       // compression algorithm
@@ -103,11 +165,47 @@ GrB_Info GB_deserialize_from_blob
     int64_t *Sblocks,           // array of size nblocks
     int32_t nblocks,            // # of compressed blocks for this array
     int32_t method_used,        // compression method used for each block
+    size_t esize,               // size of each entry of X
     // input/output:
     size_t *s_handle,           // location to write into the blob
     GB_Context Context
 ) ;
 
+size_t GB_serialize_bound           // upper bound on compressed size
+(
+    int32_t algo,                   // compression algorithm
+    size_t size                     // size of the uncompressed block
+) ;
+
+size_t GB_serialize_block           // compress a block
+(
+    // output:
+    GB_void *dst,                   // compressed block
+    size_t dst_capacity,            // size of dst
+    // input:
+    const GB_void *src,             // uncompressed block
+    size_t src_size,                // size of src
+    int32_t algo,                   // compression algorithm
+    int32_t level,                  // compression level
+    size_t esize,                   // shuffle the bytes if esize > 1
+    bool delta,                     // if true, delta-encode an int64_t block
+    GB_void *W                      // workspace, if esize > 1 or delta
+) ;
+
+bool GB_deserialize_block           // decompress a block
+(
+    // output:
+    GB_void *dst,                   // uncompressed block
+    size_t dst_size,                // size of dst
+    // input:
+    const GB_void *src,             // compressed block
+    size_t src_size,                // size of src
+    int32_t algo,                   // compression algorithm
+    size_t esize,                   // unshuffle the bytes if esize > 1
+    bool delta,                     // if true, the block is delta-encoded
+    GB_void *W                      // workspace, if esize > 1 or delta
+) ;
+
 #define GB_BLOB_HEADER_SIZE \
     sizeof (size_t)             /* blob_size                            */ \
     + 11 * sizeof (int64_t)     /* vlen, vdim, nvec, nvec_nonempty,     */ \
@@ -117,6 +215,46 @@ GrB_Info GB_deserialize_from_blob
                                 /* sparsity_iso_csc                     */ \
     + 2 * sizeof (float)        /* hyper_switch, bitmap_switch          */
 
+// The header of a stream is the same as a blob, except that its blob_size is
+// GB_BLOB_STREAM.  This ensures a stream cannot be deserialized as a blob, and
+// a blob cannot be deserialized as a stream.
+#define GB_BLOB_STREAM 0
+
+// size of each uncompressed block of a compressed array in a stream (1MB)
+#define GB_STREAM_BLOCKSIZE (1024*1024)
+
+// The header of a matrix written for GxB_Matrix_mmap has a blob_size of
+// GB_BLOB_MMAP.  Each of its arrays starts at a multiple of GB_MMAP_ALIGN
+// bytes from the start of the file, which is a multiple of the page size.
+#define GB_BLOB_MMAP 1
+#define GB_MMAP_ALIGN 4096
+#define GB_MMAP_ROUND(s) \
+    (((s) + (GB_MMAP_ALIGN-1)) & (~((size_t) (GB_MMAP_ALIGN-1))))
+
+// A delta-encoded block of n int64_t entries takes at most 10*n bytes
+#define GB_DELTA_BOUND(size) (((size) / sizeof (int64_t)) * 10)
+
+// Delta-encoded arrays are split into blocks of at most GB_DELTA_BLOCKSIZE
+// bytes, so that they can be decoded in parallel even if they were encoded by
+// a single thread.
+#define GB_DELTA_BLOCKSIZE (1024*1024)
+
+// Partition an array of len bytes into nblocks blocks, and return the
+// block X [kstart:kend-1].  If the array is delta-encoded, each block holds
+// a whole number of int64_t entries.
+#define GB_SERIALIZE_PARTITION(kstart,kend,len,blockid,nblocks,delta)   \
+    if (delta)                                                          \
+    {                                                                   \
+        GB_PARTITION (kstart, kend, (len) / ((int64_t) sizeof (int64_t)), \
+            blockid, nblocks) ;                                         \
+        kstart *= sizeof (int64_t) ;                                    \
+        kend   *= sizeof (int64_t) ;                                    \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;            \
+    }
+
 // write a scalar to the blob
 #define GB_BLOB_WRITE(x,type) \
     memcpy (blob + s, &(x), sizeof (type)) ; s += sizeof (type) ;
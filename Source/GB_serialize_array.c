@@ -9,7 +9,8 @@
 
 // Parallel compression method for an array.  The array is compressed into
 // a sequence of independently allocated blocks, or returned as-is if not
-// compressed.  Currently, only LZ4 is supported.
+// compressed.  LZ4, LZ4HC, and ZSTD are supported, with an optional byte
+// shuffle or delta encoding of each block before it is compressed.
 
 #include "GB.h"
 #include "GB_serialize.h"
@@ -17,6 +18,7 @@
 
 #define GB_FREE_ALL                                                     \
 {                                                                       \
+    GB_FREE_WORK (&W, W_size) ;                                         \
     GB_FREE (&Sblocks, Sblocks_size) ;                                  \
     GB_serialize_free_blocks (&Blocks, Blocks_size, nblocks, Context) ; \
 }
@@ -36,6 +38,7 @@ GrB_Info GB_serialize_array
     bool dryrun,                        // if true, just esimate the size
     GB_void *X,                         // input array of size len
     int64_t len,                        // size of X, in bytes
+    size_t esize,                       // size of each entry of X
     int32_t method,                     // compression method requested
     bool intel,                         // if true, use Intel IPPS
     int32_t algo,                       // compression algorithm
@@ -60,6 +63,8 @@ GrB_Info GB_serialize_array
     size_t Blocks_size = 0, Sblocks_size = 0 ;
     int32_t nblocks = 0 ;
     int64_t *Sblocks = NULL ;
+    GB_void *W = NULL ;
+    size_t W_size = 0 ;
 
     //--------------------------------------------------------------------------
     // check for quick return
@@ -115,6 +120,12 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    // The bytes of each block are shuffled only if the method requests it,
+    // and if the entries of X are larger than a single byte.  Only int64_t
+    // arrays are delta-encoded.
+    method = GB_serialize_array_method (method, esize) ;
+    bool delta = GB_SERIALIZE_DELTA (method) ;
+    bool shuffle = GB_SERIALIZE_SHUFFLE (method) ;
     (*method_used) = method ;
 
     //--------------------------------------------------------------------------
@@ -135,6 +146,12 @@ GrB_Info GB_serialize_array
     ASSERT (LZ4_MAX_INPUT_SIZE < INT32_MAX) ;
     blocksize = GB_IMIN (blocksize, LZ4_MAX_INPUT_SIZE/2) ;
 
+    if (delta)
+    { 
+        // ensure a delta-encoded array can be decoded in parallel
+        blocksize = GB_IMIN (blocksize, GB_DELTA_BLOCKSIZE) ;
+    }
+
     // ensure the blocksize is not too small
     blocksize = GB_IMAX (blocksize, (64*1024)) ;
 
@@ -163,11 +180,12 @@ GrB_Info GB_serialize_array
     { 
         // allocate a single block for the compression of X [kstart:kend-1]
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
+        GB_SERIALIZE_PARTITION (kstart, kend, len, blockid, nblocks, delta) ;
         size_t uncompressed = kend - kstart ;
         ASSERT (uncompressed < INT32_MAX) ;
         ASSERT (uncompressed > 0) ;
-        size_t s = (size_t) LZ4_compressBound ((int) uncompressed) ;
+        size_t s = GB_serialize_bound (algo,
+            delta ? GB_DELTA_BOUND (uncompressed) : uncompressed) ;
         ASSERT (s < INT32_MAX) ;
         if (dryrun)
         { 
@@ -194,6 +212,17 @@ GrB_Info GB_serialize_array
         return (GrB_SUCCESS) ;
     }
 
+    // size of the workspace for each thread to hold a shuffled block, or a
+    // delta-encoded block of at most blocksize+8 bytes
+    size_t wsize = delta ? GB_DELTA_BOUND (blocksize + sizeof (int64_t)) :
+        (blocksize + 1) ;
+    if (ok && (shuffle || delta))
+    { 
+        // allocate workspace for each thread
+        W = GB_MALLOC_WORK (nthreads * wsize, GB_void, &W_size) ;
+        ok = (W != NULL) ;
+    }
+
     if (!ok)
     { 
         // out of memory
@@ -211,28 +240,19 @@ GrB_Info GB_serialize_array
     {
         // compress X [kstart:kend-1] into Blocks [blockid].p
         int64_t kstart, kend ;
-        GB_PARTITION (kstart, kend, len, blockid, nblocks) ;
-        const char *src = (const char *) (X + kstart) ;     // source
-        char *dst = (char *) Blocks [blockid].p ;           // destination
-        int srcSize = (int) (kend - kstart) ;               // size of source
-        size_t dsize = Blocks [blockid].p_size_allocated ;  // size of dest
-        int dstCapacity = GB_IMIN (dsize, INT32_MAX) ;
-        int s ;
-        switch (algo)
-        {
-            default :
-            case GxB_COMPRESSION_LZ4 : 
-                s = LZ4_compress_default (src, dst, srcSize, dstCapacity) ;
-                break ;
-            case GxB_COMPRESSION_LZ4HC : 
-                s = LZ4_compress_HC (src, dst, srcSize, dstCapacity, level) ;
-                break ;
-        }
+        GB_SERIALIZE_PARTITION (kstart, kend, len, blockid, nblocks, delta) ;
+        GB_void *Wt = (W == NULL) ? NULL :
+            (W + GB_OPENMP_GET_THREAD_ID * wsize) ;
+        size_t s = GB_serialize_block (Blocks [blockid].p,
+            Blocks [blockid].p_size_allocated, X + kstart, kend - kstart,
+            algo, level, shuffle ? esize : 0, delta, Wt) ;
         ok = ok && (s > 0) ;
-        // compressed block is now in dst [0:s-1], of size s
+        // compressed block is now in Blocks [blockid].p [0:s-1], of size s
         Sblocks [blockid] = (int64_t) s ;
     }
 
+    GB_FREE_WORK (&W, W_size) ;
+
     if (!ok)
     {
         // compression failure: this can "never" occur
@@ -0,0 +1,347 @@
+//------------------------------------------------------------------------------
+// GB_serialize_block: compress or decompress a single block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_serialize_block compresses a single block with LZ4, LZ4HC, or ZSTD, and
+// GB_deserialize_block decompresses it.  Each method is called by a single
+// thread; the blocks of an array are compressed in parallel by the caller.
+
+// If esize > 1, the bytes of the block are shuffled before it is compressed,
+// with the k-th byte of each entry of size esize placed in the k-th segment of
+// the shuffled block.  Any trailing bytes of a block that are not a multiple
+// of esize are left in place.  The shuffle does not depend on the alignment
+// of the block, so the blocks of an array can start anywhere.  A workspace W
+// of the same size as the uncompressed block is required to hold the shuffled
+// bytes.
+
+// If delta is true, the block is an array of int64_t integers (Ap, Ah, or
+// Ai).  Each entry is replaced with its difference from the prior entry in the
+// block (the first entry is taken as its difference from zero).  The
+// differences are mapped to unsigned integers with a zigzag code, so that
+// small negative differences (at the start of each vector in Ai) remain small,
+// and each is written in a variable-length code of 7 bits per byte, with the
+// high bit of each byte set if more bytes follow.  The result is held in a
+// workspace W of size GB_DELTA_BOUND (size), which is then compressed.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_lz4.h"
+#include "GB_zstd.h"
+
+//------------------------------------------------------------------------------
+// GB_shuffle: shuffle the bytes of a block
+//------------------------------------------------------------------------------
+
+static void GB_shuffle
+(
+    GB_void *restrict dst,          // output of size n
+    const GB_void *restrict src,    // input of size n
+    size_t n,                       // size of the block, in bytes
+    size_t esize                    // size of each entry
+)
+{
+    size_t nentries = n / esize ;
+    for (size_t k = 0 ; k < esize ; k++)
+    {
+        GB_void *restrict d = dst + k * nentries ;
+        const GB_void *restrict s = src + k ;
+        for (size_t e = 0 ; e < nentries ; e++)
+        {
+            d [e] = s [e * esize] ;
+        }
+    }
+    size_t done = nentries * esize ;
+    memcpy (dst + done, src + done, n - done) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_unshuffle: undo GB_shuffle
+//------------------------------------------------------------------------------
+
+static void GB_unshuffle
+(
+    GB_void *restrict dst,          // output of size n
+    const GB_void *restrict src,    // input of size n
+    size_t n,                       // size of the block, in bytes
+    size_t esize                    // size of each entry
+)
+{
+    size_t nentries = n / esize ;
+    for (size_t k = 0 ; k < esize ; k++)
+    {
+        const GB_void *restrict s = src + k * nentries ;
+        GB_void *restrict d = dst + k ;
+        for (size_t e = 0 ; e < nentries ; e++)
+        {
+            d [e * esize] = s [e] ;
+        }
+    }
+    size_t done = nentries * esize ;
+    memcpy (dst + done, src + done, n - done) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_delta_encode: delta and varint encoding of an int64_t block
+//------------------------------------------------------------------------------
+
+// Returns the size of the encoded block, which is at most GB_DELTA_BOUND.
+
+static size_t GB_delta_encode
+(
+    uint8_t *restrict dst,          // output of size GB_DELTA_BOUND (8*n)
+    const int64_t *restrict src,    // input of size n
+    int64_t n                       // # of entries in the block
+)
+{
+    uint8_t *restrict d = dst ;
+    uint64_t prior = 0 ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        // zigzag code of the difference: 0, -1, 1, -2, ... to 0, 1, 2, 3, ...
+        uint64_t x = (uint64_t) src [k] ;
+        uint64_t diff = (x - prior) ;
+        uint64_t u = (diff << 1) ^ ((diff >> 63) ? UINT64_MAX : 0) ;
+        prior = x ;
+        // write u in 7-bit groups, lowest order first
+        while (u >= 0x80)
+        {
+            (*d++) = (uint8_t) (u | 0x80) ;
+            u >>= 7 ;
+        }
+        (*d++) = (uint8_t) u ;
+    }
+    return ((size_t) (d - dst)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_delta_decode: undo GB_delta_encode
+//------------------------------------------------------------------------------
+
+// Returns true if the src block of size len decodes into exactly n entries,
+// or false if the block is invalid.
+
+static bool GB_delta_decode
+(
+    int64_t *restrict dst,          // output of size n
+    int64_t n,                      // # of entries in the block
+    const uint8_t *restrict src,    // input of size len
+    size_t len
+)
+{
+    size_t p = 0 ;
+    uint64_t prior = 0 ;
+    int64_t k = 0 ;
+    while (k < n)
+    {
+        // check if the next 8 entries each have a single-byte code
+        bool fast = false ;
+        if (k + 8 <= n && p + 8 <= len)
+        { 
+            uint64_t w ;
+            memcpy (&w, src + p, 8) ;
+            fast = ((w & 0x8080808080808080ULL) == 0) ;
+        }
+        if (fast)
+        {
+            // fast path: the next 8 entries have single-byte codes
+            for (int t = 0 ; t < 8 ; t++)
+            {
+                uint64_t u = src [p+t] ;
+                prior += (u >> 1) ^ ((u & 1) ? UINT64_MAX : 0) ;
+                dst [k+t] = (int64_t) prior ;
+            }
+            p += 8 ;
+            k += 8 ;
+        }
+        else
+        {
+            // decode the next entry, of 1 to 10 bytes
+            uint64_t u = 0 ;
+            for (int shift = 0 ; ; shift += 7)
+            {
+                if (p >= len || shift > 63)
+                { 
+                    // the block is invalid
+                    return (false) ;
+                }
+                uint64_t b = src [p++] ;
+                u |= (b & 0x7F) << shift ;
+                if (b < 0x80) break ;
+            }
+            prior += (u >> 1) ^ ((u & 1) ? UINT64_MAX : 0) ;
+            dst [k++] = (int64_t) prior ;
+        }
+    }
+    return (p == len) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_bound: upper bound on the size of a compressed block
+//------------------------------------------------------------------------------
+
+size_t GB_serialize_bound           // upper bound on compressed size
+(
+    int32_t algo,                   // compression algorithm
+    size_t size                     // size of the uncompressed block
+)
+{
+    ASSERT (size < INT32_MAX) ;
+    if (algo == GxB_COMPRESSION_ZSTD)
+    {
+        return (ZSTD_compressBound (size)) ;
+    }
+    else
+    {
+        return ((size_t) LZ4_compressBound ((int) size)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_block: compress a single block
+//------------------------------------------------------------------------------
+
+// Returns the size of the compressed block, or zero on failure.
+
+size_t GB_serialize_block           // compress a block
+(
+    // output:
+    GB_void *dst,                   // compressed block
+    size_t dst_capacity,            // size of dst
+    // input:
+    const GB_void *src,             // uncompressed block
+    size_t src_size,                // size of src
+    int32_t algo,                   // compression algorithm
+    int32_t level,                  // compression level
+    size_t esize,                   // shuffle the bytes if esize > 1
+    bool delta,                     // if true, delta-encode an int64_t block
+    GB_void *W                      // workspace, if esize > 1 or delta
+)
+{
+
+    if (delta)
+    {
+        // delta-encode the block into W, and compress W instead
+        ASSERT (src_size % sizeof (int64_t) == 0) ;
+        src_size = GB_delta_encode ((uint8_t *) W, (const int64_t *) src,
+            src_size / sizeof (int64_t)) ;
+        src = W ;
+    }
+    else if (esize > 1)
+    {
+        // shuffle the block into W, and compress W instead
+        GB_shuffle (W, src, src_size, esize) ;
+        src = W ;
+    }
+
+    switch (algo)
+    {
+        default :
+        case GxB_COMPRESSION_LZ4 :
+        {
+            int s = LZ4_compress_default ((const char *) src, (char *) dst,
+                (int) src_size, (int) GB_IMIN (dst_capacity, INT32_MAX)) ;
+            return ((s <= 0) ? 0 : ((size_t) s)) ;
+        }
+        case GxB_COMPRESSION_LZ4HC :
+        {
+            int s = LZ4_compress_HC ((const char *) src, (char *) dst,
+                (int) src_size, (int) GB_IMIN (dst_capacity, INT32_MAX),
+                level) ;
+            return ((s <= 0) ? 0 : ((size_t) s)) ;
+        }
+        case GxB_COMPRESSION_ZSTD :
+        {
+            size_t s = ZSTD_compress (dst, dst_capacity, src, src_size,
+                level) ;
+            return (ZSTD_isError (s) ? 0 : s) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_deserialize_block: decompress a single block
+//------------------------------------------------------------------------------
+
+// Returns true if successful, or false if the compressed block is invalid or
+// does not decompress into exactly dst_size bytes.  If the block is
+// delta-encoded, it is first decompressed into W, of size
+// GB_DELTA_BOUND (dst_size), and then decoded into dst.
+
+bool GB_deserialize_block           // decompress a block
+(
+    // output:
+    GB_void *dst,                   // uncompressed block
+    size_t dst_size,                // size of dst
+    // input:
+    const GB_void *src,             // compressed block
+    size_t src_size,                // size of src
+    int32_t algo,                   // compression algorithm
+    size_t esize,                   // unshuffle the bytes if esize > 1
+    bool delta,                     // if true, the block is delta-encoded
+    GB_void *W                      // workspace, if esize > 1 or delta
+)
+{
+
+    // decompress into W if the block must be decoded or unshuffled
+    GB_void *d = (esize > 1 || delta) ? W : dst ;
+    size_t d_size = dst_size ;
+    if (delta)
+    {
+        if (dst_size % sizeof (int64_t) != 0) return (false) ;
+        d_size = GB_DELTA_BOUND (dst_size) ;
+    }
+    size_t u = 0 ;
+    bool ok ;
+
+    switch (algo)
+    {
+        case GxB_COMPRESSION_LZ4 :
+        case GxB_COMPRESSION_LZ4HC :
+        {
+            if (src_size > INT32_MAX || d_size > INT32_MAX) return (false) ;
+            int s = LZ4_decompress_safe ((const char *) src, (char *) d,
+                (int) src_size, (int) d_size) ;
+            ok = (s >= 0) ;
+            u = ok ? ((size_t) s) : 0 ;
+            break ;
+        }
+        case GxB_COMPRESSION_ZSTD :
+        {
+            u = ZSTD_decompress (d, d_size, src, src_size) ;
+            ok = !ZSTD_isError (u) ;
+            break ;
+        }
+        default :
+            // unknown compression method
+            ok = false ;
+            break ;
+    }
+
+    if (!ok)
+    { 
+        // the compressed block is invalid
+        return (false) ;
+    }
+    else if (delta)
+    {
+        // decode W into the output block
+        return (GB_delta_decode ((int64_t *) dst, dst_size / sizeof (int64_t),
+            (const uint8_t *) W, u)) ;
+    }
+    else if (u != dst_size)
+    { 
+        // the block has the wrong size
+        return (false) ;
+    }
+    else if (esize > 1)
+    {
+        // unshuffle W into the output block
+        GB_unshuffle (dst, W, dst_size, esize) ;
+    }
+    return (true) ;
+}
@@ -14,6 +14,8 @@ void GB_serialize_method
 (
     // output
     bool *intel,                    // if true, use Intel IPPS (if available)
+    bool *delta,                    // if true, delta-encode integer arrays
+    bool *shuffle,                  // if true, shuffle the bytes of each block
     int32_t *algo,                  // algorithm to use
     int32_t *level,                 // compression level
     // input
@@ -25,6 +27,8 @@ void GB_serialize_method
     { 
         // no compression if method is negative
         (*intel) = false ;
+        (*delta) = false ;
+        (*shuffle) = false ;
         (*algo) = GxB_COMPRESSION_NONE ;
         (*level) = 0 ;
         return ;
@@ -39,6 +43,13 @@ void GB_serialize_method
         method = method % GxB_COMPRESSION_INTEL ;
     }
 
+    // determine if the integer arrays should be delta-encoded, and if the
+    // bytes of each block should be shuffled, before they are compressed
+    (*delta) = (method >= GxB_COMPRESSION_DELTA) ;
+    method = method % GxB_COMPRESSION_DELTA ;
+    (*shuffle) = (method >= GxB_COMPRESSION_SHUFFLE) ;
+    method = method % GxB_COMPRESSION_SHUFFLE ;
+
     // Determine the algorithm and level.  Lower levels give faster compression
     // time but not as good of compression.  Higher levels give more compact
     // compressions, at the cost of higher run times.  For all methods: a level
@@ -70,6 +81,13 @@ void GB_serialize_method
             if ((*level) <= 0 || (*level) > 9) (*level) = 9 ;
             break ;
 
+        case GxB_COMPRESSION_ZSTD : 
+            // level 1 to 19, with a default of 1.  ZSTD at level 1 is about
+            // as fast as LZ4HC at level 1, and gives a more compact result.
+            // Levels 20 to 22 use far more memory and are not supported.
+            if ((*level) <= 0 || (*level) > 19) (*level) = 1 ;
+            break ;
+
 //      These cases will be uncommented when the methods are implemented:
 
 //      case GxB_COMPRESSION_ZLIB:
@@ -85,12 +103,37 @@ void GB_serialize_method
 //      case GxB_COMPRESSION_BZIP2:
 //          // level 1 to 9, with a default of 9
 //          if ((*level) <= 0 || (*level) > 9) (*level) = 9 ;
-//          break ;
-
-//      case GxB_COMPRESSION_LZSS:
-//          (*level) = 0 ;              // level is ignored
 //          break ;
 
     }
 }
 
+
+//------------------------------------------------------------------------------
+// GB_serialize_array_method: determine the method for a single array
+//------------------------------------------------------------------------------
+
+// Delta encoding applies only to arrays of int64_t, and the caller removes it
+// from the method for the values of the matrix.  The delta-encoded blocks are
+// bytes, so they are not shuffled.  Arrays of single bytes are not shuffled
+// either.
+
+int32_t GB_serialize_array_method   // method to use for a single array
+(
+    int32_t method,                 // method requested for the matrix
+    size_t esize                    // size of each entry of the array
+)
+{
+    if (GB_SERIALIZE_DELTA (method) && esize != sizeof (int64_t))
+    { 
+        // only int64_t arrays can be delta-encoded
+        method -= GxB_COMPRESSION_DELTA ;
+    }
+    if (GB_SERIALIZE_SHUFFLE (method) &&
+        (esize <= 1 || GB_SERIALIZE_DELTA (method)))
+    { 
+        // no need to shuffle an array of bytes
+        method -= GxB_COMPRESSION_SHUFFLE ;
+    }
+    return (method) ;
+}
@@ -0,0 +1,471 @@
+//------------------------------------------------------------------------------
+// GB_serialize_stream: compress and serialize a GrB_Matrix to a stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A parallel compression method for a GrB_Matrix, which writes its output to
+// a user-provided write_function instead of a single blob in memory.
+
+// The stream starts with the same header as the blob created by GB_serialize,
+// except that the blob_size is GB_BLOB_STREAM (zero), since the size of the
+// stream is not known until it is written.  The header is followed by the
+// type_name (for user-defined types only), and then by each of the arrays Ap,
+// Ah, Ab, Ai, and Ax.  Each array is held as a sequence of nblocks blocks,
+// where each block is its compressed size (an int64_t) followed by the
+// compressed block itself.  An uncompressed array is a single block.
+
+// The blocks of each array are compressed in parallel, in waves of nthreads
+// blocks each.  A single thread writes one wave to the stream while the other
+// threads compress the next wave, so at most 2*nthreads compressed blocks are
+// held in workspace at any one time, each of size GB_STREAM_BLOCKSIZE (plus
+// the compression overhead).  If the bytes of each block are shuffled or
+// delta-encoded before they are compressed, a workspace of nthreads blocks is
+// also used to hold the shuffled or encoded blocks.  Uncompressed arrays are
+// written directly from the matrix, with no workspace at all.
+
+// If mmap_layout is true, the matrix is written in the uncompressed layout
+// used by GxB_Matrix_mmap instead.  The blob_size in the header is
+// GB_BLOB_MMAP, and each non-empty array is written as-is (with no block
+// size), starting at an offset in the stream that is a multiple of
+// GB_MMAP_ALIGN.  Zero bytes are written to pad the space between the arrays.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&T, T_size) ;             \
+    GB_FREE_WORK (&W, W_size) ;             \
+    GB_FREE_WORK (&Wsize, Wsize_size) ;     \
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_nblocks: determine the # of blocks and method for an array
+//------------------------------------------------------------------------------
+
+static int32_t GB_stream_nblocks    // return # of blocks for the array
+(
+    // output:
+    int32_t *method_used,           // method to use for this array
+    // input:
+    int64_t len,                    // size of the array, in bytes
+    size_t esize,                   // size of each entry of the array
+    int32_t method                  // compression method requested
+)
+{
+    method = GB_serialize_array_method (method, esize) ;
+    if (len == 0)
+    {
+        // the array is empty
+        (*method_used) = GxB_COMPRESSION_NONE ;
+        return (0) ;
+    }
+    else if (method <= GxB_COMPRESSION_NONE || len < 256)
+    {
+        // no compression; the array is held as a single block
+        (*method_used) = GxB_COMPRESSION_NONE ;
+        return (1) ;
+    }
+    else
+    {
+        // each compressed block is at most GB_STREAM_BLOCKSIZE bytes
+        (*method_used) = method ;
+        return ((int32_t) GB_ICEIL (len, GB_STREAM_BLOCKSIZE)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_stream_write_array: write a single array to the stream
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_stream_write_array
+(
+    GxB_stream_write_function write_function,
+    void *stream,
+    const GB_void *X,               // array to write, of size len
+    int64_t len,                    // size of X, in bytes
+    int32_t nblocks,                // # of blocks to write
+    int32_t method,                 // compression method for this array
+    int32_t algo,                   // compression algorithm
+    int32_t level,                  // compression level
+    size_t esize,                   // size of each entry of X
+    GB_void *T,                     // workspace for shuffled or encoded blocks
+    size_t tsize,                   // size of each thread's workspace in T
+    GB_void *W,                     // workspace of size 2*nslots*wsize
+    int64_t *Wsize,                 // workspace of size 2*nslots
+    size_t wsize,                   // size of each slot in W
+    int nslots,                     // # of blocks in a wave
+    int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check for quick return
+    //--------------------------------------------------------------------------
+
+    if (nblocks == 0)
+    {
+        // the array is empty
+        return (GrB_SUCCESS) ;
+    }
+
+    if (method <= GxB_COMPRESSION_NONE)
+    {
+        // write the array as a single uncompressed block
+        ASSERT (nblocks == 1) ;
+        if (!write_function (stream, &len, sizeof (int64_t)) ||
+            !write_function (stream, X, (size_t) len))
+        {
+            // the write_function failed
+            return (GrB_INVALID_VALUE) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress and write each wave of blocks
+    //--------------------------------------------------------------------------
+
+    int32_t nwaves = GB_ICEIL (nblocks, nslots) ;
+    bool delta = GB_SERIALIZE_DELTA (method) ;
+    bool shuffle = GB_SERIALIZE_SHUFFLE (method) ;
+    ASSERT (GB_IMPLIES (shuffle || delta, T != NULL)) ;
+    bool ok = true, write_ok = true ;
+
+    for (int32_t wave = 0 ; wave <= nwaves && ok && write_ok ; wave++)
+    {
+        // blocks in this wave are compressed into W [set], where set is 0 or
+        // 1, while blocks from the prior wave are written from W [1-set].
+        int set = wave % 2 ;
+        int32_t first = wave * nslots ;
+        int32_t last  = GB_IMIN (first + nslots, nblocks) ;
+        int32_t prior = first - nslots ;
+
+        #pragma omp parallel num_threads(nthreads)
+        {
+
+            //------------------------------------------------------------------
+            // write the prior wave to the stream, with a single thread
+            //------------------------------------------------------------------
+
+            #pragma omp single nowait
+            {
+                int32_t prior_last = GB_IMIN (first, nblocks) ;
+                for (int32_t blockid = GB_IMAX (prior, 0) ;
+                     blockid < prior_last && write_ok ; blockid++)
+                {
+                    int slot = (1-set) * nslots + (blockid - prior) ;
+                    int64_t s = Wsize [slot] ;
+                    write_ok =
+                        write_function (stream, &s, sizeof (int64_t)) &&
+                        write_function (stream, W + slot * wsize, (size_t) s) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // compress the blocks in the current wave
+            //------------------------------------------------------------------
+
+            int32_t blockid ;
+            #pragma omp for schedule(dynamic) reduction(&&:ok) nowait
+            for (blockid = first ; blockid < last ; blockid++)
+            {
+                // compress X [kstart:kend-1] into its slot in W
+                int64_t kstart, kend ;
+                GB_SERIALIZE_PARTITION (kstart, kend, len, blockid, nblocks,
+                    delta) ;
+                int slot = set * nslots + (blockid - first) ;
+                GB_void *Tt = (shuffle || delta) ?
+                    (T + GB_OPENMP_GET_THREAD_ID * tsize) : NULL ;
+                size_t s = GB_serialize_block (W + slot * wsize, wsize,
+                    X + kstart, kend - kstart, algo, level,
+                    shuffle ? esize : 0, delta, Tt) ;
+                ok = ok && (s > 0) ;
+                Wsize [slot] = (int64_t) s ;
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        // compression failure: this can "never" occur
+        return (GrB_INVALID_OBJECT) ;
+    }
+    if (!write_ok)
+    {
+        // the write_function failed
+        return (GrB_INVALID_VALUE) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mmap_write_array: write a single array to the stream, aligned
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_mmap_write_array
+(
+    GxB_stream_write_function write_function,
+    void *stream,
+    const GB_void *X,               // array to write, of size len
+    int64_t len,                    // size of X, in bytes
+    size_t *offset                  // # of bytes written to the stream so far
+)
+{
+    static const GB_void zeros [GB_MMAP_ALIGN] = { 0 } ;
+    if (len == 0)
+    {
+        // the array is empty; nothing to write
+        return (GrB_SUCCESS) ;
+    }
+    size_t pad = GB_MMAP_ROUND (*offset) - (*offset) ;
+    if ((pad > 0 && !write_function (stream, zeros, pad)) ||
+        !write_function (stream, X, (size_t) len))
+    {
+        // the write_function failed
+        return (GrB_INVALID_VALUE) ;
+    }
+    (*offset) += pad + len ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_stream
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_stream        // serialize a matrix to a stream
+(
+    // input:
+    GxB_stream_write_function write_function,   // writes to the stream
+    void *stream,                   // stream to write to
+    const GrB_Matrix A,             // matrix to serialize
+    int32_t method,                 // method to use
+    bool mmap_layout,               // if true, use the layout for mmap
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (write_function != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for serialize stream", GB0) ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+    GB_void *T = NULL ; size_t T_size = 0 ;
+    int64_t *Wsize = NULL ; size_t Wsize_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // ensure all pending work is finished
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_wait (A, "A to serialize", Context)) ;
+    ASSERT (A->nvec_nonempty >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // parse the method
+    //--------------------------------------------------------------------------
+
+    if (mmap_layout)
+    { 
+        // the layout for mmap is never compressed
+        method = GxB_COMPRESSION_NONE ;
+    }
+    bool intel, delta, shuffle ;
+    int32_t algo, level ;
+    GB_serialize_method (&intel, &delta, &shuffle, &algo, &level, method) ;
+    method = (intel ? GxB_COMPRESSION_INTEL : 0) +
+        (delta ? GxB_COMPRESSION_DELTA : 0) +
+        (shuffle ? GxB_COMPRESSION_SHUFFLE : 0) + (algo) + (level) ;
+    // the values of the matrix (and its bitmap) are never delta-encoded
+    int32_t xmethod = delta ? (method - GxB_COMPRESSION_DELTA) : method ;
+    GBURBLE ("(stream compression: %s%s%s%s%s%s%s:%d) ",
+        intel ? "Intel IPP:" : "", delta ? "delta:" : "",
+        shuffle ? "shuffle:" : "",
+        (algo == GxB_COMPRESSION_NONE ) ? "none" : "",
+        (algo == GxB_COMPRESSION_LZ4  ) ? "LZ4" : "",
+        (algo == GxB_COMPRESSION_LZ4HC) ? "LZ4HC" : "",
+        (algo == GxB_COMPRESSION_ZSTD ) ? "ZSTD" : "", level) ;
+
+    //--------------------------------------------------------------------------
+    // get the content of the matrix
+    //--------------------------------------------------------------------------
+
+    size_t blob_size = mmap_layout ? GB_BLOB_MMAP : GB_BLOB_STREAM ;
+    int32_t version = GxB_IMPLEMENTATION ;
+    int64_t vlen = A->vlen ;
+    int64_t vdim = A->vdim ;
+    int64_t nvec = A->nvec ;
+    int64_t nvals = A->nvals ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    int32_t sparsity = GB_sparsity (A) ;
+    bool iso = A->iso ;
+    float hyper_switch = A->hyper_switch ;
+    float bitmap_switch = A->bitmap_switch ;
+    int32_t sparsity_control = A->sparsity_control ;
+    // the matrix has no pending work
+    ASSERT (A->Pending == NULL) ;
+    ASSERT (A->nzombies == 0) ;
+    ASSERT (!A->jumbled) ;
+    GrB_Type atype = A->type ;
+    size_t typesize = atype->size ;
+    int32_t typecode = (int32_t) (atype->code) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t anz_held = GB_nnz_held (A) ;
+
+    // determine the uncompressed sizes of Ap, Ah, Ab, Ai, and Ax
+    int64_t Ap_len = 0 ;
+    int64_t Ah_len = 0 ;
+    int64_t Ab_len = 0 ;
+    int64_t Ai_len = 0 ;
+    int64_t Ax_len = 0 ;
+    switch (sparsity)
+    {
+        case GxB_HYPERSPARSE :
+            Ah_len = sizeof (GrB_Index) * nvec ;
+        case GxB_SPARSE :
+            Ap_len = sizeof (GrB_Index) * (nvec+1) ;
+            Ai_len = sizeof (GrB_Index) * anz ;
+            Ax_len = typesize * (iso ? 1 : anz) ;
+            break ;
+        case GxB_BITMAP :
+            Ab_len = sizeof (int8_t) * anz_held ;
+        case GxB_FULL :
+            Ax_len = typesize * (iso ? 1 : anz_held) ;
+            break ;
+        default: ;
+    }
+
+    // determine the # of blocks and method for each array
+    int32_t Ap_method, Ah_method, Ab_method, Ai_method, Ax_method ;
+    int32_t Ap_nblocks = GB_stream_nblocks (&Ap_method, Ap_len,
+        sizeof (int64_t), method) ;
+    int32_t Ah_nblocks = GB_stream_nblocks (&Ah_method, Ah_len,
+        sizeof (int64_t), method) ;
+    int32_t Ab_nblocks = GB_stream_nblocks (&Ab_method, Ab_len,
+        sizeof (int8_t), xmethod) ;
+    int32_t Ai_nblocks = GB_stream_nblocks (&Ai_method, Ai_len,
+        sizeof (int64_t), method) ;
+    int32_t Ax_nblocks = GB_stream_nblocks (&Ax_method, Ax_len,
+        typesize, xmethod) ;
+
+    //--------------------------------------------------------------------------
+    // write the header and type_name to the stream
+    //--------------------------------------------------------------------------
+
+    // The header is identical to the blob header, except for blob_size.
+    GB_void blob [GB_BLOB_HEADER_SIZE + GxB_MAX_NAME_LEN] ;
+    size_t s = 0 ;
+    int32_t sparsity_iso_csc = (4 * sparsity) + (iso ? 2 : 0) +
+        (A->is_csc ? 1 : 0) ;
+
+    GB_BLOB_WRITE (blob_size, size_t) ;
+    GB_BLOB_WRITE (typecode, int32_t) ;
+    GB_BLOB_WRITE (version, int32_t) ;
+    GB_BLOB_WRITE (vlen, int64_t) ;
+    GB_BLOB_WRITE (vdim, int64_t) ;
+    GB_BLOB_WRITE (nvec, int64_t) ;
+    GB_BLOB_WRITE (nvec_nonempty, int64_t) ;
+    GB_BLOB_WRITE (nvals, int64_t) ;
+    GB_BLOB_WRITE (typesize, int64_t) ;
+    GB_BLOB_WRITE (Ap_len, int64_t) ;
+    GB_BLOB_WRITE (Ah_len, int64_t) ;
+    GB_BLOB_WRITE (Ab_len, int64_t) ;
+    GB_BLOB_WRITE (Ai_len, int64_t) ;
+    GB_BLOB_WRITE (Ax_len, int64_t) ;
+    GB_BLOB_WRITE (hyper_switch, float) ;
+    GB_BLOB_WRITE (bitmap_switch, float) ;
+    GB_BLOB_WRITE (sparsity_control, int32_t) ;
+    GB_BLOB_WRITE (sparsity_iso_csc, int32_t);
+    GB_BLOB_WRITE (Ap_nblocks, int32_t) ; GB_BLOB_WRITE (Ap_method, int32_t) ;
+    GB_BLOB_WRITE (Ah_nblocks, int32_t) ; GB_BLOB_WRITE (Ah_method, int32_t) ;
+    GB_BLOB_WRITE (Ab_nblocks, int32_t) ; GB_BLOB_WRITE (Ab_method, int32_t) ;
+    GB_BLOB_WRITE (Ai_nblocks, int32_t) ; GB_BLOB_WRITE (Ai_method, int32_t) ;
+    GB_BLOB_WRITE (Ax_nblocks, int32_t) ; GB_BLOB_WRITE (Ax_method, int32_t) ;
+
+    if (typecode == GB_UDT_code)
+    {
+        // only write the type_name for user-defined types
+        memset (blob + s, 0, GxB_MAX_NAME_LEN) ;
+        strncpy ((char *) (blob + s), atype->name, GxB_MAX_NAME_LEN-1) ;
+        s += GxB_MAX_NAME_LEN ;
+    }
+
+    if (!write_function (stream, blob, s))
+    {
+        // the write_function failed
+        return (GrB_INVALID_VALUE) ;
+    }
+    size_t offset = s ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace for two waves of compressed blocks
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nslots = 0, nthreads = 1 ;
+    size_t wsize = 0, tsize = 0 ;
+    if (algo != GxB_COMPRESSION_NONE)
+    {
+        int64_t maxlen = GB_IMAX (Ap_len, Ah_len) ;
+        maxlen = GB_IMAX (maxlen, Ab_len) ;
+        maxlen = GB_IMAX (maxlen, Ai_len) ;
+        maxlen = GB_IMAX (maxlen, Ax_len) ;
+        int64_t maxblocks = GB_ICEIL (maxlen, GB_STREAM_BLOCKSIZE) ;
+        nthreads = GB_nthreads (maxlen, chunk, nthreads_max) ;
+        nslots = (int) GB_IMIN (nthreads, maxblocks) ;
+        nslots = GB_IMAX (nslots, 1) ;
+        tsize = delta ? GB_DELTA_BOUND (GB_STREAM_BLOCKSIZE) :
+            GB_STREAM_BLOCKSIZE ;
+        wsize = GB_serialize_bound (algo, tsize) ;
+        W = GB_MALLOC_WORK (2 * nslots * wsize, GB_void, &W_size) ;
+        Wsize = GB_MALLOC_WORK (2 * nslots, int64_t, &Wsize_size) ;
+        if (shuffle || delta)
+        { 
+            // workspace for each thread to hold a shuffled or encoded block
+            T = GB_MALLOC_WORK (nthreads * tsize, GB_void, &T_size) ;
+        }
+        if (W == NULL || Wsize == NULL || ((shuffle || delta) && T == NULL))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compress and write each array (Ap, Ah, Ab, Ai, and Ax)
+    //--------------------------------------------------------------------------
+
+    #define GB_STREAM_WRITE(X,X_len,X_esize,X_nblocks,X_method)             \
+        info = (mmap_layout) ?                                              \
+            GB_mmap_write_array (write_function, stream,                    \
+                (const GB_void *) X, X_len, &offset) :                      \
+            GB_stream_write_array (write_function, stream,                  \
+                (const GB_void *) X, X_len, X_nblocks, X_method, algo,      \
+                level, X_esize, T, tsize, W, Wsize, wsize, nslots,          \
+                nthreads) ;                                                 \
+        if (info != GrB_SUCCESS)                                            \
+        {                                                                   \
+            GB_FREE_ALL ;                                                   \
+            return (info) ;                                                 \
+        }
+
+    GB_STREAM_WRITE (A->p, Ap_len, sizeof (int64_t), Ap_nblocks, Ap_method) ;
+    GB_STREAM_WRITE (A->h, Ah_len, sizeof (int64_t), Ah_nblocks, Ah_method) ;
+    GB_STREAM_WRITE (A->b, Ab_len, sizeof (int8_t),  Ab_nblocks, Ab_method) ;
+    GB_STREAM_WRITE (A->i, Ai_len, sizeof (int64_t), Ai_nblocks, Ai_method) ;
+    GB_STREAM_WRITE (A->x, Ax_len, typesize,         Ax_nblocks, Ax_method) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
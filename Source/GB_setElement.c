@@ -16,6 +16,10 @@
 // non-blocking, the tuple (i,j,scalar) is appended to a list of pending tuples
 // to C.  GB_wait assembles these pending tuples.
 
+// If C is in concurrent-ingest mode (see GxB_CONCURRENT_INGEST), the tuple is
+// always appended to the list of pending tuples of the calling thread, so that
+// many user threads can call this method on the same matrix at the same time.
+
 // GrB_setElement is the same as GrB_*assign with an implied SECOND accum
 // operator whose ztype, xtype, and ytype are the same as C, with I=i, J=1, a
 // 1-by-1 dense matrix A (where nnz (A) == 1), no mask, mask not complemented,
@@ -74,6 +78,26 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             GB_code_string (scalar_code), ctype->name) ;
     }
 
+    //--------------------------------------------------------------------------
+    // add the tuple to the list of the calling thread, if C is concurrent
+    //--------------------------------------------------------------------------
+
+    if (C->Ingest != NULL)
+    { 
+        // Other user threads may be calling GB_setElement on C at the same
+        // time, so the content of C is not accessed.  The scalar is typecasted
+        // to ctype and added to the list of pending tuples of this thread,
+        // even if C(row,col) is already present.  In that case, GB_wait
+        // turns the entry C(row,col) into a zombie, replaced by the tuple.
+        size_t csize = ctype->size ;
+        GB_void s [GB_VLA(csize)] ;
+        GB_cast_scalar (s, ccode, scalar, scalar_code, csize) ;
+        return (GB_Ingest_add (C, s,
+            C->is_csc ? row : col,      // index i into vector j
+            C->is_csc ? col : row,      // vector index j
+            Context)) ;
+    }
+
     // pending tuples and zombies are expected, and C might be jumbled too
     ASSERT (GB_JUMBLED_OK (C)) ;
     ASSERT (GB_PENDING_OK (C)) ;
@@ -201,10 +225,11 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
         // binary search in C->h for vector j, or O(1)-time lookup if sparse
         //----------------------------------------------------------------------
 
+        // if C->h has a hash index, vector j is found in O(1) time
         int64_t pC_start, pC_end, pright = C->nvec - 1 ;
         pleft = 0 ;
-        found = GB_lookup (C->h != NULL, C->h, C->p, C->vlen, &pleft,
-            pright, j, &pC_start, &pC_end) ;
+        found = GB_hyper_hash_lookup (C->h != NULL, C->h, C->p, C->vlen,
+            GB_hyper_hash_get (C), &pleft, pright, j, &pC_start, &pC_end) ;
 
         //----------------------------------------------------------------------
         // binary search in kth vector for index i
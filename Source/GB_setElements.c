@@ -0,0 +1,459 @@
+//------------------------------------------------------------------------------
+// GB_setElements: set a list of entries, C (I [k], J [k]) = X [k]
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Set the values of n entries, C (I [k], J [k]) = X [k] for k = 0:n-1,
+// typecasting from the type of X to the type of C, as needed.  If C is a
+// GrB_Vector, J is NULL, and C (I [k]) = X [k].  The result is the same as n
+// calls to GrB_*_setElement, in order, so if a tuple appears more than once,
+// the last one takes precedence.
+
+// The values are typecasted to the type of C, and the tuples are sorted by
+// vector (unless already sorted).  Each task then works on a contiguous part
+// of the sorted list.  If C(i,j) is present (or a zombie), it is modified in
+// place, using a monotonic search for each vector and index as in
+// GB_extractElements.  Otherwise, if C is bitmap, the entry is set in the
+// bitmap, or if C is sparse or hypersparse, the tuple is added to the list of
+// pending tuples of C, in parallel.  The pending tuples are assembled by the
+// next GB_wait, as usual.
+
+// Like GB_setElement, the pending tuples from this method can be appended to
+// prior pending tuples, if they have the same type as C and an implicit SECOND
+// operator.  Otherwise, the prior pending tuples are assembled first.
+
+#include "GB_Pending.h"
+#include "GB_sort.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Wi, Wi_size) ;               \
+    GB_FREE_WORK (&Wj, Wj_size) ;               \
+    GB_FREE_WORK (&Wk, Wk_size) ;               \
+    GB_FREE_WORK (&Xwork, Xwork_size) ;         \
+    GB_FREE_WORK (&Pos, Pos_size) ;             \
+    GB_WERK_POP (Task_count, int64_t) ;         \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+}
+
+GrB_Info GB_setElements         // C (I [k], J [k]) = X [k] for k = 0:n-1
+(
+    GrB_Matrix C,               // matrix to modify
+    const GrB_Index *I,         // row indices, of size n
+    const GrB_Index *J,         // column indices, of size n (NULL for vector)
+    const void *X,              // values to set, of size n
+    const GB_Type_code xcode,   // type of X
+    const int64_t n,            // # of entries to set
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Wi = NULL ; size_t Wi_size = 0 ;
+    int64_t *restrict Wj = NULL ; size_t Wj_size = 0 ;
+    int64_t *restrict Wk = NULL ; size_t Wk_size = 0 ;
+    GB_void *restrict Xwork = NULL ; size_t Xwork_size = 0 ;
+    int64_t *restrict Pos = NULL ; size_t Pos_size = 0 ;
+    GB_WERK_DECLARE (Task_count, int64_t) ;
+
+    ASSERT (C != NULL) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+    GB_RETURN_IF_NULL (X) ;
+    GB_RETURN_IF_NULL (I) ;
+    if (n == 0)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+    ASSERT (GB_IMPLIES (J == NULL, C->vdim <= 1)) ;
+
+    // xcode and C must be compatible
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+    if (!GB_code_compatible (xcode, ccode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input values of type [%s]\n"
+            "cannot be typecast to entries of type [%s]",
+            GB_code_string (xcode), ctype->name) ;
+    }
+
+    // assemble any tuples from concurrent setElement, and unjumble C
+    if (GB_INGEST (C) || C->jumbled)
+    {
+        GB_OK (GB_wait (C, "C (setElements)", Context)) ;
+    }
+
+    // pending tuples and zombies are OK, but C is not jumbled
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // check and sort the indices
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_Elements_sort (&Wi, &Wi_size, &Wj, &Wj_size, &Wk, &Wk_size,
+        I, J, n, C, true, Context)) ;
+
+    const GrB_Index *Vi = (C->is_csc || J == NULL) ? I : J ;
+    const GrB_Index *Vj = (J == NULL) ? NULL : ((C->is_csc) ? J : I) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (4 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, n) ;
+
+    //--------------------------------------------------------------------------
+    // typecast the values to the type of C, if needed
+    //--------------------------------------------------------------------------
+
+    const size_t csize = ctype->size ;
+    const GB_void *restrict Xc = (const GB_void *) X ;
+    int64_t k ;
+    if (xcode != ccode)
+    {
+        Xwork = GB_MALLOC_WORK (n * csize, GB_void, &Xwork_size) ;
+        if (Xwork == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        const size_t xsize = GB_code_size (xcode, csize) ;
+        GB_cast_function cast_X_to_C = GB_cast_factory (ccode, xcode) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            cast_X_to_C (Xwork + k * csize, Xc + k * xsize, xsize) ;
+        }
+        Xc = Xwork ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check if C needs to convert to non-iso, or if C is a new iso matrix
+    //--------------------------------------------------------------------------
+
+    bool C_is_full = GB_IS_FULL (C) ;
+    bool C_is_empty = (GB_nnz (C) == 0 && !C_is_full && C->Pending == NULL) ;
+    if (C->iso || C_is_empty)
+    {
+        // compare each value with the iso value of C, or with the first value
+        const GB_void *x0 = C->iso ? ((GB_void *) C->x) : Xc ;
+        bool all_same = true ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(&&:all_same)
+        for (k = 0 ; k < n ; k++)
+        {
+            if (all_same)
+            {
+                all_same = (memcmp (Xc + k * csize, x0, csize) == 0) ;
+            }
+        }
+        if (C->iso && !all_same)
+        {
+            // A new entry differs from the iso value of C.  Assemble all
+            // pending tuples and convert C to non-iso.  Zombies are OK.
+            if (C->Pending != NULL)
+            {
+                GB_OK (GB_wait (C, "C (setElements:to non-iso)", Context)) ;
+            }
+            GB_OK (GB_convert_any_to_non_iso (C, true, Context)) ;
+        }
+        else if (!C->iso && all_same)
+        {
+            // C is empty and all the new entries have the same value
+            GB_void s [GB_VLA(csize)] ;
+            memcpy (s, Xc, csize) ;
+            GB_OK (GB_convert_any_to_iso (C, s, Context)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check for incompatible pending tuples
+    //--------------------------------------------------------------------------
+
+    if (C->Pending != NULL && (C->Pending->type != ctype ||
+        !GB_op_is_second (C->Pending->op, ctype)))
+    {
+        // The prior pending tuples have a different type, or an operator
+        // other than SECOND, so they must be assembled first.
+        GB_OK (GB_wait (C, "C (setElements:incompatible pending tuples)",
+            Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get C
+    //--------------------------------------------------------------------------
+
+    // the vectors of a hypersparse C are found with the hash index of C->h
+    GB_hyper_hash_build (C, Context) ;
+    const GB_Hyper_hash C_hyper_hash = GB_hyper_hash_get (C) ;
+
+    const int64_t *restrict Cp = C->p ;
+    const int64_t *restrict Ch = C->h ;
+    int64_t *restrict Ci = C->i ;
+    int8_t  *restrict Cb = C->b ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t cnvec = C->nvec ;
+    const int64_t nzombies = C->nzombies ;
+    const bool C_iso = C->iso ;
+    const bool C_is_sparse_or_hyper = (Cp != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (Task_count, ntasks + 1, int64_t) ;
+    if (C_is_sparse_or_hyper)
+    {
+        Pos = GB_MALLOC_WORK (n, int64_t, &Pos_size) ;
+    }
+    if (Task_count == NULL || (C_is_sparse_or_hyper && Pos == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 1: modify each entry present in C, and find the new entries
+    //--------------------------------------------------------------------------
+
+    // Pos [t] is the position of C(i,j) if it is a zombie to bring back to
+    // life, -1 if the tuple is done, or -2 if the tuple must be added as a
+    // pending tuple.  The zombies are brought back to life in phase 2, since
+    // other tasks may be searching the same vector in phase 1.
+
+    int64_t nvals_new = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nvals_new)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend, task_count = 0 ;
+        GB_PARTITION (tstart, tend, n, tid, ntasks) ;
+        int64_t jlast = -1, pC_start = 0, pC_end = 0, pleft_h = 0, pstart = 0 ;
+        bool jfound = false ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+
+            //------------------------------------------------------------------
+            // get the tth tuple, which refers to C(i,j)
+            //------------------------------------------------------------------
+
+            int64_t kt = (Wk == NULL) ? t : Wk [t] ;
+            int64_t i = (Wi == NULL) ? Vi [t] : Wi [t] ;
+            int64_t j = (Wj == NULL) ? ((Vj == NULL) ? 0 : Vj [t]) : Wj [t] ;
+
+            //------------------------------------------------------------------
+            // skip the tuple if the next one is a duplicate
+            //------------------------------------------------------------------
+
+            if (t < n-1)
+            {
+                int64_t i2 = (Wi == NULL) ? Vi [t+1] : Wi [t+1] ;
+                int64_t j2 = (Wj == NULL) ? ((Vj == NULL) ? 0 : Vj [t+1]) :
+                    Wj [t+1] ;
+                if (i == i2 && j == j2)
+                {
+                    // the next tuple takes precedence over this one
+                    if (Pos != NULL)
+                    { 
+                        Pos [t] = -1 ;
+                    }
+                    continue ;
+                }
+            }
+
+            const GB_void *xk = Xc + kt * csize ;
+
+            if (C_is_sparse_or_hyper)
+            {
+
+                //--------------------------------------------------------------
+                // find C(i,j) in a sparse or hypersparse C
+                //--------------------------------------------------------------
+
+                if (j != jlast)
+                {
+                    // find vector j, with the hash index of C->h if present;
+                    // otherwise the tuples are sorted, so the search in the
+                    // hyperlist starts where the last one ended
+                    jfound = GB_hyper_hash_lookup (Ch != NULL, Ch, Cp, cvlen,
+                        C_hyper_hash, &pleft_h, cnvec - 1, j,
+                        &pC_start, &pC_end) ;
+                    jlast = j ;
+                    pstart = pC_start ;
+                }
+                bool found = false, is_zombie = false ;
+                int64_t p = pstart ;
+                if (jfound)
+                {
+                    // find index i in vector j, starting where the search for
+                    // the last index in this vector ended
+                    int64_t pright = pC_end - 1 ;
+                    GB_BINARY_SEARCH_ZOMBIE (i, Ci, p, pright, found,
+                        nzombies, is_zombie) ;
+                    pstart = p ;
+                }
+
+                if (found)
+                {
+                    // C(i,j) = X [k], and bring it back to life in phase 2
+                    if (!C_iso) memcpy (Cx + p * csize, xk, csize) ;
+                    Pos [t] = is_zombie ? p : (-1) ;
+                }
+                else
+                {
+                    // C(i,j) must be added as a pending tuple
+                    Pos [t] = -2 ;
+                    task_count++ ;
+                }
+
+            }
+            else
+            {
+
+                //--------------------------------------------------------------
+                // C is bitmap or full
+                //--------------------------------------------------------------
+
+                int64_t p = i + j * cvlen ;
+                if (!C_iso) memcpy (Cx + p * csize, xk, csize) ;
+                if (Cb != NULL && Cb [p] == 0)
+                {
+                    Cb [p] = 1 ;
+                    nvals_new++ ;
+                }
+            }
+        }
+        Task_count [tid] = task_count ;
+    }
+
+    if (Cb != NULL)
+    {
+        C->nvals += nvals_new ;
+    }
+
+    if (!C_is_sparse_or_hyper)
+    {
+        // all entries have been set in the bitmap or full C
+        GB_FREE_WORKSPACE ;
+        ASSERT_MATRIX_OK (C, "C after setElements", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate space for the new pending tuples
+    //--------------------------------------------------------------------------
+
+    GB_cumsum (Task_count, ntasks, NULL, 1, NULL) ;
+    int64_t nnew = Task_count [ntasks] ;
+    int64_t npending_old = 0 ;
+    if (nnew > 0)
+    {
+        if (!GB_Pending_ensure (&(C->Pending), C_iso, ctype, NULL,
+            C->vdim > 1, nnew, Context))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phbix_free (C) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        npending_old = C->Pending->n ;
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 2: bring zombies back to life and add the new pending tuples
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Pending_i = (nnew > 0) ? C->Pending->i : NULL ;
+    int64_t *restrict Pending_j = (nnew > 0) ? C->Pending->j : NULL ;
+    GB_void *restrict Pending_x = (nnew > 0) ? C->Pending->x : NULL ;
+
+    int64_t nrevived = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nrevived)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t tstart, tend ;
+        GB_PARTITION (tstart, tend, n, tid, ntasks) ;
+        int64_t pnew = npending_old + Task_count [tid] ;
+        for (int64_t t = tstart ; t < tend ; t++)
+        {
+            int64_t p = Pos [t] ;
+            if (p == -1) continue ;
+            int64_t i = (Wi == NULL) ? Vi [t] : Wi [t] ;
+            if (p >= 0)
+            {
+                // bring the zombie C(i,j) back to life
+                Ci [p] = i ;
+                nrevived++ ;
+            }
+            else
+            {
+                // add the tuple (i,j,X [k]) to the pending tuples
+                int64_t kt = (Wk == NULL) ? t : Wk [t] ;
+                Pending_i [pnew] = i ;
+                if (Pending_j != NULL)
+                {
+                    Pending_j [pnew] = (Wj == NULL) ? Vj [t] : Wj [t] ;
+                }
+                if (Pending_x != NULL)
+                {
+                    memcpy (Pending_x + pnew * csize, Xc + kt * csize, csize) ;
+                }
+                pnew++ ;
+            }
+        }
+    }
+
+    C->nzombies -= nrevived ;
+
+    if (nnew > 0)
+    {
+        // The new tuples are sorted; the whole list remains sorted if the
+        // prior tuples were sorted, and come before the new ones.
+        GB_Pending Pending = C->Pending ;
+        if (npending_old > 0 && Pending->sorted)
+        {
+            int64_t ilast = Pending_i [npending_old-1] ;
+            int64_t inew  = Pending_i [npending_old] ;
+            int64_t jlast = 0, jnew = 0 ;
+            if (Pending_j != NULL)
+            {
+                jlast = Pending_j [npending_old-1] ;
+                jnew  = Pending_j [npending_old] ;
+            }
+            Pending->sorted = (jlast < jnew) ||
+                (jlast == jnew && ilast <= inew) ;
+        }
+        Pending->n += nnew ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C after setElements", GB0) ;
+    return ((nnew > 0) ? GB_block (C, Context) : GrB_SUCCESS) ;
+}
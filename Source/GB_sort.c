@@ -268,6 +268,11 @@ GrB_Info GB_sort
     { 
         GB_phbix_free (C) ;
     }
+    else
+    { 
+        // the values of C are sorted in-place
+        GB_stamp (C) ;
+    }
 
     //--------------------------------------------------------------------------
     // make a copy of A, unless it is aliased with C
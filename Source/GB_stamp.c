@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// GB_stamp: give a matrix a new modification stamp
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This must be called whenever the pattern, values, or data structure of A
+// are modified.  It is called by GB_WHERE for the output of each user-callable
+// method, by GB_new, GB_ph_free, and GB_bix_free when the content of A is
+// created or freed, by GB_wait, and by each method that modifies A in-place
+// (GB_sort, GB_unjumble, and the GB_convert_* methods, for example).  The
+// output C of GB_mxm, GB_accum_mask, GB_subassigner, GB_apply, GB_ewise, and
+// GB_selector is stamped again when the method finishes, since C may also be
+// one of the inputs of the method, and something may have been cached for it
+// while the method was running.
+
+// A->stamp is given a new value that no other matrix has ever had, so any
+// object computed from A (such as the cached transpose A->AT) is valid only
+// if the stamp of A it was computed from is equal to A->stamp.  The cached
+// transpose and saxpy3 tasks of A are also freed, since they can no longer be
+// used.
+
+#include "GB.h"
+
+void GB_stamp                   // give A a new modification stamp
+(
+    GrB_Matrix A                // matrix that has been modified
+)
+{
+
+    if (A != NULL)
+    { 
+        A->stamp = GB_Global_stamp_next ( ) ;
+        GB_transpose_cache_free (A) ;
+        GB_AxB_saxpy3_cache_free (A) ;
+    }
+}
@@ -660,6 +660,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
     // finalize C and return result
     //--------------------------------------------------------------------------
 
+    GB_stamp (C) ;
     ASSERT_MATRIX_OK (C, "C subassigner result", GB0) ;
     return (GB_block (C, Context)) ;
 }
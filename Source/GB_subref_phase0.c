@@ -136,6 +136,45 @@ static inline void GB_find_Ap_start_end
     Ap_end   [kC] = pA_end ;
 }
 
+//------------------------------------------------------------------------------
+// GB_find_jA
+//------------------------------------------------------------------------------
+
+// Find kA so that Ah [kA] == jA, in the trimmed hyperlist Ah [0..anvec-1],
+// which starts at A->h [ktrim].  The hash index of A->h is used if present, in
+// O(1) time; otherwise, Ah [0..anvec-1] is searched with a binary search.
+
+static inline bool GB_find_jA
+(
+    // input, not modified
+    const int64_t jA,
+    const int64_t *restrict Ah,
+    const int64_t anvec,
+    const GB_Hyper_hash A_hyper_hash,
+    const int64_t ktrim,
+    // output:
+    int64_t *p_kA
+)
+{
+    bool found ;
+    int64_t kA ;
+    if (A_hyper_hash != NULL)
+    { 
+        // O(1) lookup in the hash index of A->h
+        kA = GB_hyper_hash_find (A_hyper_hash, jA) - ktrim ;
+        found = (kA >= 0 && kA < anvec) ;
+    }
+    else
+    { 
+        // binary search of Ah
+        kA = 0 ;
+        int64_t kright = anvec-1 ;
+        GB_BINARY_SEARCH (jA, Ah, kA, kright, found) ;
+    }
+    (*p_kA) = kA ;
+    return (found) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_subref_phase0
 //------------------------------------------------------------------------------
@@ -260,6 +299,8 @@ GrB_Info GB_subref_phase0
     // then Ah and Ap will not be accessed at all, so this can be skipped.
 
     bool A_is_hyper = (Ah != NULL) ;
+    int64_t ktrim = 0 ;             // Ah is A->h + ktrim
+    GB_Hyper_hash A_hyper_hash = NULL ;
 
     if (A_is_hyper && !C_empty)
     {
@@ -274,6 +315,7 @@ GrB_Info GB_subref_phase0
             int64_t kleft = 0 ;
             int64_t kright = anvec-1 ;
             GB_SPLIT_BINARY_SEARCH (jmin, Ah, kleft, kright, found) ;
+            ktrim = kleft ;
             Ah += kleft ;
             Ap += kleft ;
             anvec -= kleft ;
@@ -436,6 +478,11 @@ GrB_Info GB_subref_phase0
 
         GB_GET_NTHREADS_AND_NTASKS (nJ) ;
 
+        // each vector in J is found in Ah in O(1) time with the hash index of
+        // A->h, or with a binary search if the hash index is not present
+        GB_hyper_hash_build (A, Context) ;
+        A_hyper_hash = GB_hyper_hash_get (A) ;
+
         // scan all of J and check each entry if it appears in Ah
         int tid ;
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
@@ -444,13 +491,13 @@ GrB_Info GB_subref_phase0
             int64_t jC_start, jC_end, my_Cnvec = 0 ;
             GB_PARTITION (jC_start, jC_end, nJ, tid, ntasks) ;
             for (int64_t jC = jC_start ; jC < jC_end ; jC++)
-            { 
+            {
                 int64_t jA = GB_ijlist (J, jC, Jkind, Jcolon) ;
-                bool found ;
-                int64_t kA = 0 ;
-                int64_t kright = anvec-1 ;
-                GB_BINARY_SEARCH (jA, Ah, kA, kright, found) ;
-                if (found) my_Cnvec++ ;
+                int64_t kA ;
+                if (GB_find_jA (jA, Ah, anvec, A_hyper_hash, ktrim, &kA))
+                { 
+                    my_Cnvec++ ;
+                }
             }
             Count [tid] = my_Cnvec ;
         }
@@ -619,7 +666,7 @@ GrB_Info GB_subref_phase0
 
         // C and A are both hypersparse.  Ch is constructed by scanning the
         // list J, or the entire jbegin:jinc:jend sequence.  Each vector is
-        // then found in Ah, via binary search.
+        // then found in Ah, via the hash index of A->h or binary search.
 
         int tid ;
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
@@ -631,11 +678,8 @@ GrB_Info GB_subref_phase0
             for (int64_t jC = jC_start ; jC < jC_end ; jC++)
             {
                 int64_t jA = GB_ijlist (J, jC, Jkind, Jcolon) ;
-                bool found ;
-                int64_t kA = 0 ;
-                int64_t kright = anvec-1 ;
-                GB_BINARY_SEARCH (jA, Ah, kA, kright, found) ;
-                if (found)
+                int64_t kA ;
+                if (GB_find_jA (jA, Ah, anvec, A_hyper_hash, ktrim, &kA))
                 { 
                     ASSERT (jA == Ah [kA]) ;
                     Ch [kC] = jC ;
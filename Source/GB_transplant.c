@@ -269,6 +269,10 @@ GrB_Info GB_transplant          // transplant one matrix into another
         C->h = A->h ; C->h_size = A->h_size ;
         C->plen = A->plen ;
         C->nvec = anvec ;
+        // the hash index of A->h, if any, is still valid for C->h
+        GB_hyper_hash_free (C) ;
+        C->hyper_hash = A->hyper_hash ;
+        A->hyper_hash = NULL ;
     }
 
     // A->p and A->h have been freed or removed from A
@@ -569,6 +569,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             { 
                 // transplant A->h as T->i
                 T->i_shallow = A->h_shallow ;
+                GB_hyper_hash_free (A) ;
                 A->h = NULL ;
             }
             else
@@ -736,6 +737,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             { 
                 if (!A->p_shallow) GB_FREE (&A->p, A->p_size) ;
                 if (!A->h_shallow) GB_FREE (&A->h, A->h_size) ;
+                GB_hyper_hash_free (A) ;
             }
 
             GB_void *S_input = NULL ;
@@ -107,5 +107,33 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_transpose_cache_build   // build the cached transpose of A
+(
+    GrB_Matrix A,               // matrix to transpose; only A->AT is modified
+    GB_Context Context
+) ;
+
+// GB_transpose_cache_get: return the cached transpose of A, or NULL if it is
+// not present or A has been modified since it was computed
+static inline GrB_Matrix GB_transpose_cache_get
+(
+    const GrB_Matrix A
+)
+{
+    GrB_Matrix AT = (A == NULL) ? NULL : A->AT ;
+    if (AT == NULL || A->AT_stamp != A->stamp)
+    { 
+        // the transpose is not present, or A has been modified
+        return (NULL) ;
+    }
+    ASSERT (AT->vlen == A->vdim && AT->vdim == A->vlen) ;
+    ASSERT (AT->is_csc == A->is_csc && AT->type == A->type) ;
+    return (AT) ;
+}
+
 #endif
 
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_build: build the cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A->AT = A' is computed, with the same type and the same CSR/CSC format as A.
+// It is used by GB_AxB_push_pull for GrB_mxv and GrB_vxm, so that w=A*u can be
+// computed by either a saxpy or a dot product method, without transposing A
+// each time.  A->AT is valid only while A->AT_stamp is equal to A->stamp,
+// which changes whenever A is modified (see GB_stamp).  Nothing is done if a
+// valid transpose is already present.
+
+// A is not modified except for A->AT and A->AT_stamp.  Two user threads may
+// both use A as a read-only input at the same time, and both may try to build
+// the transpose.  The transpose is thus attached to A with an atomic
+// compare/exchange, and the loser frees its copy.
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&T) ;           \
+}
+
+GrB_Info GB_transpose_cache_build   // build the cached transpose of A
+(
+    GrB_Matrix A,               // matrix to transpose; only A->AT is modified
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+    ASSERT_MATRIX_OK (A, "A to transpose for the cache", GB0) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    if (GB_transpose_cache_get (A) != NULL)
+    { 
+        // the transpose is already present
+        return (GrB_SUCCESS) ;
+    }
+
+    // GB_stamp frees the cached transpose each time A is modified, so no
+    // stale transpose can be present; another thread may attach a valid one
+    const int64_t stamp = A->stamp ;
+
+    //--------------------------------------------------------------------------
+    // T = A', in the same format as A
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(cache A') ") ;
+    GB_OK (GB_new (&T, false,  // auto sparsity, new header
+        A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc,
+        GxB_AUTO_SPARSITY, A->hyper_switch, 0, Context)) ;
+    GB_OK (GB_transpose_cast (T, A->type, A->is_csc, A, false, Context)) ;
+    GB_MATRIX_WAIT (T) ;
+    ASSERT_MATRIX_OK (T, "T=A' for the cache", GB0) ;
+    ASSERT (!T->static_header) ;
+
+    //--------------------------------------------------------------------------
+    // attach the transpose to A, unless another thread has already done so
+    //--------------------------------------------------------------------------
+
+    // All threads that race to attach a transpose have computed it from the
+    // same A, and so they all set A->AT_stamp to the same value.
+    A->AT_stamp = stamp ;
+    int64_t expected = 0 ;
+    int64_t desired = (int64_t) T ;
+    while (!GB_ATOMIC_COMPARE_EXCHANGE_64 ((int64_t *) (&(A->AT)),
+        expected, desired))
+    {
+        GrB_Matrix T_current ;
+        GB_ATOMIC_READ
+        T_current = A->AT ;
+        if (T_current != NULL)
+        { 
+            // another thread has attached its own transpose to A
+            GB_Matrix_free (&T) ;
+            break ;
+        }
+        expected = 0 ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_free: free the cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This is called by GB_stamp whenever A is modified.
+
+#include "GB.h"
+
+void GB_transpose_cache_free    // free the cached transpose of A, if present
+(
+    GrB_Matrix A                // matrix with cached transpose to free
+)
+{
+
+    if (A != NULL && A->AT != NULL)
+    { 
+        GB_Matrix_free (&(A->AT)) ;
+    }
+}
@@ -146,6 +146,7 @@ GrB_Info GB_unjumble        // unjumble a matrix
 
     GB_WERK_POP (A_slice, int64_t) ;
     A->jumbled = false ;        // A has been unjumbled
+    GB_stamp (A) ;
     ASSERT_MATRIX_OK (A, "A unjumbled", GB0) ;
     ASSERT (A->nvec_nonempty >= 0)
     return (GrB_SUCCESS) ;
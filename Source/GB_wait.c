@@ -7,7 +7,7 @@
 
 //------------------------------------------------------------------------------
 
-// CALLS:     GB_builder
+// CALLS:     GB_Ingest_merge, GB_Pending_sort, GB_builder
 
 // This function is typically called via the GB_MATRIX_WAIT(A) macro, except
 // for GB_assign, GB_subassign, and GB_mxm.
@@ -23,7 +23,9 @@
 
 // If A is hypersparse, the time taken is at most O(nnz(A) + t log t), where t
 // is the number of pending tuples in A, and nnz(A) includes both zombies and
-// live entries.  There is no O(m) or O(n) time component, if A is m-by-n.
+// live entries.  The t log t term is reduced to O(t) if the pending tuples
+// are in order within each range of vectors (see GB_Pending_sort).  There is
+// no O(m) or O(n) time component, if A is m-by-n.
 // If the number of non-empty vectors of A grows too large, then A can be
 // converted to non-hypersparse.
 
@@ -69,6 +71,12 @@ GrB_Info GB_wait                // finish all pending computations
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_FLIP (GB0)) ;
 
+    if (GB_INGEST (A))
+    { 
+        // move the tuples from concurrent GrB_setElement into A->Pending
+        GB_OK (GB_Ingest_merge (A, Context)) ;
+    }
+
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
         // full and bitmap matrices never have any pending work
@@ -144,6 +152,17 @@ GrB_Info GB_wait                // finish all pending computations
         return (info) ;
     }
 
+    //--------------------------------------------------------------------------
+    // free the hash index of A->h, since the hyperlist is about to change
+    //--------------------------------------------------------------------------
+
+    GB_hyper_hash_free (A) ;
+
+    // A is about to be modified, so give it a new stamp.  GrB_setElement does
+    // not stamp A in concurrent-ingest mode, so this is also where the tuples
+    // it added are accounted for.
+    GB_stamp (A) ;
+
     //--------------------------------------------------------------------------
     // assemble the pending tuples into T
     //--------------------------------------------------------------------------
@@ -162,6 +181,10 @@ GrB_Info GB_wait                // finish all pending computations
         // z=accum(x,y) operator can have any types, and it does not have to be
         // associative.  T is constructed as iso if A is iso.
 
+        // sort the pending tuples in parallel, in buckets of vectors, so
+        // that GB_builder can skip its own sort
+        GB_OK (GB_Pending_sort (A, Context)) ;
+
         GB_void *S_input = (A_iso) ? ((GB_void *) A->x) : NULL ;
         GrB_Type stype = (A_iso) ? A->type : A->Pending->type ;
 
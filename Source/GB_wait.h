@@ -31,8 +31,13 @@ GrB_Info GB_unjumble        // unjumble a matrix
     GB_Context Context
 ) ;
 
+// true if a matrix has pending tuples from concurrent setElement
+#define GB_INGEST(A) \
+    ((A) != NULL && (A)->Ingest != NULL && (A)->Ingest->nonempty)
+
 // true if a matrix has pending tuples
-#define GB_PENDING(A) ((A) != NULL && (A)->Pending != NULL)
+#define GB_PENDING(A) \
+    ((A) != NULL && ((A)->Pending != NULL || GB_INGEST (A)))
 
 // true if a matrix is allowed to have pending tuples
 #define GB_PENDING_OK(A) (GB_PENDING (A) || !GB_PENDING (A))
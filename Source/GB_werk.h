@@ -26,7 +26,8 @@
 //------------------------------------------------------------------------------
 
 // The werkspace is allocated from the Werk static if it small enough and space
-// is available.  Otherwise it is allocated by malloc.
+// is available.  Otherwise it is allocated from the arena in the Context, if
+// present, or by malloc (see GB_malloc_work).
 
 static inline void *GB_werk_push    // return pointer to newly allocated space
 (
@@ -86,8 +87,9 @@ static inline void *GB_werk_push    // return pointer to newly allocated space
     }
     else
     { 
-        // allocate the werkspace from malloc
-        return (GB_malloc_memory (nitems, size_of_item, size_allocated)) ;
+        // allocate the werkspace from the arena or malloc
+        return (GB_malloc_work (nitems, size_of_item, size_allocated,
+            Context)) ;
     }
 }
 
@@ -153,8 +155,8 @@ static inline void *GB_werk_pop     // free the top block of werkspace memory
     }
     else
     { 
-        // werkspace was allocated from malloc
-        GB_dealloc_memory (&p, *size_allocated) ;
+        // werkspace was allocated from the arena or malloc
+        GB_free_work (&p, *size_allocated, Context) ;
     }
     return (NULL) ;                 // return NULL to indicate p was freed
 }
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// GB_zstd: wrapper for the ZSTD compression library
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_zstd is a wrapper for the ZSTD compression library.  The ZSTD library is
+// compiled with ZSTD_DEPS_MALLOC defined, and configured to use the
+// SuiteSparse:GraphBLAS functions in place of malloc/calloc/free.  It is
+// compiled without multithreading (each block is compressed by a single
+// thread, and GraphBLAS compresses many blocks in parallel), and without the
+// x86-64 assembly version of the Huffman decoder.
+
+#include "GB.h"
+#include "GB_serialize.h"
+#include "GB_zstd.h"
+
+void *GB_zstd_malloc (size_t s)
+{
+    return (GB_Global_malloc_function (s)) ;
+}
+
+void *GB_zstd_calloc (size_t n, size_t s)
+{
+    // ns = n*s, the size of the space to allocate
+    size_t ns = 0 ;
+    bool ok = GB_size_t_multiply (&ns, n, s) ;
+    if (!ok) return (NULL) ;
+    // malloc the space and then use memset to clear it
+    void *p = GB_Global_malloc_function (ns) ;
+    if (p != NULL) memset (p, 0, ns) ;
+    return (p) ;
+}
+
+void GB_zstd_free (void *p)
+{
+    GB_Global_free_function (p) ;
+}
+
+// ZSTD uses switch statements with no default case.
+#pragma GCC diagnostic ignored "-Wswitch-default"
+
+// Include the unmodified zstd, version 1.5.7, for the compression and
+// decompression methods only.  This allows the ZSTD_* functions to be renamed
+// via GB_zstd.h, and avoids any conflict with the original -lzstd, which might
+// be linked in by the user application.
+
+// None of the ZSTD functions are exported from the GraphBLAS library.
+#if defined ( __GNUC__ ) && !defined ( _WIN32 )
+#pragma GCC visibility push(hidden)
+#endif
+
+#include "zstd_subset/common/debug.c"
+#include "zstd_subset/common/entropy_common.c"
+#include "zstd_subset/common/error_private.c"
+#include "zstd_subset/common/fse_decompress.c"
+#include "zstd_subset/common/pool.c"
+#include "zstd_subset/common/threading.c"
+#include "zstd_subset/common/xxhash.c"
+#include "zstd_subset/common/zstd_common.c"
+
+#include "zstd_subset/compress/fse_compress.c"
+#include "zstd_subset/compress/hist.c"
+#include "zstd_subset/compress/huf_compress.c"
+#include "zstd_subset/compress/zstd_compress.c"
+#include "zstd_subset/compress/zstd_compress_literals.c"
+#include "zstd_subset/compress/zstd_compress_sequences.c"
+#include "zstd_subset/compress/zstd_compress_superblock.c"
+#include "zstd_subset/compress/zstd_double_fast.c"
+#include "zstd_subset/compress/zstd_fast.c"
+#include "zstd_subset/compress/zstd_lazy.c"
+#include "zstd_subset/compress/zstd_ldm.c"
+#include "zstd_subset/compress/zstd_opt.c"
+#include "zstd_subset/compress/zstd_preSplit.c"
+#include "zstd_subset/compress/zstdmt_compress.c"
+
+#include "zstd_subset/decompress/huf_decompress.c"
+#include "zstd_subset/decompress/zstd_ddict.c"
+#include "zstd_subset/decompress/zstd_decompress.c"
+#include "zstd_subset/decompress/zstd_decompress_block.c"
+
+#if defined ( __GNUC__ ) && !defined ( _WIN32 )
+#pragma GCC visibility pop
+#endif
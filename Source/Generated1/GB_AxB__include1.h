@@ -26,7 +26,8 @@ GrB_Info GB (_Adot3B__any_pair_iso)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
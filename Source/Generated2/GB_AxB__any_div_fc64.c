@@ -292,6 +292,14 @@
 #define GB_DISABLE \
     (GxB_NO_ANY || GxB_NO_DIV || GxB_NO_FC64 || GxB_NO_ANY_FC64 || GxB_NO_DIV_FC64 || GxB_NO_ANY_DIV_FC64)
 
+//------------------------------------------------------------------------------
+// C=A'*B and C+=A'*B with AVX2 or AVX512F, when A and B are full
+//------------------------------------------------------------------------------
+
+#if GB_SEMIRING_HAS_AVX_IMPLEMENTATION && !GB_DISABLE
+#include "GB_AxB_dot_full_avx.c"
+#endif
+
 //------------------------------------------------------------------------------
 // GB_Adot2B: C=A'*B, C<M>=A'*B, or C<!M>=A'*B: dot product method, C is bitmap
 //------------------------------------------------------------------------------
@@ -328,7 +336,8 @@ GrB_Info GB (_Adot3B__any_div_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 )
 { 
     #if GB_DISABLE
@@ -26,7 +26,8 @@ GrB_Info GB (_Adot3B__plus_pair_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -144,7 +145,8 @@ GrB_Info GB (_Adot3B__plus_pair_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -262,7 +264,8 @@ GrB_Info GB (_Adot3B__plus_pair_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -380,7 +383,8 @@ GrB_Info GB (_Adot3B__plus_pair_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -498,7 +502,8 @@ GrB_Info GB (_Adot3B__plus_pair_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -616,7 +621,8 @@ GrB_Info GB (_Adot3B__plus_pair_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -734,7 +740,8 @@ GrB_Info GB (_Adot3B__plus_pair_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -852,7 +859,8 @@ GrB_Info GB (_Adot3B__plus_pair_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -970,7 +978,8 @@ GrB_Info GB (_Adot3B__plus_pair_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1088,7 +1097,8 @@ GrB_Info GB (_Adot3B__plus_pair_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1206,7 +1216,8 @@ GrB_Info GB (_Adot3B__plus_pair_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1324,7 +1335,8 @@ GrB_Info GB (_Adot3B__plus_pair_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1442,7 +1454,8 @@ GrB_Info GB (_Adot3B__lxor_pair_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1560,7 +1573,8 @@ GrB_Info GB (_Adot3B__min_times_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1678,7 +1692,8 @@ GrB_Info GB (_Adot3B__min_times_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1796,7 +1811,8 @@ GrB_Info GB (_Adot3B__min_times_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -1914,7 +1930,8 @@ GrB_Info GB (_Adot3B__min_times_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2032,7 +2049,8 @@ GrB_Info GB (_Adot3B__min_times_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2150,7 +2168,8 @@ GrB_Info GB (_Adot3B__min_times_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2268,7 +2287,8 @@ GrB_Info GB (_Adot3B__min_times_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2386,7 +2406,8 @@ GrB_Info GB (_Adot3B__min_times_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2504,7 +2525,8 @@ GrB_Info GB (_Adot3B__min_times_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2622,7 +2644,8 @@ GrB_Info GB (_Adot3B__min_times_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2740,7 +2763,8 @@ GrB_Info GB (_Adot3B__max_times_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2858,7 +2882,8 @@ GrB_Info GB (_Adot3B__max_times_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -2976,7 +3001,8 @@ GrB_Info GB (_Adot3B__max_times_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3094,7 +3120,8 @@ GrB_Info GB (_Adot3B__max_times_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3212,7 +3239,8 @@ GrB_Info GB (_Adot3B__max_times_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3330,7 +3358,8 @@ GrB_Info GB (_Adot3B__max_times_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3448,7 +3477,8 @@ GrB_Info GB (_Adot3B__max_times_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3566,7 +3596,8 @@ GrB_Info GB (_Adot3B__max_times_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3684,7 +3715,8 @@ GrB_Info GB (_Adot3B__max_times_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3802,7 +3834,8 @@ GrB_Info GB (_Adot3B__max_times_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -3920,7 +3953,8 @@ GrB_Info GB (_Adot3B__any_times_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4038,7 +4072,8 @@ GrB_Info GB (_Adot3B__any_times_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4156,7 +4191,8 @@ GrB_Info GB (_Adot3B__any_times_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4274,7 +4310,8 @@ GrB_Info GB (_Adot3B__any_times_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4392,7 +4429,8 @@ GrB_Info GB (_Adot3B__any_times_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4510,7 +4548,8 @@ GrB_Info GB (_Adot3B__any_times_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4628,7 +4667,8 @@ GrB_Info GB (_Adot3B__any_times_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4746,7 +4786,8 @@ GrB_Info GB (_Adot3B__any_times_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4864,7 +4905,8 @@ GrB_Info GB (_Adot3B__any_times_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -4982,7 +5024,8 @@ GrB_Info GB (_Adot3B__any_times_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -5100,7 +5143,8 @@ GrB_Info GB (_Adot3B__any_times_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -5218,7 +5262,8 @@ GrB_Info GB (_Adot3B__any_times_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -5336,7 +5381,8 @@ GrB_Info GB (_Adot3B__plus_times_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -5454,7 +5500,8 @@ GrB_Info GB (_Adot3B__plus_times_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -5572,7 +5619,8 @@ GrB_Info GB (_Adot3B__plus_times_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -5690,7 +5738,8 @@ GrB_Info GB (_Adot3B__plus_times_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -5808,7 +5857,8 @@ GrB_Info GB (_Adot3B__plus_times_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -5926,7 +5976,8 @@ GrB_Info GB (_Adot3B__plus_times_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6044,7 +6095,8 @@ GrB_Info GB (_Adot3B__plus_times_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6162,7 +6214,8 @@ GrB_Info GB (_Adot3B__plus_times_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6280,7 +6333,8 @@ GrB_Info GB (_Adot3B__plus_times_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6398,7 +6452,8 @@ GrB_Info GB (_Adot3B__plus_times_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6516,7 +6571,8 @@ GrB_Info GB (_Adot3B__plus_times_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6634,7 +6690,8 @@ GrB_Info GB (_Adot3B__plus_times_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6752,7 +6809,8 @@ GrB_Info GB (_Adot3B__times_times_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6870,7 +6928,8 @@ GrB_Info GB (_Adot3B__times_times_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -6988,7 +7047,8 @@ GrB_Info GB (_Adot3B__times_times_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7106,7 +7166,8 @@ GrB_Info GB (_Adot3B__times_times_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7224,7 +7285,8 @@ GrB_Info GB (_Adot3B__times_times_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7342,7 +7404,8 @@ GrB_Info GB (_Adot3B__times_times_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7460,7 +7523,8 @@ GrB_Info GB (_Adot3B__times_times_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7578,7 +7642,8 @@ GrB_Info GB (_Adot3B__times_times_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7696,7 +7761,8 @@ GrB_Info GB (_Adot3B__times_times_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7814,7 +7880,8 @@ GrB_Info GB (_Adot3B__times_times_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -7932,7 +7999,8 @@ GrB_Info GB (_Adot3B__times_times_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8050,7 +8118,8 @@ GrB_Info GB (_Adot3B__times_times_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8168,7 +8237,8 @@ GrB_Info GB (_Adot3B__min_first_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8286,7 +8356,8 @@ GrB_Info GB (_Adot3B__min_first_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8404,7 +8475,8 @@ GrB_Info GB (_Adot3B__min_first_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8522,7 +8594,8 @@ GrB_Info GB (_Adot3B__min_first_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8640,7 +8713,8 @@ GrB_Info GB (_Adot3B__min_first_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8758,7 +8832,8 @@ GrB_Info GB (_Adot3B__min_first_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8876,7 +8951,8 @@ GrB_Info GB (_Adot3B__min_first_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -8994,7 +9070,8 @@ GrB_Info GB (_Adot3B__min_first_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9112,7 +9189,8 @@ GrB_Info GB (_Adot3B__min_first_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9230,7 +9308,8 @@ GrB_Info GB (_Adot3B__min_first_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9348,7 +9427,8 @@ GrB_Info GB (_Adot3B__max_first_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9466,7 +9546,8 @@ GrB_Info GB (_Adot3B__max_first_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9584,7 +9665,8 @@ GrB_Info GB (_Adot3B__max_first_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9702,7 +9784,8 @@ GrB_Info GB (_Adot3B__max_first_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9820,7 +9903,8 @@ GrB_Info GB (_Adot3B__max_first_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -9938,7 +10022,8 @@ GrB_Info GB (_Adot3B__max_first_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -10056,7 +10141,8 @@ GrB_Info GB (_Adot3B__max_first_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -10174,7 +10260,8 @@ GrB_Info GB (_Adot3B__max_first_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -10292,7 +10379,8 @@ GrB_Info GB (_Adot3B__max_first_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -10410,7 +10498,8 @@ GrB_Info GB (_Adot3B__max_first_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -10528,7 +10617,8 @@ GrB_Info GB (_Adot3B__any_first_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -10646,7 +10736,8 @@ GrB_Info GB (_Adot3B__any_first_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -10764,7 +10855,8 @@ GrB_Info GB (_Adot3B__any_first_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -10882,7 +10974,8 @@ GrB_Info GB (_Adot3B__any_first_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11000,7 +11093,8 @@ GrB_Info GB (_Adot3B__any_first_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11118,7 +11212,8 @@ GrB_Info GB (_Adot3B__any_first_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11236,7 +11331,8 @@ GrB_Info GB (_Adot3B__any_first_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11354,7 +11450,8 @@ GrB_Info GB (_Adot3B__any_first_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11472,7 +11569,8 @@ GrB_Info GB (_Adot3B__any_first_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11590,7 +11688,8 @@ GrB_Info GB (_Adot3B__any_first_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11708,7 +11807,8 @@ GrB_Info GB (_Adot3B__any_first_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11826,7 +11926,8 @@ GrB_Info GB (_Adot3B__any_first_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -11944,7 +12045,8 @@ GrB_Info GB (_Adot3B__plus_first_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12062,7 +12164,8 @@ GrB_Info GB (_Adot3B__plus_first_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12180,7 +12283,8 @@ GrB_Info GB (_Adot3B__plus_first_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12298,7 +12402,8 @@ GrB_Info GB (_Adot3B__plus_first_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12416,7 +12521,8 @@ GrB_Info GB (_Adot3B__plus_first_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12534,7 +12640,8 @@ GrB_Info GB (_Adot3B__plus_first_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12652,7 +12759,8 @@ GrB_Info GB (_Adot3B__plus_first_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12770,7 +12878,8 @@ GrB_Info GB (_Adot3B__plus_first_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -12888,7 +12997,8 @@ GrB_Info GB (_Adot3B__plus_first_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13006,7 +13116,8 @@ GrB_Info GB (_Adot3B__plus_first_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13124,7 +13235,8 @@ GrB_Info GB (_Adot3B__plus_first_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13242,7 +13354,8 @@ GrB_Info GB (_Adot3B__plus_first_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13360,7 +13473,8 @@ GrB_Info GB (_Adot3B__times_first_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13478,7 +13592,8 @@ GrB_Info GB (_Adot3B__times_first_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13596,7 +13711,8 @@ GrB_Info GB (_Adot3B__times_first_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13714,7 +13830,8 @@ GrB_Info GB (_Adot3B__times_first_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13832,7 +13949,8 @@ GrB_Info GB (_Adot3B__times_first_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -13950,7 +14068,8 @@ GrB_Info GB (_Adot3B__times_first_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14068,7 +14187,8 @@ GrB_Info GB (_Adot3B__times_first_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14186,7 +14306,8 @@ GrB_Info GB (_Adot3B__times_first_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14304,7 +14425,8 @@ GrB_Info GB (_Adot3B__times_first_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14422,7 +14544,8 @@ GrB_Info GB (_Adot3B__times_first_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14540,7 +14663,8 @@ GrB_Info GB (_Adot3B__times_first_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14658,7 +14782,8 @@ GrB_Info GB (_Adot3B__times_first_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14776,7 +14901,8 @@ GrB_Info GB (_Adot3B__lor_first_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -14894,7 +15020,8 @@ GrB_Info GB (_Adot3B__land_first_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15012,7 +15139,8 @@ GrB_Info GB (_Adot3B__lxor_first_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15130,7 +15258,8 @@ GrB_Info GB (_Adot3B__any_first_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -15248,7 +15377,8 @@ GrB_Info GB (_Adot3B__eq_first_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15366,7 +15496,8 @@ GrB_Info GB (_Adot3B__min_second_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15484,7 +15615,8 @@ GrB_Info GB (_Adot3B__min_second_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15602,7 +15734,8 @@ GrB_Info GB (_Adot3B__min_second_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15720,7 +15853,8 @@ GrB_Info GB (_Adot3B__min_second_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15838,7 +15972,8 @@ GrB_Info GB (_Adot3B__min_second_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -15956,7 +16091,8 @@ GrB_Info GB (_Adot3B__min_second_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16074,7 +16210,8 @@ GrB_Info GB (_Adot3B__min_second_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16192,7 +16329,8 @@ GrB_Info GB (_Adot3B__min_second_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16310,7 +16448,8 @@ GrB_Info GB (_Adot3B__min_second_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16428,7 +16567,8 @@ GrB_Info GB (_Adot3B__min_second_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16546,7 +16686,8 @@ GrB_Info GB (_Adot3B__max_second_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16664,7 +16805,8 @@ GrB_Info GB (_Adot3B__max_second_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16782,7 +16924,8 @@ GrB_Info GB (_Adot3B__max_second_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -16900,7 +17043,8 @@ GrB_Info GB (_Adot3B__max_second_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17018,7 +17162,8 @@ GrB_Info GB (_Adot3B__max_second_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17136,7 +17281,8 @@ GrB_Info GB (_Adot3B__max_second_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17254,7 +17400,8 @@ GrB_Info GB (_Adot3B__max_second_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17372,7 +17519,8 @@ GrB_Info GB (_Adot3B__max_second_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17490,7 +17638,8 @@ GrB_Info GB (_Adot3B__max_second_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17608,7 +17757,8 @@ GrB_Info GB (_Adot3B__max_second_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -17726,7 +17876,8 @@ GrB_Info GB (_Adot3B__any_second_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -17844,7 +17995,8 @@ GrB_Info GB (_Adot3B__any_second_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -17962,7 +18114,8 @@ GrB_Info GB (_Adot3B__any_second_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18080,7 +18233,8 @@ GrB_Info GB (_Adot3B__any_second_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18198,7 +18352,8 @@ GrB_Info GB (_Adot3B__any_second_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18316,7 +18471,8 @@ GrB_Info GB (_Adot3B__any_second_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18434,7 +18590,8 @@ GrB_Info GB (_Adot3B__any_second_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18552,7 +18709,8 @@ GrB_Info GB (_Adot3B__any_second_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18670,7 +18828,8 @@ GrB_Info GB (_Adot3B__any_second_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18788,7 +18947,8 @@ GrB_Info GB (_Adot3B__any_second_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -18906,7 +19066,8 @@ GrB_Info GB (_Adot3B__any_second_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -19024,7 +19185,8 @@ GrB_Info GB (_Adot3B__any_second_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -19142,7 +19304,8 @@ GrB_Info GB (_Adot3B__plus_second_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19260,7 +19423,8 @@ GrB_Info GB (_Adot3B__plus_second_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19378,7 +19542,8 @@ GrB_Info GB (_Adot3B__plus_second_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19496,7 +19661,8 @@ GrB_Info GB (_Adot3B__plus_second_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19614,7 +19780,8 @@ GrB_Info GB (_Adot3B__plus_second_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19732,7 +19899,8 @@ GrB_Info GB (_Adot3B__plus_second_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19850,7 +20018,8 @@ GrB_Info GB (_Adot3B__plus_second_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -19968,7 +20137,8 @@ GrB_Info GB (_Adot3B__plus_second_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20086,7 +20256,8 @@ GrB_Info GB (_Adot3B__plus_second_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20204,7 +20375,8 @@ GrB_Info GB (_Adot3B__plus_second_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20322,7 +20494,8 @@ GrB_Info GB (_Adot3B__plus_second_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20440,7 +20613,8 @@ GrB_Info GB (_Adot3B__plus_second_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20558,7 +20732,8 @@ GrB_Info GB (_Adot3B__times_second_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20676,7 +20851,8 @@ GrB_Info GB (_Adot3B__times_second_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20794,7 +20970,8 @@ GrB_Info GB (_Adot3B__times_second_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -20912,7 +21089,8 @@ GrB_Info GB (_Adot3B__times_second_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21030,7 +21208,8 @@ GrB_Info GB (_Adot3B__times_second_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21148,7 +21327,8 @@ GrB_Info GB (_Adot3B__times_second_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21266,7 +21446,8 @@ GrB_Info GB (_Adot3B__times_second_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21384,7 +21565,8 @@ GrB_Info GB (_Adot3B__times_second_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21502,7 +21684,8 @@ GrB_Info GB (_Adot3B__times_second_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21620,7 +21803,8 @@ GrB_Info GB (_Adot3B__times_second_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21738,7 +21922,8 @@ GrB_Info GB (_Adot3B__times_second_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21856,7 +22041,8 @@ GrB_Info GB (_Adot3B__times_second_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -21974,7 +22160,8 @@ GrB_Info GB (_Adot3B__lor_second_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22092,7 +22279,8 @@ GrB_Info GB (_Adot3B__land_second_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22210,7 +22398,8 @@ GrB_Info GB (_Adot3B__lxor_second_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22328,7 +22517,8 @@ GrB_Info GB (_Adot3B__any_second_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -22446,7 +22636,8 @@ GrB_Info GB (_Adot3B__eq_second_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22564,7 +22755,8 @@ GrB_Info GB (_Adot3B__min_min_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22682,7 +22874,8 @@ GrB_Info GB (_Adot3B__min_min_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22800,7 +22993,8 @@ GrB_Info GB (_Adot3B__min_min_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -22918,7 +23112,8 @@ GrB_Info GB (_Adot3B__min_min_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23036,7 +23231,8 @@ GrB_Info GB (_Adot3B__min_min_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23154,7 +23350,8 @@ GrB_Info GB (_Adot3B__min_min_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23272,7 +23469,8 @@ GrB_Info GB (_Adot3B__min_min_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23390,7 +23588,8 @@ GrB_Info GB (_Adot3B__min_min_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23508,7 +23707,8 @@ GrB_Info GB (_Adot3B__min_min_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23626,7 +23826,8 @@ GrB_Info GB (_Adot3B__min_min_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23744,7 +23945,8 @@ GrB_Info GB (_Adot3B__max_min_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23862,7 +24064,8 @@ GrB_Info GB (_Adot3B__max_min_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -23980,7 +24183,8 @@ GrB_Info GB (_Adot3B__max_min_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24098,7 +24302,8 @@ GrB_Info GB (_Adot3B__max_min_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24216,7 +24421,8 @@ GrB_Info GB (_Adot3B__max_min_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24334,7 +24540,8 @@ GrB_Info GB (_Adot3B__max_min_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24452,7 +24659,8 @@ GrB_Info GB (_Adot3B__max_min_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24570,7 +24778,8 @@ GrB_Info GB (_Adot3B__max_min_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24688,7 +24897,8 @@ GrB_Info GB (_Adot3B__max_min_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24806,7 +25016,8 @@ GrB_Info GB (_Adot3B__max_min_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -24924,7 +25135,8 @@ GrB_Info GB (_Adot3B__any_min_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25042,7 +25254,8 @@ GrB_Info GB (_Adot3B__any_min_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25160,7 +25373,8 @@ GrB_Info GB (_Adot3B__any_min_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25278,7 +25492,8 @@ GrB_Info GB (_Adot3B__any_min_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25396,7 +25611,8 @@ GrB_Info GB (_Adot3B__any_min_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25514,7 +25730,8 @@ GrB_Info GB (_Adot3B__any_min_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25632,7 +25849,8 @@ GrB_Info GB (_Adot3B__any_min_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25750,7 +25968,8 @@ GrB_Info GB (_Adot3B__any_min_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25868,7 +26087,8 @@ GrB_Info GB (_Adot3B__any_min_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -25986,7 +26206,8 @@ GrB_Info GB (_Adot3B__any_min_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -26104,7 +26325,8 @@ GrB_Info GB (_Adot3B__plus_min_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26222,7 +26444,8 @@ GrB_Info GB (_Adot3B__plus_min_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26340,7 +26563,8 @@ GrB_Info GB (_Adot3B__plus_min_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26458,7 +26682,8 @@ GrB_Info GB (_Adot3B__plus_min_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26576,7 +26801,8 @@ GrB_Info GB (_Adot3B__plus_min_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26694,7 +26920,8 @@ GrB_Info GB (_Adot3B__plus_min_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26812,7 +27039,8 @@ GrB_Info GB (_Adot3B__plus_min_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -26930,7 +27158,8 @@ GrB_Info GB (_Adot3B__plus_min_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27048,7 +27277,8 @@ GrB_Info GB (_Adot3B__plus_min_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27166,7 +27396,8 @@ GrB_Info GB (_Adot3B__plus_min_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27284,7 +27515,8 @@ GrB_Info GB (_Adot3B__times_min_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27402,7 +27634,8 @@ GrB_Info GB (_Adot3B__times_min_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27520,7 +27753,8 @@ GrB_Info GB (_Adot3B__times_min_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27638,7 +27872,8 @@ GrB_Info GB (_Adot3B__times_min_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27756,7 +27991,8 @@ GrB_Info GB (_Adot3B__times_min_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27874,7 +28110,8 @@ GrB_Info GB (_Adot3B__times_min_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -27992,7 +28229,8 @@ GrB_Info GB (_Adot3B__times_min_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28110,7 +28348,8 @@ GrB_Info GB (_Adot3B__times_min_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28228,7 +28467,8 @@ GrB_Info GB (_Adot3B__times_min_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28346,7 +28586,8 @@ GrB_Info GB (_Adot3B__times_min_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28464,7 +28705,8 @@ GrB_Info GB (_Adot3B__min_max_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28582,7 +28824,8 @@ GrB_Info GB (_Adot3B__min_max_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28700,7 +28943,8 @@ GrB_Info GB (_Adot3B__min_max_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28818,7 +29062,8 @@ GrB_Info GB (_Adot3B__min_max_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -28936,7 +29181,8 @@ GrB_Info GB (_Adot3B__min_max_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29054,7 +29300,8 @@ GrB_Info GB (_Adot3B__min_max_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29172,7 +29419,8 @@ GrB_Info GB (_Adot3B__min_max_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29290,7 +29538,8 @@ GrB_Info GB (_Adot3B__min_max_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29408,7 +29657,8 @@ GrB_Info GB (_Adot3B__min_max_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29526,7 +29776,8 @@ GrB_Info GB (_Adot3B__min_max_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29644,7 +29895,8 @@ GrB_Info GB (_Adot3B__max_max_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29762,7 +30014,8 @@ GrB_Info GB (_Adot3B__max_max_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29880,7 +30133,8 @@ GrB_Info GB (_Adot3B__max_max_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -29998,7 +30252,8 @@ GrB_Info GB (_Adot3B__max_max_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30116,7 +30371,8 @@ GrB_Info GB (_Adot3B__max_max_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30234,7 +30490,8 @@ GrB_Info GB (_Adot3B__max_max_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30352,7 +30609,8 @@ GrB_Info GB (_Adot3B__max_max_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30470,7 +30728,8 @@ GrB_Info GB (_Adot3B__max_max_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30588,7 +30847,8 @@ GrB_Info GB (_Adot3B__max_max_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30706,7 +30966,8 @@ GrB_Info GB (_Adot3B__max_max_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -30824,7 +31085,8 @@ GrB_Info GB (_Adot3B__any_max_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -30942,7 +31204,8 @@ GrB_Info GB (_Adot3B__any_max_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31060,7 +31323,8 @@ GrB_Info GB (_Adot3B__any_max_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31178,7 +31442,8 @@ GrB_Info GB (_Adot3B__any_max_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31296,7 +31561,8 @@ GrB_Info GB (_Adot3B__any_max_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31414,7 +31680,8 @@ GrB_Info GB (_Adot3B__any_max_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31532,7 +31799,8 @@ GrB_Info GB (_Adot3B__any_max_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31650,7 +31918,8 @@ GrB_Info GB (_Adot3B__any_max_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31768,7 +32037,8 @@ GrB_Info GB (_Adot3B__any_max_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -31886,7 +32156,8 @@ GrB_Info GB (_Adot3B__any_max_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -32004,7 +32275,8 @@ GrB_Info GB (_Adot3B__plus_max_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32122,7 +32394,8 @@ GrB_Info GB (_Adot3B__plus_max_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32240,7 +32513,8 @@ GrB_Info GB (_Adot3B__plus_max_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32358,7 +32632,8 @@ GrB_Info GB (_Adot3B__plus_max_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32476,7 +32751,8 @@ GrB_Info GB (_Adot3B__plus_max_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32594,7 +32870,8 @@ GrB_Info GB (_Adot3B__plus_max_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32712,7 +32989,8 @@ GrB_Info GB (_Adot3B__plus_max_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32830,7 +33108,8 @@ GrB_Info GB (_Adot3B__plus_max_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -32948,7 +33227,8 @@ GrB_Info GB (_Adot3B__plus_max_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33066,7 +33346,8 @@ GrB_Info GB (_Adot3B__plus_max_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33184,7 +33465,8 @@ GrB_Info GB (_Adot3B__times_max_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33302,7 +33584,8 @@ GrB_Info GB (_Adot3B__times_max_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33420,7 +33703,8 @@ GrB_Info GB (_Adot3B__times_max_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33538,7 +33822,8 @@ GrB_Info GB (_Adot3B__times_max_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33656,7 +33941,8 @@ GrB_Info GB (_Adot3B__times_max_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33774,7 +34060,8 @@ GrB_Info GB (_Adot3B__times_max_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -33892,7 +34179,8 @@ GrB_Info GB (_Adot3B__times_max_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34010,7 +34298,8 @@ GrB_Info GB (_Adot3B__times_max_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34128,7 +34417,8 @@ GrB_Info GB (_Adot3B__times_max_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34246,7 +34536,8 @@ GrB_Info GB (_Adot3B__times_max_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34364,7 +34655,8 @@ GrB_Info GB (_Adot3B__min_plus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34482,7 +34774,8 @@ GrB_Info GB (_Adot3B__min_plus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34600,7 +34893,8 @@ GrB_Info GB (_Adot3B__min_plus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34718,7 +35012,8 @@ GrB_Info GB (_Adot3B__min_plus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34836,7 +35131,8 @@ GrB_Info GB (_Adot3B__min_plus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -34954,7 +35250,8 @@ GrB_Info GB (_Adot3B__min_plus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35072,7 +35369,8 @@ GrB_Info GB (_Adot3B__min_plus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35190,7 +35488,8 @@ GrB_Info GB (_Adot3B__min_plus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35308,7 +35607,8 @@ GrB_Info GB (_Adot3B__min_plus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35426,7 +35726,8 @@ GrB_Info GB (_Adot3B__min_plus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35544,7 +35845,8 @@ GrB_Info GB (_Adot3B__max_plus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35662,7 +35964,8 @@ GrB_Info GB (_Adot3B__max_plus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35780,7 +36083,8 @@ GrB_Info GB (_Adot3B__max_plus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -35898,7 +36202,8 @@ GrB_Info GB (_Adot3B__max_plus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36016,7 +36321,8 @@ GrB_Info GB (_Adot3B__max_plus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36134,7 +36440,8 @@ GrB_Info GB (_Adot3B__max_plus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36252,7 +36559,8 @@ GrB_Info GB (_Adot3B__max_plus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36370,7 +36678,8 @@ GrB_Info GB (_Adot3B__max_plus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36488,7 +36797,8 @@ GrB_Info GB (_Adot3B__max_plus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36606,7 +36916,8 @@ GrB_Info GB (_Adot3B__max_plus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -36724,7 +37035,8 @@ GrB_Info GB (_Adot3B__any_plus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -36842,7 +37154,8 @@ GrB_Info GB (_Adot3B__any_plus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -36960,7 +37273,8 @@ GrB_Info GB (_Adot3B__any_plus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37078,7 +37392,8 @@ GrB_Info GB (_Adot3B__any_plus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37196,7 +37511,8 @@ GrB_Info GB (_Adot3B__any_plus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37314,7 +37630,8 @@ GrB_Info GB (_Adot3B__any_plus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37432,7 +37749,8 @@ GrB_Info GB (_Adot3B__any_plus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37550,7 +37868,8 @@ GrB_Info GB (_Adot3B__any_plus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37668,7 +37987,8 @@ GrB_Info GB (_Adot3B__any_plus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37786,7 +38106,8 @@ GrB_Info GB (_Adot3B__any_plus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -37904,7 +38225,8 @@ GrB_Info GB (_Adot3B__any_plus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -38022,7 +38344,8 @@ GrB_Info GB (_Adot3B__any_plus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -38140,7 +38463,8 @@ GrB_Info GB (_Adot3B__plus_plus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38258,7 +38582,8 @@ GrB_Info GB (_Adot3B__plus_plus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38376,7 +38701,8 @@ GrB_Info GB (_Adot3B__plus_plus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38494,7 +38820,8 @@ GrB_Info GB (_Adot3B__plus_plus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38612,7 +38939,8 @@ GrB_Info GB (_Adot3B__plus_plus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38730,7 +39058,8 @@ GrB_Info GB (_Adot3B__plus_plus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38848,7 +39177,8 @@ GrB_Info GB (_Adot3B__plus_plus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -38966,7 +39296,8 @@ GrB_Info GB (_Adot3B__plus_plus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39084,7 +39415,8 @@ GrB_Info GB (_Adot3B__plus_plus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39202,7 +39534,8 @@ GrB_Info GB (_Adot3B__plus_plus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39320,7 +39653,8 @@ GrB_Info GB (_Adot3B__plus_plus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39438,7 +39772,8 @@ GrB_Info GB (_Adot3B__plus_plus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39556,7 +39891,8 @@ GrB_Info GB (_Adot3B__times_plus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39674,7 +40010,8 @@ GrB_Info GB (_Adot3B__times_plus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39792,7 +40129,8 @@ GrB_Info GB (_Adot3B__times_plus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -39910,7 +40248,8 @@ GrB_Info GB (_Adot3B__times_plus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40028,7 +40367,8 @@ GrB_Info GB (_Adot3B__times_plus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40146,7 +40486,8 @@ GrB_Info GB (_Adot3B__times_plus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40264,7 +40605,8 @@ GrB_Info GB (_Adot3B__times_plus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40382,7 +40724,8 @@ GrB_Info GB (_Adot3B__times_plus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40500,7 +40843,8 @@ GrB_Info GB (_Adot3B__times_plus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40618,7 +40962,8 @@ GrB_Info GB (_Adot3B__times_plus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40736,7 +41081,8 @@ GrB_Info GB (_Adot3B__times_plus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40854,7 +41200,8 @@ GrB_Info GB (_Adot3B__times_plus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -40972,7 +41319,8 @@ GrB_Info GB (_Adot3B__min_minus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41090,7 +41438,8 @@ GrB_Info GB (_Adot3B__min_minus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41208,7 +41557,8 @@ GrB_Info GB (_Adot3B__min_minus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41326,7 +41676,8 @@ GrB_Info GB (_Adot3B__min_minus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41444,7 +41795,8 @@ GrB_Info GB (_Adot3B__min_minus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41562,7 +41914,8 @@ GrB_Info GB (_Adot3B__min_minus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41680,7 +42033,8 @@ GrB_Info GB (_Adot3B__min_minus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41798,7 +42152,8 @@ GrB_Info GB (_Adot3B__min_minus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -41916,7 +42271,8 @@ GrB_Info GB (_Adot3B__min_minus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42034,7 +42390,8 @@ GrB_Info GB (_Adot3B__min_minus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42152,7 +42509,8 @@ GrB_Info GB (_Adot3B__max_minus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42270,7 +42628,8 @@ GrB_Info GB (_Adot3B__max_minus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42388,7 +42747,8 @@ GrB_Info GB (_Adot3B__max_minus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42506,7 +42866,8 @@ GrB_Info GB (_Adot3B__max_minus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42624,7 +42985,8 @@ GrB_Info GB (_Adot3B__max_minus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42742,7 +43104,8 @@ GrB_Info GB (_Adot3B__max_minus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42860,7 +43223,8 @@ GrB_Info GB (_Adot3B__max_minus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -42978,7 +43342,8 @@ GrB_Info GB (_Adot3B__max_minus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -43096,7 +43461,8 @@ GrB_Info GB (_Adot3B__max_minus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -43214,7 +43580,8 @@ GrB_Info GB (_Adot3B__max_minus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -43332,7 +43699,8 @@ GrB_Info GB (_Adot3B__any_minus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -43450,7 +43818,8 @@ GrB_Info GB (_Adot3B__any_minus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -43568,7 +43937,8 @@ GrB_Info GB (_Adot3B__any_minus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -43686,7 +44056,8 @@ GrB_Info GB (_Adot3B__any_minus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -43804,7 +44175,8 @@ GrB_Info GB (_Adot3B__any_minus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -43922,7 +44294,8 @@ GrB_Info GB (_Adot3B__any_minus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44040,7 +44413,8 @@ GrB_Info GB (_Adot3B__any_minus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44158,7 +44532,8 @@ GrB_Info GB (_Adot3B__any_minus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44276,7 +44651,8 @@ GrB_Info GB (_Adot3B__any_minus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44394,7 +44770,8 @@ GrB_Info GB (_Adot3B__any_minus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44512,7 +44889,8 @@ GrB_Info GB (_Adot3B__any_minus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44630,7 +45008,8 @@ GrB_Info GB (_Adot3B__any_minus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -44748,7 +45127,8 @@ GrB_Info GB (_Adot3B__plus_minus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -44866,7 +45246,8 @@ GrB_Info GB (_Adot3B__plus_minus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -44984,7 +45365,8 @@ GrB_Info GB (_Adot3B__plus_minus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45102,7 +45484,8 @@ GrB_Info GB (_Adot3B__plus_minus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45220,7 +45603,8 @@ GrB_Info GB (_Adot3B__plus_minus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45338,7 +45722,8 @@ GrB_Info GB (_Adot3B__plus_minus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45456,7 +45841,8 @@ GrB_Info GB (_Adot3B__plus_minus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45574,7 +45960,8 @@ GrB_Info GB (_Adot3B__plus_minus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45692,7 +46079,8 @@ GrB_Info GB (_Adot3B__plus_minus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45810,7 +46198,8 @@ GrB_Info GB (_Adot3B__plus_minus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -45928,7 +46317,8 @@ GrB_Info GB (_Adot3B__plus_minus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46046,7 +46436,8 @@ GrB_Info GB (_Adot3B__plus_minus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46164,7 +46555,8 @@ GrB_Info GB (_Adot3B__times_minus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46282,7 +46674,8 @@ GrB_Info GB (_Adot3B__times_minus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46400,7 +46793,8 @@ GrB_Info GB (_Adot3B__times_minus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46518,7 +46912,8 @@ GrB_Info GB (_Adot3B__times_minus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46636,7 +47031,8 @@ GrB_Info GB (_Adot3B__times_minus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46754,7 +47150,8 @@ GrB_Info GB (_Adot3B__times_minus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46872,7 +47269,8 @@ GrB_Info GB (_Adot3B__times_minus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -46990,7 +47388,8 @@ GrB_Info GB (_Adot3B__times_minus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47108,7 +47507,8 @@ GrB_Info GB (_Adot3B__times_minus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47226,7 +47626,8 @@ GrB_Info GB (_Adot3B__times_minus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47344,7 +47745,8 @@ GrB_Info GB (_Adot3B__times_minus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47462,7 +47864,8 @@ GrB_Info GB (_Adot3B__times_minus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47580,7 +47983,8 @@ GrB_Info GB (_Adot3B__min_rminus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47698,7 +48102,8 @@ GrB_Info GB (_Adot3B__min_rminus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47816,7 +48221,8 @@ GrB_Info GB (_Adot3B__min_rminus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -47934,7 +48340,8 @@ GrB_Info GB (_Adot3B__min_rminus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48052,7 +48459,8 @@ GrB_Info GB (_Adot3B__min_rminus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48170,7 +48578,8 @@ GrB_Info GB (_Adot3B__min_rminus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48288,7 +48697,8 @@ GrB_Info GB (_Adot3B__min_rminus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48406,7 +48816,8 @@ GrB_Info GB (_Adot3B__min_rminus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48524,7 +48935,8 @@ GrB_Info GB (_Adot3B__min_rminus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48642,7 +49054,8 @@ GrB_Info GB (_Adot3B__min_rminus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48760,7 +49173,8 @@ GrB_Info GB (_Adot3B__max_rminus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48878,7 +49292,8 @@ GrB_Info GB (_Adot3B__max_rminus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -48996,7 +49411,8 @@ GrB_Info GB (_Adot3B__max_rminus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49114,7 +49530,8 @@ GrB_Info GB (_Adot3B__max_rminus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49232,7 +49649,8 @@ GrB_Info GB (_Adot3B__max_rminus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49350,7 +49768,8 @@ GrB_Info GB (_Adot3B__max_rminus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49468,7 +49887,8 @@ GrB_Info GB (_Adot3B__max_rminus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49586,7 +50006,8 @@ GrB_Info GB (_Adot3B__max_rminus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49704,7 +50125,8 @@ GrB_Info GB (_Adot3B__max_rminus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49822,7 +50244,8 @@ GrB_Info GB (_Adot3B__max_rminus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -49940,7 +50363,8 @@ GrB_Info GB (_Adot3B__any_rminus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50058,7 +50482,8 @@ GrB_Info GB (_Adot3B__any_rminus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50176,7 +50601,8 @@ GrB_Info GB (_Adot3B__any_rminus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50294,7 +50720,8 @@ GrB_Info GB (_Adot3B__any_rminus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50412,7 +50839,8 @@ GrB_Info GB (_Adot3B__any_rminus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50530,7 +50958,8 @@ GrB_Info GB (_Adot3B__any_rminus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50648,7 +51077,8 @@ GrB_Info GB (_Adot3B__any_rminus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50766,7 +51196,8 @@ GrB_Info GB (_Adot3B__any_rminus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -50884,7 +51315,8 @@ GrB_Info GB (_Adot3B__any_rminus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -51002,7 +51434,8 @@ GrB_Info GB (_Adot3B__any_rminus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -51120,7 +51553,8 @@ GrB_Info GB (_Adot3B__any_rminus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -51238,7 +51672,8 @@ GrB_Info GB (_Adot3B__any_rminus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -51356,7 +51791,8 @@ GrB_Info GB (_Adot3B__plus_rminus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -51474,7 +51910,8 @@ GrB_Info GB (_Adot3B__plus_rminus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -51592,7 +52029,8 @@ GrB_Info GB (_Adot3B__plus_rminus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -51710,7 +52148,8 @@ GrB_Info GB (_Adot3B__plus_rminus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -51828,7 +52267,8 @@ GrB_Info GB (_Adot3B__plus_rminus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -51946,7 +52386,8 @@ GrB_Info GB (_Adot3B__plus_rminus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52064,7 +52505,8 @@ GrB_Info GB (_Adot3B__plus_rminus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52182,7 +52624,8 @@ GrB_Info GB (_Adot3B__plus_rminus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52300,7 +52743,8 @@ GrB_Info GB (_Adot3B__plus_rminus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52418,7 +52862,8 @@ GrB_Info GB (_Adot3B__plus_rminus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52536,7 +52981,8 @@ GrB_Info GB (_Adot3B__plus_rminus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52654,7 +53100,8 @@ GrB_Info GB (_Adot3B__plus_rminus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52772,7 +53219,8 @@ GrB_Info GB (_Adot3B__times_rminus_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -52890,7 +53338,8 @@ GrB_Info GB (_Adot3B__times_rminus_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53008,7 +53457,8 @@ GrB_Info GB (_Adot3B__times_rminus_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53126,7 +53576,8 @@ GrB_Info GB (_Adot3B__times_rminus_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53244,7 +53695,8 @@ GrB_Info GB (_Adot3B__times_rminus_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53362,7 +53814,8 @@ GrB_Info GB (_Adot3B__times_rminus_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53480,7 +53933,8 @@ GrB_Info GB (_Adot3B__times_rminus_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53598,7 +54052,8 @@ GrB_Info GB (_Adot3B__times_rminus_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53716,7 +54171,8 @@ GrB_Info GB (_Adot3B__times_rminus_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53834,7 +54290,8 @@ GrB_Info GB (_Adot3B__times_rminus_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -53952,7 +54409,8 @@ GrB_Info GB (_Adot3B__times_rminus_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54070,7 +54528,8 @@ GrB_Info GB (_Adot3B__times_rminus_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54188,7 +54647,8 @@ GrB_Info GB (_Adot3B__min_div_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54306,7 +54766,8 @@ GrB_Info GB (_Adot3B__min_div_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54424,7 +54885,8 @@ GrB_Info GB (_Adot3B__min_div_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54542,7 +55004,8 @@ GrB_Info GB (_Adot3B__min_div_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54660,7 +55123,8 @@ GrB_Info GB (_Adot3B__min_div_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54778,7 +55242,8 @@ GrB_Info GB (_Adot3B__min_div_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -54896,7 +55361,8 @@ GrB_Info GB (_Adot3B__min_div_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55014,7 +55480,8 @@ GrB_Info GB (_Adot3B__min_div_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55132,7 +55599,8 @@ GrB_Info GB (_Adot3B__min_div_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55250,7 +55718,8 @@ GrB_Info GB (_Adot3B__min_div_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55368,7 +55837,8 @@ GrB_Info GB (_Adot3B__max_div_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55486,7 +55956,8 @@ GrB_Info GB (_Adot3B__max_div_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55604,7 +56075,8 @@ GrB_Info GB (_Adot3B__max_div_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55722,7 +56194,8 @@ GrB_Info GB (_Adot3B__max_div_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55840,7 +56313,8 @@ GrB_Info GB (_Adot3B__max_div_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -55958,7 +56432,8 @@ GrB_Info GB (_Adot3B__max_div_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -56076,7 +56551,8 @@ GrB_Info GB (_Adot3B__max_div_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -56194,7 +56670,8 @@ GrB_Info GB (_Adot3B__max_div_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -56312,7 +56789,8 @@ GrB_Info GB (_Adot3B__max_div_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -56430,7 +56908,8 @@ GrB_Info GB (_Adot3B__max_div_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -56548,7 +57027,8 @@ GrB_Info GB (_Adot3B__any_div_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -56666,7 +57146,8 @@ GrB_Info GB (_Adot3B__any_div_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -56784,7 +57265,8 @@ GrB_Info GB (_Adot3B__any_div_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -56902,7 +57384,8 @@ GrB_Info GB (_Adot3B__any_div_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57020,7 +57503,8 @@ GrB_Info GB (_Adot3B__any_div_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57138,7 +57622,8 @@ GrB_Info GB (_Adot3B__any_div_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57256,7 +57741,8 @@ GrB_Info GB (_Adot3B__any_div_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57374,7 +57860,8 @@ GrB_Info GB (_Adot3B__any_div_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57492,7 +57979,8 @@ GrB_Info GB (_Adot3B__any_div_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57610,7 +58098,8 @@ GrB_Info GB (_Adot3B__any_div_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57728,7 +58217,8 @@ GrB_Info GB (_Adot3B__any_div_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57846,7 +58336,8 @@ GrB_Info GB (_Adot3B__any_div_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -57964,7 +58455,8 @@ GrB_Info GB (_Adot3B__plus_div_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58082,7 +58574,8 @@ GrB_Info GB (_Adot3B__plus_div_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58200,7 +58693,8 @@ GrB_Info GB (_Adot3B__plus_div_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58318,7 +58812,8 @@ GrB_Info GB (_Adot3B__plus_div_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58436,7 +58931,8 @@ GrB_Info GB (_Adot3B__plus_div_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58554,7 +59050,8 @@ GrB_Info GB (_Adot3B__plus_div_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58672,7 +59169,8 @@ GrB_Info GB (_Adot3B__plus_div_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58790,7 +59288,8 @@ GrB_Info GB (_Adot3B__plus_div_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -58908,7 +59407,8 @@ GrB_Info GB (_Adot3B__plus_div_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59026,7 +59526,8 @@ GrB_Info GB (_Adot3B__plus_div_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59144,7 +59645,8 @@ GrB_Info GB (_Adot3B__plus_div_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59262,7 +59764,8 @@ GrB_Info GB (_Adot3B__plus_div_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59380,7 +59883,8 @@ GrB_Info GB (_Adot3B__times_div_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59498,7 +60002,8 @@ GrB_Info GB (_Adot3B__times_div_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59616,7 +60121,8 @@ GrB_Info GB (_Adot3B__times_div_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59734,7 +60240,8 @@ GrB_Info GB (_Adot3B__times_div_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59852,7 +60359,8 @@ GrB_Info GB (_Adot3B__times_div_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -59970,7 +60478,8 @@ GrB_Info GB (_Adot3B__times_div_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60088,7 +60597,8 @@ GrB_Info GB (_Adot3B__times_div_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60206,7 +60716,8 @@ GrB_Info GB (_Adot3B__times_div_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60324,7 +60835,8 @@ GrB_Info GB (_Adot3B__times_div_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60442,7 +60954,8 @@ GrB_Info GB (_Adot3B__times_div_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60560,7 +61073,8 @@ GrB_Info GB (_Adot3B__times_div_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60678,7 +61192,8 @@ GrB_Info GB (_Adot3B__times_div_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60796,7 +61311,8 @@ GrB_Info GB (_Adot3B__min_rdiv_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -60914,7 +61430,8 @@ GrB_Info GB (_Adot3B__min_rdiv_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61032,7 +61549,8 @@ GrB_Info GB (_Adot3B__min_rdiv_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61150,7 +61668,8 @@ GrB_Info GB (_Adot3B__min_rdiv_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61268,7 +61787,8 @@ GrB_Info GB (_Adot3B__min_rdiv_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61386,7 +61906,8 @@ GrB_Info GB (_Adot3B__min_rdiv_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61504,7 +62025,8 @@ GrB_Info GB (_Adot3B__min_rdiv_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61622,7 +62144,8 @@ GrB_Info GB (_Adot3B__min_rdiv_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61740,7 +62263,8 @@ GrB_Info GB (_Adot3B__min_rdiv_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61858,7 +62382,8 @@ GrB_Info GB (_Adot3B__min_rdiv_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -61976,7 +62501,8 @@ GrB_Info GB (_Adot3B__max_rdiv_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62094,7 +62620,8 @@ GrB_Info GB (_Adot3B__max_rdiv_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62212,7 +62739,8 @@ GrB_Info GB (_Adot3B__max_rdiv_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62330,7 +62858,8 @@ GrB_Info GB (_Adot3B__max_rdiv_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62448,7 +62977,8 @@ GrB_Info GB (_Adot3B__max_rdiv_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62566,7 +63096,8 @@ GrB_Info GB (_Adot3B__max_rdiv_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62684,7 +63215,8 @@ GrB_Info GB (_Adot3B__max_rdiv_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62802,7 +63334,8 @@ GrB_Info GB (_Adot3B__max_rdiv_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -62920,7 +63453,8 @@ GrB_Info GB (_Adot3B__max_rdiv_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -63038,7 +63572,8 @@ GrB_Info GB (_Adot3B__max_rdiv_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -63156,7 +63691,8 @@ GrB_Info GB (_Adot3B__any_rdiv_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63274,7 +63810,8 @@ GrB_Info GB (_Adot3B__any_rdiv_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63392,7 +63929,8 @@ GrB_Info GB (_Adot3B__any_rdiv_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63510,7 +64048,8 @@ GrB_Info GB (_Adot3B__any_rdiv_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63628,7 +64167,8 @@ GrB_Info GB (_Adot3B__any_rdiv_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63746,7 +64286,8 @@ GrB_Info GB (_Adot3B__any_rdiv_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63864,7 +64405,8 @@ GrB_Info GB (_Adot3B__any_rdiv_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -63982,7 +64524,8 @@ GrB_Info GB (_Adot3B__any_rdiv_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -64100,7 +64643,8 @@ GrB_Info GB (_Adot3B__any_rdiv_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -64218,7 +64762,8 @@ GrB_Info GB (_Adot3B__any_rdiv_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -64336,7 +64881,8 @@ GrB_Info GB (_Adot3B__any_rdiv_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -64454,7 +65000,8 @@ GrB_Info GB (_Adot3B__any_rdiv_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -64572,7 +65119,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -64690,7 +65238,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -64808,7 +65357,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -64926,7 +65476,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65044,7 +65595,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65162,7 +65714,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65280,7 +65833,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65398,7 +65952,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65516,7 +66071,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65634,7 +66190,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65752,7 +66309,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65870,7 +66428,8 @@ GrB_Info GB (_Adot3B__plus_rdiv_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -65988,7 +66547,8 @@ GrB_Info GB (_Adot3B__times_rdiv_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66106,7 +66666,8 @@ GrB_Info GB (_Adot3B__times_rdiv_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66224,7 +66785,8 @@ GrB_Info GB (_Adot3B__times_rdiv_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66342,7 +66904,8 @@ GrB_Info GB (_Adot3B__times_rdiv_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66460,7 +67023,8 @@ GrB_Info GB (_Adot3B__times_rdiv_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66578,7 +67142,8 @@ GrB_Info GB (_Adot3B__times_rdiv_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66696,7 +67261,8 @@ GrB_Info GB (_Adot3B__times_rdiv_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66814,7 +67380,8 @@ GrB_Info GB (_Adot3B__times_rdiv_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -66932,7 +67499,8 @@ GrB_Info GB (_Adot3B__times_rdiv_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67050,7 +67618,8 @@ GrB_Info GB (_Adot3B__times_rdiv_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67168,7 +67737,8 @@ GrB_Info GB (_Adot3B__times_rdiv_fc32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67286,7 +67856,8 @@ GrB_Info GB (_Adot3B__times_rdiv_fc64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67404,7 +67975,8 @@ GrB_Info GB (_Adot3B__lor_eq_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67522,7 +68094,8 @@ GrB_Info GB (_Adot3B__lor_eq_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67640,7 +68213,8 @@ GrB_Info GB (_Adot3B__lor_eq_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67758,7 +68332,8 @@ GrB_Info GB (_Adot3B__lor_eq_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67876,7 +68451,8 @@ GrB_Info GB (_Adot3B__lor_eq_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -67994,7 +68570,8 @@ GrB_Info GB (_Adot3B__lor_eq_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68112,7 +68689,8 @@ GrB_Info GB (_Adot3B__lor_eq_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68230,7 +68808,8 @@ GrB_Info GB (_Adot3B__lor_eq_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68348,7 +68927,8 @@ GrB_Info GB (_Adot3B__lor_eq_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68466,7 +69046,8 @@ GrB_Info GB (_Adot3B__lor_eq_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68584,7 +69165,8 @@ GrB_Info GB (_Adot3B__lor_eq_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -68702,7 +69284,8 @@ GrB_Info GB (_Adot3B__any_eq_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -68820,7 +69403,8 @@ GrB_Info GB (_Adot3B__any_eq_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -68938,7 +69522,8 @@ GrB_Info GB (_Adot3B__any_eq_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69056,7 +69641,8 @@ GrB_Info GB (_Adot3B__any_eq_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69174,7 +69760,8 @@ GrB_Info GB (_Adot3B__any_eq_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69292,7 +69879,8 @@ GrB_Info GB (_Adot3B__any_eq_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69410,7 +69998,8 @@ GrB_Info GB (_Adot3B__any_eq_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69528,7 +70117,8 @@ GrB_Info GB (_Adot3B__any_eq_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69646,7 +70236,8 @@ GrB_Info GB (_Adot3B__any_eq_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69764,7 +70355,8 @@ GrB_Info GB (_Adot3B__any_eq_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -69882,7 +70474,8 @@ GrB_Info GB (_Adot3B__any_eq_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -70000,7 +70593,8 @@ GrB_Info GB (_Adot3B__land_eq_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70118,7 +70712,8 @@ GrB_Info GB (_Adot3B__land_eq_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70236,7 +70831,8 @@ GrB_Info GB (_Adot3B__land_eq_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70354,7 +70950,8 @@ GrB_Info GB (_Adot3B__land_eq_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70472,7 +71069,8 @@ GrB_Info GB (_Adot3B__land_eq_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70590,7 +71188,8 @@ GrB_Info GB (_Adot3B__land_eq_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70708,7 +71307,8 @@ GrB_Info GB (_Adot3B__land_eq_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70826,7 +71426,8 @@ GrB_Info GB (_Adot3B__land_eq_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -70944,7 +71545,8 @@ GrB_Info GB (_Adot3B__land_eq_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71062,7 +71664,8 @@ GrB_Info GB (_Adot3B__land_eq_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71180,7 +71783,8 @@ GrB_Info GB (_Adot3B__land_eq_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71298,7 +71902,8 @@ GrB_Info GB (_Adot3B__lxor_eq_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71416,7 +72021,8 @@ GrB_Info GB (_Adot3B__lxor_eq_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71534,7 +72140,8 @@ GrB_Info GB (_Adot3B__lxor_eq_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71652,7 +72259,8 @@ GrB_Info GB (_Adot3B__lxor_eq_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71770,7 +72378,8 @@ GrB_Info GB (_Adot3B__lxor_eq_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -71888,7 +72497,8 @@ GrB_Info GB (_Adot3B__lxor_eq_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72006,7 +72616,8 @@ GrB_Info GB (_Adot3B__lxor_eq_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72124,7 +72735,8 @@ GrB_Info GB (_Adot3B__lxor_eq_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72242,7 +72854,8 @@ GrB_Info GB (_Adot3B__lxor_eq_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72360,7 +72973,8 @@ GrB_Info GB (_Adot3B__lxor_eq_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72478,7 +73092,8 @@ GrB_Info GB (_Adot3B__lxor_eq_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72596,7 +73211,8 @@ GrB_Info GB (_Adot3B__eq_eq_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72714,7 +73330,8 @@ GrB_Info GB (_Adot3B__eq_eq_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72832,7 +73449,8 @@ GrB_Info GB (_Adot3B__eq_eq_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -72950,7 +73568,8 @@ GrB_Info GB (_Adot3B__eq_eq_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73068,7 +73687,8 @@ GrB_Info GB (_Adot3B__eq_eq_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73186,7 +73806,8 @@ GrB_Info GB (_Adot3B__eq_eq_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73304,7 +73925,8 @@ GrB_Info GB (_Adot3B__eq_eq_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73422,7 +74044,8 @@ GrB_Info GB (_Adot3B__eq_eq_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73540,7 +74163,8 @@ GrB_Info GB (_Adot3B__eq_eq_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73658,7 +74282,8 @@ GrB_Info GB (_Adot3B__eq_eq_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73776,7 +74401,8 @@ GrB_Info GB (_Adot3B__eq_eq_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -73894,7 +74520,8 @@ GrB_Info GB (_Adot3B__lor_ne_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74012,7 +74639,8 @@ GrB_Info GB (_Adot3B__lor_ne_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74130,7 +74758,8 @@ GrB_Info GB (_Adot3B__lor_ne_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74248,7 +74877,8 @@ GrB_Info GB (_Adot3B__lor_ne_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74366,7 +74996,8 @@ GrB_Info GB (_Adot3B__lor_ne_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74484,7 +75115,8 @@ GrB_Info GB (_Adot3B__lor_ne_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74602,7 +75234,8 @@ GrB_Info GB (_Adot3B__lor_ne_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74720,7 +75353,8 @@ GrB_Info GB (_Adot3B__lor_ne_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74838,7 +75472,8 @@ GrB_Info GB (_Adot3B__lor_ne_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -74956,7 +75591,8 @@ GrB_Info GB (_Adot3B__lor_ne_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -75074,7 +75710,8 @@ GrB_Info GB (_Adot3B__any_ne_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75192,7 +75829,8 @@ GrB_Info GB (_Adot3B__any_ne_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75310,7 +75948,8 @@ GrB_Info GB (_Adot3B__any_ne_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75428,7 +76067,8 @@ GrB_Info GB (_Adot3B__any_ne_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75546,7 +76186,8 @@ GrB_Info GB (_Adot3B__any_ne_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75664,7 +76305,8 @@ GrB_Info GB (_Adot3B__any_ne_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75782,7 +76424,8 @@ GrB_Info GB (_Adot3B__any_ne_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -75900,7 +76543,8 @@ GrB_Info GB (_Adot3B__any_ne_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -76018,7 +76662,8 @@ GrB_Info GB (_Adot3B__any_ne_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -76136,7 +76781,8 @@ GrB_Info GB (_Adot3B__any_ne_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -76254,7 +76900,8 @@ GrB_Info GB (_Adot3B__land_ne_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76372,7 +77019,8 @@ GrB_Info GB (_Adot3B__land_ne_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76490,7 +77138,8 @@ GrB_Info GB (_Adot3B__land_ne_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76608,7 +77257,8 @@ GrB_Info GB (_Adot3B__land_ne_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76726,7 +77376,8 @@ GrB_Info GB (_Adot3B__land_ne_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76844,7 +77495,8 @@ GrB_Info GB (_Adot3B__land_ne_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -76962,7 +77614,8 @@ GrB_Info GB (_Adot3B__land_ne_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77080,7 +77733,8 @@ GrB_Info GB (_Adot3B__land_ne_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77198,7 +77852,8 @@ GrB_Info GB (_Adot3B__land_ne_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77316,7 +77971,8 @@ GrB_Info GB (_Adot3B__land_ne_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77434,7 +78090,8 @@ GrB_Info GB (_Adot3B__lxor_ne_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77552,7 +78209,8 @@ GrB_Info GB (_Adot3B__lxor_ne_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77670,7 +78328,8 @@ GrB_Info GB (_Adot3B__lxor_ne_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77788,7 +78447,8 @@ GrB_Info GB (_Adot3B__lxor_ne_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -77906,7 +78566,8 @@ GrB_Info GB (_Adot3B__lxor_ne_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78024,7 +78685,8 @@ GrB_Info GB (_Adot3B__lxor_ne_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78142,7 +78804,8 @@ GrB_Info GB (_Adot3B__lxor_ne_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78260,7 +78923,8 @@ GrB_Info GB (_Adot3B__lxor_ne_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78378,7 +79042,8 @@ GrB_Info GB (_Adot3B__lxor_ne_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78496,7 +79161,8 @@ GrB_Info GB (_Adot3B__lxor_ne_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78614,7 +79280,8 @@ GrB_Info GB (_Adot3B__eq_ne_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78732,7 +79399,8 @@ GrB_Info GB (_Adot3B__eq_ne_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78850,7 +79518,8 @@ GrB_Info GB (_Adot3B__eq_ne_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -78968,7 +79637,8 @@ GrB_Info GB (_Adot3B__eq_ne_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79086,7 +79756,8 @@ GrB_Info GB (_Adot3B__eq_ne_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79204,7 +79875,8 @@ GrB_Info GB (_Adot3B__eq_ne_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79322,7 +79994,8 @@ GrB_Info GB (_Adot3B__eq_ne_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79440,7 +80113,8 @@ GrB_Info GB (_Adot3B__eq_ne_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79558,7 +80232,8 @@ GrB_Info GB (_Adot3B__eq_ne_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79676,7 +80351,8 @@ GrB_Info GB (_Adot3B__eq_ne_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79794,7 +80470,8 @@ GrB_Info GB (_Adot3B__lor_gt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -79912,7 +80589,8 @@ GrB_Info GB (_Adot3B__lor_gt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80030,7 +80708,8 @@ GrB_Info GB (_Adot3B__lor_gt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80148,7 +80827,8 @@ GrB_Info GB (_Adot3B__lor_gt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80266,7 +80946,8 @@ GrB_Info GB (_Adot3B__lor_gt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80384,7 +81065,8 @@ GrB_Info GB (_Adot3B__lor_gt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80502,7 +81184,8 @@ GrB_Info GB (_Adot3B__lor_gt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80620,7 +81303,8 @@ GrB_Info GB (_Adot3B__lor_gt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80738,7 +81422,8 @@ GrB_Info GB (_Adot3B__lor_gt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80856,7 +81541,8 @@ GrB_Info GB (_Adot3B__lor_gt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -80974,7 +81660,8 @@ GrB_Info GB (_Adot3B__lor_gt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -81092,7 +81779,8 @@ GrB_Info GB (_Adot3B__any_gt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81210,7 +81898,8 @@ GrB_Info GB (_Adot3B__any_gt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81328,7 +82017,8 @@ GrB_Info GB (_Adot3B__any_gt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81446,7 +82136,8 @@ GrB_Info GB (_Adot3B__any_gt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81564,7 +82255,8 @@ GrB_Info GB (_Adot3B__any_gt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81682,7 +82374,8 @@ GrB_Info GB (_Adot3B__any_gt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81800,7 +82493,8 @@ GrB_Info GB (_Adot3B__any_gt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -81918,7 +82612,8 @@ GrB_Info GB (_Adot3B__any_gt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -82036,7 +82731,8 @@ GrB_Info GB (_Adot3B__any_gt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -82154,7 +82850,8 @@ GrB_Info GB (_Adot3B__any_gt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -82272,7 +82969,8 @@ GrB_Info GB (_Adot3B__any_gt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -82390,7 +83088,8 @@ GrB_Info GB (_Adot3B__land_gt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -82508,7 +83207,8 @@ GrB_Info GB (_Adot3B__land_gt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -82626,7 +83326,8 @@ GrB_Info GB (_Adot3B__land_gt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -82744,7 +83445,8 @@ GrB_Info GB (_Adot3B__land_gt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -82862,7 +83564,8 @@ GrB_Info GB (_Adot3B__land_gt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -82980,7 +83683,8 @@ GrB_Info GB (_Adot3B__land_gt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83098,7 +83802,8 @@ GrB_Info GB (_Adot3B__land_gt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83216,7 +83921,8 @@ GrB_Info GB (_Adot3B__land_gt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83334,7 +84040,8 @@ GrB_Info GB (_Adot3B__land_gt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83452,7 +84159,8 @@ GrB_Info GB (_Adot3B__land_gt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83570,7 +84278,8 @@ GrB_Info GB (_Adot3B__land_gt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83688,7 +84397,8 @@ GrB_Info GB (_Adot3B__lxor_gt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83806,7 +84516,8 @@ GrB_Info GB (_Adot3B__lxor_gt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -83924,7 +84635,8 @@ GrB_Info GB (_Adot3B__lxor_gt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84042,7 +84754,8 @@ GrB_Info GB (_Adot3B__lxor_gt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84160,7 +84873,8 @@ GrB_Info GB (_Adot3B__lxor_gt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84278,7 +84992,8 @@ GrB_Info GB (_Adot3B__lxor_gt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84396,7 +85111,8 @@ GrB_Info GB (_Adot3B__lxor_gt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84514,7 +85230,8 @@ GrB_Info GB (_Adot3B__lxor_gt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84632,7 +85349,8 @@ GrB_Info GB (_Adot3B__lxor_gt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84750,7 +85468,8 @@ GrB_Info GB (_Adot3B__lxor_gt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84868,7 +85587,8 @@ GrB_Info GB (_Adot3B__lxor_gt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -84986,7 +85706,8 @@ GrB_Info GB (_Adot3B__eq_gt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85104,7 +85825,8 @@ GrB_Info GB (_Adot3B__eq_gt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85222,7 +85944,8 @@ GrB_Info GB (_Adot3B__eq_gt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85340,7 +86063,8 @@ GrB_Info GB (_Adot3B__eq_gt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85458,7 +86182,8 @@ GrB_Info GB (_Adot3B__eq_gt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85576,7 +86301,8 @@ GrB_Info GB (_Adot3B__eq_gt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85694,7 +86420,8 @@ GrB_Info GB (_Adot3B__eq_gt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85812,7 +86539,8 @@ GrB_Info GB (_Adot3B__eq_gt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -85930,7 +86658,8 @@ GrB_Info GB (_Adot3B__eq_gt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86048,7 +86777,8 @@ GrB_Info GB (_Adot3B__eq_gt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86166,7 +86896,8 @@ GrB_Info GB (_Adot3B__eq_gt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86284,7 +87015,8 @@ GrB_Info GB (_Adot3B__lor_lt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86402,7 +87134,8 @@ GrB_Info GB (_Adot3B__lor_lt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86520,7 +87253,8 @@ GrB_Info GB (_Adot3B__lor_lt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86638,7 +87372,8 @@ GrB_Info GB (_Adot3B__lor_lt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86756,7 +87491,8 @@ GrB_Info GB (_Adot3B__lor_lt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86874,7 +87610,8 @@ GrB_Info GB (_Adot3B__lor_lt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -86992,7 +87729,8 @@ GrB_Info GB (_Adot3B__lor_lt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -87110,7 +87848,8 @@ GrB_Info GB (_Adot3B__lor_lt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -87228,7 +87967,8 @@ GrB_Info GB (_Adot3B__lor_lt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -87346,7 +88086,8 @@ GrB_Info GB (_Adot3B__lor_lt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -87464,7 +88205,8 @@ GrB_Info GB (_Adot3B__lor_lt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -87582,7 +88324,8 @@ GrB_Info GB (_Adot3B__any_lt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -87700,7 +88443,8 @@ GrB_Info GB (_Adot3B__any_lt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -87818,7 +88562,8 @@ GrB_Info GB (_Adot3B__any_lt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -87936,7 +88681,8 @@ GrB_Info GB (_Adot3B__any_lt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88054,7 +88800,8 @@ GrB_Info GB (_Adot3B__any_lt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88172,7 +88919,8 @@ GrB_Info GB (_Adot3B__any_lt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88290,7 +89038,8 @@ GrB_Info GB (_Adot3B__any_lt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88408,7 +89157,8 @@ GrB_Info GB (_Adot3B__any_lt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88526,7 +89276,8 @@ GrB_Info GB (_Adot3B__any_lt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88644,7 +89395,8 @@ GrB_Info GB (_Adot3B__any_lt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88762,7 +89514,8 @@ GrB_Info GB (_Adot3B__any_lt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -88880,7 +89633,8 @@ GrB_Info GB (_Adot3B__land_lt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -88998,7 +89752,8 @@ GrB_Info GB (_Adot3B__land_lt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89116,7 +89871,8 @@ GrB_Info GB (_Adot3B__land_lt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89234,7 +89990,8 @@ GrB_Info GB (_Adot3B__land_lt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89352,7 +90109,8 @@ GrB_Info GB (_Adot3B__land_lt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89470,7 +90228,8 @@ GrB_Info GB (_Adot3B__land_lt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89588,7 +90347,8 @@ GrB_Info GB (_Adot3B__land_lt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89706,7 +90466,8 @@ GrB_Info GB (_Adot3B__land_lt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89824,7 +90585,8 @@ GrB_Info GB (_Adot3B__land_lt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -89942,7 +90704,8 @@ GrB_Info GB (_Adot3B__land_lt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90060,7 +90823,8 @@ GrB_Info GB (_Adot3B__land_lt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90178,7 +90942,8 @@ GrB_Info GB (_Adot3B__lxor_lt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90296,7 +91061,8 @@ GrB_Info GB (_Adot3B__lxor_lt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90414,7 +91180,8 @@ GrB_Info GB (_Adot3B__lxor_lt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90532,7 +91299,8 @@ GrB_Info GB (_Adot3B__lxor_lt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90650,7 +91418,8 @@ GrB_Info GB (_Adot3B__lxor_lt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90768,7 +91537,8 @@ GrB_Info GB (_Adot3B__lxor_lt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -90886,7 +91656,8 @@ GrB_Info GB (_Adot3B__lxor_lt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91004,7 +91775,8 @@ GrB_Info GB (_Adot3B__lxor_lt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91122,7 +91894,8 @@ GrB_Info GB (_Adot3B__lxor_lt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91240,7 +92013,8 @@ GrB_Info GB (_Adot3B__lxor_lt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91358,7 +92132,8 @@ GrB_Info GB (_Adot3B__lxor_lt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91476,7 +92251,8 @@ GrB_Info GB (_Adot3B__eq_lt_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91594,7 +92370,8 @@ GrB_Info GB (_Adot3B__eq_lt_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91712,7 +92489,8 @@ GrB_Info GB (_Adot3B__eq_lt_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91830,7 +92608,8 @@ GrB_Info GB (_Adot3B__eq_lt_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -91948,7 +92727,8 @@ GrB_Info GB (_Adot3B__eq_lt_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92066,7 +92846,8 @@ GrB_Info GB (_Adot3B__eq_lt_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92184,7 +92965,8 @@ GrB_Info GB (_Adot3B__eq_lt_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92302,7 +93084,8 @@ GrB_Info GB (_Adot3B__eq_lt_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92420,7 +93203,8 @@ GrB_Info GB (_Adot3B__eq_lt_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92538,7 +93322,8 @@ GrB_Info GB (_Adot3B__eq_lt_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92656,7 +93441,8 @@ GrB_Info GB (_Adot3B__eq_lt_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92774,7 +93560,8 @@ GrB_Info GB (_Adot3B__lor_ge_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -92892,7 +93679,8 @@ GrB_Info GB (_Adot3B__lor_ge_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93010,7 +93798,8 @@ GrB_Info GB (_Adot3B__lor_ge_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93128,7 +93917,8 @@ GrB_Info GB (_Adot3B__lor_ge_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93246,7 +94036,8 @@ GrB_Info GB (_Adot3B__lor_ge_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93364,7 +94155,8 @@ GrB_Info GB (_Adot3B__lor_ge_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93482,7 +94274,8 @@ GrB_Info GB (_Adot3B__lor_ge_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93600,7 +94393,8 @@ GrB_Info GB (_Adot3B__lor_ge_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93718,7 +94512,8 @@ GrB_Info GB (_Adot3B__lor_ge_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93836,7 +94631,8 @@ GrB_Info GB (_Adot3B__lor_ge_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -93954,7 +94750,8 @@ GrB_Info GB (_Adot3B__lor_ge_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -94072,7 +94869,8 @@ GrB_Info GB (_Adot3B__any_ge_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94190,7 +94988,8 @@ GrB_Info GB (_Adot3B__any_ge_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94308,7 +95107,8 @@ GrB_Info GB (_Adot3B__any_ge_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94426,7 +95226,8 @@ GrB_Info GB (_Adot3B__any_ge_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94544,7 +95345,8 @@ GrB_Info GB (_Adot3B__any_ge_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94662,7 +95464,8 @@ GrB_Info GB (_Adot3B__any_ge_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94780,7 +95583,8 @@ GrB_Info GB (_Adot3B__any_ge_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -94898,7 +95702,8 @@ GrB_Info GB (_Adot3B__any_ge_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -95016,7 +95821,8 @@ GrB_Info GB (_Adot3B__any_ge_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -95134,7 +95940,8 @@ GrB_Info GB (_Adot3B__any_ge_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -95252,7 +96059,8 @@ GrB_Info GB (_Adot3B__any_ge_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -95370,7 +96178,8 @@ GrB_Info GB (_Adot3B__land_ge_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -95488,7 +96297,8 @@ GrB_Info GB (_Adot3B__land_ge_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -95606,7 +96416,8 @@ GrB_Info GB (_Adot3B__land_ge_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -95724,7 +96535,8 @@ GrB_Info GB (_Adot3B__land_ge_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -95842,7 +96654,8 @@ GrB_Info GB (_Adot3B__land_ge_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -95960,7 +96773,8 @@ GrB_Info GB (_Adot3B__land_ge_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96078,7 +96892,8 @@ GrB_Info GB (_Adot3B__land_ge_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96196,7 +97011,8 @@ GrB_Info GB (_Adot3B__land_ge_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96314,7 +97130,8 @@ GrB_Info GB (_Adot3B__land_ge_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96432,7 +97249,8 @@ GrB_Info GB (_Adot3B__land_ge_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96550,7 +97368,8 @@ GrB_Info GB (_Adot3B__land_ge_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96668,7 +97487,8 @@ GrB_Info GB (_Adot3B__lxor_ge_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96786,7 +97606,8 @@ GrB_Info GB (_Adot3B__lxor_ge_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -96904,7 +97725,8 @@ GrB_Info GB (_Adot3B__lxor_ge_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97022,7 +97844,8 @@ GrB_Info GB (_Adot3B__lxor_ge_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97140,7 +97963,8 @@ GrB_Info GB (_Adot3B__lxor_ge_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97258,7 +98082,8 @@ GrB_Info GB (_Adot3B__lxor_ge_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97376,7 +98201,8 @@ GrB_Info GB (_Adot3B__lxor_ge_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97494,7 +98320,8 @@ GrB_Info GB (_Adot3B__lxor_ge_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97612,7 +98439,8 @@ GrB_Info GB (_Adot3B__lxor_ge_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97730,7 +98558,8 @@ GrB_Info GB (_Adot3B__lxor_ge_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97848,7 +98677,8 @@ GrB_Info GB (_Adot3B__lxor_ge_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -97966,7 +98796,8 @@ GrB_Info GB (_Adot3B__eq_ge_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98084,7 +98915,8 @@ GrB_Info GB (_Adot3B__eq_ge_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98202,7 +99034,8 @@ GrB_Info GB (_Adot3B__eq_ge_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98320,7 +99153,8 @@ GrB_Info GB (_Adot3B__eq_ge_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98438,7 +99272,8 @@ GrB_Info GB (_Adot3B__eq_ge_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98556,7 +99391,8 @@ GrB_Info GB (_Adot3B__eq_ge_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98674,7 +99510,8 @@ GrB_Info GB (_Adot3B__eq_ge_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98792,7 +99629,8 @@ GrB_Info GB (_Adot3B__eq_ge_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -98910,7 +99748,8 @@ GrB_Info GB (_Adot3B__eq_ge_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99028,7 +99867,8 @@ GrB_Info GB (_Adot3B__eq_ge_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99146,7 +99986,8 @@ GrB_Info GB (_Adot3B__eq_ge_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99264,7 +100105,8 @@ GrB_Info GB (_Adot3B__lor_le_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99382,7 +100224,8 @@ GrB_Info GB (_Adot3B__lor_le_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99500,7 +100343,8 @@ GrB_Info GB (_Adot3B__lor_le_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99618,7 +100462,8 @@ GrB_Info GB (_Adot3B__lor_le_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99736,7 +100581,8 @@ GrB_Info GB (_Adot3B__lor_le_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99854,7 +100700,8 @@ GrB_Info GB (_Adot3B__lor_le_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -99972,7 +100819,8 @@ GrB_Info GB (_Adot3B__lor_le_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -100090,7 +100938,8 @@ GrB_Info GB (_Adot3B__lor_le_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -100208,7 +101057,8 @@ GrB_Info GB (_Adot3B__lor_le_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -100326,7 +101176,8 @@ GrB_Info GB (_Adot3B__lor_le_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -100444,7 +101295,8 @@ GrB_Info GB (_Adot3B__lor_le_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -100562,7 +101414,8 @@ GrB_Info GB (_Adot3B__any_le_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -100680,7 +101533,8 @@ GrB_Info GB (_Adot3B__any_le_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -100798,7 +101652,8 @@ GrB_Info GB (_Adot3B__any_le_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -100916,7 +101771,8 @@ GrB_Info GB (_Adot3B__any_le_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101034,7 +101890,8 @@ GrB_Info GB (_Adot3B__any_le_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101152,7 +102009,8 @@ GrB_Info GB (_Adot3B__any_le_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101270,7 +102128,8 @@ GrB_Info GB (_Adot3B__any_le_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101388,7 +102247,8 @@ GrB_Info GB (_Adot3B__any_le_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101506,7 +102366,8 @@ GrB_Info GB (_Adot3B__any_le_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101624,7 +102485,8 @@ GrB_Info GB (_Adot3B__any_le_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101742,7 +102604,8 @@ GrB_Info GB (_Adot3B__any_le_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -101860,7 +102723,8 @@ GrB_Info GB (_Adot3B__land_le_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -101978,7 +102842,8 @@ GrB_Info GB (_Adot3B__land_le_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102096,7 +102961,8 @@ GrB_Info GB (_Adot3B__land_le_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102214,7 +103080,8 @@ GrB_Info GB (_Adot3B__land_le_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102332,7 +103199,8 @@ GrB_Info GB (_Adot3B__land_le_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102450,7 +103318,8 @@ GrB_Info GB (_Adot3B__land_le_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102568,7 +103437,8 @@ GrB_Info GB (_Adot3B__land_le_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102686,7 +103556,8 @@ GrB_Info GB (_Adot3B__land_le_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102804,7 +103675,8 @@ GrB_Info GB (_Adot3B__land_le_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -102922,7 +103794,8 @@ GrB_Info GB (_Adot3B__land_le_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103040,7 +103913,8 @@ GrB_Info GB (_Adot3B__land_le_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103158,7 +104032,8 @@ GrB_Info GB (_Adot3B__lxor_le_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103276,7 +104151,8 @@ GrB_Info GB (_Adot3B__lxor_le_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103394,7 +104270,8 @@ GrB_Info GB (_Adot3B__lxor_le_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103512,7 +104389,8 @@ GrB_Info GB (_Adot3B__lxor_le_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103630,7 +104508,8 @@ GrB_Info GB (_Adot3B__lxor_le_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103748,7 +104627,8 @@ GrB_Info GB (_Adot3B__lxor_le_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103866,7 +104746,8 @@ GrB_Info GB (_Adot3B__lxor_le_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -103984,7 +104865,8 @@ GrB_Info GB (_Adot3B__lxor_le_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104102,7 +104984,8 @@ GrB_Info GB (_Adot3B__lxor_le_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104220,7 +105103,8 @@ GrB_Info GB (_Adot3B__lxor_le_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104338,7 +105222,8 @@ GrB_Info GB (_Adot3B__lxor_le_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104456,7 +105341,8 @@ GrB_Info GB (_Adot3B__eq_le_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104574,7 +105460,8 @@ GrB_Info GB (_Adot3B__eq_le_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104692,7 +105579,8 @@ GrB_Info GB (_Adot3B__eq_le_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104810,7 +105698,8 @@ GrB_Info GB (_Adot3B__eq_le_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -104928,7 +105817,8 @@ GrB_Info GB (_Adot3B__eq_le_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105046,7 +105936,8 @@ GrB_Info GB (_Adot3B__eq_le_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105164,7 +106055,8 @@ GrB_Info GB (_Adot3B__eq_le_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105282,7 +106174,8 @@ GrB_Info GB (_Adot3B__eq_le_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105400,7 +106293,8 @@ GrB_Info GB (_Adot3B__eq_le_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105518,7 +106412,8 @@ GrB_Info GB (_Adot3B__eq_le_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105636,7 +106531,8 @@ GrB_Info GB (_Adot3B__eq_le_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105754,7 +106650,8 @@ GrB_Info GB (_Adot3B__plus_lor_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105872,7 +106769,8 @@ GrB_Info GB (_Adot3B__plus_lor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -105990,7 +106888,8 @@ GrB_Info GB (_Adot3B__plus_lor_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106108,7 +107007,8 @@ GrB_Info GB (_Adot3B__plus_lor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106226,7 +107126,8 @@ GrB_Info GB (_Adot3B__plus_lor_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106344,7 +107245,8 @@ GrB_Info GB (_Adot3B__plus_lor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106462,7 +107364,8 @@ GrB_Info GB (_Adot3B__plus_lor_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106580,7 +107483,8 @@ GrB_Info GB (_Adot3B__plus_lor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106698,7 +107602,8 @@ GrB_Info GB (_Adot3B__plus_lor_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106816,7 +107721,8 @@ GrB_Info GB (_Adot3B__plus_lor_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -106934,7 +107840,8 @@ GrB_Info GB (_Adot3B__lor_lor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107052,7 +107959,8 @@ GrB_Info GB (_Adot3B__land_lor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107170,7 +108078,8 @@ GrB_Info GB (_Adot3B__lxor_lor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107288,7 +108197,8 @@ GrB_Info GB (_Adot3B__any_lor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -107406,7 +108316,8 @@ GrB_Info GB (_Adot3B__eq_lor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107524,7 +108435,8 @@ GrB_Info GB (_Adot3B__plus_land_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107642,7 +108554,8 @@ GrB_Info GB (_Adot3B__plus_land_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107760,7 +108673,8 @@ GrB_Info GB (_Adot3B__plus_land_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107878,7 +108792,8 @@ GrB_Info GB (_Adot3B__plus_land_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -107996,7 +108911,8 @@ GrB_Info GB (_Adot3B__plus_land_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108114,7 +109030,8 @@ GrB_Info GB (_Adot3B__plus_land_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108232,7 +109149,8 @@ GrB_Info GB (_Adot3B__plus_land_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108350,7 +109268,8 @@ GrB_Info GB (_Adot3B__plus_land_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108468,7 +109387,8 @@ GrB_Info GB (_Adot3B__plus_land_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108586,7 +109506,8 @@ GrB_Info GB (_Adot3B__plus_land_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108704,7 +109625,8 @@ GrB_Info GB (_Adot3B__lor_land_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108822,7 +109744,8 @@ GrB_Info GB (_Adot3B__land_land_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -108940,7 +109863,8 @@ GrB_Info GB (_Adot3B__lxor_land_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109058,7 +109982,8 @@ GrB_Info GB (_Adot3B__any_land_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -109176,7 +110101,8 @@ GrB_Info GB (_Adot3B__eq_land_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109294,7 +110220,8 @@ GrB_Info GB (_Adot3B__plus_lxor_int8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109412,7 +110339,8 @@ GrB_Info GB (_Adot3B__plus_lxor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109530,7 +110458,8 @@ GrB_Info GB (_Adot3B__plus_lxor_int16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109648,7 +110577,8 @@ GrB_Info GB (_Adot3B__plus_lxor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109766,7 +110696,8 @@ GrB_Info GB (_Adot3B__plus_lxor_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -109884,7 +110815,8 @@ GrB_Info GB (_Adot3B__plus_lxor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110002,7 +110934,8 @@ GrB_Info GB (_Adot3B__plus_lxor_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110120,7 +111053,8 @@ GrB_Info GB (_Adot3B__plus_lxor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110238,7 +111172,8 @@ GrB_Info GB (_Adot3B__plus_lxor_fp32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110356,7 +111291,8 @@ GrB_Info GB (_Adot3B__plus_lxor_fp64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110474,7 +111410,8 @@ GrB_Info GB (_Adot3B__lor_lxor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110592,7 +111529,8 @@ GrB_Info GB (_Adot3B__land_lxor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110710,7 +111648,8 @@ GrB_Info GB (_Adot3B__lxor_lxor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -110828,7 +111767,8 @@ GrB_Info GB (_Adot3B__any_lxor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -110946,7 +111886,8 @@ GrB_Info GB (_Adot3B__eq_lxor_bool)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111064,7 +112005,8 @@ GrB_Info GB (_Adot3B__bor_bor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111182,7 +112124,8 @@ GrB_Info GB (_Adot3B__bor_bor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111300,7 +112243,8 @@ GrB_Info GB (_Adot3B__bor_bor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111418,7 +112362,8 @@ GrB_Info GB (_Adot3B__bor_bor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111536,7 +112481,8 @@ GrB_Info GB (_Adot3B__bor_band_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111654,7 +112600,8 @@ GrB_Info GB (_Adot3B__bor_band_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111772,7 +112719,8 @@ GrB_Info GB (_Adot3B__bor_band_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -111890,7 +112838,8 @@ GrB_Info GB (_Adot3B__bor_band_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112008,7 +112957,8 @@ GrB_Info GB (_Adot3B__bor_bxor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112126,7 +113076,8 @@ GrB_Info GB (_Adot3B__bor_bxor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112244,7 +113195,8 @@ GrB_Info GB (_Adot3B__bor_bxor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112362,7 +113314,8 @@ GrB_Info GB (_Adot3B__bor_bxor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112480,7 +113433,8 @@ GrB_Info GB (_Adot3B__bor_bxnor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112598,7 +113552,8 @@ GrB_Info GB (_Adot3B__bor_bxnor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112716,7 +113671,8 @@ GrB_Info GB (_Adot3B__bor_bxnor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112834,7 +113790,8 @@ GrB_Info GB (_Adot3B__bor_bxnor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -112952,7 +113909,8 @@ GrB_Info GB (_Adot3B__band_bor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113070,7 +114028,8 @@ GrB_Info GB (_Adot3B__band_bor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113188,7 +114147,8 @@ GrB_Info GB (_Adot3B__band_bor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113306,7 +114266,8 @@ GrB_Info GB (_Adot3B__band_bor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113424,7 +114385,8 @@ GrB_Info GB (_Adot3B__band_band_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113542,7 +114504,8 @@ GrB_Info GB (_Adot3B__band_band_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113660,7 +114623,8 @@ GrB_Info GB (_Adot3B__band_band_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113778,7 +114742,8 @@ GrB_Info GB (_Adot3B__band_band_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -113896,7 +114861,8 @@ GrB_Info GB (_Adot3B__band_bxor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114014,7 +114980,8 @@ GrB_Info GB (_Adot3B__band_bxor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114132,7 +115099,8 @@ GrB_Info GB (_Adot3B__band_bxor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114250,7 +115218,8 @@ GrB_Info GB (_Adot3B__band_bxor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114368,7 +115337,8 @@ GrB_Info GB (_Adot3B__band_bxnor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114486,7 +115456,8 @@ GrB_Info GB (_Adot3B__band_bxnor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114604,7 +115575,8 @@ GrB_Info GB (_Adot3B__band_bxnor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114722,7 +115694,8 @@ GrB_Info GB (_Adot3B__band_bxnor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114840,7 +115813,8 @@ GrB_Info GB (_Adot3B__bxor_bor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -114958,7 +115932,8 @@ GrB_Info GB (_Adot3B__bxor_bor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115076,7 +116051,8 @@ GrB_Info GB (_Adot3B__bxor_bor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115194,7 +116170,8 @@ GrB_Info GB (_Adot3B__bxor_bor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115312,7 +116289,8 @@ GrB_Info GB (_Adot3B__bxor_band_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115430,7 +116408,8 @@ GrB_Info GB (_Adot3B__bxor_band_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115548,7 +116527,8 @@ GrB_Info GB (_Adot3B__bxor_band_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115666,7 +116646,8 @@ GrB_Info GB (_Adot3B__bxor_band_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115784,7 +116765,8 @@ GrB_Info GB (_Adot3B__bxor_bxor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -115902,7 +116884,8 @@ GrB_Info GB (_Adot3B__bxor_bxor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116020,7 +117003,8 @@ GrB_Info GB (_Adot3B__bxor_bxor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116138,7 +117122,8 @@ GrB_Info GB (_Adot3B__bxor_bxor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116256,7 +117241,8 @@ GrB_Info GB (_Adot3B__bxor_bxnor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116374,7 +117360,8 @@ GrB_Info GB (_Adot3B__bxor_bxnor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116492,7 +117479,8 @@ GrB_Info GB (_Adot3B__bxor_bxnor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116610,7 +117598,8 @@ GrB_Info GB (_Adot3B__bxor_bxnor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116728,7 +117717,8 @@ GrB_Info GB (_Adot3B__bxnor_bor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116846,7 +117836,8 @@ GrB_Info GB (_Adot3B__bxnor_bor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -116964,7 +117955,8 @@ GrB_Info GB (_Adot3B__bxnor_bor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117082,7 +118074,8 @@ GrB_Info GB (_Adot3B__bxnor_bor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117200,7 +118193,8 @@ GrB_Info GB (_Adot3B__bxnor_band_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117318,7 +118312,8 @@ GrB_Info GB (_Adot3B__bxnor_band_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117436,7 +118431,8 @@ GrB_Info GB (_Adot3B__bxnor_band_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117554,7 +118550,8 @@ GrB_Info GB (_Adot3B__bxnor_band_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117672,7 +118669,8 @@ GrB_Info GB (_Adot3B__bxnor_bxor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117790,7 +118788,8 @@ GrB_Info GB (_Adot3B__bxnor_bxor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -117908,7 +118907,8 @@ GrB_Info GB (_Adot3B__bxnor_bxor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118026,7 +119026,8 @@ GrB_Info GB (_Adot3B__bxnor_bxor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118144,7 +119145,8 @@ GrB_Info GB (_Adot3B__bxnor_bxnor_uint8)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118262,7 +119264,8 @@ GrB_Info GB (_Adot3B__bxnor_bxnor_uint16)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118380,7 +119383,8 @@ GrB_Info GB (_Adot3B__bxnor_bxnor_uint32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118498,7 +119502,8 @@ GrB_Info GB (_Adot3B__bxnor_bxnor_uint64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118616,7 +119621,8 @@ GrB_Info GB (_Adot3B__min_firsti_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118734,7 +119740,8 @@ GrB_Info GB (_Adot3B__min_firsti_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118852,7 +119859,8 @@ GrB_Info GB (_Adot3B__max_firsti_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -118970,7 +119978,8 @@ GrB_Info GB (_Adot3B__max_firsti_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119088,7 +120097,8 @@ GrB_Info GB (_Adot3B__any_firsti_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -119206,7 +120216,8 @@ GrB_Info GB (_Adot3B__any_firsti_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -119324,7 +120335,8 @@ GrB_Info GB (_Adot3B__plus_firsti_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119442,7 +120454,8 @@ GrB_Info GB (_Adot3B__plus_firsti_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119560,7 +120573,8 @@ GrB_Info GB (_Adot3B__times_firsti_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119678,7 +120692,8 @@ GrB_Info GB (_Adot3B__times_firsti_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119796,7 +120811,8 @@ GrB_Info GB (_Adot3B__min_firsti1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -119914,7 +120930,8 @@ GrB_Info GB (_Adot3B__min_firsti1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120032,7 +121049,8 @@ GrB_Info GB (_Adot3B__max_firsti1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120150,7 +121168,8 @@ GrB_Info GB (_Adot3B__max_firsti1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120268,7 +121287,8 @@ GrB_Info GB (_Adot3B__any_firsti1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -120386,7 +121406,8 @@ GrB_Info GB (_Adot3B__any_firsti1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -120504,7 +121525,8 @@ GrB_Info GB (_Adot3B__plus_firsti1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120622,7 +121644,8 @@ GrB_Info GB (_Adot3B__plus_firsti1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120740,7 +121763,8 @@ GrB_Info GB (_Adot3B__times_firsti1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120858,7 +121882,8 @@ GrB_Info GB (_Adot3B__times_firsti1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120976,7 +122001,8 @@ GrB_Info GB (_Adot3B__min_firstj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121094,7 +122120,8 @@ GrB_Info GB (_Adot3B__min_firstj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121212,7 +122239,8 @@ GrB_Info GB (_Adot3B__max_firstj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121330,7 +122358,8 @@ GrB_Info GB (_Adot3B__max_firstj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121448,7 +122477,8 @@ GrB_Info GB (_Adot3B__any_firstj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -121566,7 +122596,8 @@ GrB_Info GB (_Adot3B__any_firstj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -121684,7 +122715,8 @@ GrB_Info GB (_Adot3B__plus_firstj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121802,7 +122834,8 @@ GrB_Info GB (_Adot3B__plus_firstj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -121920,7 +122953,8 @@ GrB_Info GB (_Adot3B__times_firstj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122038,7 +123072,8 @@ GrB_Info GB (_Adot3B__times_firstj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122156,7 +123191,8 @@ GrB_Info GB (_Adot3B__min_firstj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122274,7 +123310,8 @@ GrB_Info GB (_Adot3B__min_firstj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122392,7 +123429,8 @@ GrB_Info GB (_Adot3B__max_firstj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122510,7 +123548,8 @@ GrB_Info GB (_Adot3B__max_firstj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122628,7 +123667,8 @@ GrB_Info GB (_Adot3B__any_firstj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -122746,7 +123786,8 @@ GrB_Info GB (_Adot3B__any_firstj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -122864,7 +123905,8 @@ GrB_Info GB (_Adot3B__plus_firstj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -122982,7 +124024,8 @@ GrB_Info GB (_Adot3B__plus_firstj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123100,7 +124143,8 @@ GrB_Info GB (_Adot3B__times_firstj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123218,7 +124262,8 @@ GrB_Info GB (_Adot3B__times_firstj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123336,7 +124381,8 @@ GrB_Info GB (_Adot3B__min_secondj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123454,7 +124500,8 @@ GrB_Info GB (_Adot3B__min_secondj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123572,7 +124619,8 @@ GrB_Info GB (_Adot3B__max_secondj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123690,7 +124738,8 @@ GrB_Info GB (_Adot3B__max_secondj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -123808,7 +124857,8 @@ GrB_Info GB (_Adot3B__any_secondj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -123926,7 +124976,8 @@ GrB_Info GB (_Adot3B__any_secondj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -124044,7 +125095,8 @@ GrB_Info GB (_Adot3B__plus_secondj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124162,7 +125214,8 @@ GrB_Info GB (_Adot3B__plus_secondj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124280,7 +125333,8 @@ GrB_Info GB (_Adot3B__times_secondj_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124398,7 +125452,8 @@ GrB_Info GB (_Adot3B__times_secondj_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124516,7 +125571,8 @@ GrB_Info GB (_Adot3B__min_secondj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124634,7 +125690,8 @@ GrB_Info GB (_Adot3B__min_secondj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124752,7 +125809,8 @@ GrB_Info GB (_Adot3B__max_secondj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124870,7 +125928,8 @@ GrB_Info GB (_Adot3B__max_secondj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -124988,7 +126047,8 @@ GrB_Info GB (_Adot3B__any_secondj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -125106,7 +126166,8 @@ GrB_Info GB (_Adot3B__any_secondj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 0
@@ -125224,7 +126285,8 @@ GrB_Info GB (_Adot3B__plus_secondj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -125342,7 +126404,8 @@ GrB_Info GB (_Adot3B__plus_secondj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -125460,7 +126523,8 @@ GrB_Info GB (_Adot3B__times_secondj1_int64)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -125578,7 +126642,8 @@ GrB_Info GB (_Adot3B__times_secondj1_int32)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 #if 1
@@ -120,6 +120,18 @@
 #define GB_DISABLE \
     (GxB_NO_BAND || GxB_NO_INT64 || GxB_NO_BAND_INT64)
 
+// 1 if the operator is accelerated with AVX2 or AVX512f
+#define GB_BINOP_HAS_AVX_IMPLEMENTATION \
+    0
+
+//------------------------------------------------------------------------------
+// C += A+B and C = A+B, all 3 matrices dense, with AVX2 or AVX512F
+//------------------------------------------------------------------------------
+
+#if GB_BINOP_HAS_AVX_IMPLEMENTATION
+#include "GB_dense_ewise3_avx.c"
+#endif
+
 //------------------------------------------------------------------------------
 // C += A+B, all 3 matrices dense
 //------------------------------------------------------------------------------
@@ -136,6 +148,22 @@ void GB ((none))
     const int nthreads
 )
 { 
+    #if GB_BINOP_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512F
+        GB_dense_ewise3_accum_avx512f (C, A, B, nthreads) ;
+        return ;
+    }
+    #endif
+    #if GB_BINOP_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        GB_dense_ewise3_accum_avx2 (C, A, B, nthreads) ;
+        return ;
+    }
+    #endif
     #include "GB_dense_ewise3_accum_template.c"
 }
 
@@ -153,6 +181,22 @@ void GB (_Cdense_ewise3_noaccum__band_int64)
     const int nthreads
 )
 { 
+    #if GB_BINOP_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512F
+        GB_dense_ewise3_noaccum_avx512f (C, A, B, nthreads) ;
+        return ;
+    }
+    #endif
+    #if GB_BINOP_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        GB_dense_ewise3_noaccum_avx2 (C, A, B, nthreads) ;
+        return ;
+    }
+    #endif
     #include "GB_dense_ewise3_noaccum_template.c"
 }
 
@@ -99,11 +99,20 @@
 #define GB_DISABLE \
     (GxB_NO_ANY || GxB_NO_FC64 || GxB_NO_ANY_FC64)
 
+// 1 if the monoid is accelerated with AVX2 or AVX512f
+#define GB_MONOID_HAS_AVX_IMPLEMENTATION \
+    0
+
 //------------------------------------------------------------------------------
 // reduce to a non-iso matrix to scalar, for monoids only
 //------------------------------------------------------------------------------
 
 
+
+#if GB_MONOID_HAS_AVX_IMPLEMENTATION && !GB_DISABLE
+#include "GB_reduce_to_scalar_avx.c"
+#endif
+
 GrB_Info GB (_red_scalar__any_fc64)
 (
     GxB_FC64_t *result,
@@ -119,6 +128,22 @@ GrB_Info GB (_red_scalar__any_fc64)
     #else
     GxB_FC64_t s = (*result) ;
     GxB_FC64_t *restrict W = (GxB_FC64_t *) W_space ;
+    #if GB_MONOID_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        // x86_64 with AVX512F
+        GB_reduce_to_scalar_avx512f (&s, A, W, F, ntasks, nthreads) ;
+    }
+    else
+    #endif
+    #if GB_MONOID_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        // x86_64 with AVX2
+        GB_reduce_to_scalar_avx2 (&s, A, W, F, ntasks, nthreads) ;
+    }
+    else
+    #endif
     if (A->nzombies > 0 || GB_IS_BITMAP (A))
     {
         #include "GB_reduce_to_scalar_template.c"
@@ -17,7 +17,8 @@ GrB_Info GB (_Adot3B)
     const GrB_Matrix B,
     const GB_task_struct *restrict TaskList,
     const int ntasks,
-    const int nthreads
+    const int nthreads,
+    GB_Context Context
 ) ;
 
 if_dot4_enabled
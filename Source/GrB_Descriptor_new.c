@@ -54,6 +54,8 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->do_sort = false ;        // do not sort in GrB_mxm and others
     desc->compression = GxB_DEFAULT ;
     desc->import = GxB_DEFAULT ;   // trust input data in GxB import/deserialize
+    desc->arena = NULL ;           // no arena for werkspace
+    desc->plan = NULL ;            // no plan for C=A*B
     return (GrB_SUCCESS) ;
 }
 
@@ -27,7 +27,7 @@ GrB_Info GrB_Descriptor_set     // set a parameter in a descriptor
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GrB_Descriptor_set (desc, field, value)") ;
+    GB_WHERE_LOGGER (desc, "GrB_Descriptor_set (desc, field, value)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
 
@@ -105,15 +105,18 @@ GrB_Info GrB_Descriptor_set     // set a parameter in a descriptor
 
             if (! (value == GxB_DEFAULT  || value == GxB_AxB_GUSTAVSON
                 || value == GxB_AxB_DOT
-                || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY))
+                || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY
+                || value == GxB_AxB_OUTER))
             { 
                 GB_ERROR (GrB_INVALID_VALUE,
                     "invalid descriptor value [%d] for GrB_AxB_METHOD field;\n"
                     "must be GxB_DEFAULT [%d], GxB_AxB_GUSTAVSON [%d]\n"
-                    "GxB_AxB_DOT [%d], GxB_AxB_HASH [%d] or GxB_AxB_SAXPY [%d]",
+                    "GxB_AxB_DOT [%d], GxB_AxB_HASH [%d], GxB_AxB_SAXPY [%d]"
+                    " or GxB_AxB_OUTER [%d]",
                     (int) value, (int) GxB_DEFAULT, (int) GxB_AxB_GUSTAVSON,
                     (int) GxB_AxB_DOT,
-                    (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY) ;
+                    (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY,
+                    (int) GxB_AxB_OUTER) ;
             }
             desc->axb = value ;
             break ;
@@ -138,6 +138,16 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // assemble any tuples from concurrent setElement, since they come first
+    //--------------------------------------------------------------------------
+
+    if (GB_INGEST (C))
+    { 
+        GrB_Info info ;
+        GB_OK (GB_wait (C, "C (removeElement:concurrent)", Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
@@ -21,7 +21,7 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
     GrB_Index col                       /* column index                   */\
 )                                                                           \
 {                                                                           \
-    GB_WHERE (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)             \
+    GB_WHERE_SETELEMENT (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)  \
         " (C, row, col, x)") ;                                              \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
     return (GB_setElement (C, ampersand x, row, col, GB_ ## T ## _code,     \
@@ -64,7 +64,7 @@ GrB_Info GrB_Matrix_setElement_Scalar
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (C, "GrB_Matrix_setElement_Scalar (C, x, row, col)") ;
+    GB_WHERE_SETELEMENT (C, "GrB_Matrix_setElement_Scalar (C, x, row, col)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_NULL_OR_FAULTY (scalar) ;
 
@@ -7,7 +7,9 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a matrix, followed by an OpenMP flush.
+// Finishes all work on a matrix, followed by an OpenMP flush.  If the
+// waitmode is GrB_MATERIALIZE and A is hypersparse, the hash index of its
+// hyperlist is also constructed, if A has enough vectors (see GxB_HYPER_HASH).
 
 #include "GB.h"
 
@@ -29,11 +31,11 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     //--------------------------------------------------------------------------
 
     #if (GxB_IMPLEMENTATION_MAJOR <= 5)
-    GB_WHERE ((*A), "GrB_Matrix_wait (&A)") ;
+    GB_WHERE_LOGGER ((*A), "GrB_Matrix_wait (&A)") ;
     GB_RETURN_IF_NULL (A) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     #else
-    GB_WHERE (A, "GrB_Matrix_wait (A, waitmode)") ;
+    GB_WHERE_LOGGER (A, "GrB_Matrix_wait (A, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     #endif
 
@@ -57,6 +59,11 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
         GB_OK (GB_wait (A, "matrix", Context)) ;
         GB_BURBLE_END ;
     }
+    if (waitmode == GrB_MATERIALIZE)
+    { 
+        // build the hash index of A->h, if A is hypersparse with many vectors
+        GB_hyper_hash_build (A, Context) ;
+    }
     #endif
 
     //--------------------------------------------------------------------------
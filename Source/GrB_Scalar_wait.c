@@ -29,11 +29,11 @@ GrB_Info GrB_Scalar_wait    // finish all work on a scalar
     //--------------------------------------------------------------------------
 
     #if (GxB_IMPLEMENTATION_MAJOR <= 5)
-    GB_WHERE ((*s), "GrB_Scalar_wait (&s)") ;
+    GB_WHERE_LOGGER ((*s), "GrB_Scalar_wait (&s)") ;
     GB_RETURN_IF_NULL (s) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*s) ;
     #else
-    GB_WHERE (s, "GrB_Scalar_wait (s, waitmode)") ;
+    GB_WHERE_LOGGER (s, "GrB_Scalar_wait (s, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (s) ;
     #endif
 
@@ -110,6 +110,17 @@ GrB_Info GB_Vector_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // assemble any tuples from concurrent setElement, since they come first
+    //--------------------------------------------------------------------------
+
+    if (GB_INGEST (V))
+    { 
+        GrB_Info info ;
+        GB_OK (GB_wait ((GrB_Matrix) V, "v (removeElement:concurrent)",
+            Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
@@ -20,7 +20,8 @@ GrB_Info GB_EVAL3 (prefix, _Vector_setElement_, T)    /* w(row) = x */      \
     GrB_Index row                       /* row index                  */    \
 )                                                                           \
 {                                                                           \
-    GB_WHERE (w, "GrB_Vector_setElement_" GB_STR(T) " (w, x, row)") ;       \
+    GB_WHERE_SETELEMENT (w, "GrB_Vector_setElement_" GB_STR(T)              \
+        " (w, x, row)") ;                                                   \
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
     ASSERT (GB_VECTOR_OK (w)) ;                                             \
     return (GB_setElement ((GrB_Matrix) w, ampersand x, row, 0,             \
@@ -62,7 +63,7 @@ GrB_Info GrB_Vector_setElement_Scalar
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (w, "GrB_Vector_setElement_Scalar (w, x, row)") ;
+    GB_WHERE_SETELEMENT (w, "GrB_Vector_setElement_Scalar (w, x, row)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;
     GB_RETURN_IF_NULL_OR_FAULTY (scalar) ;
     ASSERT (GB_VECTOR_OK (w)) ;
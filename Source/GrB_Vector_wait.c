@@ -29,11 +29,11 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
     //--------------------------------------------------------------------------
 
     #if (GxB_IMPLEMENTATION_MAJOR <= 5)
-    GB_WHERE ((*v), "GrB_Vector_wait (&v)") ;
+    GB_WHERE_LOGGER ((*v), "GrB_Vector_wait (&v)") ;
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     #else
-    GB_WHERE (v, "GrB_Vector_wait (v, waitmode)") ;
+    GB_WHERE_LOGGER (v, "GrB_Vector_wait (v, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     #endif
 
@@ -15,6 +15,8 @@
 #include "GB_mxm.h"
 #include "GB_get_mask.h"
 
+#define GB_FREE_ALL ;
+
 GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
 (
     GrB_Vector w,                   // input/output vector for results
@@ -49,6 +51,14 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // select push or pull, if A is in push/pull mode
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A_final = A ;
+    GB_OK (GB_AxB_push_pull (&A_final, &A_transpose, &AxB_method,
+        (GrB_Matrix) w, M, Mask_comp, (GrB_Matrix) u, semiring, Context)) ;
+
     //--------------------------------------------------------------------------
     // w<M> = accum (w,A*u) and variations, using the mxm kernel
     //--------------------------------------------------------------------------
@@ -59,7 +69,7 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
         M, Mask_comp, Mask_struct,          // mask and its descriptor
         accum,                              // for accum (w,t)
         semiring,                           // definition of matrix multiply
-        A,                  A_transpose,    // allow A to be transposed
+        A_final,            A_transpose,    // allow A to be transposed
         (GrB_Matrix) u,     false,          // u is never transposed
         false,                              // fmult(x,y), flipxy = false
         AxB_method, do_sort,                // algorithm selector
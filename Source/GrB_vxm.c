@@ -16,6 +16,8 @@
 #include "GB_mxm.h"
 #include "GB_get_mask.h"
 
+#define GB_FREE_ALL ;
+
 GrB_Info GrB_vxm                    // w'<M> = accum (w', u'*A)
 (
     GrB_Vector w,                   // input/output vector for results
@@ -60,12 +62,19 @@ GrB_Info GrB_vxm                    // w'<M> = accum (w', u'*A)
     // Since A and u are swapped, in all the matrix multiply kernels,
     // the multiplier must be flipped, so flipxy is passed in as true.
 
+    A_transpose = !A_transpose ;
+
+    // select push or pull, if A is in push/pull mode
+    GrB_Matrix A_final = A ;
+    GB_OK (GB_AxB_push_pull (&A_final, &A_transpose, &AxB_method,
+        (GrB_Matrix) w, M, Mask_comp, (GrB_Matrix) u, semiring, Context)) ;
+
     info = GB_mxm (
         (GrB_Matrix) w,     C_replace,      // w and its descriptor
         M, Mask_comp, Mask_struct,          // mask and its descriptor
         accum,                              // for accum (w,t)
         semiring,                           // definition of matrix multiply
-        A,                  !A_transpose,   // allow A to be transposed
+        A_final,            A_transpose,    // allow A to be transposed
         (GrB_Matrix) u,     false,          // u is never transposed
         true,                               // fmult(y,x), flipxy = true
         AxB_method, do_sort,                // algorithm selector
@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GxB_Arena_clear: reset the statistics of an arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The high-water mark and the overflow count of the arena are set to zero.
+// The arena itself is not modified.
+
+#include "GB.h"
+
+GrB_Info GxB_Arena_clear        // reset the high-water mark of an arena
+(
+    GxB_Arena arena             // arena to modify
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Arena_clear (arena)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (arena) ;
+
+    //--------------------------------------------------------------------------
+    // clear the statistics
+    //--------------------------------------------------------------------------
+
+    arena->highwater = 0 ;
+    arena->noverflow = 0 ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GxB_Arena_free: free an arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The arena must not be freed while it is attached to a descriptor that is
+// still in use.  Any descriptor that holds the arena must be freed first, or
+// have its arena removed with GxB_set (desc, GxB_ARENA, NULL).
+
+#include "GB.h"
+
+GrB_Info GxB_Arena_free         // free an arena
+(
+    GxB_Arena *arena            // handle of arena to free
+)
+{
+
+    if (arena != NULL)
+    {
+        GxB_Arena a = *arena ;
+        if (a != NULL)
+        {
+            size_t header_size = a->header_size ;
+            if (header_size > 0)
+            { 
+                ASSERT (a->nlive == 0) ;
+                GB_FREE (&(a->space), a->space_size) ;
+                a->space_size = 0 ;
+                a->magic = GB_FREED ;  // to help detect dangling pointers
+                a->header_size = 0 ;
+                GB_FREE (arena, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
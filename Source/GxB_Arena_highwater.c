@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GxB_Arena_highwater: report the memory usage of an arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// highwater is the largest # of bytes ever in use in the arena.  noverflow is
+// the # of werkspace requests that did not fit in the arena, and which were
+// allocated by malloc instead.  If noverflow is nonzero, a larger arena may
+// be faster.  Both statistics are reset to zero by GxB_Arena_clear.
+
+#include "GB.h"
+
+GrB_Info GxB_Arena_highwater    // report the memory usage of an arena
+(
+    size_t *highwater,          // max # of bytes in use in the arena
+    int64_t *noverflow,         // # of requests that did not fit
+    const GxB_Arena arena       // arena to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Arena_highwater (&highwater, &noverflow, arena)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (arena) ;
+
+    //--------------------------------------------------------------------------
+    // return the statistics
+    //--------------------------------------------------------------------------
+
+    if (highwater != NULL)
+    { 
+        (*highwater) = arena->highwater ;
+    }
+    if (noverflow != NULL)
+    { 
+        (*noverflow) = arena->noverflow ;
+    }
+    return (GrB_SUCCESS) ;
+}
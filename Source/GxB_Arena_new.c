@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// GxB_Arena_new: create a new arena for werkspace
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The arena is a single block of memory of the given size.  It is attached to
+// a descriptor with GxB_set (desc, GxB_ARENA, arena).  See GB_arena.c.
+
+#include "GB.h"
+
+#define GB_FREE_ALL GxB_Arena_free (arena) ;
+
+GrB_Info GxB_Arena_new          // create a new arena
+(
+    GxB_Arena *arena,           // handle of arena to create
+    size_t size                 // size of the arena, in bytes
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Arena_new (&arena, size)") ;
+    GB_RETURN_IF_NULL (arena) ;
+    (*arena) = NULL ;
+    if (size == 0 || size > GB_NMAX)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the arena
+    //--------------------------------------------------------------------------
+
+    // allocate the header
+    size_t header_size ;
+    (*arena) = GB_MALLOC (1, struct GB_Arena_opaque, &header_size) ;
+    if (*arena == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // initialize the header
+    GxB_Arena a = (*arena) ;
+    a->magic = GB_MAGIC ;
+    a->header_size = header_size ;
+    a->space = NULL ;
+    a->space_size = 0 ;
+    a->top = 0 ;
+    a->nlive = 0 ;
+    a->highwater = 0 ;
+    a->noverflow = 0 ;
+
+    // allocate the space itself
+    a->space = GB_MALLOC (size, GB_void, &(a->space_size)) ;
+    if (a->space == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -147,6 +147,28 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                GxB_Arena *arena = va_arg (ap, GxB_Arena *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (arena) ;
+                (*arena) = (desc == NULL) ? NULL : desc->arena ;
+            }
+            break ;
+
+        case GxB_MXM_PLAN : 
+
+            {
+                va_start (ap, field) ;
+                GxB_MxM_Plan *plan = va_arg (ap, GxB_MxM_Plan *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (plan) ;
+                (*plan) = (desc == NULL) ? NULL : desc->plan ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -32,7 +32,7 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GxB_Desc_set (desc, field, value)") ;
+    GB_WHERE_LOGGER (desc, "GxB_Desc_set (desc, field, value)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
 
@@ -152,16 +152,19 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 va_end (ap) ;
                 if (! (value == GxB_DEFAULT  || value == GxB_AxB_GUSTAVSON
                     || value == GxB_AxB_DOT
-                    || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY))
+                    || value == GxB_AxB_HASH || value == GxB_AxB_SAXPY
+                    || value == GxB_AxB_OUTER))
                 { 
                     GB_ERROR (GrB_INVALID_VALUE,
                         "invalid descriptor value [%d] for GrB_AxB_METHOD"
                         " field;\nmust be GxB_DEFAULT [%d], GxB_AxB_GUSTAVSON"
                         " [%d]\nGxB_AxB_DOT [%d]"
-                        " GxB_AxB_HASH [%d] or GxB_AxB_SAXPY [%d]",
+                        " GxB_AxB_HASH [%d], GxB_AxB_SAXPY [%d]"
+                        " or GxB_AxB_OUTER [%d]",
                         value, (int) GxB_DEFAULT, (int) GxB_AxB_GUSTAVSON,
                         (int) GxB_AxB_DOT,
-                        (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY) ;
+                        (int) GxB_AxB_HASH, (int) GxB_AxB_SAXPY,
+                        (int) GxB_AxB_OUTER) ;
                 }
                 desc->axb = (GrB_Desc_Value) value ;
             }
@@ -198,16 +201,42 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_ARENA : 
+
+            {
+                va_start (ap, field) ;
+                GxB_Arena arena = va_arg (ap, GxB_Arena) ;
+                va_end (ap) ;
+                // arena may be NULL, to remove the arena from the descriptor
+                GB_RETURN_IF_FAULTY (arena) ;
+                desc->arena = arena ;
+            }
+            break ;
+
+        case GxB_MXM_PLAN : 
+
+            {
+                va_start (ap, field) ;
+                GxB_MxM_Plan plan = va_arg (ap, GxB_MxM_Plan) ;
+                va_end (ap) ;
+                // plan may be NULL, to remove the plan from the descriptor
+                GB_RETURN_IF_FAULTY (plan) ;
+                desc->plan = plan ;
+            }
+            break ;
+
         default : 
 
             GB_ERROR (GrB_INVALID_VALUE,
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]\n"
                 "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d]\n"
-                "GxB_SORT [%d], or GxB_COMPRESSION [%d]\n",
+                "GxB_SORT [%d], GxB_COMPRESSION [%d], GxB_ARENA [%d],\n"
+                "or GxB_MXM_PLAN [%d]\n",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK,
-                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION) ;
+                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION,
+                (int) GxB_ARENA, (int) GxB_MXM_PLAN) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -73,6 +73,43 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_HYPER_HASH : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *hyper_hash = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (hyper_hash) ;
+                (*hyper_hash) = GB_Global_hyper_hash_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // AVX2 and AVX512F kernels
+        //----------------------------------------------------------------------
+
+        case GxB_CPU_AVX2 : 
+
+            {
+                va_start (ap, field) ;
+                bool *avx2 = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (avx2) ;
+                (*avx2) = GB_Global_cpu_features_avx2 ( ) ;
+            }
+            break ;
+
+        case GxB_CPU_AVX512F : 
+
+            {
+                va_start (ap, field) ;
+                bool *avx512f = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (avx512f) ;
+                (*avx512f) = GB_Global_cpu_features_avx512f ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // mode from GrB_init (blocking or non-blocking)
         //----------------------------------------------------------------------
@@ -136,6 +173,32 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_MEMORY_POOL_MAGAZINE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *magazine_limit = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (magazine_limit) ;
+                for (int k = 0 ; k < 64 ; k++)
+                { 
+                    magazine_limit [k] =
+                        GB_Global_free_pool_magazine_limit_get (k) ;
+                }
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *stats = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                GB_Global_free_pool_stats_get (stats) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, date, license, etc
         //----------------------------------------------------------------------
@@ -81,6 +81,42 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_HYPER_HASH : 
+
+            {
+                va_start (ap, field) ;
+                int64_t hyper_hash = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_Global_hyper_hash_set (hyper_hash) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // AVX2 and AVX512F kernels
+        //----------------------------------------------------------------------
+
+        case GxB_CPU_AVX2 : 
+
+            {
+                va_start (ap, field) ;
+                int avx2 = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_cpu_features_set ((bool) avx2,
+                    GB_Global_cpu_features_avx512f ( )) ;
+            }
+            break ;
+
+        case GxB_CPU_AVX512F : 
+
+            {
+                va_start (ap, field) ;
+                int avx512f = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_cpu_features_set (GB_Global_cpu_features_avx2 ( ),
+                    (bool) avx512f) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // OpenMP control
         //----------------------------------------------------------------------
@@ -132,6 +168,36 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_MEMORY_POOL_MAGAZINE : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *magazine_limit = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                for (int k = 3 ; k < 64 ; k++)
+                { 
+                    // a negative limit selects the default
+                    GB_Global_free_pool_magazine_limit_set (k,
+                        (magazine_limit == NULL) ? -1 : magazine_limit [k]) ;
+                }
+            }
+            break ;
+
+        case GxB_MEMORY_POOL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                void *stats = va_arg (ap, void *) ;
+                va_end (ap) ;
+                if (stats != NULL)
+                { 
+                    // the statistics can only be cleared
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_free_pool_stats_clear ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // diagnostics
         //----------------------------------------------------------------------
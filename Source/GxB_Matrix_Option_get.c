@@ -100,6 +100,28 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_CONCURRENT_INGEST : 
+
+            {
+                va_start (ap, field) ;
+                bool *concurrent = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (concurrent) ;
+                (*concurrent) = (A->Ingest != NULL) ;
+            }
+            break ;
+
+        case GxB_PUSH_PULL : 
+
+            { 
+                va_start (ap, field) ;
+                bool *push_pull = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (push_pull) ;
+                (*push_pull) = A->push_pull ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
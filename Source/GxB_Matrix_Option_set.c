@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_transpose.h"
+#include "GB_Pending.h"
 
 #define GB_FREE_ALL ;
 
@@ -94,6 +95,45 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
             }
             break ;
 
+        case GxB_CONCURRENT_INGEST : 
+
+            {
+                va_start (ap, field) ;
+                bool concurrent = (bool) va_arg (ap, int) ;
+                va_end (ap) ;
+                if (concurrent && A->Ingest == NULL)
+                { 
+                    // allocate the per-thread lists of pending tuples
+                    if (!GB_Ingest_alloc (&(A->Ingest), Context))
+                    { 
+                        // out of memory
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                }
+                else if (!concurrent && A->Ingest != NULL)
+                { 
+                    // assemble any tuples from concurrent setElement, and
+                    // free the per-thread lists
+                    if (GB_INGEST (A))
+                    { 
+                        GB_OK (GB_wait (A, "A (ingest off)", Context)) ;
+                    }
+                    GB_Ingest_free (&(A->Ingest)) ;
+                }
+            }
+            break ;
+
+        case GxB_PUSH_PULL : 
+
+            { 
+                va_start (ap, field) ;
+                A->push_pull = (bool) va_arg (ap, int) ;
+                va_end (ap) ;
+                // any cached transpose of A has already been freed by GB_WHERE
+                ASSERT (A->AT == NULL) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_fd: create a matrix from a file descriptor
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a file, pipe, or socket, read with the
+// POSIX read.  The stream must have been created by GxB_Matrix_serialize_fd or
+// GxB_Matrix_serialize_stream.  Only the bytes of the serialized matrix are
+// read, and the file descriptor is not closed.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_fd  // deserialize a GrB_Matrix from a file
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the file
+    // input:
+    GrB_Type type,      // type of the matrix C (see GxB_Matrix_deserialize)
+    int fd,                         // file descriptor to read from
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_fd (&C, type, fd, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_fd") ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (fd < 0)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid file descriptor: %d", fd) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // deserialize the file into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_stream (C, type, GB_fd_read, (void *) &fd, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize_stream: create a matrix from a user-provided stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// deserialize: create a GrB_Matrix from a stream created by
+// GxB_Matrix_serialize_stream or GxB_Matrix_serialize_fd, read with a
+// user-provided read_function.  The descriptor controls the # of threads used.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize_stream  // deserialize stream into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the stream
+    // input:
+    GrB_Type type,      // type of the matrix C.  Required if the stream holds
+                        // a matrix of user-defined type.  May be NULL if the
+                        // stream holds a built-in type; otherwise must match
+                        // the type of C.
+    GxB_stream_read_function read_function,     // reads from the stream
+    void *stream,                   // stream to read from
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_deserialize_stream (&C, type, read_function, "
+        "stream, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize_stream") ;
+    GB_RETURN_IF_NULL (read_function) ;
+    GB_RETURN_IF_NULL (C) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the stream into a matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize_stream (C, type, read_function, stream, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
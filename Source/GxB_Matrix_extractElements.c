@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements: extract a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Extract the values of a list of entries, X [k] = A (I [k], J [k]) for
+// k = 0:n-1, typecasting from the type of A to the type of X, as needed.
+
+// Returns GrB_SUCCESS if all the entries are present, or GrB_NO_VALUE if any
+// are not.  If the optional Found array is present, Found [k] is set true if
+// A (I [k], J [k]) is present, and false otherwise.  X [k] is not modified
+// if the entry is not present.
+
+#include "GB.h"
+
+#define GB_EXTRACT(prefix,type,T)                                           \
+GrB_Info GB_EVAL3 (prefix, _Matrix_extractElements_, T) /* X=A(I,J) */      \
+(                                                                           \
+    type *X,                        /* array of extracted values          */\
+    bool *Found,                    /* optional: true if entry present    */\
+    const GrB_Matrix A,             /* matrix to extract entries from     */\
+    const GrB_Index *I,             /* array of row indices of tuples     */\
+    const GrB_Index *J,             /* array of column indices of tuples  */\
+    GrB_Index nvals                 /* number of tuples                   */\
+)                                                                           \
+{                                                                           \
+    GB_WHERE1 ("GxB_Matrix_extractElements_" GB_STR(T)                      \
+        " (X, Found, A, I, J, nvals)") ;                                    \
+    GB_BURBLE_START ("GxB_Matrix_extractElements") ;                        \
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                       \
+    GB_RETURN_IF_NULL (J) ;                                                 \
+    GrB_Info info = GB_extractElements ((void *) X, GB_ ## T ## _code,      \
+        Found, A, I, J, (int64_t) nvals, Context) ;                         \
+    GB_BURBLE_END ;                                                         \
+    return (info) ;                                                         \
+}
+
+GB_EXTRACT (GxB, bool      , BOOL   )
+GB_EXTRACT (GxB, int8_t    , INT8   )
+GB_EXTRACT (GxB, int16_t   , INT16  )
+GB_EXTRACT (GxB, int32_t   , INT32  )
+GB_EXTRACT (GxB, int64_t   , INT64  )
+GB_EXTRACT (GxB, uint8_t   , UINT8  )
+GB_EXTRACT (GxB, uint16_t  , UINT16 )
+GB_EXTRACT (GxB, uint32_t  , UINT32 )
+GB_EXTRACT (GxB, uint64_t  , UINT64 )
+GB_EXTRACT (GxB, float     , FP32   )
+GB_EXTRACT (GxB, double    , FP64   )
+GB_EXTRACT (GxB, GxB_FC32_t, FC32   )
+GB_EXTRACT (GxB, GxB_FC64_t, FC64   )
+GB_EXTRACT (GxB, void      , UDT    )
+
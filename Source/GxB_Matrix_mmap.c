@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_mmap: create a matrix from a memory-mapped file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Maps a file written by GxB_Matrix_serialize_mmap into memory, read-only, and
+// creates a matrix C whose content points directly into the mapped file.  No
+// data is read or copied, so this takes O(1) time, and the pages of the file
+// are shared in the page cache by all processes that map the same file.  The
+// file descriptor may be closed once C has been created.  The file remains
+// mapped until C is freed, and the file must not be modified while it is
+// mapped.
+
+// C is read-only.  It may be used as an input to any GraphBLAS method, but it
+// must not be used as an output, nor be modified by GrB_*_setElement,
+// GrB_*_removeElement, or GrB_Matrix_clear.  It cannot be exported or
+// unpacked.  Use GrB_Matrix_dup to create a modifiable copy.  Example usage:
+
+/*
+    // in one process:
+    int fd = open ("A.grb", O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    GxB_Matrix_serialize_mmap (fd, A, NULL) ;
+    close (fd) ;
+    // in any other process:
+    fd = open ("A.grb", O_RDONLY) ;
+    GxB_Matrix_mmap (&C, atype, fd, NULL) ;
+    close (fd) ;
+    ... use C as an input to any GraphBLAS method ...
+    GrB_Matrix_free (&C) ;      // unmaps the file
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_mmap            // create a matrix from a mapped file
+(
+    // output:
+    GrB_Matrix *C,      // output matrix created from the file (read-only)
+    // input:
+    GrB_Type type,      // type of the matrix C (see GxB_Matrix_deserialize)
+    int fd,                         // file descriptor of the file to map
+    const GrB_Descriptor desc       // currently unused
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_mmap (&C, type, fd, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_mmap") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (fd < 0)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid file descriptor: %d", fd) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // map the file and create the matrix
+    //--------------------------------------------------------------------------
+
+    GB_void *base = NULL ;
+    size_t size = 0 ;
+    info = GB_mmap (&base, &size, fd) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GB_deserialize_mmap (C, type, base, size, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // the file is invalid; unmap it
+            GB_munmap ((void **) &base, &size) ;
+        }
+    }
+    GB_BURBLE_END ;
+    return (info) ;
+}
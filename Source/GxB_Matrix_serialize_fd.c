@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_fd: serialize a matrix to a file descriptor
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Matrix to a file, pipe, or socket, with the POSIX write.
+// The matrix is written as a stream, which can be read back with
+// GxB_Matrix_deserialize_fd or GxB_Matrix_deserialize_stream.  The file
+// descriptor is not closed.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_fd    // serialize a GrB_Matrix to a file
+(
+    // input:
+    int fd,                         // file descriptor to write to
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_fd (fd, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_fd") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (fd < 0)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid file descriptor: %d", fd) ;
+    }
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the file
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (GB_fd_write, (void *) &fd, A, method, false,
+        Context) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
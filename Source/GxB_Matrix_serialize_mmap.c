@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_mmap: write a matrix to a file for GxB_Matrix_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Writes a GrB_Matrix to a file, uncompressed, with each of its arrays padded
+// to start on a page boundary.  The file can then be mapped into memory with
+// GxB_Matrix_mmap, which creates a matrix in O(1) time with no copying.  The
+// file descriptor must refer to a regular file, opened for writing at its
+// start, and it is not closed.  The compression method in the descriptor is
+// ignored; the descriptor only controls the # of threads used.
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_mmap  // write a GrB_Matrix to a file for mmap
+(
+    // input:
+    int fd,                         // file descriptor to write to
+    GrB_Matrix A,                   // matrix to write
+    const GrB_Descriptor desc       // to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_mmap (fd, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize_mmap") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+    if (fd < 0)
+    { 
+        GB_ERROR (GrB_INVALID_VALUE, "Invalid file descriptor: %d", fd) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the matrix to the file, in the layout for mmap
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (GB_fd_write, (void *) &fd, A,
+        GxB_COMPRESSION_NONE, true, Context) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
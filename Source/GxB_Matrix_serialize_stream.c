@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize_stream: serialize a matrix to a user-provided stream
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// serialize a GrB_Matrix to a stream, with a user-provided write_function
+
+// This method is similar to GxB_Matrix_serialize, except that the serialized
+// matrix is passed to the write_function in a sequence of compressed blocks,
+// instead of being returned as a single blob.  The descriptor selects the
+// compression method and controls the # of threads used.  Example usage, with
+// a stdio FILE as the stream:
+
+/*
+    bool my_fwrite (void *stream, const void *buffer, size_t size)
+    {
+        return (fwrite (buffer, 1, size, (FILE *) stream) == size) ;
+    }
+    ...
+    FILE *f = fopen ("A.grb", "wb") ;
+    GxB_Matrix_serialize_stream (my_fwrite, (void *) f, A, NULL) ;
+    fclose (f) ;
+*/
+
+#include "GB.h"
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_serialize_stream    // serialize a GrB_Matrix to a stream
+(
+    // input:
+    GxB_stream_write_function write_function,   // writes to the stream
+    void *stream,                   // stream to write to
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor to select compression method
+                                    // and to control # of threads used
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_serialize_stream (write_function, stream, A, desc)");
+    GB_BURBLE_START ("GxB_Matrix_serialize_stream") ;
+    GB_RETURN_IF_NULL (write_function) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    // get the compression method from the descriptor
+    int method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    //--------------------------------------------------------------------------
+    // serialize the matrix to the stream
+    //--------------------------------------------------------------------------
+
+    info = GB_serialize_stream (write_function, stream, A, method, false,
+        Context) ;
+    GB_BURBLE_END ;
+    #pragma omp flush
+    return (info) ;
+}
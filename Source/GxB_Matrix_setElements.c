@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: set a list of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Set a list of entries in a matrix, C (I [k], J [k]) = X [k] for k = 0:n-1,
+// typecasting from the type of X to the type of C, as needed.  The result is
+// the same as n calls to GrB_Matrix_setElement, in order.
+
+#include "GB.h"
+
+#define GB_SET(prefix,type,T)                                               \
+GrB_Info GB_EVAL3 (prefix, _Matrix_setElements_, T) /* C(I,J)=X */          \
+(                                                                           \
+    GrB_Matrix C,                   /* matrix to modify                   */\
+    const GrB_Index *I,             /* array of row indices of tuples     */\
+    const GrB_Index *J,             /* array of column indices of tuples  */\
+    const type *X,                  /* array of values of tuples          */\
+    GrB_Index nvals                 /* number of tuples                   */\
+)                                                                           \
+{                                                                           \
+    GB_WHERE (C, "GxB_Matrix_setElements_" GB_STR(T)                        \
+        " (C, I, J, X, nvals)") ;                                           \
+    GB_BURBLE_START ("GxB_Matrix_setElements") ;                            \
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
+    GB_RETURN_IF_NULL (J) ;                                                 \
+    GrB_Info info = GB_setElements (C, I, J, (const void *) X,              \
+        GB_ ## T ## _code, (int64_t) nvals, Context) ;                      \
+    GB_BURBLE_END ;                                                         \
+    return (info) ;                                                         \
+}
+
+GB_SET (GxB, bool      , BOOL   )
+GB_SET (GxB, int8_t    , INT8   )
+GB_SET (GxB, int16_t   , INT16  )
+GB_SET (GxB, int32_t   , INT32  )
+GB_SET (GxB, int64_t   , INT64  )
+GB_SET (GxB, uint8_t   , UINT8  )
+GB_SET (GxB, uint16_t  , UINT16 )
+GB_SET (GxB, uint32_t  , UINT32 )
+GB_SET (GxB, uint64_t  , UINT64 )
+GB_SET (GxB, float     , FP32   )
+GB_SET (GxB, double    , FP64   )
+GB_SET (GxB, GxB_FC32_t, FC32   )
+GB_SET (GxB, GxB_FC64_t, FC64   )
+GB_SET (GxB, void      , UDT    )
+
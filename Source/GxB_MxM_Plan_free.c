@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GxB_MxM_Plan_free: free a plan for C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The plan must not be freed while it is attached to a descriptor that is
+// still in use.  Any descriptor that holds the plan must be freed first, or
+// have its plan removed with GxB_set (desc, GxB_MXM_PLAN, NULL).
+
+#include "GB_AxB_saxpy3.h"
+
+GrB_Info GxB_MxM_Plan_free      // free a plan
+(
+    GxB_MxM_Plan *plan          // handle of plan to free
+)
+{
+
+    if (plan != NULL)
+    {
+        GxB_MxM_Plan p = *plan ;
+        if (p != NULL)
+        {
+            size_t header_size = p->header_size ;
+            if (header_size > 0)
+            { 
+                GB_AxB_saxpy3_plan_clear (p) ;
+                p->magic = GB_FREED ;  // to help detect dangling pointers
+                p->header_size = 0 ;
+                GB_FREE (plan, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
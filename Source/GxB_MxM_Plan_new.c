@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_MxM_Plan_new: create a new, empty plan for C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The plan is empty when created.  It is attached to a descriptor with GxB_set
+// (desc, GxB_MXM_PLAN, plan), and the analysis is saved in the plan by the
+// first GrB_mxm, GrB_mxv, or GrB_vxm that uses it.  See GB_AxB_saxpy3_plan.c.
+
+#include "GB.h"
+
+GrB_Info GxB_MxM_Plan_new       // create a new, empty plan
+(
+    GxB_MxM_Plan *plan          // handle of plan to create
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_MxM_Plan_new (&plan)") ;
+    GB_RETURN_IF_NULL (plan) ;
+    (*plan) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the plan
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    (*plan) = GB_MALLOC (1, struct GB_MxM_Plan_opaque, &header_size) ;
+    if (*plan == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GxB_MxM_Plan p = (*plan) ;
+    p->magic = GB_MAGIC ;
+    p->header_size = header_size ;
+    p->saxpy3 [0] = NULL ;
+    p->saxpy3 [1] = NULL ;
+    p->saxpy3_size [0] = 0 ;
+    p->saxpy3_size [1] = 0 ;
+    p->nbuild = 0 ;
+    p->nreuse = 0 ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GxB_MxM_Plan_stats: report how often a plan was built and reused
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// nbuild is the # of times the symbolic analysis has been saved in the plan,
+// either because the plan was empty or because the patterns of A, B, or M
+// changed.  nreuse is the # of times the analysis has been reused.  If nbuild
+// is close to nreuse + nbuild, the plan is not helping, and may be removed.
+
+#include "GB.h"
+
+GrB_Info GxB_MxM_Plan_stats     // report how often a plan was reused
+(
+    int64_t *nbuild,            // # of times the plan was built
+    int64_t *nreuse,            // # of times the plan was reused
+    const GxB_MxM_Plan plan     // plan to query
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_MxM_Plan_stats (&nbuild, &nreuse, plan)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (plan) ;
+
+    //--------------------------------------------------------------------------
+    // return the statistics
+    //--------------------------------------------------------------------------
+
+    if (nbuild != NULL)
+    { 
+        (*nbuild) = plan->nbuild ;
+    }
+    if (nreuse != NULL)
+    { 
+        (*nreuse) = plan->nreuse ;
+    }
+    return (GrB_SUCCESS) ;
+}
@@ -91,6 +91,17 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
             }
             break ;
 
+        case GxB_CONCURRENT_INGEST : 
+
+            {
+                va_start (ap, field) ;
+                bool *concurrent = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (concurrent) ;
+                (*concurrent) = (v->Ingest != NULL) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
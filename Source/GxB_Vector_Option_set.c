@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_transpose.h"
+#include "GB_Pending.h"
 
 #define GB_FREE_ALL ;
 
@@ -59,6 +60,34 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
             }
             break ;
 
+        case GxB_CONCURRENT_INGEST : 
+
+            {
+                va_start (ap, field) ;
+                bool concurrent = (bool) va_arg (ap, int) ;
+                va_end (ap) ;
+                if (concurrent && v->Ingest == NULL)
+                { 
+                    // allocate the per-thread lists of pending tuples
+                    if (!GB_Ingest_alloc (&(v->Ingest), Context))
+                    { 
+                        // out of memory
+                        return (GrB_OUT_OF_MEMORY) ;
+                    }
+                }
+                else if (!concurrent && v->Ingest != NULL)
+                { 
+                    // assemble any tuples from concurrent setElement, and
+                    // free the per-thread lists
+                    if (GB_INGEST (v))
+                    { 
+                        GB_OK (GB_wait ((GrB_Matrix) v, "v (ingest off)", Context)) ;
+                    }
+                    GB_Ingest_free (&(v->Ingest)) ;
+                }
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_setElements: set a list of entries in a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Set a list of entries in a vector, w (I [k]) = X [k] for k = 0:n-1,
+// typecasting from the type of X to the type of w, as needed.  The result is
+// the same as n calls to GrB_Vector_setElement, in order.
+
+#include "GB.h"
+
+#define GB_SET(prefix,type,T)                                               \
+GrB_Info GB_EVAL3 (prefix, _Vector_setElements_, T) /* w(I)=X */            \
+(                                                                           \
+    GrB_Vector w,                   /* vector to modify                   */\
+    const GrB_Index *I,             /* array of row indices of tuples     */\
+    const type *X,                  /* array of values of tuples          */\
+    GrB_Index nvals                 /* number of tuples                   */\
+)                                                                           \
+{                                                                           \
+    GB_WHERE (w, "GxB_Vector_setElements_" GB_STR(T)                        \
+        " (w, I, X, nvals)") ;                                              \
+    GB_BURBLE_START ("GxB_Vector_setElements") ;                            \
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
+    ASSERT (GB_VECTOR_OK (w)) ;                                             \
+    GrB_Info info = GB_setElements ((GrB_Matrix) w, I, NULL,                \
+        (const void *) X, GB_ ## T ## _code, (int64_t) nvals, Context) ;    \
+    GB_BURBLE_END ;                                                         \
+    return (info) ;                                                         \
+}
+
+GB_SET (GxB, bool      , BOOL   )
+GB_SET (GxB, int8_t    , INT8   )
+GB_SET (GxB, int16_t   , INT16  )
+GB_SET (GxB, int32_t   , INT32  )
+GB_SET (GxB, int64_t   , INT64  )
+GB_SET (GxB, uint8_t   , UINT8  )
+GB_SET (GxB, uint16_t  , UINT16 )
+GB_SET (GxB, uint32_t  , UINT32 )
+GB_SET (GxB, uint64_t  , UINT64 )
+GB_SET (GxB, float     , FP32   )
+GB_SET (GxB, double    , FP64   )
+GB_SET (GxB, GxB_FC32_t, FC32   )
+GB_SET (GxB, GxB_FC64_t, FC64   )
+GB_SET (GxB, void      , UDT    )
+
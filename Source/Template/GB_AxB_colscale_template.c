@@ -11,7 +11,9 @@
 // C as a shallow-copy of the pattern of A.
 
 // A and C can be jumbled.  D cannot, but it is a diagonal matrix so it is
-// never jumbled.
+// never jumbled.  A and C have the same sparsity structure, which can be
+// sparse, hypersparse, bitmap, or full.  C and A may be aliased, if C=A*D is
+// computed in-place.
 
 {
 
@@ -30,6 +32,7 @@
 
     const int64_t  *restrict Ap = A->p ;
     const int64_t  *restrict Ah = A->h ;
+    const int8_t   *restrict Ab = A->b ;
     #if !GB_A_IS_PATTERN
     const GB_ATYPE *restrict Ax = (GB_ATYPE *) A->x ;
     #endif
@@ -81,6 +84,7 @@
             GB_PRAGMA_SIMD_VECTORIZE
             for (int64_t p = pA_start ; p < pA_end ; p++)
             { 
+                if (!GBB (Ab, p)) continue ;
                 GB_GETA (aij, Ax, p, A_iso) ;           // aij = A(i,j)
                 GB_BINOP (GB_CX (p), aij, djj, 0, 0) ;  // C(i,j) = aij * djj
             }
@@ -23,7 +23,9 @@
     // dimensions.  The C bitmap/full matrix is converted back into a sparse or
     // hypersparse matrix when done.
 
-    int64_t cnvals = 0 ;
+    // C->nvals is zero if C is a new matrix, or the number of entries in C if
+    // C+=A'*B is computed in-place
+    int64_t cnvals = C->nvals ;
 
     ASSERT (GB_IS_BITMAP (C) || GB_IS_FULL (C)) ;
     int8_t *restrict Cb = C->b ;
@@ -144,15 +146,38 @@
             if (A_is_full && B_is_full)
             {
                 // A full, B full
-                #define GB_A_IS_SPARSE 0
-                #define GB_A_IS_HYPER  0
-                #define GB_A_IS_BITMAP 0
-                #define GB_A_IS_FULL   1
-                #define GB_B_IS_SPARSE 0
-                #define GB_B_IS_HYPER  0
-                #define GB_B_IS_BITMAP 0
-                #define GB_B_IS_FULL   1
-                #include "GB_AxB_dot2_template.c"
+                #if GB_SEMIRING_HAS_AVX_IMPLEMENTATION          \
+                    && GB_COMPILER_SUPPORTS_AVX512F
+                if (GB_Global_cpu_features_avx512f ( ))
+                { 
+                    // x86_64 with AVX512f
+                    GB_AxB_dot2_full_avx512f (C, A, A_slice, B, B_slice,
+                        nthreads, naslice, nbslice) ;
+                }
+                else
+                #endif
+                #if GB_SEMIRING_HAS_AVX_IMPLEMENTATION          \
+                    && GB_COMPILER_SUPPORTS_AVX2
+                if (GB_Global_cpu_features_avx2 ( ))
+                { 
+                    // x86_64 with AVX2
+                    GB_AxB_dot2_full_avx2 (C, A, A_slice, B, B_slice,
+                        nthreads, naslice, nbslice) ;
+                }
+                else
+                #endif
+                { 
+                    // any architecture and any semiring
+                    #define GB_A_IS_SPARSE 0
+                    #define GB_A_IS_HYPER  0
+                    #define GB_A_IS_BITMAP 0
+                    #define GB_A_IS_FULL   1
+                    #define GB_B_IS_SPARSE 0
+                    #define GB_B_IS_HYPER  0
+                    #define GB_B_IS_BITMAP 0
+                    #define GB_B_IS_FULL   1
+                    #include "GB_AxB_dot2_template.c"
+                }
             }
             else if (A_is_full)
             { 
@@ -15,7 +15,12 @@
 // If A_NOT_TRANSPOSED is #defined, the C=A*B or C<#M>=A*B is computed.
 // In this case A is bitmap or full, and B is sparse.
 
-// GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij
+// If the mask is not present and C is bitmap, Cb is all zero on input if C is
+// a new matrix.  Otherwise, C is the user's input matrix, and C+=A'*B is
+// computed in-place (GB_AxB_dot2 with C_in_place true).  The accum operator
+// is the same as the monoid, and the ANY monoid is not used in this case.
+
+// GB_DOT_ALWAYS_SAVE_CIJ: C(i,j) = cij, or C(i,j) += cij if already present
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #if GB_C_IS_FULL
     #define GB_DOT_ALWAYS_SAVE_CIJ      \
@@ -25,9 +30,16 @@
 #else
     #define GB_DOT_ALWAYS_SAVE_CIJ      \
     {                                   \
-        GB_PUTC (cij, pC) ;             \
-        Cb [pC] = 1 ;                   \
-        task_cnvals++ ;                 \
+        if (Cb [pC])                    \
+        {                               \
+            GB_CIJ_UPDATE (pC, cij) ;   \
+        }                               \
+        else                            \
+        {                               \
+            GB_PUTC (cij, pC) ;         \
+            Cb [pC] = 1 ;               \
+            task_cnvals++ ;             \
+        }                               \
     }
 #endif
 
@@ -103,7 +115,10 @@
                 if (bjnz == 0)
                 { 
                     // no work to do if B(:,j) is empty, except to clear Cb
+                    // if the mask is present
+                    #if defined ( GB_MASK_IS_PRESENT )
                     memset (&Cb [pC_start + kA_start], 0, kA_end - kA_start) ;
+                    #endif
                     continue ;
                 }
                 #if GB_A_IS_SPARSE
@@ -152,11 +167,9 @@
                 }
                 Cb [pC] = 0 ;
                 if (mij ^ Mask_comp)
-                #elif GB_C_IS_FULL
-                // C is full; nothing to do
                 #else
-                // M is not present
-                Cb [pC] = 0 ;
+                // M is not present; C is full, or bitmap and all zero on
+                // input unless computed in-place
                 #endif
                 { 
 
@@ -33,8 +33,8 @@
 
 #endif
 
-// GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists
-#define GB_DOT_SAVE_CIJ             \
+// GB_DOT_SAVE_CIJ_COARSE: C(i,j) = cij, if it exists
+#define GB_DOT_SAVE_CIJ_COARSE      \
 {                                   \
     if (GB_CIJ_EXISTS)              \
     {                               \
@@ -43,6 +43,21 @@
     }                               \
 }
 
+// GB_DOT_SAVE_CIJ_ULTRA: Hx [tid] = cij, if it exists, for an ultra-fine task.
+// The partial results of all ultra-fine tasks for C(i,j) are summed into C(i,j)
+// after all tasks are done.
+#define GB_DOT_SAVE_CIJ_ULTRA       \
+{                                   \
+    if (GB_CIJ_EXISTS)              \
+    {                               \
+        GB_HX_WRITE (tid, cij) ;    \
+        Hf [tid] = 1 ;              \
+    }                               \
+}
+
+// GB_DOT_SAVE_CIJ: C(i,j) = cij, if it exists
+#define GB_DOT_SAVE_CIJ GB_DOT_SAVE_CIJ_COARSE
+
 {
 
     //--------------------------------------------------------------------------
@@ -69,6 +84,7 @@
     const bool B_is_bitmap = GB_IS_BITMAP (B) ;
     const bool B_is_sparse = GB_IS_SPARSE (B) ;
     const bool B_iso = B->iso ;
+    const GB_Hyper_hash B_hyper_hash = GB_hyper_hash_get (B) ;
 
     const int64_t *restrict Ap = A->p ;
     const int64_t *restrict Ah = A->h ;
@@ -79,6 +95,7 @@
     const bool A_is_bitmap = GB_IS_BITMAP (A) ;
     const bool A_is_sparse = GB_IS_SPARSE (A) ;
     const bool A_iso = A->iso ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
 
     #if !GB_A_IS_PATTERN
     const GB_ATYPE *restrict Ax = (GB_ATYPE *) A->x ;
@@ -98,6 +115,34 @@
     const int64_t *restrict Mi = M->i ;
     const size_t mvlen = M->vlen ;
 
+    //--------------------------------------------------------------------------
+    // allocate workspace for the ultra-fine tasks, if any
+    //--------------------------------------------------------------------------
+
+    // Ultra-fine tasks appear at the end of the TaskList.  Ultra-fine task tid
+    // saves its partial result in Hx [tid], and sets Hf [tid] = 1 if it finds
+    // any entry in its part of the dot product.
+
+    int8_t *restrict Hf = NULL ; size_t Hf_size = 0 ;
+    GB_void *restrict Wx = NULL ; size_t Wx_size = 0 ;
+    if (ntasks > 0 && TaskList [ntasks-1].klast == -1)
+    {
+        Hf = GB_CALLOC_WORK (ntasks, int8_t, &Hf_size) ;
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        Wx = GB_MALLOC_WORK (ntasks * C->type->size, GB_void, &Wx_size) ;
+        #endif
+        if (Hf == NULL || (Wx == NULL && !GB_IS_ANY_PAIR_SEMIRING))
+        { 
+            // out of memory
+            GB_FREE_WORK (&Hf, Hf_size) ;
+            GB_FREE_WORK (&Wx, Wx_size) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+    #if !GB_IS_ANY_PAIR_SEMIRING
+    GB_CTYPE *restrict Hx = (GB_CTYPE *) Wx ;
+    #endif
+
     //--------------------------------------------------------------------------
     // C<M> = A'*B via dot products, where C and M are both sparse/hyper
     //--------------------------------------------------------------------------
@@ -135,10 +180,14 @@
     }
 
     C->nzombies = nzombies ;
+    GB_FREE_WORK (&Hf, Hf_size) ;
+    GB_FREE_WORK (&Wx, Wx_size) ;
 }
 
 #undef GB_DOT_ALWAYS_SAVE_CIJ
 #undef GB_DOT_SAVE_CIJ
+#undef GB_DOT_SAVE_CIJ_COARSE
+#undef GB_DOT_SAVE_CIJ_ULTRA
 
 #undef GB_DOT3
 #undef GB_DOT3_PHASE2
@@ -55,8 +55,8 @@
             #if GB_B_IS_HYPER
                 // B is hyper
                 int64_t pB_start, pB_end ;
-                GB_lookup (true, Bh, Bp, vlen, &bpleft, bnvec-1, j,
-                    &pB_start, &pB_end) ;
+                GB_hyper_hash_lookup (true, Bh, Bp, vlen, B_hyper_hash,
+                    &bpleft, bnvec-1, j, &pB_start, &pB_end) ;
             #elif GB_B_IS_SPARSE
                 // B is sparse
                 const int64_t pB_start = Bp [j] ;
@@ -105,8 +105,8 @@
                         // A is hyper
                         int64_t pA, pA_end ;
                         int64_t apleft = 0 ;    // M might be jumbled
-                        GB_lookup (true, Ah, Ap, vlen, &apleft, anvec-1, i,
-                            &pA, &pA_end) ;
+                        GB_hyper_hash_lookup (true, Ah, Ap, vlen, A_hyper_hash,
+                            &apleft, anvec-1, i, &pA, &pA_end) ;
                         const int64_t ainz = pA_end - pA ;
                         work += GB_IMIN (ainz, bjnz) ;
                         #elif GB_A_IS_SPARSE
@@ -10,9 +10,22 @@
 // C and M are both sparse or hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
 
+// If A and B are both sparse or hyper, the TaskList may also contain
+// ultra-fine tasks (see GB_AxB_dot3_slice), each of which computes a part of
+// a single costly dot product C(i,j).  Each ultra-fine task saves its partial
+// result in the workspace Hf and Hx, and the partial results are summed into
+// C(i,j) after all tasks are done.
+
+#if ( (GB_A_IS_SPARSE || GB_A_IS_HYPER) && (GB_B_IS_SPARSE || GB_B_IS_HYPER) )
+#define GB_DOT3_ULTRA 1
+#else
+#define GB_DOT3_ULTRA 0
+#endif
+
 {
 
     int tid ;
+
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
         reduction(+:nzombies)
     for (tid = 0 ; tid < ntasks ; tid++)
@@ -29,6 +42,52 @@
         int64_t bpleft = 0 ;            // Ch is not jumbled
         int64_t task_nzombies = 0 ;     // # of zombies found by this task
 
+        if (klast == -1)
+        {
+
+            //------------------------------------------------------------------
+            // ultra-fine task: Hx [tid] = A(i1:i2,i)'*B(i1:i2,j)
+            //------------------------------------------------------------------
+
+            #if GB_DOT3_ULTRA
+            {
+                // get C(i,j) and M(i,j)
+                int64_t pC = pC_first ;
+                int64_t i = Mi [pC] ;
+                #if defined ( GB_MASK_SPARSE_AND_STRUCTURAL )
+                const int64_t j = kfirst ;
+                #else
+                const int64_t j = GBH (Ch, kfirst) ;
+                // if M is structural, no need to check its values
+                if (GB_mcast (Mx, pC, msize))
+                #endif
+                {
+                    // get the slices of A(:,i) and B(:,j) for this task
+                    int64_t pA = TaskList [tid].pA ;
+                    const int64_t pA_end = TaskList [tid].pA_end ;
+                    const int64_t pB_start = TaskList [tid].pB ;
+                    const int64_t pB_end = TaskList [tid].pB_end ;
+                    const int64_t ainz = pA_end - pA ;
+                    const int64_t bjnz = pB_end - pB_start ;
+                    if (ainz > 0 && bjnz > 0)
+                    { 
+                        // cij = A(i1:i2,i)'*B(i1:i2,j), saved in Hx [tid]
+                        const int64_t ib_first = Bi [pB_start] ;
+                        const int64_t ib_last  = Bi [pB_end-1] ;
+                        bool cij_exists = false ;
+                        GB_CIJ_DECLARE (cij) ;
+                        #undef  GB_DOT_SAVE_CIJ
+                        #define GB_DOT_SAVE_CIJ GB_DOT_SAVE_CIJ_ULTRA
+                        #include "GB_AxB_dot_cij.c"
+                        #undef  GB_DOT_SAVE_CIJ
+                        #define GB_DOT_SAVE_CIJ GB_DOT_SAVE_CIJ_COARSE
+                    }
+                }
+            }
+            #endif
+            continue ;
+        }
+
         //----------------------------------------------------------------------
         // compute all vectors in this task
         //----------------------------------------------------------------------
@@ -73,8 +132,8 @@
             #if GB_B_IS_HYPER
                 // B is hyper
                 int64_t pB_start, pB_end ;
-                GB_lookup (true, Bh, Bp, vlen, &bpleft, bnvec-1, j,
-                    &pB_start, &pB_end) ;
+                GB_hyper_hash_lookup (true, Bh, Bp, vlen, B_hyper_hash,
+                    &bpleft, bnvec-1, j, &pB_start, &pB_end) ;
             #elif GB_B_IS_SPARSE
                 // B is sparse
                 const int64_t pB_start = Bp [j] ;
@@ -135,8 +194,8 @@
                     // A is hyper
                     int64_t pA, pA_end ;
                     int64_t apleft = 0 ;    // M might be jumbled
-                    GB_lookup (true, Ah, Ap, vlen, &apleft, anvec-1, i,
-                        &pA, &pA_end) ;
+                    GB_hyper_hash_lookup (true, Ah, Ap, vlen, A_hyper_hash,
+                        &apleft, anvec-1, i, &pA, &pA_end) ;
                     const int64_t ainz = pA_end - pA ;
                     if (ainz > 0)
                     #elif GB_A_IS_SPARSE
@@ -165,8 +224,66 @@
         }
         nzombies += task_nzombies ;
     }
+
+    #if GB_DOT3_ULTRA
+    if (Hf != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // sum the partial results of each team of ultra-fine tasks
+        //----------------------------------------------------------------------
+
+        // All ultra-fine tasks for the same entry C(i,j) are consecutive in
+        // the TaskList.  The first task of each team sums the results of its
+        // team into C(i,j), or makes C(i,j) a zombie if no task of the team
+        // found an entry.
+
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+            reduction(+:nzombies)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            const int64_t pC = TaskList [tid].pC ;
+            if (TaskList [tid].klast != -1 || (tid > 0 &&
+                TaskList [tid-1].klast == -1 && TaskList [tid-1].pC == pC))
+            { 
+                // not the first ultra-fine task of a team
+                continue ;
+            }
+            const int64_t i = Mi [pC] ;
+            bool cij_exists = false ;
+            for (int t = tid ; t < ntasks && TaskList [t].klast == -1 &&
+                TaskList [t].pC == pC ; t++)
+            {
+                if (!Hf [t]) continue ;
+                if (cij_exists)
+                { 
+                    // C(i,j) += Hx [t]
+                    GB_CIJ_GATHER_UPDATE (pC, t) ;
+                }
+                else
+                { 
+                    // C(i,j) = Hx [t]
+                    GB_CIJ_GATHER (pC, t) ;
+                    cij_exists = true ;
+                }
+            }
+            if (cij_exists)
+            { 
+                Ci [pC] = i ;
+            }
+            else
+            { 
+                // C(i,j) is a zombie
+                nzombies++ ;
+                Ci [pC] = GB_FLIP (i) ;
+            }
+        }
+    }
+    #endif
 }
 
+#undef GB_DOT3_ULTRA
+
 #undef GB_A_IS_SPARSE
 #undef GB_A_IS_HYPER
 #undef GB_A_IS_BITMAP
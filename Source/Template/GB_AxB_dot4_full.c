@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot4_full: C+=A'*B via dot products, where A, B, and C are full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This is the body of GB_AxB_dot4_full_avx512f and GB_AxB_dot4_full_avx2,
+// defined in GB_AxB_dot_full_avx.c.  It computes the same result as
+// GB_AxB_dot4_meta when A and B are full (or as-if-full).  If C was iso on
+// input, it has already been expanded by GB_AxB_dot4_meta, and its iso value
+// is cinput.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A, B, and C
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_as_if_full (A)) ;
+    ASSERT (GB_as_if_full (B)) ;
+    ASSERT (!C->iso) ;
+    const int64_t cvlen = C->vlen ;
+    const int64_t vlen = B->vlen ;
+    const bool A_iso = A->iso ;
+    const bool B_iso = B->iso ;
+    #if !GB_A_IS_PATTERN
+    const GB_ATYPE *restrict Ax = (GB_ATYPE *) A->x ;
+    #endif
+    #if !GB_B_IS_PATTERN
+    const GB_BTYPE *restrict Bx = (GB_BTYPE *) B->x ;
+    #endif
+    GB_CTYPE *restrict Cx = (GB_CTYPE *) C->x ;
+    const int ntasks = naslice * nbslice ;
+
+    //--------------------------------------------------------------------------
+    // C+=A'*B
+    //--------------------------------------------------------------------------
+
+    #define GB_A_IS_SPARSE 0
+    #define GB_A_IS_HYPER  0
+    #define GB_A_IS_BITMAP 0
+    #define GB_A_IS_FULL   1
+    #define GB_B_IS_SPARSE 0
+    #define GB_B_IS_HYPER  0
+    #define GB_B_IS_BITMAP 0
+    #define GB_B_IS_FULL   1
+    #include "GB_AxB_dot4_template.c"
+    #undef GB_A_IS_SPARSE
+    #undef GB_A_IS_HYPER
+    #undef GB_A_IS_BITMAP
+    #undef GB_A_IS_FULL
+    #undef GB_B_IS_SPARSE
+    #undef GB_B_IS_HYPER
+    #undef GB_B_IS_BITMAP
+    #undef GB_B_IS_FULL
+}
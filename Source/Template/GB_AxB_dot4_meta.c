@@ -95,6 +95,32 @@
         Cx = (GB_CTYPE *) C->x ;
     }
 
+    //--------------------------------------------------------------------------
+    // C += A'*B with AVX512F or AVX2, if A and B are full
+    //--------------------------------------------------------------------------
+
+    #if GB_SEMIRING_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ) &&
+        GB_as_if_full (A) && GB_as_if_full (B))
+    { 
+        // x86_64 with AVX512f
+        GB_AxB_dot4_full_avx512f (C, C_in_iso, cinput, A, A_slice, B, B_slice,
+            nthreads, naslice, nbslice) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
+    #if GB_SEMIRING_HAS_AVX_IMPLEMENTATION && GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ) &&
+        GB_as_if_full (A) && GB_as_if_full (B))
+    { 
+        // x86_64 with AVX2
+        GB_AxB_dot4_full_avx2 (C, C_in_iso, cinput, A, A_slice, B, B_slice,
+            nthreads, naslice, nbslice) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
     //--------------------------------------------------------------------------
     // C += A'*B
     //--------------------------------------------------------------------------
@@ -1069,8 +1069,7 @@
                             // A(ia,i) appears before B(ib,j)
                             // discard all entries A(ia:ib-1,i)
                             int64_t pleft = pA + 1 ;
-                            int64_t pright = pA_end - 1 ;
-                            GB_TRIM_BINARY_SEARCH (ib, Ai, pleft, pright) ;
+                            GB_GALLOP_SEARCH (ib, Ai, pleft, pA_end) ;
                             ASSERT (pleft > pA) ;
                             pA = pleft ;
                         }
@@ -1113,8 +1112,7 @@
                             // B(ib,j) appears before A(ia,i)
                             // discard all entries B(ib:ia-1,j)
                             int64_t pleft = pB + 1 ;
-                            int64_t pright = pB_end - 1 ;
-                            GB_TRIM_BINARY_SEARCH (ia, Bi, pleft, pright) ;
+                            GB_GALLOP_SEARCH (ia, Bi, pleft, pB_end) ;
                             ASSERT (pleft > pB) ;
                             pB = pleft ;
                         }
@@ -481,6 +481,10 @@
             // B(:,j) is very sparse compared to A(:,i)
             //------------------------------------------------------------------
 
+            // A galloping search skips over the entries in A(:,i) that are
+            // not in the pattern of B(:,j).  The next match is usually not
+            // far, so this is faster than a binary search of all of A(:,i).
+
             while (pA < pA_end && pB < pB_end)
             {
                 int64_t ia = Ai [pA] ;
@@ -490,8 +494,7 @@
                     // A(ia,i) appears before B(ib,j)
                     // discard all entries A(ia:ib-1,i)
                     int64_t pleft = pA + 1 ;
-                    int64_t pright = pA_end - 1 ;
-                    GB_TRIM_BINARY_SEARCH (ib, Ai, pleft, pright) ;
+                    GB_GALLOP_SEARCH (ib, Ai, pleft, pA_end) ;
                     ASSERT (pleft > pA) ;
                     pA = pleft ;
                 }
@@ -535,8 +538,7 @@
                     // B(ib,j) appears before A(ia,i)
                     // discard all entries B(ib:ia-1,j)
                     int64_t pleft = pB + 1 ;
-                    int64_t pright = pB_end - 1 ;
-                    GB_TRIM_BINARY_SEARCH (ia, Bi, pleft, pright) ;
+                    GB_GALLOP_SEARCH (ia, Bi, pleft, pB_end) ;
                     ASSERT (pleft > pB) ;
                     pB = pleft ;
                 }
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot_full_avx: C=A'*B and C+=A'*B for full matrices, with AVX
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd at file scope in Generated2/GB_AxB__*.c, for the
+// semirings accelerated with AVX2 or AVX512F
+// (GB_SEMIRING_HAS_AVX_IMPLEMENTATION).  It defines variants of the dot2 and
+// dot4 kernels for the case when A and B are full, compiled for each
+// instruction set.  Each dot product A(:,i)'*B(:,j) is then vectorized with
+// 256-bit or 512-bit registers.  The variant is selected at run time, in
+// GB_AxB_dot2_meta and GB_AxB_dot4_meta.
+
+#include "GB_AxB_dot_cij.h"
+
+// cij += A(k,i) * B(k,j), for dot4
+#undef  GB_DOT
+#define GB_DOT(k,pA,pB)                                                 \
+{                                                                       \
+    GB_DOT_TERMINAL (cij) ;         /* break if cij == terminal */      \
+    GB_GETA (aki, Ax, pA, A_iso) ;          /* aki = A(k,i) */          \
+    GB_GETB (bkj, Bx, pB, B_iso) ;          /* bkj = B(k,j) */          \
+    GB_MULTADD (cij, aki, bkj, i, k, j) ;   /* cij += aki * bkj */      \
+}
+
+//------------------------------------------------------------------------------
+// AVX512F variants
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+
+    GB_TARGET_AVX512F static inline void GB_AxB_dot2_full_avx512f
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A, const int64_t *restrict A_slice,
+        const GrB_Matrix B, const int64_t *restrict B_slice,
+        const int nthreads, const int naslice, const int nbslice
+    )
+    {
+        #include "GB_AxB_dot2_full.c"
+    }
+
+    GB_TARGET_AVX512F static inline void GB_AxB_dot4_full_avx512f
+    (
+        GrB_Matrix C, const bool C_in_iso, const GB_CTYPE cinput,
+        const GrB_Matrix A, const int64_t *restrict A_slice,
+        const GrB_Matrix B, const int64_t *restrict B_slice,
+        const int nthreads, const int naslice, const int nbslice
+    )
+    {
+        #include "GB_AxB_dot4_full.c"
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// AVX2 variants
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX2
+
+    GB_TARGET_AVX2 static inline void GB_AxB_dot2_full_avx2
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A, const int64_t *restrict A_slice,
+        const GrB_Matrix B, const int64_t *restrict B_slice,
+        const int nthreads, const int naslice, const int nbslice
+    )
+    {
+        #include "GB_AxB_dot2_full.c"
+    }
+
+    GB_TARGET_AVX2 static inline void GB_AxB_dot4_full_avx2
+    (
+        GrB_Matrix C, const bool C_in_iso, const GB_CTYPE cinput,
+        const GrB_Matrix A, const int64_t *restrict A_slice,
+        const GrB_Matrix B, const int64_t *restrict B_slice,
+        const int nthreads, const int naslice, const int nbslice
+    )
+    {
+        #include "GB_AxB_dot4_full.c"
+    }
+
+#endif
+
+#undef GB_DOT
@@ -108,6 +108,21 @@
         // Cx [p] = cij
         #define GB_PUTC(cij,p) Cx [p] = cij
 
+        // Cx [p] += cij
+        #define GB_CIJ_UPDATE(p,cij) fadd (GB_CX (p), GB_CX (p), &cij)
+
+        // address of Hx [i]
+        #define GB_HX(i) (&Hx [i])
+
+        // Hx [i] = t
+        #define GB_HX_WRITE(i,t) Hx [i] = t
+
+        // Cx [p] = Hx [i]
+        #define GB_CIJ_GATHER(p,i) Cx [p] = Hx [i]
+
+        // Cx [p] += Hx [i]
+        #define GB_CIJ_GATHER_UPDATE(p,i) fadd (GB_CX (p), GB_CX (p), GB_HX (i))
+
         // break if cij reaches the terminal value
         #define GB_DOT_TERMINAL(cij)                                    \
             if (is_terminal && cij == cij_terminal)                     \
@@ -253,6 +268,26 @@
         #undef  GB_PUTC
         #define GB_PUTC(cij,p) memcpy (GB_CX (p), cij, csize)
 
+        // Cx [p] += cij
+        #undef  GB_CIJ_UPDATE
+        #define GB_CIJ_UPDATE(p,cij) fadd (GB_CX (p), GB_CX (p), cij)
+
+        // address of Hx [i]
+        #undef  GB_HX
+        #define GB_HX(i) Hx +((i)*csize)
+
+        // Hx [i] = t
+        #undef  GB_HX_WRITE
+        #define GB_HX_WRITE(i,t) memcpy (GB_HX (i), t, csize)
+
+        // Cx [p] = Hx [i]
+        #undef  GB_CIJ_GATHER
+        #define GB_CIJ_GATHER(p,i) memcpy (GB_CX (p), GB_HX (i), csize)
+
+        // Cx [p] += Hx [i]
+        #undef  GB_CIJ_GATHER_UPDATE
+        #define GB_CIJ_GATHER_UPDATE(p,i) fadd (GB_CX (p), GB_CX (p), GB_HX (i))
+
         // break if cij reaches the terminal value
         #undef  GB_DOT_TERMINAL
         #define GB_DOT_TERMINAL(cij)                                    \
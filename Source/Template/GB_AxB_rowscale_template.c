@@ -8,10 +8,12 @@
 //------------------------------------------------------------------------------
 
 // This template is not used If C is iso, since all that is needed is to create
-// C as a shallow-copy of the pattern of A.
+// C as a shallow-copy of the pattern of B.
 
 // B and C can be jumbled.  D cannot, but it is a diagonal matrix so it is
-// never jumbled.
+// never jumbled.  B and C have the same sparsity structure, which can be
+// sparse, hypersparse, bitmap, or full.  C and B may be aliased, if C=D*B is
+// computed in-place.
 
 {
 
@@ -37,7 +39,8 @@
     #endif
     const bool B_iso = B->iso ;
     const int64_t *restrict Bi = B->i ;
-    const int64_t bnz = GB_nnz (B) ;
+    const int8_t  *restrict Bb = B->b ;
+    const int64_t bnz = GB_nnz_held (B) ;
     const int64_t bvlen = B->vlen ;
 
     //--------------------------------------------------------------------------
@@ -56,6 +59,7 @@
         GB_PRAGMA_SIMD_VECTORIZE
         for (int64_t p = pstart ; p < pend ; p++)
         { 
+            if (!GBB (Bb, p)) continue ;
             int64_t i = GBI (Bi, p, bvlen) ;        // get row index of B(i,j)
             GB_GETA (dii, Dx, i, D_iso) ;           // dii = D(i,i)
             GB_GETB (bij, Bx, p, B_iso) ;           // bij = B(i,j)
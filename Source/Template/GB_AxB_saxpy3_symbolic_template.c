@@ -71,6 +71,7 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
     const int64_t anvec = A->nvec ;
     const int64_t avlen = A->vlen ;
     const bool A_jumbled = A->jumbled ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
 
     ASSERT (GB_A_IS_SPARSE == GB_IS_SPARSE (A)) ;
     ASSERT (GB_A_IS_HYPER  == GB_IS_HYPERSPARSE (A)) ;
@@ -58,6 +58,7 @@
     const bool A_is_bitmap = GB_IS_BITMAP (A) ;
     const bool A_iso = A->iso ;
     const bool A_jumbled = A->jumbled ;
+    const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
     const bool A_ok_for_binary_search = 
         ((A_is_sparse || A_is_hyper) && !A_jumbled) ;
 
@@ -104,6 +105,10 @@
         bool use_Gustavson = (hash_size == cvlen) ;
         int64_t pB     = SaxpyTasks [taskid].start ;
         int64_t pB_end = SaxpyTasks [taskid].end + 1 ;
+        const int64_t pB_first = pB ;
+        const int64_t pB_last  = pB_end - 1 ;
+        const int64_t askip_first = SaxpyTasks [taskid].askip_first ;
+        const int64_t askip_last  = SaxpyTasks [taskid].askip_last ;
         int64_t pleft = 0, pright = anvec-1 ;
         int64_t j = GBH (Bh, kk) ;
 
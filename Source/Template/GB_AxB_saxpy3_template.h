@@ -201,8 +201,28 @@ break ;
 #define GB_GET_A_k_FOR_ALL_FORMATS(A_is_hyper)                              \
     if (B_jumbled) pleft = 0 ;  /* reuse pleft if B is not jumbled */       \
     int64_t pA_start, pA_end ;                                              \
-    GB_lookup (A_is_hyper, Ah, Ap, avlen, &pleft, pright, k,                \
-        &pA_start, &pA_end) ;                                               \
+    GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, avlen, A_hyper_hash,          \
+        &pleft, pright, k, &pA_start, &pA_end) ;                            \
+    const int64_t aknz = pA_end - pA_start
+
+//------------------------------------------------------------------------------
+// GB_GET_A_k_ULTRA_FOR_ALL_FORMATS: get the part of A(:,k) for a fine task
+//------------------------------------------------------------------------------
+
+// An ultra-fine task uses only part of A(:,k) for its first entry B(k,j), at
+// pB_first, and its last entry B(k,j), at pB_last.  For all other entries, and
+// for all other fine tasks, askip_first and askip_last are zero.
+
+#define GB_ASKIP_FIRST ((pB == pB_first) ? askip_first : 0)
+#define GB_ASKIP_LAST  ((pB == pB_last ) ? askip_last  : 0)
+
+#define GB_GET_A_k_ULTRA_FOR_ALL_FORMATS(A_is_hyper)                        \
+    if (B_jumbled) pleft = 0 ;  /* reuse pleft if B is not jumbled */       \
+    int64_t pA_start, pA_end ;                                              \
+    GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, avlen, A_hyper_hash,          \
+        &pleft, pright, k, &pA_start, &pA_end) ;                            \
+    pA_start += GB_ASKIP_FIRST ;                                            \
+    pA_end   -= GB_ASKIP_LAST ;                                             \
     const int64_t aknz = pA_end - pA_start
 
 //------------------------------------------------------------------------------
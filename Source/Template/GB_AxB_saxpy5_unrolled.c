@@ -35,8 +35,17 @@
     // GB_CIJ_MULTADD:  C(i,j) += A(i,k) * B(k,j)
     // the semiring is not positional (or A would be pattern-only), so the
     // i, k, j values are not needed
+    #undef GB_CIJ_MULTADD
+    #if GB_SEMIRING_HAS_AVX_IMPLEMENTATION && (GB_V16 || GB_V8 || GB_V4)
+    // The semiring is PLUS_TIMES.  GB_MULTADD for integer types uses a scalar
+    // temporary to avoid ANSI C integer promotion, but vector types are not
+    // promoted, so the multiply-add is computed directly.
+    #define GB_CIJ_MULTADD(cij,aik,bkj) \
+        cij += (aik) * (bkj) ;
+    #else
     #define GB_CIJ_MULTADD(cij,aik,bkj) \
         GB_MULTADD (cij, aik, bkj, ignore, ignore, ignore) ;
+    #endif
 
     #if GB_V16
     typedef GB_CTYPE __attribute__ ((vector_size (16 * sizeof (GB_CTYPE)))) v16 ;
@@ -59,6 +68,13 @@
     // C += A*B where A is full (and not iso or pattern-only)
     //--------------------------------------------------------------------------
 
+    // If A is too large to fit in cache, and B has enough entries, the rows of
+    // B are split into k-blocks, and each task computes
+    // C(:,j1:j2) += A(:,k1:k2-1)*B(k1:k2-1,j1:j2) one k-block at a time.
+    // Otherwise, nkblocks is 1 and each vector of B is done all at once.
+    const int64_t kblock = GB_AxB_saxpy5_kblock (A, B) ;
+    const int64_t nkblocks = GB_IMAX (1, GB_ICEIL (B->vlen, kblock)) ;
+
     int tid ;
     #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
     for (tid = 0 ; tid < ntasks ; tid++)
@@ -70,14 +86,33 @@
         // get the task descriptor
         const int64_t jB_start = B_slice [tid] ;
         const int64_t jB_end   = B_slice [tid+1] ;
-        // C(:,jB_start:jB_end-1) += A * B(:,jB_start:jB_end-1)
-        for (int64_t jB = jB_start ; jB < jB_end ; jB++)
+        const int64_t njB = jB_end - jB_start ;
+        ASSERT (nkblocks == 1 || njB <= GB_SAXPY5_JPANEL) ;
+        // pB_next [jB-jB_start]: start of B(:,j) for the next k-block
+        int64_t pB_next [GB_SAXPY5_JPANEL] ;
+        // C(:,jB_start:jB_end-1) += A(:,k1:k2-1) * B(k1:k2-1,jB_start:jB_end-1)
+        // for each k-block, so that A(:,k1:k2-1) stays in cache for all
+        // vectors of this task
+        for (int64_t t = 0 ; t < nkblocks * njB ; t++)
         {
-            // get B(:,j) and C(:,j)
+            // get B(k1:k2-1,j) and C(:,j), where k1 = kb*kblock
+            const int64_t kb = t / njB ;
+            const int64_t jB = jB_start + (t % njB) ;
             const int64_t j = GBH (Bh, jB) ;
             GB_CTYPE *restrict Cxj = Cx + (j * m) ;
-            const int64_t pB_start = Bp [jB] ;
-            const int64_t pB_end   = Bp [jB+1] ;
+            const int64_t pB_start = (kb == 0) ? Bp [jB] :
+                pB_next [jB-jB_start] ;
+            int64_t pB_end = Bp [jB+1] ;
+            if (nkblocks > 1)
+            { 
+                // find the end of B(k1:k2-1,j); B is not jumbled
+                const int64_t k2 = (kb + 1) * kblock ;
+                int64_t pB = pB_start ;
+                while (pB < pB_end && Bi [pB] < k2) pB++ ;
+                pB_end = pB ;
+                pB_next [jB-jB_start] = pB_end ;
+            }
+            if (pB_start == pB_end) continue ;
 
             //------------------------------------------------------------------
             // C(:,j) += A*B(:,j), on sets of 16 rows of C and A at a time
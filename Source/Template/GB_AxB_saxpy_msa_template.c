@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_msa_template: C<M>=A*B, driven by the entries of a sparse mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C has the same pattern as M, and the entries of C(:,j) in Cx [pM_start:
+// pM_end-1] are the masked sparse accumulator (MSA) for C(:,j)=A*B(:,j).  For
+// each entry B(k,j), the sorted pattern of A(:,k) is intersected with the
+// sorted pattern of M(:,j), with a galloping search on whichever of the two
+// is much longer.  C(i,j) starts as a zombie, and becomes live when the first
+// term A(i,k)*B(k,j) is found with M(i,j) true.  Entries of C(:,j) that are
+// still zombies when all of B(:,j) has been visited are left as zombies.
+
+// The #including file defines GB_C_ISO as 1 if C is iso, in which case only
+// the pattern of C is computed.  Otherwise, it defines GB_CTYPE, GB_GETA,
+// GB_GETB, GB_CIJ_DECLARE, GB_MULT, GB_PUTC, and GB_CIJ_UPDATE.
+
+{
+
+    #if !GB_C_ISO
+    GB_CTYPE *restrict Cx = (GB_CTYPE *) C->x ;
+    #endif
+
+    int64_t nzombies = 0 ;
+    int tid ;
+    #pragma omp parallel for num_threads(M_nthreads) schedule(dynamic,1) \
+        reduction(+:nzombies)
+    for (tid = 0 ; tid < M_ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t kfirst = kfirst_Mslice [tid] ;
+        int64_t klast  = klast_Mslice  [tid] ;
+        int64_t task_nzombies = 0 ;
+        int64_t bpleft = 0 ;
+
+        //----------------------------------------------------------------------
+        // compute all vectors in this task
+        //----------------------------------------------------------------------
+
+        for (int64_t kk = kfirst ; kk <= klast ; kk++)
+        {
+
+            //------------------------------------------------------------------
+            // get the part of M(:,j) owned by this task, and B(:,j)
+            //------------------------------------------------------------------
+
+            int64_t j = GBH (Mh, kk) ;
+            int64_t pM_start, pM_end ;
+            GB_get_pA (&pM_start, &pM_end, tid, kk, kfirst, klast,
+                pstart_Mslice, Mp, mvlen) ;
+
+            // all entries of C(:,j) start as zombies
+            for (int64_t pM = pM_start ; pM < pM_end ; pM++)
+            {
+                Ci [pM] = GB_FLIP (Mi [pM]) ;
+            }
+
+            int64_t pB_start, pB_end ;
+            bool found = GB_hyper_hash_lookup (B_is_hyper, Bh, Bp, bvlen,
+                B_hyper_hash, &bpleft, bnvec-1, j, &pB_start, &pB_end) ;
+            if (!found || pM_start >= pM_end)
+            {
+                // C(:,j) is empty
+                task_nzombies += (pM_end - pM_start) ;
+                continue ;
+            }
+
+            int64_t ifirst = Mi [pM_start] ;
+            int64_t ilast  = Mi [pM_end-1] ;
+
+            //------------------------------------------------------------------
+            // C(:,j)<M(:,j)> += A(:,k) * B(k,j) for each entry B(k,j)
+            //------------------------------------------------------------------
+
+            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
+            {
+
+                //--------------------------------------------------------------
+                // get A(:,k)
+                //--------------------------------------------------------------
+
+                int64_t k = Bi [pB] ;
+                int64_t pA, pA_end, apleft = 0 ;
+                if (!GB_hyper_hash_lookup (A_is_hyper, Ah, Ap, avlen,
+                    A_hyper_hash, &apleft, anvec-1, k, &pA, &pA_end)
+                    || pA >= pA_end
+                    || Ai [pA_end-1] < ifirst || Ai [pA] > ilast)
+                {
+                    // A(:,k) is empty, or does not overlap M(:,j)
+                    continue ;
+                }
+
+                GB_GETB (bkj, Bx, pB, B_iso) ;
+
+                //--------------------------------------------------------------
+                // intersect A(:,k) and M(:,j)
+                //--------------------------------------------------------------
+
+                int64_t pM = pM_start ;
+                while (pM < pM_end && pA < pA_end)
+                {
+                    int64_t ia = Ai [pA] ;
+                    int64_t im = Mi [pM] ;
+                    if (ia < im)
+                    {
+                        // A(ia,k) appears before M(im,j)
+                        if (pA_end - pA > 8 * (pM_end - pM))
+                        {
+                            // discard all entries A(ia:im-1,k)
+                            int64_t pleft = pA + 1 ;
+                            GB_GALLOP_SEARCH (im, Ai, pleft, pA_end) ;
+                            ASSERT (pleft > pA) ;
+                            pA = pleft ;
+                        }
+                        else
+                        {
+                            pA++ ;
+                        }
+                    }
+                    else if (im < ia)
+                    {
+                        // M(im,j) appears before A(ia,k)
+                        if (pM_end - pM > 8 * (pA_end - pA))
+                        {
+                            // discard all entries M(im:ia-1,j)
+                            int64_t pleft = pM + 1 ;
+                            GB_GALLOP_SEARCH (ia, Mi, pleft, pM_end) ;
+                            ASSERT (pleft > pM) ;
+                            pM = pleft ;
+                        }
+                        else
+                        {
+                            pM++ ;
+                        }
+                    }
+                    else
+                    {
+                        // C(i,j) += A(i,k) * B(k,j), if M(i,j) is true
+                        int64_t i = ia ;
+                        if (GB_mcast (Mx, pM, msize))
+                        {
+                            #if GB_C_ISO
+                            {
+                                Ci [pM] = i ;
+                            }
+                            #else
+                            {
+                                GB_GETA (aik, Ax, pA, A_iso) ;
+                                GB_CIJ_DECLARE (t) ;
+                                GB_MULT (t, aik, bkj, i, k, j) ;
+                                if (Ci [pM] < 0)
+                                {
+                                    // C(i,j) = A(i,k) * B(k,j)
+                                    Ci [pM] = i ;
+                                    GB_PUTC (t, pM) ;
+                                }
+                                else
+                                {
+                                    // C(i,j) += A(i,k) * B(k,j)
+                                    GB_CIJ_UPDATE (pM, t) ;
+                                }
+                            }
+                            #endif
+                        }
+                        pA++ ;
+                        pM++ ;
+                    }
+                }
+            }
+
+            //------------------------------------------------------------------
+            // count the zombies left in C(:,j)
+            //------------------------------------------------------------------
+
+            for (int64_t pM = pM_start ; pM < pM_end ; pM++)
+            {
+                if (Ci [pM] < 0) task_nzombies++ ;
+            }
+        }
+
+        nzombies += task_nzombies ;
+    }
+
+    C->nzombies = nzombies ;
+}
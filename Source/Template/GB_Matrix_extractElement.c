@@ -105,16 +105,27 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         {
             // A is hypersparse: look for j in hyperlist A->h [0 ... A->nvec-1]
             const int64_t *restrict Ah = A->h ;
-            int64_t pleft = 0 ;
-            int64_t pright = A->nvec-1 ;
-            GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+            const GB_Hyper_hash A_hyper_hash = GB_hyper_hash_get (A) ;
+            if (A_hyper_hash != NULL)
+            { 
+                // O(1)-time lookup in the hash index of A->h
+                k = GB_hyper_hash_find (A_hyper_hash, j) ;
+                found = (k >= 0) ;
+            }
+            else
+            { 
+                // binary search of A->h
+                int64_t pleft = 0 ;
+                int64_t pright = A->nvec-1 ;
+                GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+                k = pleft ;
+            }
             if (!found)
             { 
                 // vector j is empty
                 return (GrB_NO_VALUE) ;
             }
-            ASSERT (j == Ah [pleft]) ;
-            k = pleft ;
+            ASSERT (j == Ah [k]) ;
         }
         else
         { 
@@ -9,7 +9,8 @@
 
 // C is bitmap or full. A is hyper/sparse, B is bitmap/full.
 
-// if C is bitmap: no accumulator is used
+// if C is bitmap: C is either a new matrix, or C+=A*B is computed in-place
+// with the accumulator identical to the monoid
 
 // if C is full: C += A*B is computed with the accumulator identical to
 // the monoid
@@ -429,13 +430,9 @@
                             task_cnvals++ ;
                         }
                         else
-                        {
-                            // Currently, the matrix C is a newly allocated
-                            // matrix, not the C_in input matrix to GrB_mxm.
-                            // As a result, this condition is not used.  It
-                            // will be in the future when this method is
-                            // modified to modify C in-place.
-                            ASSERT (GB_DEAD_CODE) ;
+                        { 
+                            // C(i,j) is already present, since C is the C_in
+                            // input matrix to GrB_mxm, modified in-place.
                             // C(i,j) += H(i,jj)
                             GB_CIJ_GATHER_UPDATE (pC, pH) ;
                         }
@@ -46,6 +46,14 @@
     // accum operator.
     int64_t cnvals = 0 ;
 
+    // GB_SKIP_WORD (p) is true if p starts a word of 8 entries that lies in
+    // [p,pend), in which A(i,j) and B(i,j) are never both present.  None of
+    // these 8 entries of C can be computed, so the word can be skipped.
+    #undef  GB_SKIP_WORD
+    #define GB_SKIP_WORD(p)                                             \
+        (((p) & 7) == 0 && (p) + 8 <= pend &&                           \
+        (GB_bitmap_word (Ab, p) & GB_bitmap_word (Bb, p)) == 0)
+
     if (ewise_method == GB_EMULT_METHOD5)
     {
 
@@ -69,6 +77,12 @@
             GB_PARTITION (pstart, pend, cnz, tid, C_nthreads) ;
             for (int64_t p = pstart ; p < pend ; p++)
             {
+                if (GB_SKIP_WORD (p))
+                { 
+                    // C (p:p+7) is not computed; Cb is already zero
+                    p += 7 ;
+                    continue ;
+                }
                 if (GBB (Ab, p) && GBB (Bb,p))
                 { 
                     // C (i,j) = A (i,j) + B (i,j)
@@ -129,6 +143,13 @@
             GB_PARTITION (pstart, pend, cnz, tid, C_nthreads) ;
             for (int64_t p = pstart ; p < pend ; p++)
             {
+                if (GB_SKIP_WORD (p))
+                { 
+                    // C (p:p+7) is not computed; clear any marks of M
+                    memset (Cb + p, 0, 8) ;
+                    p += 7 ;
+                    continue ;
+                }
                 if (Cb [p] == 0)
                 {
                     // M(i,j) is zero, so C(i,j) can be computed
@@ -209,6 +230,12 @@
             GB_PARTITION (pstart, pend, cnz, tid, C_nthreads) ;
             for (int64_t p = pstart ; p < pend ; p++)
             {
+                if (GB_SKIP_WORD (p))
+                { 
+                    // C (p:p+7) is not computed; Cb is already zero
+                    p += 7 ;
+                    continue ;
+                }
                 GB_GET_MIJ (p) ;
                 if (mij)
                 {
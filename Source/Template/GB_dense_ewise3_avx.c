@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// GB_dense_ewise3_avx: C=A+B or C+=A+B with AVX2 or AVX512F instructions
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd at file scope in Generated2/GB_binop__*.c, for the
+// operators accelerated with AVX2 or AVX512F (GB_BINOP_HAS_AVX_IMPLEMENTATION).
+// All of these operators are used in GB (_Cdense_ewise3_accum) as well as
+// GB (_Cdense_ewise3_noaccum).  Each kernel is compiled once for each
+// instruction set, and the variant is selected at run time.
+
+//------------------------------------------------------------------------------
+// AVX512F variants
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+
+    GB_TARGET_AVX512F static inline void GB_dense_ewise3_accum_avx512f
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        const int nthreads
+    )
+    {
+        #include "GB_dense_ewise3_accum_template.c"
+    }
+
+    GB_TARGET_AVX512F static inline void GB_dense_ewise3_noaccum_avx512f
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        const int nthreads
+    )
+    {
+        #include "GB_dense_ewise3_noaccum_template.c"
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// AVX2 variants
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX2
+
+    GB_TARGET_AVX2 static inline void GB_dense_ewise3_accum_avx2
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        const int nthreads
+    )
+    {
+        #include "GB_dense_ewise3_accum_template.c"
+    }
+
+    GB_TARGET_AVX2 static inline void GB_dense_ewise3_noaccum_avx2
+    (
+        GrB_Matrix C,
+        const GrB_Matrix A,
+        const GrB_Matrix B,
+        const int nthreads
+    )
+    {
+        #include "GB_dense_ewise3_noaccum_template.c"
+    }
+
+#endif
@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_kroner_template: C = kron (A,B), one slice of C per task
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The pattern of C has already been computed: C->p and C->h are known (C is
+// sparse, hypersparse, or full).  The entries of C have been sliced by
+// GB_ek_slice, so that each task computes a contiguous set of entries of C,
+// which may start and end in the middle of a vector.  Each vector C(:,kC) is
+// the Kronecker product of A(:,kA) and B(:,kB), where kA = kC / bnvec and kB
+// = kC % bnvec, and its qth entry is A(pA,kA)*B(pB,kB), where pA = pA_start
+// + q / bknz and pB = pB_start + q % bknz.
+
+// The #include'ing file defines GB_KRON_OP (pC,pA,pB,iA,iB,kA,kB), which
+// computes the numerical value of C(iC,jC) = A(iA,jA)*B(iB,jB) in Cx [pC].
+
+{
+    int tid ;
+    #pragma omp parallel for num_threads(C_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < C_ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_Cslice [tid] ;
+        int64_t klast  = klast_Cslice  [tid] ;
+        for (int64_t kC = kfirst ; kC <= klast ; kC++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of C(:,kC) for this task
+            //------------------------------------------------------------------
+
+            int64_t pC_start, pC_end ;
+            GB_get_pA (&pC_start, &pC_end, tid, kC, kfirst, klast,
+                pstart_Cslice, Cp, cvlen) ;
+            if (pC_start >= pC_end) continue ;
+
+            //------------------------------------------------------------------
+            // get A(:,kA) and B(:,kB)
+            //------------------------------------------------------------------
+
+            const int64_t kA = kC / bnvec ;
+            const int64_t kB = kC % bnvec ;
+            const int64_t pA_start = GBP (Ap, kA, avlen) ;
+            const int64_t pB_start = GBP (Bp, kB, bvlen) ;
+            const int64_t pB_end   = GBP (Bp, kB+1, bvlen) ;
+            const int64_t bknz = pB_end - pB_start ;
+            ASSERT (bknz > 0) ;
+
+            //------------------------------------------------------------------
+            // find the first entries of A(:,kA) and B(:,kB) for this task
+            //------------------------------------------------------------------
+
+            const int64_t q = pC_start - GBP (Cp, kC, cvlen) ;
+            int64_t pA = pA_start + q / bknz ;
+            int64_t pB = pB_start + q % bknz ;
+            int64_t iA = GBI (Ai, pA, avlen) ;
+
+            //------------------------------------------------------------------
+            // C(:,kC) = kron (A(:,kA), B(:,kB)) for this task
+            //------------------------------------------------------------------
+
+            for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+            {
+                // C(iC,jC) = A(iA,jA) * B(iB,jB)
+                const int64_t iB = GBI (Bi, pB, bvlen) ;
+                if (Ci != NULL)
+                {
+                    Ci [pC] = iA * bvlen + iB ;
+                }
+                GB_KRON_OP (pC, pA, pB, iA, iB, kA, kB) ;
+                if (++pB == pB_end && pC+1 < pC_end)
+                {
+                    // advance to the next entry in A(:,kA)
+                    pB = pB_start ;
+                    pA++ ;
+                    iA = GBI (Ai, pA, avlen) ;
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// GB_kroner_type_factory: switch factory for built-in types for C=kron(A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The #include'ing file defines the GB_KRON_OP and GB_KRON_MULT macros, and
+// ccode, the type of C, A, and B.  No typecasting is done.  If the type is
+// handled here, done is set to true.
+
+{
+    switch (ccode)
+    {
+        case GB_INT32_code  :
+        {
+            #define GB_CTYPE int32_t
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        case GB_INT64_code  :
+        {
+            #define GB_CTYPE int64_t
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        case GB_UINT32_code :
+        {
+            #define GB_CTYPE uint32_t
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        case GB_UINT64_code :
+        {
+            #define GB_CTYPE uint64_t
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        case GB_FP32_code   :
+        {
+            #define GB_CTYPE float
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        case GB_FP64_code   :
+        {
+            #define GB_CTYPE double
+            #include "GB_kroner_template.c"
+            #undef  GB_CTYPE
+            done = true ;
+        }
+        break ;
+
+        default: ;
+    }
+}
+
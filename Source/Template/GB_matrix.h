@@ -225,6 +225,32 @@ size_t b_size ;         // exact size of A->b in bytes, zero if A->b is NULL
 size_t i_size ;         // exact size of A->i in bytes, zero if A->i is NULL
 size_t x_size ;         // exact size of A->x in bytes, zero if A->x is NULL
 
+// A->hyper_hash is an optional hash index of A->h, for O(1)-time lookups of
+// the vectors of a hypersparse matrix.  It is never shallow; it is built on
+// demand and freed whenever A->h changes.  See GB_hyper_hash_build.c.
+
+GB_Hyper_hash hyper_hash ;  // hash index of A->h, or NULL
+
+// A->stamp is changed to a new unique value whenever A is created or modified
+// (see GB_stamp.c), so anything computed from A can be checked in O(1) time.
+
+int64_t stamp ;             // modification stamp of A
+
+// A->AT is an optional copy of the transpose of A, held in the same CSR/CSC
+// format as A, for the push/pull selection in GrB_mxv and GrB_vxm (see
+// GxB_PUSH_PULL).  It is never shallow; it is built on demand if A->push_pull
+// is true, and it is valid only if A->AT_stamp is equal to A->stamp.  It is
+// also freed whenever A is stamped.  See GB_transpose_cache_build.c.
+GrB_Matrix AT ;             // cached transpose of A, or NULL
+int64_t AT_stamp ;          // A->stamp when A->AT was computed
+bool push_pull ;            // if true, mxv and vxm select push or pull
+
+// B->saxpy3_cache is an optional list of the tasks constructed by
+// GB_AxB_saxpy3 for C<#M>=A*B, where B is this matrix.  It is never shallow,
+// and it is freed whenever B is stamped.  The list entries are defined in
+// GB_AxB_saxpy3.h.  See GB_AxB_saxpy3_slice_cached.c.
+struct GB_saxpy3_cache_struct *saxpy3_cache ;   // cached saxpy3 tasks, or NULL
+
 //------------------------------------------------------------------------------
 // pending tuples
 //------------------------------------------------------------------------------
@@ -276,6 +302,15 @@ size_t x_size ;         // exact size of A->x in bytes, zero if A->x is NULL
 
 GB_Pending Pending ;        // list of pending tuples
 
+// If the matrix is in concurrent-ingest mode, each user thread that calls
+// GrB_setElement appends its tuples to its own list in A->Ingest instead, so
+// that multiple user threads can call GrB_setElement on the same matrix at
+// the same time.  These tuples are moved into A->Pending by GB_wait.  They are
+// typecasted to A->type, and they are assembled with the implicit SECOND
+// operator, just like the tuples from GrB_setElement held in A->Pending.
+
+GB_Ingest Ingest ;          // per-thread pending tuples, or NULL
+
 //-----------------------------------------------------------------------------
 // zombies
 //-----------------------------------------------------------------------------
@@ -395,6 +430,18 @@ bool i_shallow ;        // true if i is a shallow copy
 bool x_shallow ;        // true if x is a shallow copy
 bool static_header ;    // true if this struct is statically allocated
 
+//------------------------------------------------------------------------------
+// memory-mapped matrices
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_mmap has shallow components that point into
+// a read-only mapping of a file.  This is the only case where a matrix with
+// shallow components is passed back to the user application.  The mapping is
+// released by GB_Matrix_free, when the matrix itself is freed.
+
+void *mmap_base ;       // start of the mapped file, or NULL if not mapped
+size_t mmap_size ;      // size of the mapped file, in bytes
+
 //------------------------------------------------------------------------------
 // other bool content
 //------------------------------------------------------------------------------
@@ -134,6 +134,44 @@
 
 #endif
 
+//------------------------------------------------------------------------------
+// GB_GET_A_k_ULTRA: get the part of A(:,k) used by a fine task
+//------------------------------------------------------------------------------
+
+#undef GB_GET_A_k_ULTRA
+
+#if defined ( GB_META16 )
+
+    #if ( GB_A_IS_HYPER )
+
+        // A is hyper
+        #define GB_GET_A_k_ULTRA GB_GET_A_k_ULTRA_FOR_ALL_FORMATS (true)
+
+    #elif ( GB_A_IS_SPARSE )
+
+        // A is sparse
+        #define GB_GET_A_k_ULTRA                                    \
+            const int64_t pA_start = Ap [k] + GB_ASKIP_FIRST ;      \
+            const int64_t pA_end = Ap [k+1] - GB_ASKIP_LAST ;       \
+            const int64_t aknz = pA_end - pA_start
+
+    #else
+
+        // A is bitmap or full
+        #define GB_GET_A_k_ULTRA                                    \
+            const int64_t pA_start = k * avlen + GB_ASKIP_FIRST ;   \
+            const int64_t pA_end = (k+1) * avlen - GB_ASKIP_LAST ;  \
+            const int64_t aknz = pA_end - pA_start
+
+    #endif
+
+#else
+
+    // define GB_GET_A_k_ULTRA for all sparsity formats
+    #define GB_GET_A_k_ULTRA GB_GET_A_k_ULTRA_FOR_ALL_FORMATS (A_is_hyper)
+
+#endif
+
 //------------------------------------------------------------------------------
 // GB_GET_A_ik_INDEX: get the index i of the entry A(i,k)
 //------------------------------------------------------------------------------
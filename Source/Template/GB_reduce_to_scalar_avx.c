@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar_avx: s=reduce(A) with AVX2 or AVX512F instructions
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This file is #include'd at file scope in Generated2/GB_red__*.c, for the
+// monoids accelerated with AVX2 or AVX512F (GB_MONOID_HAS_AVX_IMPLEMENTATION).
+// It defines two variants of the kernel in GB (_red_scalar), with the same
+// method but compiled for each instruction set.  The loops over the Panel in
+// GB_reduce_panel.c are then vectorized with 256-bit or 512-bit registers.
+// The variant is selected at run time, in GB (_red_scalar).
+
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar_avx512f: s=reduce(A) with AVX512F
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+
+    GB_TARGET_AVX512F static inline void GB_reduce_to_scalar_avx512f
+    (
+        GB_CTYPE *s_handle,
+        const GrB_Matrix A,
+        GB_CTYPE *restrict W,
+        bool *restrict F,
+        int ntasks,
+        int nthreads
+    )
+    {
+        GB_CTYPE s = (*s_handle) ;
+        if (A->nzombies > 0 || GB_IS_BITMAP (A))
+        {
+            #include "GB_reduce_to_scalar_template.c"
+        }
+        else
+        {
+            #include "GB_reduce_panel.c"
+        }
+        (*s_handle) = s ;
+    }
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar_avx2: s=reduce(A) with AVX2
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX2
+
+    GB_TARGET_AVX2 static inline void GB_reduce_to_scalar_avx2
+    (
+        GB_CTYPE *s_handle,
+        const GrB_Matrix A,
+        GB_CTYPE *restrict W,
+        bool *restrict F,
+        int ntasks,
+        int nthreads
+    )
+    {
+        GB_CTYPE s = (*s_handle) ;
+        if (A->nzombies > 0 || GB_IS_BITMAP (A))
+        {
+            #include "GB_reduce_to_scalar_template.c"
+        }
+        else
+        {
+            #include "GB_reduce_panel.c"
+        }
+        (*s_handle) = s ;
+    }
+
+#endif
@@ -56,10 +56,9 @@ else
 end
 
 ztype_is_real = ~codegen_contains (ztype, 'FC') ;
-ztype_is_fp = isequal (ztype, 'float') || isequal (ztype, 'double') ;
 is_any_complex = is_any && ~ztype_is_real ;
 is_plus_pair_real  = isequal (addop, 'plus') && isequal (multop, 'pair' ) && ztype_is_real ;
-is_plus_times_fp = isequal (addop, 'plus') && isequal (multop, 'times') && ztype_is_fp ;
+is_plus_times_real = isequal (addop, 'plus') && isequal (multop, 'times') && ztype_is_real ;
 
 t_is_simple = isequal (multop, 'pair') || codegen_contains (multop, 'first') || codegen_contains (multop, 'second') ;
 t_is_nonnan = isequal (multop (1:2), 'is') || (multop (1) == 'l') ;
@@ -223,9 +222,9 @@ else
     fprintf (f, 'define(`GB_cij_declare'', `%s cij'')\n', ztype) ;
 end
 
-if (is_plus_times_fp)
-    % plus_times_fp32 and plus_times_fp64 are accelerated with AVX2 or AVX512f instructions.
-    % More semirings will be accelerated in the future.
+if (is_plus_times_real)
+    % plus_times semirings on integer and floating-point types are accelerated
+    % with AVX2 or AVX512f instructions.
     fprintf (f, 'define(`GB_semiring_has_avx_implementation'', `1'')\n') ;
 else
     fprintf (f, 'define(`GB_semiring_has_avx_implementation'', `0'')\n') ;
@@ -232,6 +232,16 @@ disable = [disable (sprintf (' || GxB_NO_%s', upper (fname)))] ;
 disable = [disable (sprintf (' || GxB_NO_%s_%s', upper (binop), upper (fname)))] ;
 fprintf (f, 'define(`GB_disable'', `(%s)'')\n', disable) ;
 
+% plus, min, max, and times on integer and floating-point types are
+% accelerated with AVX2 or AVX512f instructions, for GB_dense_ewise3_*.
+switch (binop)
+    case { 'plus', 'min', 'max', 'times' }
+        has_avx = ~isequal (xtype, 'bool') && ~codegen_contains (xtype, 'FC') ;
+    otherwise
+        has_avx = false ;
+end
+fprintf (f, 'define(`GB_binop_has_avx_implementation'', `%d'')\n', has_avx) ;
+
 % ff = fopen ('temp.h', 'a') ;
 % fprintf (ff, '// #define GxB_NO_%s_%s\n',  upper (binop), upper (fname)) ;
 % fclose (ff) ;
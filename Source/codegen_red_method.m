@@ -71,6 +71,16 @@ disable = [disable (sprintf (' || GxB_NO_%s', upper (aname)))] ;
 disable = [disable (sprintf (' || GxB_NO_%s_%s', upper (opname), upper (aname)))] ;
 fprintf (f, 'define(`GB_disable'', `(%s)'')\n', disable) ;
 
+% plus, min, max, and times monoids on integer and floating-point types are
+% accelerated with AVX2 or AVX512f instructions.
+switch (opname)
+    case { 'plus', 'min', 'max', 'times' }
+        has_avx = ~isequal (atype, 'bool') && ~codegen_contains (atype, 'FC') ;
+    otherwise
+        has_avx = false ;
+end
+fprintf (f, 'define(`GB_monoid_has_avx_implementation'', `%d'')\n', has_avx) ;
+
 fclose (f) ;
 
 % construct the *.c file
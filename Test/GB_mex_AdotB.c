@@ -82,7 +82,7 @@ GrB_Info adotb_complex (GB_Context Context)
     {
         // C = A'*B using dot product method
         mask_applied = false ;  // no mask to apply
-        info = GB_AxB_dot2 (C, false, NULL, NULL, false, false,
+        info = GB_AxB_dot2 (C, false, false, NULL, NULL, false, false,
             false, Aconj, B, semiring, flipxy, Context) ;
     }
 
@@ -117,7 +117,7 @@ GrB_Info adotb (GB_Context Context)
     else
     {
         mask_applied = false ;  // no mask to apply
-        info = GB_AxB_dot2 (C, false, NULL, NULL, false, false,
+        info = GB_AxB_dot2 (C, false, false, NULL, NULL, false, false,
             false, A, B, semiring /* GxB_PLUS_TIMES_FP64 */, flipxy, Context) ;
     }
 
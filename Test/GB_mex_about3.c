@@ -139,6 +139,50 @@ void mexFunction
         CHECK (free_pool_limit [k] == 0) ;
     }
 
+    //--------------------------------------------------------------------------
+    // test GxB_set/get for the per-thread magazines and pool statistics
+    //--------------------------------------------------------------------------
+
+    int64_t magazine_limit [64] ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_MAGAZINE, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_MAGAZINE, magazine_limit)) ;
+    printf ("\ndefault memory pool magazine limits:\n") ;
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        if (magazine_limit [k] > 0)
+        {
+            printf ("magazine %2d: limit %ld\n", k, magazine_limit [k]) ;
+        }
+    }
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        CHECK (magazine_limit [k] == 0) ;
+    }
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        magazine_limit [k] = 0 ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_MAGAZINE, magazine_limit)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_MAGAZINE, magazine_limit)) ;
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        CHECK (magazine_limit [k] == 0) ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_MAGAZINE, NULL)) ;
+
+    int64_t pool_stats [GxB_MEMORY_POOL_NSTATS*64] ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_STATS, pool_stats)) ;
+    for (int k = 0 ; k < GxB_MEMORY_POOL_NSTATS*64 ; k++)
+    {
+        CHECK (pool_stats [k] >= 0) ;
+    }
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, pool_stats)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_MEMORY_POOL_STATS, NULL)) ;
+    ERR (GxB_Global_Option_get (GxB_MEMORY_POOL_MAGAZINE, NULL)) ;
+
     //--------------------------------------------------------------------------
     // GrB_reduce with invalid binary op
     //--------------------------------------------------------------------------
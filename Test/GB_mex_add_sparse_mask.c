@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GB_mex_add_sparse_mask: test C<M>=A+B with a very sparse mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When M is much sparser than A and B, C<M>=A+B is computed by iterating over
+// the entries of M, and must match the unmasked A+B with the mask applied after.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_add_sparse_mask"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, C3 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index nvals ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=A+B with a very sparse mask
+    //--------------------------------------------------------------------------
+
+    // M has far fewer entries than A and B, so C<M>=A+B is computed by
+    // iterating over the entries of M and slicing the work by nnz(M).  C1 is
+    // compared with C2<M>=T, where T=A+B is computed without the mask.  In
+    // the first trial M, A, and B are sparse, in the second B is bitmap, and
+    // in the third M is hypersparse.  Some entries of M are false.
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GrB_OUTP, GrB_REPLACE)) ;
+    OK (GxB_Desc_set (desc, GxB_CHUNK, (double) 1)) ;
+    OK (GxB_Desc_set (desc, GxB_NTHREADS, 4)) ;
+
+    for (int trial = 0 ; trial < 3 ; trial++)
+    {
+        GrB_Index n = 1000 ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&M, GrB_BOOL, n, n)) ;
+        for (int64_t j = 0 ; j < n ; j++)
+        {
+            for (int64_t k = 0 ; k < 10 ; k++)
+            {
+                int64_t i = (j * 37 + k * 101) % n ;
+                OK (GrB_Matrix_setElement_FP64 (A, i + j, i, j)) ;
+                i = (j * 53 + k * 97 + 3) % n ;
+                OK (GrB_Matrix_setElement_FP64 (B, 2*i - j, i, j)) ;
+            }
+        }
+        for (int64_t j = 0 ; j < n ; j += (trial == 2) ? 500 : 100)
+        {
+            for (int64_t k = 0 ; k < 100 ; k++)
+            {
+                int64_t i = (j + k * 7) % n ;
+                OK (GrB_Matrix_setElement_BOOL (M, (k % 5) != 0, i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+        OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL,
+            (trial == 2) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL,
+            (trial == 1) ? GxB_BITMAP : GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+
+        // C1<M> = A+B
+        OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C1, M, NULL, GrB_PLUS_FP64, A, B,
+            desc)) ;
+
+        // C2<M> = T where T = A+B
+        OK (GrB_Matrix_new (&C3, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C3, NULL, NULL, GrB_PLUS_FP64, A, B,
+            NULL)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GrB_Matrix_apply (C2, M, NULL, GrB_IDENTITY_FP64, C3,
+            GrB_DESC_R)) ;
+
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals > 0) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+        OK (GrB_Matrix_free (&A)) ;
+        OK (GrB_Matrix_free (&B)) ;
+        OK (GrB_Matrix_free (&M)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+        OK (GrB_Matrix_free (&C3)) ;
+    }
+
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_add_sparse_mask: all tests passed\n\n") ;
+}
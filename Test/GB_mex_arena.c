@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// GB_mex_arena: test GxB_Arena
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Werkspace is taken from a GxB_Arena when the descriptor holds one.  Any
+// buffer passed to GB_builder or transplanted into a matrix must not come from
+// the arena; GxB_Matrix_concat (hypersparse case) and the outer-product method
+// for C=A*B' are tested with an arena to check this.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_arena"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int expected = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // arena for werkspace
+    //--------------------------------------------------------------------------
+
+    GxB_Arena arena = NULL, arena2 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Matrix C1 = NULL, C2 = NULL ;
+    size_t highwater ;
+    int64_t noverflow ;
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Arena_new (&arena, 0)) ;
+    CHECK (arena == NULL) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Arena_new (NULL, 1000)) ;
+    OK (GxB_Arena_new (&arena, 1000)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GrB_INP1, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_HASH)) ;
+    OK (GxB_Desc_get (desc, GxB_ARENA, &arena2)) ;
+    CHECK (arena2 == NULL) ;
+
+    // C1 = A*A' without the arena
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) k, k, (k * 37) % 1000)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, (double) k, k, (k * 91) % 1000)) ;
+    }
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, desc)) ;
+    OK (GrB_Matrix_wait (C1, 1)) ;
+
+    // C2 = A*A' with an arena that is too small
+    OK (GxB_Desc_set (desc, GxB_ARENA, arena)) ;
+    OK (GxB_Desc_get (desc, GxB_ARENA, &arena2)) ;
+    CHECK (arena2 == arena) ;
+    OK (GxB_Descriptor_fprint (desc, "desc with arena", 3, NULL)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Descriptor_set (desc, GxB_ARENA, GxB_DEFAULT)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, desc)) ;
+    OK (GrB_Matrix_wait (C2, 1)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GxB_Arena_highwater (&highwater, &noverflow, arena)) ;
+    printf ("arena: highwater %g noverflow %g\n", (double) highwater,
+        (double) noverflow) ;
+    CHECK (noverflow > 0) ;
+
+    // again with an arena large enough for all the werkspace
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GxB_Arena_free (&arena)) ;
+    CHECK (arena == NULL) ;
+    OK (GxB_Arena_new (&arena, 16 * 1024 * 1024)) ;
+    OK (GxB_Desc_set (desc, GxB_ARENA, arena)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 1000, 1000)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, desc)) ;
+    OK (GrB_Matrix_wait (C2, 1)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GxB_Arena_highwater (&highwater, &noverflow, arena)) ;
+    printf ("arena: highwater %g noverflow %g\n", (double) highwater,
+        (double) noverflow) ;
+    CHECK (highwater > 0 && noverflow == 0) ;
+    OK (GxB_Arena_clear (arena)) ;
+    OK (GxB_Arena_highwater (&highwater, NULL, arena)) ;
+    CHECK (highwater == 0) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Arena_highwater (&highwater, &noverflow, NULL)) ;
+
+    OK (GxB_Desc_set (desc, GxB_ARENA, NULL)) ;
+    OK (GxB_Desc_get (desc, GxB_ARENA, &arena2)) ;
+    CHECK (arena2 == NULL) ;
+    OK (GrB_free (&arena)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // hypersparse concat with an arena
+    //--------------------------------------------------------------------------
+
+    // GB_concat_hyper passes its Wj and Wx workspace to GB_builder, which
+    // frees them with GB_FREE.  They must not be taken from the arena.
+
+    GrB_Matrix Tiles [4] = { NULL, NULL, NULL, NULL } ;
+    for (int t = 0 ; t < 4 ; t++)
+    {
+        OK (GrB_Matrix_new (&(Tiles [t]), GrB_FP64, 5000, 5000)) ;
+        OK (GxB_Matrix_Option_set (Tiles [t], GxB_SPARSITY_CONTROL,
+            GxB_HYPERSPARSE)) ;
+        for (int k = 0 ; k < 20 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (Tiles [t], (double) (t * 100 + k),
+                (k * 997 + t) % 5000, (k * 13 + t * 7) % 50)) ;
+        }
+        OK (GrB_Matrix_wait (Tiles [t], GrB_MATERIALIZE)) ;
+    }
+
+    // C1 = concat (Tiles) without the arena
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 10000, 10000)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GxB_Matrix_concat (C1, Tiles, 2, 2, NULL)) ;
+    OK (GxB_Matrix_fprint (C1, "C1 concat", 2, NULL)) ;
+
+    // C2 = concat (Tiles) with an arena
+    OK (GxB_Arena_new (&arena, 1024 * 1024)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GxB_ARENA, arena)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 10000, 10000)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GxB_Matrix_concat (C2, Tiles, 2, 2, desc)) ;
+    OK (GxB_Matrix_fprint (C2, "C2 concat with arena", 2, NULL)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GxB_Arena_highwater (&highwater, &noverflow, arena)) ;
+    printf ("arena: highwater %g noverflow %g\n", (double) highwater,
+        (double) noverflow) ;
+    CHECK (highwater > 0) ;
+    OK (GrB_Matrix_free (&C2)) ;
+
+    // again, with the tiles typecasted to C2
+    OK (GrB_Matrix_new (&C2, GrB_FP32, 10000, 10000)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GxB_Matrix_concat (C2, Tiles, 2, 2, desc)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP32, 10000, 10000)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GxB_Matrix_concat (C1, Tiles, 2, 2, NULL)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    for (int t = 0 ; t < 4 ; t++)
+    {
+        OK (GrB_Matrix_free (&(Tiles [t]))) ;
+    }
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+
+    //--------------------------------------------------------------------------
+    // outer-product method with an arena
+    //--------------------------------------------------------------------------
+
+    // GB_AxB_outer passes its Tj workspace to GB_builder.
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, 100, 10)) ;
+    OK (GrB_Matrix_new (&A2, GrB_INT64, 80, 10)) ;
+    for (int k = 0 ; k < 300 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k % 7 - 3, (k * 37) % 100,
+            (k * 13) % 10)) ;
+        OK (GrB_Matrix_setElement_INT64 (A2, k % 5 - 2, (k * 41) % 80,
+            (k * 7) % 10)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Descriptor_set (desc, GrB_INP1, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_Matrix_new (&C1, GrB_INT64, 100, 80)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, A2, desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_OUTER)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, 100, 80)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, A2, desc)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GrB_free (&arena)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_arena: all tests passed\n\n") ;
+}
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_mex_avx: test the GxB_CPU_AVX2 and GxB_CPU_AVX512F options
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The AVX2 and AVX512F kernels are enabled or disabled with GxB_set, and
+// must give the same results as the vanilla kernels.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_avx"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, C3 = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int expected = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // axv2 and avx512f
+    //--------------------------------------------------------------------------
+
+    bool have_avx2 = GB_Global_cpu_features_avx2 ( ) ;
+    bool have_avx512f = GB_Global_cpu_features_avx512f ( ) ;
+    printf ("avx2: %d avx512f: %d\n", have_avx2, have_avx512f) ;
+
+    bool use_avx2, use_avx512f ;
+    OK (GxB_Global_Option_get (GxB_CPU_AVX2, &use_avx2)) ;
+    OK (GxB_Global_Option_get (GxB_CPU_AVX512F, &use_avx512f)) ;
+    CHECK (use_avx2 == have_avx2) ;
+    CHECK (use_avx512f == have_avx512f) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Global_Option_get (GxB_CPU_AVX2, NULL)) ;
+    ERR (GxB_Global_Option_get (GxB_CPU_AVX512F, NULL)) ;
+
+    // the AVX kernels must give the same results as the vanilla ones
+    double s1 = 0, s2 = 0 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 100, 100)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int i = 0 ; i < 100 ; i++)
+    {
+        for (int j = 0 ; j < 100 ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A, (double) ((i+j) % 7), i, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (B, (double) ((i*j) % 5), i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_FULL)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 100, 100)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+
+    for (int trial = 0 ; trial < 3 ; trial++)
+    {
+        // trial 0: vanilla kernels, 1: AVX2 if available, 2: AVX512F too
+        OK (GxB_Global_Option_set (GxB_CPU_AVX2, trial >= 1)) ;
+        OK (GxB_Global_Option_set (GxB_CPU_AVX512F, trial >= 2)) ;
+        OK (GxB_Global_Option_get (GxB_CPU_AVX2, &use_avx2)) ;
+        OK (GxB_Global_Option_get (GxB_CPU_AVX512F, &use_avx512f)) ;
+        CHECK (use_avx2 == (have_avx2 && trial >= 1)) ;
+        CHECK (use_avx512f == (have_avx512f && trial >= 2)) ;
+        GrB_Matrix C = (trial == 0) ? C1 : C2 ;
+        OK (GrB_Matrix_clear (C)) ;
+        // reduce to scalar
+        OK (GrB_Matrix_reduce_FP64 ((trial == 0) ? &s1 : &s2, NULL,
+            GrB_PLUS_MONOID_FP64, A, NULL)) ;
+        // C = A'*B via dot2, then C += A'*B via dot4
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc)) ;
+        OK (GrB_mxm (C, NULL, GrB_PLUS_FP64, GrB_PLUS_TIMES_SEMIRING_FP64,
+            A, B, desc)) ;
+        // C = A+C, then C = C+B, with all matrices dense
+        OK (GrB_Matrix_new (&C3, GrB_FP64, 100, 100)) ;
+        OK (GxB_Matrix_Option_set (C3, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C3, NULL, NULL, GrB_PLUS_FP64,
+            A, C, NULL)) ;
+        OK (GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, GrB_PLUS_FP64,
+            GrB_PLUS_FP64, C3, B, NULL)) ;
+        OK (GrB_Matrix_free (&C3)) ;
+        if (trial > 0)
+        {
+            CHECK (s1 == s2) ;
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        }
+    }
+
+    OK (GxB_Global_Option_set (GxB_CPU_AVX2, have_avx2)) ;
+    OK (GxB_Global_Option_set (GxB_CPU_AVX512F, have_avx512f)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_avx: all tests passed\n\n") ;
+}
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GB_mex_bitmap_word: test bitmap emult and bitmap-to-sparse a word at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The bitmap emult methods and the bitmap-to-sparse conversion skip runs of 8
+// entries at a time, and must give the same results as the sparse methods.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_bitmap_word"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Index nvals ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C=A.*B with C, A, and B bitmap, and long runs of missing entries
+    //--------------------------------------------------------------------------
+
+    // A and B are bitmap, with many runs of 8 or more entries that are not
+    // present in A.*B, so the bitmap emult skips them a word at a time.  C1
+    // is computed without a mask (method 5), with a complemented sparse mask
+    // (method 6), and with a bitmap mask (method 7).  C2 is computed with
+    // sparse copies of A and B.  C1 and C2 are then converted to sparse,
+    // which also skips the empty words of their bitmaps.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, 100, 100)) ;
+    for (int i = 0 ; i < 100 ; i++)
+    {
+        for (int j = 0 ; j < 100 ; j++)
+        {
+            if (i < 10 || (i*j) % 37 == 0)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, i + 2*j, i, j)) ;
+            }
+            if (i % 3 == 0 || i > 90)
+            {
+                OK (GrB_Matrix_setElement_FP64 (B, i - j, i, j)) ;
+            }
+            if ((i + j) % 4 == 0)
+            {
+                OK (GrB_Matrix_setElement_BOOL (M, true, i, j)) ;
+            }
+        }
+    }
+    GrB_Matrix B2 = NULL ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    OK (GrB_Matrix_dup (&B2, B)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_Option_set (A2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_set (B2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_IS_BITMAP (A)) ;
+    CHECK (GB_IS_BITMAP (B)) ;
+
+    for (int method = 5 ; method <= 7 ; method++)
+    {
+        if (method == 7)
+        {
+            OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        }
+        GrB_Matrix Mask = (method == 5) ? NULL : M ;
+        GrB_Descriptor d = (method == 6) ? GrB_DESC_C : NULL ;
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 100, 100)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 100, 100)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (C1, Mask, NULL, GrB_TIMES_FP64,
+            A, B, d)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (C2, Mask, NULL, GrB_TIMES_FP64,
+            A2, B2, d)) ;
+        CHECK (GB_IS_BITMAP (C1)) ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals > 0) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+    }
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Matrix_free (&B2)) ;
+    OK (GrB_Matrix_free (&M)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_bitmap_word: all tests passed\n\n") ;
+}
@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+// GB_mex_builder_pack: test GrB_Matrix_build with (j,i) packed into one sort key
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_builder sorts the (j,i) pairs packed into single 64-bit keys when the
+// dimensions are small enough, and as two keys otherwise.  The results must
+// be the same.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_builder_pack"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL ;
+    GrB_Index nvals ;
+    int k ;
+    #define NT 3000
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // build with (j,i) packed into a single sort key
+    //--------------------------------------------------------------------------
+
+    // A has small dimensions, so GB_builder sorts the (j,i) pairs packed into
+    // single keys.  A2 has 2^33 rows (or columns if held by row), so the pairs
+    // are sorted as two keys instead.  The tuples are unsorted with
+    // duplicates, and the results must match.
+
+    I = mxMalloc (NT * sizeof (GrB_Index)) ;
+    J = mxMalloc (NT * sizeof (GrB_Index)) ;
+    X = mxMalloc (NT * sizeof (double)) ;
+    GrB_Index *I2 = mxMalloc (NT * sizeof (GrB_Index)) ;
+    GrB_Index *J2 = mxMalloc (NT * sizeof (GrB_Index)) ;
+    double *X2 = mxMalloc (NT * sizeof (double)) ;
+    GrB_Scalar scalar = NULL ;
+    OK (GrB_Scalar_new (&scalar, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (scalar, 3)) ;
+    GrB_Index big = ((GrB_Index) 1) << 33 ;
+
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+            OK (GrB_Matrix_new (&A2, GrB_FP64, by_row ? 1000 : big,
+                by_row ? big : 1000)) ;
+            GxB_Format_Value fmt = by_row ? GxB_BY_ROW : GxB_BY_COL ;
+            OK (GxB_Matrix_Option_set (A, GxB_FORMAT, fmt)) ;
+            OK (GxB_Matrix_Option_set (A2, GxB_FORMAT, fmt)) ;
+            for (k = 0 ; k < NT ; k++)
+            {
+                int64_t t = k % 1500 ;
+                I [k] = (t * 7919) % 1000 ;
+                J [k] = (t * 104729) % 997 ;
+                X [k] = (double) k ;
+            }
+            if (iso)
+            {
+                OK (GxB_Matrix_build_Scalar (A, I, J, scalar, NT)) ;
+                OK (GxB_Matrix_build_Scalar (A2, I, J, scalar, NT)) ;
+            }
+            else
+            {
+                OK (GrB_Matrix_build_FP64 (A, I, J, X, NT, GrB_PLUS_FP64)) ;
+                OK (GrB_Matrix_build_FP64 (A2, I, J, X, NT, GrB_PLUS_FP64)) ;
+            }
+            GrB_Index nvals2 ;
+            OK (GrB_Matrix_nvals (&nvals, A)) ;
+            OK (GrB_Matrix_nvals (&nvals2, A2)) ;
+            CHECK (nvals == 1500) ;
+            CHECK (nvals == nvals2) ;
+            OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A)) ;
+            OK (GrB_Matrix_extractTuples_FP64 (I2, J2, X2, &nvals2, A2)) ;
+            for (k = 0 ; k < nvals ; k++)
+            {
+                CHECK (I [k] == I2 [k]) ;
+                CHECK (J [k] == J2 [k]) ;
+                CHECK (X [k] == X2 [k]) ;
+                // each entry is the sum of tuples t and t+1500, or 3 if iso
+                CHECK (iso ? (X [k] == 3) :
+                    ((((int64_t) X [k]) - 1500) % 2 == 0)) ;
+            }
+            OK (GrB_Matrix_free (&A)) ;
+            OK (GrB_Matrix_free (&A2)) ;
+        }
+    }
+
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (I2) ;
+    mxFree (J2) ;
+    mxFree (X2) ;
+    OK (GrB_Scalar_free (&scalar)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_builder_pack: all tests passed\n\n") ;
+}
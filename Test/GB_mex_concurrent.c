@@ -0,0 +1,113 @@
+//------------------------------------------------------------------------------
+// GB_mex_concurrent: concurrent setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Multiple user threads call GrB_Matrix_setElement on the same matrix, held
+// in concurrent-ingest mode (GxB_CONCURRENT_INGEST).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_concurrent"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // concurrent setElement
+    //--------------------------------------------------------------------------
+
+    bool concurrent = true ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_CONCURRENT_INGEST, &concurrent)) ;
+    CHECK (!concurrent) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) k, k, k)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_CONCURRENT_INGEST, true)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_CONCURRENT_INGEST, &concurrent)) ;
+    CHECK (concurrent) ;
+
+    // each thread adds all entries in a set of rows, each one twice; the
+    // diagonal is already present and is modified
+    int nfail = 0 ;
+    int k ;
+    #pragma omp parallel for num_threads(4) schedule(static,1) \
+        reduction(+:nfail)
+    for (k = 0 ; k < 1000 ; k++)
+    {
+        for (int j = 0 ; j < 1000 ; j += 7)
+        {
+            if (GrB_Matrix_setElement_FP64 (A, (double) (-1), k, j)
+                != GrB_SUCCESS) nfail++ ;
+            if (GrB_Matrix_setElement_FP64 (A, (double) (k+j), k, j)
+                != GrB_SUCCESS) nfail++ ;
+        }
+    }
+    CHECK (nfail == 0) ;
+    OK (GrB_Matrix_removeElement (A, 7, 7)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_CONCURRENT_INGEST, false)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_CONCURRENT_INGEST, &concurrent)) ;
+    CHECK (!concurrent) ;
+
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 1000 * 143 + (1000 - 143) - 1) ;
+    for (int i = 0 ; i < 1000 ; i++)
+    {
+        for (int j = 0 ; j < 1000 ; j++)
+        {
+            double x = 0 ;
+            info = GrB_Matrix_extractElement_FP64 (&x, A, i, j) ;
+            if (i == 7 && j == 7)
+            {
+                CHECK (info == GrB_NO_VALUE) ;
+            }
+            else if (j % 7 == 0)
+            {
+                CHECK (info == GrB_SUCCESS && x == (double) (i+j)) ;
+            }
+            else if (i == j)
+            {
+                CHECK (info == GrB_SUCCESS && x == (double) i) ;
+            }
+            else
+            {
+                CHECK (info == GrB_NO_VALUE) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_free (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_concurrent: all tests passed\n\n") ;
+}
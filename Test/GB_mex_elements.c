@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+// GB_mex_elements: setElements and extractElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_setElements and GxB_Matrix_extractElements, and the vector
+// variants, are compared with GrB_*_setElement and GrB_*_extractElement.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_elements"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int expected = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // setElements and extractElements
+    //--------------------------------------------------------------------------
+
+    #define NT 3000
+    GrB_Matrix A2 = NULL ;
+    GrB_Index *I = mxMalloc (NT * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (NT * sizeof (GrB_Index)) ;
+    double *X = mxMalloc (NT * sizeof (double)) ;
+    int32_t *Y = mxMalloc (NT * sizeof (int32_t)) ;
+    bool *Found = mxMalloc (NT * sizeof (bool)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&A2, GrB_FP64, 100, 100)) ;
+    for (k = 0 ; k < 100 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) k, k, k)) ;
+        OK (GrB_Matrix_setElement_FP64 (A2, (double) k, k, k)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_removeElement (A, 3, 3)) ;
+    OK (GrB_Matrix_removeElement (A2, 3, 3)) ;
+
+    // random tuples, with duplicates; the last duplicate takes precedence
+    for (k = 0 ; k < NT ; k++)
+    {
+        I [k] = (k * 7919) % 100 ;
+        J [k] = (k * 104729) % 97 ;
+        X [k] = (double) k ;
+        OK (GrB_Matrix_setElement_FP64 (A2, X [k], I [k], J [k])) ;
+    }
+    OK (GxB_Matrix_setElements_FP64 (A, I, J, X, NT)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, A2, 0)) ;
+
+    // extract the entries, with typecasting
+    for (k = 0 ; k < NT ; k++)
+    {
+        I [k] = (k * 31) % 100 ;
+        J [k] = (k * 17) % 100 ;
+    }
+    info = GxB_Matrix_extractElements_INT32 (Y, Found, A, I, J, NT) ;
+    CHECK (info == GrB_NO_VALUE) ;
+    for (k = 0 ; k < NT ; k++)
+    {
+        double x = 0 ;
+        info = GrB_Matrix_extractElement_FP64 (&x, A2, I [k], J [k]) ;
+        CHECK (Found [k] == (info == GrB_SUCCESS)) ;
+        CHECK (!Found [k] || Y [k] == (int32_t) x) ;
+    }
+
+    // as a bitmap matrix
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_setElements_FP64 (A, I, J, X, NT)) ;
+    OK (GxB_Matrix_Option_set (A2, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_setElements_FP64 (A2, I, J, X, NT)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, A2, 0)) ;
+    OK (GxB_Matrix_extractElements_INT32 (Y, NULL, A, I, J, NT)) ;
+
+    // errors
+    I [0] = 100 ;
+    expected = GrB_INVALID_INDEX ;
+    ERR (GxB_Matrix_setElements_FP64 (A, I, J, X, NT)) ;
+    ERR (GxB_Matrix_extractElements_INT32 (Y, Found, A, I, J, NT)) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_setElements_FP64 (A, I, NULL, X, NT)) ;
+    ERR (GxB_Matrix_extractElements_INT32 (NULL, Found, A, I, J, NT)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_setElements_UDT (A, I, J, X, NT)) ;
+    OK (GxB_Matrix_setElements_FP64 (A, I, J, X, 0)) ;
+    CHECK (GB_mx_isequal (A, A2, 0)) ;
+
+    // vectors
+    GrB_Vector v = NULL ;
+    OK (GrB_Vector_new (&v, GrB_INT32, 100)) ;
+    OK (GxB_Vector_setElements_FP64 (v, J, X, NT)) ;
+    OK (GxB_Vector_extractElements_FP64 (X, Found, v, J, NT)) ;
+    for (k = 0 ; k < NT ; k++)
+    {
+        int32_t y = 0 ;
+        OK (GrB_Vector_extractElement_INT32 (&y, v, J [k])) ;
+        CHECK (Found [k] && X [k] == (double) y) ;
+    }
+    OK (GrB_Vector_free (&v)) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (Y) ;
+    mxFree (Found) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_elements: all tests passed\n\n") ;
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// GB_mex_extract_inverse: test C=A(I,:) with a parallel I inverse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_I_inverse builds the inverse of a long index list I in parallel when
+// the chunk is small, and must give the same result as the sequential method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_extract_inverse"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index nvals, *I = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C=A(I,:) with the I inverse constructed in parallel
+    //--------------------------------------------------------------------------
+
+    // A is held by column, and I is a long list of row indices: unsorted with
+    // duplicates, then sorted with duplicates, then a permutation with no
+    // duplicates.  C1 is computed with a small chunk, so GB_I_inverse uses
+    // the parallel sort-based method, and C2 is computed with the default
+    // chunk, so it uses the sequential method.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 200)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int j = 0 ; j < 200 ; j++)
+    {
+        for (int p = 0 ; p < 50 ; p++)
+        {
+            int i = (j * 7 + p * 19) % 1000 ;
+            OK (GrB_Matrix_setElement_FP64 (A, i + j/10., i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GxB_CHUNK, (double) 1)) ;
+    OK (GxB_Desc_set (desc, GxB_NTHREADS, 4)) ;
+    I = mxMalloc (3000 * sizeof (GrB_Index)) ;
+
+    for (int kind = 0 ; kind < 3 ; kind++)
+    {
+        GrB_Index nI = (kind == 2) ? 1000 : 3000 ;
+        for (k = 0 ; k < nI ; k++)
+        {
+            switch (kind)
+            {
+                case 0 : I [k] = (k * 7919) % 1000 ; break ;   // unsorted
+                case 1 : I [k] = k / 3 ;             break ;   // sorted
+                default: I [k] = (k * 7919) % 1000 ; break ;   // permutation
+            }
+        }
+        OK (GrB_Matrix_new (&C1, GrB_FP64, nI, 200)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, nI, 200)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GrB_Matrix_extract (C1, NULL, NULL, A, I, nI, GrB_ALL, 200,
+            desc)) ;
+        OK (GrB_Matrix_extract (C2, NULL, NULL, A, I, nI, GrB_ALL, 200,
+            NULL)) ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals == ((kind == 2) ? 10000 : 30000)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+    }
+
+    mxFree (I) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_extract_inverse: all tests passed\n\n") ;
+}
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_mex_hyper_hash: hash index of the hyperlist
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A->hyper_hash is an optional hash index of A->h, built on demand when a
+// hypersparse matrix has more than GxB_HYPER_HASH vectors.  Results with and
+// without the hash index are compared.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_hyper_hash"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Index nvals ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // hash index of the hyperlist
+    //--------------------------------------------------------------------------
+
+    int64_t hyper_hash = 0 ;
+    OK (GxB_Global_Option_get (GxB_HYPER_HASH, &hyper_hash)) ;
+    CHECK (hyper_hash == 1024) ;
+
+    // A and A2 are hypersparse with 200 vectors; only A has a hash index
+    GrB_Index nhuge = ((GrB_Index) 1) << 40 ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, nhuge, nhuge)) ;
+    OK (GrB_Matrix_new (&A2, GrB_FP64, nhuge, nhuge)) ;
+    for (k = 0 ; k < 200 ; k++)
+    {
+        GrB_Index i = (k * 1000003) % nhuge, j = (k * 7919) % 300 ;
+        OK (GrB_Matrix_setElement_FP64 (A, (double) k, i, j)) ;
+        OK (GrB_Matrix_setElement_FP64 (A2, (double) k, i, j)) ;
+    }
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, INT64_MAX)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (A2->hyper_hash == NULL) ;
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, 4)) ;
+    OK (GxB_Global_Option_get (GxB_HYPER_HASH, &hyper_hash)) ;
+    CHECK (hyper_hash == 4) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->hyper_hash != NULL) ;
+    CHECK (GB_mx_isequal (A, A2, 0)) ;
+
+    // lookups of entries that are present, and not present
+    for (k = 0 ; k < 400 ; k++)
+    {
+        GrB_Index i = (k * 1000003) % nhuge, j = (k * 7919) % 300 ;
+        double x1 = -1, x2 = -1 ;
+        GrB_Info info1 = GrB_Matrix_extractElement_FP64 (&x1, A, i, j) ;
+        GrB_Info info2 = GrB_Matrix_extractElement_FP64 (&x2, A2, i, j) ;
+        CHECK (info1 == info2 && x1 == x2) ;
+        CHECK (info1 == ((k < 200) ? GrB_SUCCESS : GrB_NO_VALUE)) ;
+    }
+
+    // C1 = A*A' with the hash index of A->h, and C2 = A2*A2' without it
+    OK (GrB_Matrix_new (&C1, GrB_FP64, nhuge, nhuge)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, nhuge, nhuge)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+        GrB_DESC_T1)) ;
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, INT64_MAX)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, A2,
+        GrB_DESC_T1)) ;
+    CHECK (A2->hyper_hash == NULL) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // the hash index is discarded when the hyperlist changes
+    OK (GrB_Matrix_setElement_FP64 (A, 1000, 3, 3)) ;
+    OK (GrB_Matrix_setElement_FP64 (A2, 1000, 3, 3)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->hyper_hash == NULL) ;
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, 4)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->hyper_hash != NULL) ;
+    double x = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, A, 3, 3)) ;
+    CHECK (x == 1000) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    CHECK (GB_mx_isequal (A, A2, 0)) ;
+
+    // C1 = A (I,:) and C2 = A2 (I,:) for a list I
+    GrB_Index Ilist [4] = { 3, 1000003, 2000006, 5 } ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 4, nhuge)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 4, nhuge)) ;
+    OK (GrB_Matrix_extract (C1, NULL, NULL, A, Ilist, 4, GrB_ALL, nhuge,
+        NULL)) ;
+    OK (GrB_Matrix_extract (C2, NULL, NULL, A2, Ilist, 4, GrB_ALL, nhuge,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals, C1)) ;
+    CHECK (nvals == 3) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GxB_Global_Option_set (GxB_HYPER_HASH, 1024)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_hyper_hash: all tests passed\n\n") ;
+}
@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_mex_kron_tasks: test C=kron(A,B) with entry-level tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_kroner slices the entries of C into tasks, so a single vector of C can
+// be split across several threads.  The results must match the generic method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_kron_tasks"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL, B = NULL, B2 = NULL, C1 = NULL, C2 = NULL,
+        C3 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index nvals ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C=kron(A,B) with entry-level tasks
+    //--------------------------------------------------------------------------
+
+    // C1 is computed with the built-in TIMES_FP64 kernel, and C2 with the
+    // generic method, since A2 and B2 are INT32 and must be typecasted.  In
+    // the first trial A and B are n-by-1, so C has a single vector, which is
+    // split across several tasks.  In the second, A is small and B is large,
+    // and in the third, A and B are full.
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GxB_CHUNK, (double) 1)) ;
+    OK (GxB_Desc_set (desc, GxB_NTHREADS, 4)) ;
+
+    for (int trial = 0 ; trial < 3 ; trial++)
+    {
+        GrB_Index am = (trial == 0) ? 100 : ((trial == 1) ?   3 : 10) ;
+        GrB_Index an = (trial == 0) ?   1 : ((trial == 1) ?   4 : 10) ;
+        GrB_Index bm = (trial == 0) ? 200 : ((trial == 1) ? 300 : 12) ;
+        GrB_Index bn = (trial == 0) ?   1 : ((trial == 1) ?  50 :  8) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, am, an)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, bm, bn)) ;
+        OK (GrB_Matrix_new (&A2, GrB_INT32, am, an)) ;
+        OK (GrB_Matrix_new (&B2, GrB_INT32, bm, bn)) ;
+        for (int64_t i = 0 ; i < am ; i++)
+        {
+            for (int64_t j = 0 ; j < an ; j++)
+            {
+                if (trial < 2 && (i + j) % 3 == 0) continue ;
+                OK (GrB_Matrix_setElement_FP64 (A, i + 2*j, i, j)) ;
+                OK (GrB_Matrix_setElement_INT32 (A2, i + 2*j, i, j)) ;
+            }
+        }
+        for (int64_t i = 0 ; i < bm ; i++)
+        {
+            for (int64_t j = 0 ; j < bn ; j++)
+            {
+                if (trial < 2 && (i * 5 + j) % 7 > 2) continue ;
+                OK (GrB_Matrix_setElement_FP64 (B, 1 + i - j, i, j)) ;
+                OK (GrB_Matrix_setElement_INT32 (B2, 1 + i - j, i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_new (&C1, GrB_FP64, am*bm, an*bn)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, am*bm, an*bn)) ;
+        OK (GrB_Matrix_kronecker_BinaryOp (C1, NULL, NULL, GrB_TIMES_FP64,
+            A, B, desc)) ;
+        OK (GrB_Matrix_kronecker_BinaryOp (C2, NULL, NULL, GrB_TIMES_FP64,
+            A2, B2, desc)) ;
+        GrB_Index anvals, bnvals ;
+        OK (GrB_Matrix_nvals (&anvals, A)) ;
+        OK (GrB_Matrix_nvals (&bnvals, B)) ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals == anvals * bnvals) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+        // C3 = kron (A,B) with a positional operator: C3(iC,jC) = iA
+        OK (GrB_Matrix_new (&C3, GrB_INT64, am*bm, an*bn)) ;
+        OK (GrB_Matrix_kronecker_BinaryOp (C3, NULL, NULL, GxB_FIRSTI_INT64,
+            A, B, desc)) ;
+        OK (GrB_Matrix_nvals (&nvals, C3)) ;
+        CHECK (nvals == anvals * bnvals) ;
+        OK (GrB_Matrix_new (&M, GrB_INT64, am*bm, an*bn)) ;
+        OK (GrB_Matrix_apply (M, NULL, NULL, GxB_POSITIONI_INT64, C3, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT64 (M, NULL, NULL, GrB_DIV_INT64,
+            M, bm, NULL)) ;
+        OK (GrB_Matrix_eWiseMult_BinaryOp (M, NULL, NULL, GrB_MINUS_INT64,
+            M, C3, NULL)) ;
+        OK (GrB_Matrix_select_INT64 (M, NULL, NULL, GrB_VALUENE_INT64, M, 0,
+            NULL)) ;
+        OK (GrB_Matrix_nvals (&nvals, M)) ;
+        CHECK (nvals == 0) ;
+
+        OK (GrB_Matrix_free (&A)) ;
+        OK (GrB_Matrix_free (&B)) ;
+        OK (GrB_Matrix_free (&A2)) ;
+        OK (GrB_Matrix_free (&B2)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+        OK (GrB_Matrix_free (&C3)) ;
+        OK (GrB_Matrix_free (&M)) ;
+    }
+
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_kron_tasks: all tests passed\n\n") ;
+}
@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// GB_mex_mempool_threads: test the per-thread memory pool magazines
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Blocks allocated by one thread are freed by another, and then reused by a
+// third, with the GxB_MEMORY_POOL_STATS hit/miss counts checked at each step.
+// Only the main thread calls malloc and free; the other threads only move
+// blocks into and out of the memory pool.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include <pthread.h>
+
+#define USAGE "GB_mex_mempool_threads"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// size class of the blocks, and # of blocks used
+#define K 10
+#define NBLOCKS 100
+
+static void *block [NBLOCKS] ;
+static void *reused [NBLOCKS] ;
+static void *original [NBLOCKS] ;
+
+// free all blocks in the block [ ] array (into the memory pool)
+static void *free_blocks (void *arg)
+{
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        GB_FREE (&(block [i]), ((size_t) 1) << K) ;
+    }
+    return (NULL) ;
+}
+
+// allocate NBLOCKS blocks into the reused [ ] array (from the memory pool)
+static void *get_blocks (void *arg)
+{
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        size_t size ;
+        reused [i] = GB_malloc_memory (((size_t) 1) << K, 1, &size) ;
+    }
+    return (NULL) ;
+}
+
+// get the memory pool statistics for blocks of size 2^K
+static void get_stats (int64_t *stats)
+{
+    int64_t pool_stats [GxB_MEMORY_POOL_NSTATS*64] ;
+    GrB_Info info = GxB_Global_Option_get (GxB_MEMORY_POOL_STATS, pool_stats) ;
+    if (info != GrB_SUCCESS) mexErrMsgTxt ("stats failed") ;
+    for (int s = 0 ; s < GxB_MEMORY_POOL_NSTATS ; s++)
+    {
+        stats [s] = pool_stats [s*64+K] ;
+    }
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    pthread_t thread ;
+    int64_t stats [GxB_MEMORY_POOL_NSTATS] ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // get the current limits and empty the memory pool
+    //--------------------------------------------------------------------------
+
+    int64_t free_pool_limit_save [64], free_pool_limit [64] ;
+    int64_t magazine_limit [64] ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL, free_pool_limit_save)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL_MAGAZINE, magazine_limit)) ;
+    int64_t nbatch = GB_IMAX (1, magazine_limit [K] / 2) ;
+    printf ("magazine limit for 2^%d: " GBd "\n", K, magazine_limit [K]) ;
+
+    // a pool limit of zero frees all blocks cached by this thread
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        free_pool_limit [k] = 0 ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL, free_pool_limit)) ;
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == 0) ;
+
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_MEMORY_POOL, free_pool_limit)) ;
+    CHECK (free_pool_limit [K] >= NBLOCKS) ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the blocks in this thread: all are misses
+    //--------------------------------------------------------------------------
+
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        size_t size ;
+        block [i] = GB_malloc_memory (((size_t) 1) << K, 1, &size) ;
+        CHECK (block [i] != NULL) ;
+        CHECK (size == ((size_t) 1) << K) ;
+        original [i] = block [i] ;
+    }
+    get_stats (stats) ;
+    CHECK (stats [0] == 0) ;            // magazine hits
+    CHECK (stats [1] == 0) ;            // shared pool hits
+    CHECK (stats [2] == NBLOCKS) ;      // misses
+    CHECK (stats [3] == 0) ;            // blocks freed
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == 0) ;
+
+    //--------------------------------------------------------------------------
+    // free them in another thread
+    //--------------------------------------------------------------------------
+
+    // The blocks go into the magazine of the thread, and the overflow of the
+    // magazine into the shared pool.  When the thread terminates, all blocks
+    // left in its magazine are returned to the shared pool.
+
+    CHECK (pthread_create (&thread, NULL, free_blocks, NULL) == 0) ;
+    CHECK (pthread_join (thread, NULL) == 0) ;
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        CHECK (block [i] == NULL) ;
+    }
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == NBLOCKS) ;
+    get_stats (stats) ;
+    CHECK (stats [2] == NBLOCKS) ;
+    CHECK (stats [3] == 0) ;
+
+    //--------------------------------------------------------------------------
+    // reuse them in a third thread: all are hits
+    //--------------------------------------------------------------------------
+
+    // If the magazine is enabled, it is refilled from the shared pool in
+    // batches of nbatch blocks, and each refill counts as one shared hit.
+
+    CHECK (pthread_create (&thread, NULL, get_blocks, NULL) == 0) ;
+    CHECK (pthread_join (thread, NULL) == 0) ;
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == 0) ;
+    get_stats (stats) ;
+    int64_t nshared = (magazine_limit [K] > 0) ?
+        ((NBLOCKS + nbatch - 1) / nbatch) : NBLOCKS ;
+    printf ("hits: magazine " GBd " shared " GBd "\n", stats [0], stats [1]) ;
+    CHECK (stats [0] == NBLOCKS - nshared) ;
+    CHECK (stats [1] == nshared) ;
+    CHECK (stats [2] == NBLOCKS) ;
+    CHECK (stats [3] == 0) ;
+
+    // each block allocated by the third thread was allocated by this one
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        bool found = false ;
+        for (int j = 0 ; j < NBLOCKS && !found ; j++)
+        {
+            found = (reused [i] == original [j]) ;
+        }
+        CHECK (found) ;
+        for (int j = 0 ; j < i ; j++)
+        {
+            CHECK (reused [i] != reused [j]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free them in this thread, then disable the pool
+    //--------------------------------------------------------------------------
+
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        GB_FREE (&(reused [i]), ((size_t) 1) << K) ;
+    }
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == NBLOCKS) ;
+
+    // setting the limit to zero frees all the cached blocks, both in the
+    // magazine of this thread and in the shared pool
+    for (int k = 0 ; k < 64 ; k++)
+    {
+        free_pool_limit [k] = 0 ;
+    }
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL, free_pool_limit)) ;
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == 0) ;
+    get_stats (stats) ;
+    CHECK (stats [3] == NBLOCKS) ;
+
+    // with the pool disabled, blocks are neither taken from it nor cached
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        size_t size ;
+        block [i] = GB_malloc_memory (((size_t) 1) << K, 1, &size) ;
+        CHECK (block [i] != NULL) ;
+    }
+    for (int i = 0 ; i < NBLOCKS ; i++)
+    {
+        GB_FREE (&(block [i]), ((size_t) 1) << K) ;
+    }
+    CHECK (GB_Global_free_pool_nblocks_total ( ) == 0) ;
+    int64_t stats2 [GxB_MEMORY_POOL_NSTATS] ;
+    get_stats (stats2) ;
+    for (int s = 0 ; s < GxB_MEMORY_POOL_NSTATS ; s++)
+    {
+        CHECK (stats2 [s] == stats [s]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // restore the pool limits
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL, free_pool_limit_save)) ;
+    OK (GxB_Global_Option_set (GxB_MEMORY_POOL_STATS, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_mempool_threads: all tests passed\n\n") ;
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// GB_mex_mxm_inplace: test C+=A'*B and C<M>+=A*B in-place with C bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When C is bitmap, C+=A'*B and C<M>+=A*B are computed in-place, and must
+// give the same result as T=A'*B or T<M>=A*B followed by C+=T.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_mxm_inplace"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, C3 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C+=A'*B and C<M>+=A*B in-place, with C bitmap
+    //--------------------------------------------------------------------------
+
+    // C1 is bitmap with some entries present, A is sparse, and B and M are
+    // bitmap.  C1+=A'*B is computed in-place with dot2, and C1<M>+=A*B
+    // in-place with the bitmap saxpy method, so C1->b is not reallocated.
+    // C2 is computed with T=A'*B or T<M>=A*B first, and then C2+=T.
+
+    OK (GrB_Matrix_new (&A, GrB_INT64, 100, 100)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT64, 100, 100)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, 100, 100)) ;
+    OK (GrB_Matrix_new (&C1, GrB_INT64, 100, 100)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int i = 0 ; i < 100 ; i++)
+    {
+        for (int j = 0 ; j < 100 ; j++)
+        {
+            if ((i + 2*j) % 5 == 0)
+            {
+                OK (GrB_Matrix_setElement_INT64 (A, (i+j) % 7 + 1, i, j)) ;
+            }
+            if ((3*i + j) % 4 == 0)
+            {
+                OK (GrB_Matrix_setElement_INT64 (B, (i*j) % 5 + 1, i, j)) ;
+            }
+            if ((i + j) % 3 == 0)
+            {
+                OK (GrB_Matrix_setElement_BOOL (M, true, i, j)) ;
+            }
+            if ((i * j) % 11 == 0)
+            {
+                OK (GrB_Matrix_setElement_INT64 (C1, i - j, i, j)) ;
+            }
+        }
+    }
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&C2, C1)) ;
+    OK (GrB_Matrix_new (&C3, GrB_INT64, 100, 100)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GrB_INP0, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+
+    // C1 += A'*B, in-place via dot2
+    int8_t *Cb_save = C1->b ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+    OK (GrB_mxm (C1, NULL, GrB_PLUS_INT64, GrB_PLUS_TIMES_SEMIRING_INT64,
+        A, B, desc)) ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+    CHECK (C1->b == Cb_save) ;
+    OK (GrB_mxm (C3, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, B, desc)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL, GrB_PLUS_INT64, C2, C3,
+        NULL)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // C1<M> += A*B, in-place via the bitmap saxpy method
+    OK (GrB_mxm (C1, M, GrB_PLUS_INT64, GrB_PLUS_TIMES_SEMIRING_INT64,
+        A, B, NULL)) ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+    CHECK (C1->b == Cb_save) ;
+    OK (GrB_mxm (C3, M, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, B,
+        GrB_DESC_R)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL, GrB_PLUS_INT64, C2, C3,
+        NULL)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Matrix_free (&C3)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_mxm_inplace: all tests passed\n\n") ;
+}
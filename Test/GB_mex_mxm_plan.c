@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// GB_mex_mxm_plan: test GxB_MxM_Plan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C1<M>=A*A is computed with a plan, and compared with C2<M>=A*A computed
+// without one.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_mxm_plan"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int expected = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // GxB_MxM_Plan
+    //--------------------------------------------------------------------------
+
+    // C1<M>=A*A is computed with a plan, and C2<M>=A*A without it, while the
+    // values of A, the semiring, and then the pattern of A are changed.
+
+    GxB_MxM_Plan plan = NULL, plan2 = NULL ;
+    int64_t nbuild, nreuse ;
+    OK (GxB_MxM_Plan_new (&plan)) ;
+    OK (GxB_MxM_Plan_stats (&nbuild, &nreuse, plan)) ;
+    CHECK (nbuild == 0 && nreuse == 0) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_MxM_Plan_new (NULL)) ;
+    ERR (GxB_MxM_Plan_stats (&nbuild, &nreuse, NULL)) ;
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_CHUNK, &chunk_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, 4)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, (double) 1)) ;
+    OK (GrB_Matrix_new (&A, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, 200, 200)) ;
+    for (k = 0 ; k < 200 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k % 7 + 1, k, 7)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 3 + 1, (k * 13) % 200, k)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 5 + 1, (k * 31) % 200, k)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, k % 2, (k * 17) % 200, k)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true, k, (k * 3) % 200)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&C1, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, 200, 200)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_HASH)) ;
+    OK (GxB_Desc_set (desc, GxB_MXM_PLAN, plan)) ;
+    OK (GxB_Desc_get (desc, GxB_MXM_PLAN, &plan2)) ;
+    CHECK (plan == plan2) ;
+    OK (GxB_Descriptor_fprint (desc, "desc with plan", GxB_COMPLETE, NULL)) ;
+
+    for (int trial = 0 ; trial < 5 ; trial++)
+    {
+        GrB_Semiring semiring = (trial == 2) ?
+            GrB_MIN_PLUS_SEMIRING_INT64 : GrB_PLUS_TIMES_SEMIRING_INT64 ;
+        OK (GxB_Desc_set (desc, GxB_MXM_PLAN, plan)) ;
+        OK (GrB_mxm (C1, M, NULL, semiring, A, A, desc)) ;
+        OK (GxB_Desc_set (desc, GxB_MXM_PLAN, NULL)) ;
+        OK (GrB_mxm (C2, M, NULL, semiring, A, A, desc)) ;
+        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        if (trial == 0 || trial == 1)
+        {
+            // change the values of A but not its pattern
+            OK (GrB_Matrix_apply_BinaryOp2nd_INT64 (A, NULL, NULL,
+                GrB_PLUS_INT64, A, 1, NULL)) ;
+        }
+        else if (trial == 3)
+        {
+            // change the pattern of A
+            OK (GrB_Matrix_setElement_INT64 (A, 42, 3, 11)) ;
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        }
+    }
+
+    // the plan is built for trials 0 and 4, and reused for trials 1 to 3
+    OK (GxB_MxM_Plan_stats (&nbuild, &nreuse, plan)) ;
+    printf ("plan: nbuild %g nreuse %g\n", (double) nbuild, (double) nreuse) ;
+    CHECK (nbuild == 2 && nreuse == 3) ;
+
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, chunk_save)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+    OK (GrB_free (&plan)) ;
+    CHECK (plan == NULL) ;
+    OK (GxB_MxM_Plan_free (&plan)) ;
+    OK (GxB_MxM_Plan_free (NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_mxm_plan: all tests passed\n\n") ;
+}
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// GB_mex_outer: outer-product method for C=A*B'
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B' is computed with the outer-product method (GxB_AxB_OUTER) and
+// compared with saxpy.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_outer"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // outer-product method for C=A*B'
+    //--------------------------------------------------------------------------
+
+    // A is 100-by-10 and A2 is 80-by-10, both held by column
+    OK (GrB_Matrix_new (&A, GrB_INT64, 100, 10)) ;
+    OK (GrB_Matrix_new (&A2, GrB_INT64, 80, 10)) ;
+    for (k = 0 ; k < 300 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k % 7 - 3, (k * 37) % 100,
+            (k * 13) % 10)) ;
+        OK (GrB_Matrix_setElement_INT64 (A2, k % 5 - 2, (k * 41) % 80,
+            (k * 7) % 10)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GrB_INP1, GrB_TRAN)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_OUTER)) ;
+    OK (GxB_Descriptor_fprint (desc, "desc with outer", 3, NULL)) ;
+    GrB_Desc_Value method ;
+    OK (GxB_Desc_get (desc, GxB_AxB_METHOD, &method)) ;
+    CHECK (method == GxB_AxB_OUTER) ;
+
+    // C1 = A*A2' via outer products, and C2 = A*A2' via saxpy
+    OK (GrB_Matrix_new (&C1, GrB_INT64, 100, 80)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, 100, 80)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, A2, desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, A2, desc)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // again with A2 hypersparse, a mask, and an accumulator
+    OK (GxB_Matrix_Option_set (A2, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_OUTER)) ;
+    OK (GrB_mxm (C1, C1, GrB_PLUS_INT64, GrB_MIN_PLUS_SEMIRING_INT64, A, A2,
+        desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+    OK (GrB_mxm (C2, C2, GrB_PLUS_INT64, GrB_MIN_PLUS_SEMIRING_INT64, A, A2,
+        desc)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_outer: all tests passed\n\n") ;
+}
@@ -0,0 +1,224 @@
+//------------------------------------------------------------------------------
+// GB_mex_push_pull: test push/pull selection for GrB_mxv and GrB_vxm
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_push_pull"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL ;
+    GrB_Index nvals ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    int expected = GrB_SUCCESS ;
+
+    //--------------------------------------------------------------------------
+    // push/pull for GrB_mxv and GrB_vxm
+    //--------------------------------------------------------------------------
+
+    // A is in push/pull mode and A2 is a copy of A that is not.  One step of
+    // a breadth-first search is computed with a sparse frontier u (push) and
+    // then with a dense frontier and few unvisited nodes (pull, which needs
+    // the transpose of A).  The results must match those computed with A2.
+    // The cached transpose is freed when A is modified.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 1000, 1000)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int j = 0 ; j < 1000 ; j++)
+    {
+        for (int p = 0 ; p < 8 ; p++)
+        {
+            int i = (j * 13 + p * 127) % 1000 ;
+            OK (GrB_Matrix_setElement_FP64 (A, (i+j) % 7 + 1, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&A2, A)) ;
+    bool push_pull = true ;
+    OK (GxB_Matrix_Option_get (A, GxB_PUSH_PULL, &push_pull)) ;
+    CHECK (!push_pull) ;
+    OK (GxB_Matrix_Option_set (A, GxB_PUSH_PULL, true)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_PUSH_PULL, &push_pull)) ;
+    CHECK (push_pull) ;
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_Option_get (A, GxB_PUSH_PULL, NULL)) ;
+
+    // u1: sparse frontier, u2: dense frontier, M1 and M2: visited nodes
+    GrB_Vector u1 = NULL, u2 = NULL, M1 = NULL, M2 = NULL, w1 = NULL,
+        w2 = NULL ;
+    OK (GrB_Vector_new (&u1, GrB_FP64, 1000)) ;
+    OK (GrB_Vector_new (&u2, GrB_FP64, 1000)) ;
+    OK (GrB_Vector_new (&M1, GrB_BOOL, 1000)) ;
+    OK (GrB_Vector_new (&M2, GrB_BOOL, 1000)) ;
+    OK (GrB_Vector_new (&w1, GrB_FP64, 1000)) ;
+    OK (GrB_Vector_new (&w2, GrB_FP64, 1000)) ;
+    OK (GrB_Vector_setElement_FP64 (u1, 1, 3)) ;
+    OK (GrB_Vector_setElement_FP64 (u1, 2, 500)) ;
+    for (int i = 0 ; i < 1000 ; i++)
+    {
+        if (i % 10 != 0) OK (GrB_Vector_setElement_FP64 (u2, i % 3 + 1, i)) ;
+        if (i < 10) OK (GrB_Vector_setElement_BOOL (M1, true, i)) ;
+        if (i % 100 != 7) OK (GrB_Vector_setElement_BOOL (M2, true, i)) ;
+    }
+    OK (GrB_Vector_wait (u1, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_wait (u2, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_wait (M1, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_wait (M2, GrB_MATERIALIZE)) ;
+
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        GrB_Semiring semiring = (k == 0) ? GrB_PLUS_TIMES_SEMIRING_FP64 :
+            GrB_LOR_LAND_SEMIRING_BOOL ;
+
+        // push: w<!M1,struct> = A*u1 and w<!M1,struct> = u1'*A
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            if (trial == 0)
+            {
+                OK (GrB_mxv (w1, M1, NULL, semiring, A, u1, GrB_DESC_RSC)) ;
+                OK (GrB_mxv (w2, M1, NULL, semiring, A2, u1, GrB_DESC_RSC)) ;
+            }
+            else
+            {
+                OK (GrB_vxm (w1, M1, NULL, semiring, u1, A, GrB_DESC_RSC)) ;
+                OK (GrB_vxm (w2, M1, NULL, semiring, u1, A2, GrB_DESC_RSC)) ;
+            }
+            OK (GrB_Vector_nvals (&nvals, w1)) ;
+            CHECK (nvals > 0) ;
+            OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+            OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        }
+
+        // pull: w<!M2,struct> = A*u2 and w<!M2,struct> = u2'*A
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            if (trial == 0)
+            {
+                OK (GrB_mxv (w1, M2, NULL, semiring, A, u2, GrB_DESC_RSC)) ;
+                OK (GrB_mxv (w2, M2, NULL, semiring, A2, u2, GrB_DESC_RSC)) ;
+                // A is held by column, so A*u via dot products needs A'
+                CHECK (A->AT != NULL) ;
+            }
+            else
+            {
+                OK (GrB_vxm (w1, M2, NULL, semiring, u2, A, GrB_DESC_RSC)) ;
+                OK (GrB_vxm (w2, M2, NULL, semiring, u2, A2, GrB_DESC_RSC)) ;
+            }
+            OK (GrB_Vector_nvals (&nvals, w1)) ;
+            CHECK (nvals > 0) ;
+            OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+            OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        }
+
+        // modifying A frees its cached transpose
+        CHECK (A->AT != NULL) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 4, 7, 3 + k)) ;
+        OK (GrB_Matrix_setElement_FP64 (A2, 4, 7, 3 + k)) ;
+        CHECK (A->AT == NULL) ;
+    }
+
+    // A is modified in-place by each method below, without changing its
+    // pattern or its number of entries.  Each one gives A a new stamp, so the
+    // transpose of A cached by the prior GrB_mxv is not used again.
+    for (int method = 0 ; method < 3 ; method++)
+    {
+        OK (GrB_mxv (w1, M2, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u2,
+            GrB_DESC_RSC)) ;
+        CHECK (A->AT != NULL && A->AT_stamp == A->stamp) ;
+        int64_t stamp = A->stamp ;
+        if (method == 0)
+        {
+            // A = -A, in-place
+            OK (GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+            OK (GrB_Matrix_apply (A2, NULL, NULL, GrB_AINV_FP64, A2, NULL)) ;
+        }
+        else if (method == 1)
+        {
+            // sort each column of A in-place
+            OK (GxB_Matrix_sort (A, NULL, GrB_LT_FP64, A, NULL)) ;
+            OK (GxB_Matrix_sort (A2, NULL, GrB_LT_FP64, A2, NULL)) ;
+        }
+        else
+        {
+            // A = 2*A, with the values of A unpacked and packed back
+            GrB_Index *Ap = NULL, *Ai = NULL, Ap_size, Ai_size, Ax_size ;
+            double *Ax = NULL ;
+            bool iso, jumbled ;
+            OK (GxB_Matrix_unpack_CSC (A, &Ap, &Ai, (void **) &Ax, &Ap_size,
+                &Ai_size, &Ax_size, &iso, &jumbled, NULL)) ;
+            CHECK (!iso) ;
+            for (int64_t p = 0 ; p < Ax_size / sizeof (double) ; p++)
+            {
+                Ax [p] = 2 * Ax [p] ;
+            }
+            OK (GxB_Matrix_pack_CSC (A, &Ap, &Ai, (void **) &Ax, Ap_size,
+                Ai_size, Ax_size, iso, jumbled, NULL)) ;
+            OK (GrB_Matrix_apply_BinaryOp1st_FP64 (A2, NULL, NULL,
+                GrB_TIMES_FP64, 2, A2, NULL)) ;
+        }
+        CHECK (A->stamp != stamp) ;
+        CHECK (A->AT == NULL || A->AT_stamp != A->stamp) ;
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            GrB_Vector u = (trial == 0) ? u1 : u2 ;
+            GrB_Vector M = (trial == 0) ? M1 : M2 ;
+            OK (GrB_mxv (w1, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u,
+                GrB_DESC_RSC)) ;
+            OK (GrB_mxv (w2, M, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A2, u,
+                GrB_DESC_RSC)) ;
+            OK (GrB_Vector_wait (w1, GrB_MATERIALIZE)) ;
+            OK (GrB_Vector_wait (w2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        }
+    }
+
+    // the cached transpose is freed when push/pull is disabled
+    OK (GrB_mxv (w1, M2, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u2,
+        GrB_DESC_RSC)) ;
+    CHECK (A->AT != NULL) ;
+    OK (GxB_Matrix_Option_set (A, GxB_PUSH_PULL, false)) ;
+    CHECK (A->AT == NULL) ;
+    OK (GxB_Matrix_Option_get (A, GxB_PUSH_PULL, &push_pull)) ;
+    CHECK (!push_pull) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Vector_free (&u1)) ;
+    OK (GrB_Vector_free (&u2)) ;
+    OK (GrB_Vector_free (&M1)) ;
+    OK (GrB_Vector_free (&M2)) ;
+    OK (GrB_Vector_free (&w1)) ;
+    OK (GrB_Vector_free (&w2)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_push_pull: all tests passed\n\n") ;
+}
@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+// GB_mex_saxpy3_cache: test the reuse of cached saxpy3 tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The tasks for C<#M>=A*B are cached in B->saxpy3_cache, and reused only if
+// none of A, B, and M has been modified since.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_AxB_saxpy3.h"
+
+#define USAGE "GB_mex_saxpy3_cache"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// # of entries in the list of cached saxpy3 tasks of B
+static int64_t ncached (GrB_Matrix B)
+{
+    return ((B->saxpy3_cache == NULL) ? 0 : B->saxpy3_cache->count) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // reuse of cached saxpy3 tasks
+    //--------------------------------------------------------------------------
+
+    // C1<#M>=A*B is computed several times with saxpy3, and C2<#M>=A*B is
+    // computed each time with the dot2 method instead.  The matrices are held
+    // by column, so B is the matrix B in saxpy3, where the tasks are cached.
+    // In trial 0, the tasks are created for C=A*B, C<M>=A*B, and C<!M>=A*B.
+    // Trial 1 reuses all three.  Trial 2 modifies the values of A in-place,
+    // so the tasks are not reused, and one more entry is cached; the list of
+    // B is then full.  Trial 3 modifies M, so the tasks for the two masked
+    // products are not reused, and no more entries are cached.  Trial 4
+    // modifies the pattern of B, which frees its cached tasks, and trial 5
+    // computes C=A*A, with its tasks cached in A.
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_CHUNK, &chunk_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, 4)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, (double) 1)) ;
+    OK (GrB_Matrix_new (&A, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, 200, 200)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    for (k = 0 ; k < 200 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k % 7 + 1, k, 7)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 3 + 1, (k * 13) % 200, k)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 5 + 1, (k * 31) % 200, k)) ;
+        OK (GrB_Matrix_setElement_INT64 (B, k % 4 + 1, (k * 17) % 200, k)) ;
+        OK (GrB_Matrix_setElement_INT64 (B, k % 6 + 1, (k * 37) % 200, k)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true, (k * 11) % 200, k)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true, (k * 23) % 200, k)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&C1, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&C2, GrB_INT64, 200, 200)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    for (int trial = 0 ; trial <= 5 ; trial++)
+    {
+        if (trial == 2)
+        {
+            // change the values of A but not its pattern
+            OK (GrB_Matrix_apply_BinaryOp2nd_INT64 (A, NULL, NULL,
+                GrB_PLUS_INT64, A, 1, NULL)) ;
+        }
+        else if (trial == 3)
+        {
+            // delete an entry of M in-place
+            OK (GrB_Matrix_removeElement (M, 11, 1)) ;
+            OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+        }
+        else if (trial == 4)
+        {
+            // add an entry to B, which frees its cached tasks
+            CHECK (ncached (B) == 4) ;
+            OK (GrB_Matrix_setElement_INT64 (B, 42, 3, 7)) ;
+            OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+            CHECK (ncached (B) == 0) ;
+        }
+
+        GrB_Matrix Y = (trial == 5) ? A : B ;
+        for (int kind = 0 ; kind <= 2 ; kind++)
+        {
+            // kind 0: C=A*Y, kind 1: C<M>=A*Y, kind 2: C<!M>=A*Y
+            GrB_Matrix Mask = (kind == 0) ? NULL : M ;
+            OK (GrB_Descriptor_set (desc, GrB_MASK,
+                (kind == 2) ? GrB_COMP : GxB_DEFAULT)) ;
+            OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_SAXPY)) ;
+            OK (GrB_mxm (C1, Mask, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, Y,
+                desc)) ;
+            OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+            OK (GrB_mxm (C2, Mask, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, Y,
+                desc)) ;
+            OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+            CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        }
+
+        // check the # of cached entries
+        int64_t n = ncached (Y) ;
+        switch (trial)
+        {
+            case 0 : CHECK (n == 3) ; break ;   // C=A*B, C<M>=A*B, C<!M>=A*B
+            case 1 : CHECK (n == 3) ; break ;   // all three reused
+            case 2 : CHECK (n == 4) ; break ;   // one more cached; now full
+            case 3 : CHECK (n == 4) ; break ;   // none reused, none cached
+            case 4 : CHECK (n == 3) ; break ;   // new tasks for the new B
+            case 5 : CHECK (n == 3) ; break ;   // tasks for C=A*A cached in A
+            default: break ;
+        }
+    }
+
+    // freeing B frees its cached tasks, as checked by GB_mx_put_global
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, chunk_save)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_saxpy3_cache: all tests passed\n\n") ;
+}
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GB_mex_saxpy45: test C=A*X and C=X*A with A sparse and X full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When A is sparse and X is full, C=A*X is computed by saxpy4 and C=X*A by
+// saxpy5, and must give the same result as dot2.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_saxpy45"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index nvals ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C=A*X and C=X*A with A sparse and X full
+    //--------------------------------------------------------------------------
+
+    // A is sparse with some empty rows and columns, and X is full.  C1=A*X is
+    // computed by saxpy4 and C1=X'*A by saxpy5, with C1 full and then
+    // converted to bitmap since some rows of A*X (and columns of X'*A) are
+    // empty.  C2 is computed with dot2 instead.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 100, 8)) ;
+    OK (GrB_Matrix_new (&M, GrB_FP64, 8, 100)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int i = 0 ; i < 100 ; i++)
+    {
+        for (int j = 0 ; j < 100 ; j++)
+        {
+            if ((i + 2*j) % 5 == 0 && i % 10 != 3 && j % 10 != 7)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, (i*j) % 7 + 1, i, j)) ;
+            }
+        }
+        for (int j = 0 ; j < 8 ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (B, (i+j) % 5 - 2, i, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (M, (i+j) % 3 + 1, j, i)) ;
+        }
+    }
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    CHECK (GB_IS_FULL (B)) ;
+    CHECK (GB_IS_FULL (M)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+
+    for (int k = 0 ; k < 2 ; k++)
+    {
+        GrB_Semiring semiring = (k == 0) ? GrB_PLUS_TIMES_SEMIRING_FP64 :
+            GrB_MIN_PLUS_SEMIRING_FP64 ;
+
+        // C1 = A*X with saxpy4, and C2 = A*X with dot2
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 100, 8)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 100, 8)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GrB_mxm (C1, NULL, NULL, semiring, A, B, NULL)) ;
+        OK (GrB_mxm (C2, NULL, NULL, semiring, A, B, desc)) ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals == 90 * 8) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+
+        // C1 = X'*A with saxpy5, and C2 = X'*A with dot2
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 8, 100)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 8, 100)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GrB_mxm (C1, NULL, NULL, semiring, M, A, NULL)) ;
+        OK (GrB_mxm (C2, NULL, NULL, semiring, M, A, desc)) ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals == 8 * 90) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+    }
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&M)) ;
+
+    //--------------------------------------------------------------------------
+    // C=X*A with X full and too large for the cache: saxpy5 with k-blocks
+    //--------------------------------------------------------------------------
+
+    // X is 64-by-2000 and full (1 MB), and A is sparse with 20 entries in
+    // each column, so saxpy5 splits the columns of X into k-blocks.  C1 is
+    // compared with C2, which is computed with dot2.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 2000, 300)) ;
+    OK (GrB_Matrix_new (&M, GrB_FP64, 64, 2000)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int j = 0 ; j < 300 ; j++)
+    {
+        for (int p = 0 ; p < 20 ; p++)
+        {
+            int i = (j * 37 + p * 101) % 2000 ;
+            OK (GrB_Matrix_setElement_FP64 (A, (i+p) % 9 + 1, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_assign_FP64 (M, NULL, NULL, 1, GrB_ALL, 64, GrB_ALL, 2000,
+        NULL)) ;
+    OK (GrB_Matrix_apply_IndexOp_INT64 (M, NULL, NULL, GrB_ROWINDEX_INT64, M,
+        1, NULL)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    CHECK (GB_IS_FULL (M)) ;
+    CHECK (GB_AxB_saxpy5_kblock (M, A) < 2000) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 64, 300)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 64, 300)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, M, A, NULL)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, M, A, desc)) ;
+    CHECK (GB_IS_FULL (C1)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_saxpy45: all tests passed\n\n") ;
+}
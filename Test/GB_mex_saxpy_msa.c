@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_mex_saxpy_msa: test C<M>=A*B with a very sparse mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A*B is computed by the mask-driven saxpy method when M is very sparse,
+// and must give the same result as saxpy3.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_saxpy_msa"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    GrB_Index nvals ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=A*B with a very sparse mask
+    //--------------------------------------------------------------------------
+
+    // A has long columns and rows, B has a few entries in each column, and M
+    // has two entries in each column, so the default method uses the
+    // mask-driven saxpy (GB_AxB_saxpy_msa) when the matrices are held by
+    // column.  The result is compared with saxpy3, for several semirings
+    // (iso, positional, and with typecasting), valued and structural masks,
+    // sparse and hypersparse matrices, both formats, and 1 or 4 threads.
+
+    #define N 300
+    OK (GrB_Matrix_new (&A, GrB_INT64, N, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_INT64, N, N)) ;
+    OK (GrB_Matrix_new (&M, GrB_INT8, N, N)) ;
+    for (k = 0 ; k < N ; k++)
+    {
+        if (k == 7 || k == 200)
+        {
+            OK (GrB_Matrix_setElement_INT64 (A, 3, 150, k)) ;
+        }
+        else
+        {
+            for (int i = k % 2 ; i < N ; i += 2)
+            {
+                OK (GrB_Matrix_setElement_INT64 (A, (i+k) % 5 + 1, i, k)) ;
+            }
+        }
+        for (int i = 0 ; i < 12 ; i++)
+        {
+            OK (GrB_Matrix_setElement_INT64 (B, i+1, (k + 83*i) % N, k)) ;
+        }
+        // some entries of M are zero, and are false if M is valued
+        OK (GrB_Matrix_setElement_INT8 (M, k % 4, (k * 7) % N, k)) ;
+        OK (GrB_Matrix_setElement_INT8 (M, 1, (k * 13 + 1) % N, k)) ;
+    }
+    // The columns of A are much denser than those of M, except for A(:,7)
+    // and A(:,200), which have a single entry.  B(:,6) is dense, and M(:,6)
+    // has 31 entries, so the galloping search is used in both directions.
+    for (int i = 0 ; i < N ; i++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (B, 2, i, 6)) ;
+    }
+    for (int i = 0 ; i < N ; i += 10)
+    {
+        OK (GrB_Matrix_setElement_INT8 (M, 1, i, 6)) ;
+    }
+    OK (GrB_Matrix_setElement_INT8 (M, 1, 150, 6)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    GrB_Semiring semirings [7] =
+    {
+        GrB_PLUS_TIMES_SEMIRING_INT64,      // built-in, non-iso
+        GxB_ANY_PAIR_INT64,                 // C is iso
+        GxB_MIN_FIRSTI_INT64,               // positional, int64
+        GxB_PLUS_SECONDJ_INT32,             // positional, int32
+        GxB_MAX_FIRST_FP64,                 // A typecast to double
+        GxB_PLUS_SECOND_INT64,              // A is not accessed
+        GrB_PLUS_TIMES_SEMIRING_FP32        // A and B typecast to float
+    } ;
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_CHUNK, &chunk_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, (double) 1)) ;
+
+    for (int fmt = 0 ; fmt <= 1 ; fmt++)
+    {
+        GxB_Format_Value format = (fmt == 0) ? GxB_BY_COL : GxB_BY_ROW ;
+        OK (GxB_Matrix_Option_set (A, GxB_FORMAT, format)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_FORMAT, format)) ;
+        OK (GxB_Matrix_Option_set (M, GxB_FORMAT, format)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, format)) ;
+        OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, format)) ;
+        for (int hyper = 0 ; hyper <= 3 ; hyper++)
+        {
+            // A is hypersparse if hyper is odd; B and M if hyper >= 2
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+                (hyper % 2) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL,
+                (hyper >= 2) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL,
+                (hyper >= 2) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            if (fmt == 0)
+            {
+                // M is very sparse compared with the flop count of A*B
+                CHECK (GB_AxB_saxpy_msa_control (M, false, A, B, NULL)) ;
+                CHECK (!GB_AxB_saxpy_msa_control (M, true, A, B, NULL)) ;
+                CHECK (!GB_AxB_saxpy_msa_control (A, false, A, B, NULL)) ;
+            }
+            for (int s = 0 ; s < 7 ; s++)
+            {
+                for (int mask_struct = 0 ; mask_struct <= 1 ; mask_struct++)
+                {
+                    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                    {
+                        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS,
+                            nthreads)) ;
+                        OK (GrB_Descriptor_set (desc, GrB_MASK, mask_struct ?
+                            GrB_STRUCTURE : GxB_DEFAULT)) ;
+                        OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD,
+                            GxB_DEFAULT)) ;
+                        OK (GrB_mxm (C1, M, NULL, semirings [s], A, B, desc)) ;
+                        OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD,
+                            GxB_AxB_SAXPY)) ;
+                        OK (GrB_mxm (C2, M, NULL, semirings [s], A, B, desc)) ;
+                        OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                        OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+                    }
+                }
+            }
+        }
+    }
+
+    // an empty mask gives an empty result
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GrB_Matrix_clear (M)) ;
+    OK (GrB_Matrix_clear (C1)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    CHECK (GB_AxB_saxpy_msa_control (M, false, A, B, NULL)) ;
+    OK (GrB_mxm (C1, M, NULL, GrB_PLUS_TIMES_SEMIRING_INT64, A, B, NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals, C1)) ;
+    CHECK (nvals == 0) ;
+
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, chunk_save)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_saxpy_msa: all tests passed\n\n") ;
+}
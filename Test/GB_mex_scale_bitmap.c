@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// GB_mex_scale_bitmap: test C=A*D and C=D*A with A bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When A is bitmap and D is diagonal, C=A*D and C=D*A are computed with
+// colscale and rowscale, and A=A*D and A=D*A are computed in-place.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_scale_bitmap"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // C=A*D and C=D*A with A bitmap, and in-place
+    //--------------------------------------------------------------------------
+
+    // A is bitmap and D is diagonal.  C1=A*D and C1=D*A are computed with
+    // colscale and rowscale.  C2 is computed with D held as bitmap, which is
+    // never treated as diagonal, so saxpy is used instead.  Then A=A*D and
+    // A=D*A are computed in-place, so A->b is not reallocated.
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&M, GrB_FP64, 100, 100)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    for (int i = 0 ; i < 100 ; i++)
+    {
+        for (int j = 0 ; j < 100 ; j++)
+        {
+            if ((i + 3*j) % 4 == 0)
+            {
+                OK (GrB_Matrix_setElement_FP64 (A, (i*j) % 7 + 1, i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_setElement_FP64 (B, i % 5 + 2, i, i)) ;
+        OK (GrB_Matrix_setElement_FP64 (M, i % 5 + 2, i, i)) ;
+    }
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    CHECK (GB_is_diagonal (B, NULL)) ;
+    CHECK (!GB_is_diagonal (M, NULL)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 100, 100)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 100, 100)) ;
+    OK (GxB_Matrix_Option_set (C1, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (C2, GxB_FORMAT, GxB_BY_COL)) ;
+
+    // C1 = A*D and C1 = D*A, with A bitmap
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, M, NULL)) ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, B, A, NULL)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, M, A, NULL)) ;
+    CHECK (GB_IS_BITMAP (C1)) ;
+    CHECK (GB_mx_isequal (C1, C2, 0)) ;
+
+    // A = A*D in-place, then A = D*A in-place
+    int8_t *Ab_save = A->b ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, M, NULL)) ;
+    OK (GrB_mxm (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    CHECK (A->b == Ab_save) ;
+    CHECK (GB_mx_isequal (A, C2, 0)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, M, A, NULL)) ;
+    OK (GrB_mxm (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, B, A, NULL)) ;
+    CHECK (A->b == Ab_save) ;
+    CHECK (GB_mx_isequal (A, C2, 0)) ;
+
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&B)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Matrix_free (&C1)) ;
+    OK (GrB_Matrix_free (&C2)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_scale_bitmap: all tests passed\n\n") ;
+}
@@ -13,6 +13,12 @@
 // GxB_Vector_serialize and GxB_Vector_deserialize
 // GrB_Vector_serialize and GrB_Vector_deserialize
 
+// For the GxB_Matrix methods, the matrix is also copied with
+// GxB_Matrix_serialize_stream and GxB_Matrix_deserialize_stream, using a
+// stream held in memory, and the result is compared with C.  It is also
+// written to a temporary file with GxB_Matrix_serialize_mmap, and mapped back
+// with GxB_Matrix_mmap.
+
 #include "GB_mex.h"
 #include "GB_mex_errors.h"
 
@@ -25,18 +31,91 @@
 // GxB_COMPRESSION_LZ4HC 2001  // LZ4HC:1
 // ...
 // GxB_COMPRESSION_LZ4HC 2009  // LZ4HC:9
+// GxB_COMPRESSION_ZSTD  6000  // ZSTD, with default level 1
+// GxB_COMPRESSION_ZSTD  6001  // ZSTD:1
+// ...
+// GxB_COMPRESSION_ZSTD  6019  // ZSTD:19
+// GxB_COMPRESSION_SHUFFLE + any of the above: shuffle the bytes first
+// GxB_COMPRESSION_DELTA + any of the above: delta-encode Ap, Ah, and Ai
 
 #define USAGE "C = GB_mex_serialize (A, method)"
 
 #define FREE_ALL                        \
 {                                       \
     mxFree (blob) ;                     \
+    mxFree (stream.buffer) ;            \
     GrB_Matrix_free_(&A) ;              \
     GrB_Matrix_free_(&C) ;              \
+    GrB_Matrix_free_(&C2) ;             \
+    GrB_Matrix_free_(&C3) ;             \
     GrB_Descriptor_free_(&desc) ;       \
     GB_mx_put_global (true) ;           \
 }
 
+//------------------------------------------------------------------------------
+// a stream held in memory
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GB_void *buffer ;       // content of the stream
+    size_t size ;           // # of bytes written to the stream
+    size_t allocated ;      // allocated size of the buffer
+    size_t position ;       // position of the next read
+}
+mem_stream ;
+
+static bool mem_write (void *stream, const void *buffer, size_t size)
+{
+    mem_stream *m = (mem_stream *) stream ;
+    if (m->size + size > m->allocated)
+    {
+        m->allocated = 2 * (m->size + size) ;
+        m->buffer = mxRealloc (m->buffer, m->allocated) ;
+    }
+    memcpy (m->buffer + m->size, buffer, size) ;
+    m->size += size ;
+    return (true) ;
+}
+
+static bool mem_read (void *stream, void *buffer, size_t size)
+{
+    mem_stream *m = (mem_stream *) stream ;
+    if (m->position + size > m->size) return (false) ;
+    memcpy (buffer, m->buffer + m->position, size) ;
+    m->position += size ;
+    return (true) ;
+}
+
+// copy A into C2 via the stream, restarting the stream on each try
+static GrB_Info stream_copy (GrB_Matrix *C2, GrB_Type atype,
+    mem_stream *stream, GrB_Matrix A, GrB_Descriptor desc)
+{
+    stream->size = 0 ;
+    stream->position = 0 ;
+    GrB_Info info = GxB_Matrix_serialize_stream (mem_write, stream, A, desc) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    return (GxB_Matrix_deserialize_stream (C2, atype, mem_read, stream,
+        desc)) ;
+}
+
+// copy A into C3 via a temporary file mapped into memory
+static GrB_Info mmap_copy (GrB_Matrix *C3, GrB_Type atype, GrB_Matrix A,
+    GrB_Descriptor desc)
+{
+    FILE *f = tmpfile ( ) ;
+    if (f == NULL) return (GrB_INVALID_VALUE) ;
+    GrB_Info info = GxB_Matrix_serialize_mmap (fileno (f), A, desc) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Matrix_mmap (C3, atype, fileno (f), desc) ;
+    }
+    fclose (f) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+
 void mexFunction
 (
     int nargout,
@@ -47,8 +126,9 @@ void mexFunction
 {
 
     bool malloc_debug = GB_mx_get_global (true) ;
-    GrB_Matrix A = NULL, C = NULL ;
+    GrB_Matrix A = NULL, C = NULL, C2 = NULL, C3 = NULL ;
     GrB_Descriptor desc = NULL ;
+    mem_stream stream = { NULL, 0, 0, 0 } ;
     void *blob = NULL ;
     GrB_Index blob_size = 0 ;
 
@@ -122,6 +202,13 @@ void mexFunction
             // test the matrix methods
             METHOD (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
             METHOD (GxB_Matrix_deserialize (&C, atype, blob, blob_size, desc)) ;
+            // test the stream methods
+            METHOD (stream_copy (&C2, atype, &stream, A, desc)) ;
+            CHECK (stream.position == stream.size) ;
+            CHECK (GB_mx_isequal (C, C2, 0)) ;
+            // test the mmap methods
+            METHOD (mmap_copy (&C3, atype, A, desc)) ;
+            CHECK (GB_mx_isequal (C, C3, 0)) ;
         }
     }
 
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// GB_mex_ultra: test ultra-fine tasks for costly dot products and saxpys
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each costly dot product or saxpy is split into ultra-fine tasks, and the
+// result is compared with the same computation done by a single thread.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_ultra"
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A2 = NULL, C1 = NULL, C2 = NULL, M = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int k ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+
+    //--------------------------------------------------------------------------
+    // ultra-fine tasks for costly dot products and saxpys
+    //--------------------------------------------------------------------------
+
+    // A is 200-by-200 with a dense column A(:,7) and a dense row A(7,:), and
+    // M(7,7) is present, so C(7,7)=A(:,7)'*A(:,7) is costly in C<M>=A'*A.  A2
+    // is 200-by-1 with A2(7,0) present, so A(:,7)*A2(7,0) is costly in C=A*A2.
+    // Each is computed with one thread, and then again with many threads and a
+    // tiny chunk, which splits the costly work into ultra-fine tasks.  The
+    // dot3 method is also tested with a semiring that requires typecasting,
+    // which uses the generic kernel, and with M(7,7) false, so the team of
+    // ultra-fine tasks for C(7,7) leaves it as a zombie.
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_CHUNK, &chunk_save)) ;
+    OK (GrB_Matrix_new (&A, GrB_INT64, 200, 200)) ;
+    OK (GrB_Matrix_new (&A2, GrB_INT64, 200, 1)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, 200, 200)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (A2, GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_FORMAT, GxB_BY_COL)) ;
+    for (k = 0 ; k < 200 ; k++)
+    {
+        OK (GrB_Matrix_setElement_INT64 (A, k % 7 + 1, k, 7)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 5 + 1, 7, k)) ;
+        OK (GrB_Matrix_setElement_INT64 (A, k % 3 - 1, (k * 13) % 200, k)) ;
+        OK (GrB_Matrix_setElement_BOOL (M, true, (k * 11) % 200, k)) ;
+    }
+    OK (GrB_Matrix_setElement_BOOL (M, true, 7, 7)) ;
+    OK (GrB_Matrix_setElement_INT64 (A2, 3, 7, 0)) ;
+    OK (GrB_Matrix_setElement_INT64 (A2, 2, 100, 0)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (A2, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    for (int trial = 0 ; trial <= 3 ; trial++)
+    {
+        // trial 0: C<M>=A'*A via dot3
+        // trial 1: C=A*A2 via saxpy3
+        // trial 2: C<M>=A'*A via dot3, with the generic kernel
+        // trial 3: C<M>=A'*A via dot3, with M(7,7) false
+        bool dot = (trial != 1) ;
+        GrB_Matrix Mask = dot ? M : NULL ;
+        GrB_Matrix B = dot ? A : A2 ;
+        GrB_Index bncols = dot ? 200 : 1 ;
+        GrB_Semiring semiring = (trial == 2) ?
+            GrB_PLUS_TIMES_SEMIRING_FP64 : GrB_PLUS_TIMES_SEMIRING_INT64 ;
+        if (trial == 3)
+        {
+            OK (GrB_Matrix_setElement_BOOL (M, false, 7, 7)) ;
+            OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+        }
+        OK (GrB_Descriptor_set (desc, GrB_INP0,
+            dot ? GrB_TRAN : GxB_DEFAULT)) ;
+        OK (GrB_Descriptor_set (desc, GxB_AxB_METHOD,
+            dot ? GxB_AxB_DOT : GxB_AxB_SAXPY)) ;
+        OK (GrB_Matrix_new (&C1, GrB_INT64, 200, bncols)) ;
+        OK (GrB_Matrix_new (&C2, GrB_INT64, 200, bncols)) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, 1)) ;
+        OK (GrB_mxm (C1, Mask, NULL, semiring, A, B, desc)) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, 8)) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, (double) 1)) ;
+        OK (GrB_mxm (C2, Mask, NULL, semiring, A, B, desc)) ;
+        OK (GxB_Global_Option_set (GxB_GLOBAL_CHUNK, chunk_save)) ;
+        CHECK (GB_mx_isequal (C1, C2, 0)) ;
+        if (trial == 3)
+        {
+            int64_t cij = 0 ;
+            info = GrB_Matrix_extractElement_INT64 (&cij, C2, 7, 7) ;
+            CHECK (info == GrB_NO_VALUE) ;
+        }
+        OK (GrB_Matrix_free (&C1)) ;
+        OK (GrB_Matrix_free (&C2)) ;
+    }
+
+    OK (GxB_Global_Option_set (GxB_GLOBAL_NTHREADS, nthreads_save)) ;
+    OK (GrB_Matrix_free (&A)) ;
+    OK (GrB_Matrix_free (&A2)) ;
+    OK (GrB_Matrix_free (&M)) ;
+    OK (GrB_Descriptor_free (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_ultra: all tests passed\n\n") ;
+}
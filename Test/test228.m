@@ -21,7 +21,9 @@ for k1 = 1:length (types)
                 A.sparsity = A_sparsity ;
                 C = GB_mex_serialize (A, -2) ;      % GrB_serialize
                 GB_spec_compare (A, C) ;
-                for method = [-1 0 1000 2000:2009]
+                for method = [-1 0 1000 2000:2009 6000:6003 ...
+                    101000 102000 106000 ...
+                    201000 202000 206000 306000]
                     C = GB_mex_serialize (A, method) ;
                     GB_spec_compare (A, C) ;
                 end
@@ -35,6 +37,20 @@ nthreads_set (4, 1) ;
 d = 0.5 ;
 A = GB_spec_random (1000, 1000, d, 128, 'double') ;
 C = GB_mex_serialize (A, 0) ;
+% many blocks for the stream methods
+A = GB_spec_random (2000, 2000, d, 128, 'double') ;
+C = GB_mex_serialize (A, 0) ;
+GB_spec_compare (A, C) ;
+C = GB_mex_serialize (A, 2001) ;
+GB_spec_compare (A, C) ;
+C = GB_mex_serialize (A, 6000) ;
+GB_spec_compare (A, C) ;
+C = GB_mex_serialize (A, 106019) ;
+GB_spec_compare (A, C) ;
+C = GB_mex_serialize (A, 201000) ;
+GB_spec_compare (A, C) ;
+C = GB_mex_serialize (A, 306000) ;
+GB_spec_compare (A, C) ;
 nthreads_set (save_nthreads, save_chunk) ;
 
 fprintf ('\n') ;
@@ -0,0 +1,80 @@
+function test242
+%TEST242 performance test for setElement + wait
+
+% Many tuples are appended with GrB_setElement, in sorted, randomized, and
+% interleaved order, and then assembled into the matrix by GrB_wait.  The
+% pending tuples are sorted in parallel buckets of vectors by GB_Pending_sort.
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test242 ----------------------------------- setElement + wait\n') ;
+
+[save save_chunk] = nthreads_get ;
+rng ('default') ;
+
+ncores = feature_numcores ;
+ntuples = 1e6 ;
+
+for n = [1000 100000]
+
+    if (n > 1000)
+        m = 10 ;
+    else
+        m = n ;
+    end
+    S = sparse (m, n) ;
+
+    for trial = 1:3
+
+        % create the tuples, with duplicates
+        I = floor (m * rand (ntuples, 1)) ;
+        J = floor (n * rand (ntuples, 1)) ;
+        X = rand (ntuples, 1) ;
+        if (trial == 1)
+            % tuples in sorted order
+            [~, p] = sortrows ([J I]) ;
+            what = 'sorted' ;
+        elseif (trial == 2)
+            % tuples in randomized order
+            p = (1:ntuples)' ;
+            what = 'random' ;
+        else
+            % 8 interleaved streams, each in sorted order
+            [~, p] = sortrows ([J I]) ;
+            p = reshape (p, 8, ntuples/8)' ;
+            p = p (:) ;
+            what = 'interleaved' ;
+        end
+        I0 = uint64 (I (p)) ;
+        J0 = uint64 (J (p)) ;
+        X = X (p) ;
+
+        % built-in method: the last duplicate is kept
+        A1 = sparse (m, n) ;
+        [~, last] = unique ([J0 I0], 'rows', 'last') ;
+        A1 (sub2ind ([m n], double (I0 (last))+1, double (J0 (last))+1)) = ...
+            X (last) ;
+
+        fprintf ('\n%dx%d, %g tuples, %s:\n', m, n, ntuples, what) ;
+        t1 = 0 ;
+        for nthreads = [1 2 4 8 16 20 32 40 64]
+            if (nthreads > 2*ncores)
+                break ;
+            end
+            nthreads_set (nthreads) ;
+            tic
+            A2 = GB_mex_setElement (S, I0, J0, X) ;
+            t = toc ;
+            if (nthreads == 1)
+                t1 = t ;
+            end
+            fprintf ('nthreads %3d setElement+wait: %10.4f sec ', nthreads, t) ;
+            fprintf ('speedup %10.2f\n', t1 / t) ;
+            assert (isequal (A1, A2.matrix)) ;
+        end
+    end
+end
+
+nthreads_set (save, save_chunk) ;
+fprintf ('\ntest242: all tests passed\n') ;
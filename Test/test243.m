@@ -0,0 +1,11 @@
+function test243
+%TEST243 test GxB_Arena
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test243 ----------------------------------- GxB_Arena\n') ;
+
+GB_mex_arena ;
+
+fprintf ('\ntest243: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test244
+%TEST244 test concurrent setElement
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test244 ---------- test concurrent setElement\n') ;
+
+GB_mex_concurrent ;
+
+fprintf ('\ntest244: all tests passed\n') ;
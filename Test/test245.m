@@ -0,0 +1,11 @@
+function test245
+%TEST245 test GxB_setElements and GxB_extractElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test245 --- test GxB_setElements and GxB_extractElements\n') ;
+
+GB_mex_elements ;
+
+fprintf ('\ntest245: all tests passed\n') ;
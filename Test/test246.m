@@ -0,0 +1,11 @@
+function test246
+%TEST246 test the hash index of the hyperlist
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test246 --- test the hash index of the hyperlist\n') ;
+
+GB_mex_hyper_hash ;
+
+fprintf ('\ntest246: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test247
+%TEST247 test the outer-product method for C=A*B'
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test247 --- test the outer-product method for C=A*B''\n') ;
+
+GB_mex_outer ;
+
+fprintf ('\ntest247: all tests passed\n') ;
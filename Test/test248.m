@@ -0,0 +1,11 @@
+function test248
+%TEST248 test ultra-fine tasks for dot3 and saxpy3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test248 --- test ultra-fine tasks for dot3 and saxpy3\n') ;
+
+GB_mex_ultra ;
+
+fprintf ('\ntest248: all tests passed\n') ;
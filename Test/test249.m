@@ -0,0 +1,11 @@
+function test249
+%TEST249 test push/pull for GrB_mxv and GrB_vxm
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test249 --- test push/pull for GrB_mxv and GrB_vxm\n') ;
+
+GB_mex_push_pull ;
+
+fprintf ('\ntest249: all tests passed\n') ;
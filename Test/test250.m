@@ -0,0 +1,11 @@
+function test250
+%TEST250 test the reuse of cached saxpy3 tasks
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test250 --- test the reuse of cached saxpy3 tasks\n') ;
+
+GB_mex_saxpy3_cache ;
+
+fprintf ('\ntest250: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test251
+%TEST251 test GxB_MxM_Plan for saxpy3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test251 --- test GxB_MxM_Plan for saxpy3\n') ;
+
+GB_mex_mxm_plan ;
+
+fprintf ('\ntest251: all tests passed\n') ;
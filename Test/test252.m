@@ -0,0 +1,11 @@
+function test252
+%TEST252 test the GxB_CPU_AVX2 and GxB_CPU_AVX512F options
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test252 --- test the GxB_CPU_AVX2 and GxB_CPU_AVX512F options\n') ;
+
+GB_mex_avx ;
+
+fprintf ('\ntest252: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test253
+%TEST253 test C<M>=A*B with a very sparse mask
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test253 --- test C<M>=A*B with a very sparse mask\n') ;
+
+GB_mex_saxpy_msa ;
+
+fprintf ('\ntest253: all tests passed\n') ;
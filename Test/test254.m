@@ -0,0 +1,11 @@
+function test254
+%TEST254 test C+=A'*B and C<M>+=A*B in-place with C bitmap
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test254 --- test C+=A''*B and C<M>+=A*B in-place with C bitmap\n') ;
+
+GB_mex_mxm_inplace ;
+
+fprintf ('\ntest254: all tests passed\n') ;
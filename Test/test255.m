@@ -0,0 +1,11 @@
+function test255
+%TEST255 test C=A*D and C=D*A with A bitmap
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test255 --- test C=A*D and C=D*A with A bitmap\n') ;
+
+GB_mex_scale_bitmap ;
+
+fprintf ('\ntest255: all tests passed\n') ;
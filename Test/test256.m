@@ -0,0 +1,11 @@
+function test256
+%TEST256 test C=A*X and C=X*A with A sparse and X full
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test256 --- test C=A*X and C=X*A with A sparse and X full\n') ;
+
+GB_mex_saxpy45 ;
+
+fprintf ('\ntest256: all tests passed\n') ;
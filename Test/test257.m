@@ -0,0 +1,11 @@
+function test257
+%TEST257 test GrB_Matrix_build with packed (j,i) sort keys
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test257 --- test GrB_Matrix_build with packed (j,i) sort keys\n') ;
+
+GB_mex_builder_pack ;
+
+fprintf ('\ntest257: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test258
+%TEST258 test bitmap scans a word at a time in emult and convert
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test258 --- test bitmap scans a word at a time in emult and convert\n') ;
+
+GB_mex_bitmap_word ;
+
+fprintf ('\ntest258: all tests passed\n') ;
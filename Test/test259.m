@@ -0,0 +1,11 @@
+function test259
+%TEST259 test C=A(I,:) with a parallel I inverse
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test259 --- test C=A(I,:) with a parallel I inverse\n') ;
+
+GB_mex_extract_inverse ;
+
+fprintf ('\ntest259: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test260
+%TEST260 test C=kron(A,B) with entry-level tasks
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test260 --- test C=kron(A,B) with entry-level tasks\n') ;
+
+GB_mex_kron_tasks ;
+
+fprintf ('\ntest260: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test261
+%TEST261 test C<M>=A+B with a very sparse mask
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test261 --- test C<M>=A+B with a very sparse mask\n') ;
+
+GB_mex_add_sparse_mask ;
+
+fprintf ('\ntest261: all tests passed\n') ;
@@ -0,0 +1,11 @@
+function test262
+%TEST262 test the per-thread memory pool magazines
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2021, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+fprintf ('test262 --- test the per-thread memory pool magazines\n') ;
+
+GB_mex_mempool_threads ;
+
+fprintf ('\ntest262: all tests passed\n') ;
@@ -160,6 +160,26 @@ logstat ('test179',t) ; % test bitmap select
 
 logstat ('test165',t) ; % test C=A*B' where A is diagonal and B becomes bitmap
 logstat ('test01' ,t) ; % error handling
+logstat ('test243',t) ; % test GxB_Arena
+logstat ('test244',t) ; % test concurrent setElement
+logstat ('test245',t) ; % test GxB_setElements and GxB_extractElements
+logstat ('test246',t) ; % test the hash index of the hyperlist
+logstat ('test247',t) ; % test the outer-product method for C=A*B'
+logstat ('test248',t) ; % test ultra-fine tasks for dot3 and saxpy3
+logstat ('test249',t) ; % test push/pull for GrB_mxv and GrB_vxm
+logstat ('test250',t) ; % test the reuse of cached saxpy3 tasks
+logstat ('test251',t) ; % test GxB_MxM_Plan for saxpy3
+logstat ('test252',t) ; % test the GxB_CPU_AVX2 and GxB_CPU_AVX512F options
+logstat ('test253',t) ; % test C<M>=A*B with a very sparse mask
+logstat ('test254',t) ; % test C+=A'*B and C<M>+=A*B in-place with C bitmap
+logstat ('test255',t) ; % test C=A*D and C=D*A with A bitmap
+logstat ('test256',t) ; % test C=A*X and C=X*A with A sparse and X full
+logstat ('test257',t) ; % test GrB_Matrix_build with packed (j,i) sort keys
+logstat ('test258',t) ; % test bitmap scans a word at a time in emult and convert
+logstat ('test259',t) ; % test C=A(I,:) with a parallel I inverse
+logstat ('test260',t) ; % test C=kron(A,B) with entry-level tasks
+logstat ('test261',t) ; % test C<M>=A+B with a very sparse mask
+logstat ('test262',t) ; % test the per-thread memory pool magazines
 logstat ('test07b',t) ; % quick test GB_mex_assign
 logstat ('test83' ,t) ; % GrB_assign with C_replace and empty J
 
@@ -427,6 +447,7 @@ logstat ('test190',t) ;    %   .3 % test dense matrix for C<!M>=A*B
 
 logstat ('test205',t) ;    %    0 % test iso kron
 logstat ('test218',t) ;    %    0 % test C=A+B, C and A are full, B is bitmap
+logstat ('test242',t) ;    %      % performance test for setElement + wait
 
 % tested via test16:
 logstat ('testc1',t) ;     %      % test complex operators